@@ -0,0 +1,86 @@
+/**
+ * AudioBenchmarks.cpp - Audio Mixer Microbenchmarks
+ *
+ * Covers AudioSystem::mixBuffer (one 256-frame stereo buffer at 48 kHz,
+ * 5.3 ms of real-time budget) with range(0) looping positional voices, and
+ * a gunfire burst that keeps the voice pool full so every shot steals.
+ * Runs on the calling thread; no mixer thread or output device involved.
+ */
+
+#include "MicroBenchmark.h"
+#include "Engine/Audio/AudioSystem.h"
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+using namespace Engine;
+using Engine::Bench::State;
+using Engine::Bench::doNotOptimize;
+
+namespace {
+
+// Sources spread around the listener at 1-60 units
+Vec3 sourcePosition(int index) {
+    float angle = index * 2.39996f;
+    float distance = 1.0f + static_cast<float>(index % 60);
+    return Vec3(std::cos(angle) * distance, 0.0f, std::sin(angle) * distance);
+}
+
+} // namespace
+
+// One buffer with voiceCount = range(0) looping voices, the listener turning
+static void BM_AudioMixBuffer(State& state) {
+    const int voiceCount = static_cast<int>(state.range(0));
+    AudioConfig config;
+    config.maxVoices = voiceCount;
+    config.commandCapacity = static_cast<size_t>(voiceCount) * 2;
+    AudioSystem audio(config);
+    SoundId loop = audio.addSound("loop", AudioSystem::makePlaceholderSound(7, 2.0f, config.sampleRate), config.sampleRate);
+    for (int i = 0; i < voiceCount; i++) {
+        SoundPlayParams params;
+        params.position = sourcePosition(i);
+        params.loop = true;
+        audio.play(loop, params);
+    }
+
+    std::vector<float> output(static_cast<size_t>(config.framesPerBuffer) * AudioSystem::CHANNELS);
+    float angle = 0.0f;
+    while (state.keepRunning()) {
+        angle += 0.01f;
+        audio.setListener(Vec3(0.0f, 0.0f, 0.0f), Vec3(std::cos(angle), 0.0f, std::sin(angle)));
+        audio.mixBuffer(output.data());
+        doNotOptimize(output[0]);
+    }
+
+    AudioMixStats stats = audio.getStats();
+    state.setItemsProcessed(static_cast<int64_t>(state.iterations()) * voiceCount);
+    state.setCounter("budget%", stats.avgMixMicros / stats.bufferMicros * 100.0);
+}
+WW3_BENCHMARK(BM_AudioMixBuffer, "voices", {8}, {32}, {128});
+
+// Eight shots and impacts per buffer into a full 32-voice pool
+static void BM_AudioGunfireStealing(State& state) {
+    AudioConfig config;
+    AudioSystem audio(config);
+    SoundId shot = audio.addSound("shot", AudioSystem::makePlaceholderSound(1, 0.25f, config.sampleRate), config.sampleRate);
+    SoundId impact = audio.addSound("impact", AudioSystem::makePlaceholderSound(2, 0.25f, config.sampleRate), config.sampleRate);
+
+    std::vector<float> output(static_cast<size_t>(config.framesPerBuffer) * AudioSystem::CHANNELS);
+    int next = 0;
+    while (state.keepRunning()) {
+        for (int i = 0; i < 8; i++, next++) {
+            SoundPlayParams params;
+            params.position = sourcePosition(next);
+            params.priority = (next & 1) ? SoundPriority::Low : SoundPriority::Normal;
+            audio.play((next & 1) ? impact : shot, params);
+        }
+        audio.mixBuffer(output.data());
+        doNotOptimize(output[0]);
+    }
+
+    AudioMixStats stats = audio.getStats();
+    state.setItemsProcessed(static_cast<int64_t>(state.iterations()) * 8);
+    state.setCounter("stolen/buffer", static_cast<double>(stats.voicesStolen) / state.iterations());
+    state.setCounter("budget%", stats.avgMixMicros / stats.bufferMicros * 100.0);
+}
+WW3_BENCHMARK(BM_AudioGunfireStealing, "shots");
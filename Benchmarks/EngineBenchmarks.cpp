@@ -0,0 +1,172 @@
+/**
+ * EngineBenchmarks.cpp - Scene and ProjectileManager Microbenchmarks
+ *
+ * Only built when the full engine (ww3_engine) is available. Runs without a
+ * GL context: Mesh keeps CPU-side data only when GLEW has not been initialized,
+ * so scene objects and projectiles can be created and updated headless.
+ */
+
+#include "MicroBenchmark.h"
+#include "Engine/Core/Scene.h"
+#include "Engine/Core/Projectile.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Engine;
+using Engine::Bench::State;
+using Engine::Bench::doNotOptimize;
+
+namespace {
+
+std::vector<std::string> makeNames(const std::string& prefix, int count) {
+    std::vector<std::string> names;
+    names.reserve(count);
+    for (int i = 0; i < count; i++) {
+        names.push_back(prefix + std::to_string(i));
+    }
+    return names;
+}
+
+std::vector<std::unique_ptr<GameObject>> makeObjects(const std::vector<std::string>& names) {
+    std::vector<std::unique_ptr<GameObject>> objects;
+    objects.reserve(names.size());
+    for (size_t i = 0; i < names.size(); i++) {
+        auto object = std::make_unique<GameObject>(names[i]);
+        object->setPosition(Vec3(static_cast<float>(i % 64), 0.0f, static_cast<float>(i / 64)));
+        objects.push_back(std::move(object));
+    }
+    return objects;
+}
+
+void fillScene(Scene& scene, const std::vector<std::string>& names) {
+    for (auto& object : makeObjects(names)) {
+        scene.addGameObject(std::move(object));
+    }
+}
+
+} // namespace
+
+// ===== Scene =====
+
+// Add range(0) objects to an initialized scene
+static void BM_SceneAddGameObject(State& state) {
+    const int count = static_cast<int>(state.range(0));
+    std::vector<std::string> names = makeNames("Object_", count);
+
+    while (state.keepRunning()) {
+        state.pauseTiming();
+        Scene scene("BenchScene");
+        scene.initialize();
+        std::vector<std::unique_ptr<GameObject>> objects = makeObjects(names);
+        state.resumeTiming();
+
+        for (auto& object : objects) {
+            scene.addGameObject(std::move(object));
+        }
+
+        state.pauseTiming();
+        scene.clear();
+        state.resumeTiming();
+    }
+
+    state.setItemsProcessed(static_cast<int64_t>(state.iterations()) * count);
+}
+WW3_BENCHMARK(BM_SceneAddGameObject, "objects", {64}, {512}, {4096});
+
+// Name lookups in a scene holding range(0) objects
+static void BM_SceneGetGameObject(State& state) {
+    const int count = static_cast<int>(state.range(0));
+    std::vector<std::string> names = makeNames("Object_", count);
+    Scene scene("BenchScene");
+    scene.initialize();
+    fillScene(scene, names);
+
+    while (state.keepRunning()) {
+        for (const auto& name : names) {
+            doNotOptimize(scene.getGameObject(name));
+        }
+    }
+
+    state.setItemsProcessed(static_cast<int64_t>(state.iterations()) * count);
+}
+WW3_BENCHMARK(BM_SceneGetGameObject, "lookups", {64}, {512}, {4096});
+
+// Remove all range(0) objects by name (front to back)
+static void BM_SceneRemoveGameObject(State& state) {
+    const int count = static_cast<int>(state.range(0));
+    std::vector<std::string> names = makeNames("Object_", count);
+
+    while (state.keepRunning()) {
+        state.pauseTiming();
+        Scene scene("BenchScene");
+        scene.initialize();
+        fillScene(scene, names);
+        state.resumeTiming();
+
+        for (const auto& name : names) {
+            scene.removeGameObject(name);
+        }
+    }
+
+    state.setItemsProcessed(static_cast<int64_t>(state.iterations()) * count);
+}
+WW3_BENCHMARK(BM_SceneRemoveGameObject, "objects", {64}, {512}, {4096});
+
+// Per-frame collision candidate gathering over range(0) objects, a quarter of them monsters
+static void BM_SceneGetAllObjectsForCollision(State& state) {
+    const int count = static_cast<int>(state.range(0));
+    std::vector<std::string> names = makeNames("Object_", count - count / 4);
+    std::vector<std::string> monsterNames = makeNames("Monster_", count / 4);
+    names.insert(names.end(), monsterNames.begin(), monsterNames.end());
+
+    Scene scene("BenchScene");
+    scene.initialize();
+    fillScene(scene, names);
+
+    while (state.keepRunning()) {
+        std::vector<GameObject*> objects = scene.getAllObjectsForCollision();
+        doNotOptimize(objects.data());
+    }
+
+    state.setItemsProcessed(static_cast<int64_t>(state.iterations()) * count);
+}
+WW3_BENCHMARK(BM_SceneGetAllObjectsForCollision, "objects", {64}, {512}, {4096});
+
+// ===== ProjectileManager =====
+
+// checkAllCollisions with range(0) projectiles against range(1) monster-named targets.
+// Targets sit away from the projectiles so every pair is tested (no early break on hit).
+static void BM_ProjectileCheckAllCollisions(State& state) {
+    const int projectileCount = static_cast<int>(state.range(0));
+    const int targetCount = static_cast<int>(state.range(1));
+
+    ProjectileManager manager;
+    manager.initialize(nullptr, nullptr, nullptr);
+
+    ProjectileConfig config;
+    config.speed = 50.0f;
+    config.lifetime = 1000.0f;
+    config.maxDistance = 10000.0f;
+    for (int i = 0; i < projectileCount; i++) {
+        Projectile* projectile = manager.createProjectile(config, "BenchProjectile_" + std::to_string(i));
+        if (projectile) {
+            projectile->fire(Vec3(static_cast<float>(i % 32), 50.0f, static_cast<float>(i / 32)),
+                             Vec3(0.0f, 0.0f, -1.0f));
+        }
+    }
+
+    std::vector<std::unique_ptr<GameObject>> targets = makeObjects(makeNames("Monster_", targetCount));
+    std::vector<GameObject*> targetPointers;
+    for (auto& target : targets) {
+        targetPointers.push_back(target.get());
+    }
+
+    while (state.keepRunning()) {
+        manager.checkAllCollisions(targetPointers);
+    }
+
+    state.setItemsProcessed(static_cast<int64_t>(state.iterations()) * projectileCount * targetCount);
+}
+WW3_BENCHMARK(BM_ProjectileCheckAllCollisions, "pairs",
+              {16, 16}, {64, 64}, {256, 64}, {256, 256}, {1024, 256});
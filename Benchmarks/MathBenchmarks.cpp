@@ -0,0 +1,117 @@
+/**
+ * MathBenchmarks.cpp - Math.cpp Matrix/Vector Microbenchmarks
+ *
+ * Times the Mat4 operations used on every draw call (model matrix build,
+ * view/projection, matrix-vector transform) over batches of 1024 inputs.
+ */
+
+#include "MicroBenchmark.h"
+#include "Engine/Math/Math.h"
+#include <vector>
+
+using namespace Engine;
+using Engine::Bench::State;
+using Engine::Bench::doNotOptimize;
+
+namespace {
+
+const int BATCH_SIZE = 1024;
+
+std::vector<Mat4> makeMatrices() {
+    std::vector<Mat4> matrices;
+    matrices.reserve(BATCH_SIZE);
+    for (int i = 0; i < BATCH_SIZE; i++) {
+        Mat4 m = multiply(rotateY(0.01f * i), translate(Mat4(), Vec3(0.1f * i, 0.2f, -0.3f * i)));
+        matrices.push_back(m);
+    }
+    return matrices;
+}
+
+} // namespace
+
+static void BM_Mat4Multiply(State& state) {
+    std::vector<Mat4> a = makeMatrices();
+    std::vector<Mat4> b = makeMatrices();
+    std::vector<Mat4> out(BATCH_SIZE);
+
+    while (state.keepRunning()) {
+        for (int i = 0; i < BATCH_SIZE; i++) {
+            out[i] = multiply(a[i], b[BATCH_SIZE - 1 - i]);
+        }
+        doNotOptimize(out.data());
+    }
+
+    state.setItemsProcessed(static_cast<int64_t>(state.iterations()) * BATCH_SIZE);
+}
+WW3_BENCHMARK(BM_Mat4Multiply, "matrices");
+
+static void BM_Mat4TransformVec4(State& state) {
+    std::vector<Mat4> matrices = makeMatrices();
+    std::vector<Vec4> out(BATCH_SIZE);
+    Vec4 point(1.0f, 2.0f, 3.0f, 1.0f);
+
+    while (state.keepRunning()) {
+        for (int i = 0; i < BATCH_SIZE; i++) {
+            out[i] = matrices[i] * point;
+        }
+        doNotOptimize(out.data());
+    }
+
+    state.setItemsProcessed(static_cast<int64_t>(state.iterations()) * BATCH_SIZE);
+}
+WW3_BENCHMARK(BM_Mat4TransformVec4, "vectors");
+
+// Same composition as GameObject::getModelMatrix: scale * rotX * rotY * rotZ, then translate
+static void BM_ModelMatrixCompose(State& state) {
+    std::vector<Mat4> out(BATCH_SIZE);
+
+    while (state.keepRunning()) {
+        for (int i = 0; i < BATCH_SIZE; i++) {
+            float angle = 0.001f * i;
+            Mat4 model = scale(Vec3(1.0f, 1.5f, 1.0f));
+            model = multiply(model, rotateX(angle));
+            model = multiply(model, rotateY(angle * 2.0f));
+            model = multiply(model, rotateZ(angle * 3.0f));
+            out[i] = translate(model, Vec3(static_cast<float>(i), 0.0f, -static_cast<float>(i)));
+        }
+        doNotOptimize(out.data());
+    }
+
+    state.setItemsProcessed(static_cast<int64_t>(state.iterations()) * BATCH_SIZE);
+}
+WW3_BENCHMARK(BM_ModelMatrixCompose, "matrices");
+
+static void BM_ViewProjection(State& state) {
+    std::vector<Mat4> out(BATCH_SIZE);
+    Mat4 projection = perspective(45.0f * 3.14159f / 180.0f, 16.0f / 9.0f, 0.1f, 100.0f);
+
+    while (state.keepRunning()) {
+        for (int i = 0; i < BATCH_SIZE; i++) {
+            Vec3 eye(0.01f * i, 2.0f, 5.0f);
+            Mat4 view = lookAt(eye, Vec3(0.0f, 0.0f, 0.0f), Vec3(0.0f, 1.0f, 0.0f));
+            out[i] = multiply(projection, view);
+        }
+        doNotOptimize(out.data());
+    }
+
+    state.setItemsProcessed(static_cast<int64_t>(state.iterations()) * BATCH_SIZE);
+}
+WW3_BENCHMARK(BM_ViewProjection, "matrices");
+
+static void BM_Vec3NormalizeCross(State& state) {
+    std::vector<Vec3> vectors(BATCH_SIZE);
+    for (int i = 0; i < BATCH_SIZE; i++) {
+        vectors[i] = Vec3(1.0f + i, 0.5f * i, -0.25f * i);
+    }
+    std::vector<Vec3> out(BATCH_SIZE);
+
+    while (state.keepRunning()) {
+        for (int i = 0; i < BATCH_SIZE; i++) {
+            out[i] = normalize(cross(vectors[i], vectors[BATCH_SIZE - 1 - i]));
+        }
+        doNotOptimize(out.data());
+    }
+
+    state.setItemsProcessed(static_cast<int64_t>(state.iterations()) * BATCH_SIZE);
+}
+WW3_BENCHMARK(BM_Vec3NormalizeCross, "vectors");
@@ -0,0 +1,240 @@
+/**
+ * MicroBenchmark.cpp - Implementation of the Component Benchmark Harness
+ */
+
+#include "MicroBenchmark.h"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <streambuf>
+
+namespace Engine {
+namespace Bench {
+
+namespace {
+
+const uint64_t MAX_ITERATIONS = 1000000000ULL;
+
+// Swallows engine debug output while a benchmark body runs
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char*, std::streamsize count) override { return count; }
+};
+
+struct RunResult {
+    std::string name;
+    std::string itemLabel;
+    uint64_t iterations = 0;
+    double nsPerIteration = 0.0;
+    double itemsPerSecond = 0.0;
+    double bytesPerSecond = 0.0;
+    std::vector<std::pair<std::string, double>> counters;
+};
+
+std::string makeRunName(const BenchmarkDefinition& definition, const std::vector<int64_t>& args) {
+    std::string name = definition.name;
+    for (int64_t arg : args) {
+        name += "/" + std::to_string(arg);
+    }
+    return name;
+}
+
+State runOnce(const BenchmarkDefinition& definition, const std::vector<int64_t>& args, uint64_t iterations) {
+    State state(iterations, args);
+
+    static NullBuffer nullBuffer;
+    std::streambuf* previous = std::cout.rdbuf(&nullBuffer);
+    definition.function(state);
+    std::cout.rdbuf(previous);
+
+    return state;
+}
+
+std::string formatRate(double perSecond) {
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(2);
+    if (perSecond >= 1e9)      out << perSecond / 1e9 << "G";
+    else if (perSecond >= 1e6) out << perSecond / 1e6 << "M";
+    else if (perSecond >= 1e3) out << perSecond / 1e3 << "k";
+    else                       out << perSecond;
+    return out.str();
+}
+
+std::string formatTime(double ns) {
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(2);
+    if (ns >= 1e6)      out << ns / 1e6 << " ms";
+    else if (ns >= 1e3) out << ns / 1e3 << " us";
+    else                out << ns << " ns";
+    return out.str();
+}
+
+} // namespace
+
+// ===== State =====
+
+State::State(uint64_t iterations, const std::vector<int64_t>& arguments)
+    : maxIterations(iterations), remaining(iterations), args(arguments),
+      started(false), finished(false), paused(false),
+      elapsedSeconds(0.0), itemsProcessed(0), bytesProcessed(0) {}
+
+bool State::keepRunning() {
+    if (!started) {
+        started = true;
+        segmentStart = Clock::now();
+    }
+    if (remaining > 0) {
+        --remaining;
+        return true;
+    }
+    if (!finished) {
+        finished = true;
+        if (!paused) {
+            elapsedSeconds += std::chrono::duration<double>(Clock::now() - segmentStart).count();
+        }
+    }
+    return false;
+}
+
+void State::setCounter(const std::string& name, double value) {
+    for (auto& counter : counters) {
+        if (counter.first == name) {
+            counter.second = value;
+            return;
+        }
+    }
+    counters.emplace_back(name, value);
+}
+
+void State::pauseTiming() {
+    if (paused || !started) return;
+    elapsedSeconds += std::chrono::duration<double>(Clock::now() - segmentStart).count();
+    paused = true;
+}
+
+void State::resumeTiming() {
+    if (!paused) return;
+    paused = false;
+    segmentStart = Clock::now();
+}
+
+// ===== Registry =====
+
+Registry& Registry::getInstance() {
+    static Registry instance;
+    return instance;
+}
+
+Registrar::Registrar(const char* name, BenchmarkFunction function, const char* itemLabel,
+                     std::vector<std::vector<int64_t>> argumentSets) {
+    BenchmarkDefinition definition;
+    definition.name = name;
+    definition.itemLabel = itemLabel ? itemLabel : "items";
+    definition.function = std::move(function);
+    definition.argumentSets = std::move(argumentSets);
+    if (definition.argumentSets.empty()) {
+        definition.argumentSets.push_back({});
+    }
+    Registry::getInstance().add(definition);
+}
+
+// ===== Runner =====
+
+int runBenchmarks(const RunOptions& options) {
+    std::vector<RunResult> results;
+
+    if (!options.listOnly) {
+        std::cout << std::left << std::setw(52) << "Benchmark"
+                  << std::right << std::setw(14) << "Time/iter"
+                  << std::setw(14) << "Iterations"
+                  << std::setw(32) << "Throughput" << std::endl;
+        std::cout << std::string(112, '-') << std::endl;
+    }
+
+    for (const auto& definition : Registry::getInstance().getBenchmarks()) {
+        for (const auto& args : definition.argumentSets) {
+            std::string runName = makeRunName(definition, args);
+            if (!options.filter.empty() && runName.find(options.filter) == std::string::npos) {
+                continue;
+            }
+            if (options.listOnly) {
+                std::cout << runName << std::endl;
+                continue;
+            }
+
+            // Calibrate: grow the iteration count until the run is long enough to trust
+            uint64_t iterations = 1;
+            State state = runOnce(definition, args, iterations);
+            while (state.getElapsedSeconds() < options.minTimeSeconds && iterations < MAX_ITERATIONS) {
+                double elapsed = std::max(state.getElapsedSeconds(), 1e-9);
+                double scale = std::min(10.0, std::max(1.5, 1.4 * options.minTimeSeconds / elapsed));
+                iterations = std::min(MAX_ITERATIONS, static_cast<uint64_t>(static_cast<double>(iterations) * scale) + 1);
+                state = runOnce(definition, args, iterations);
+            }
+
+            RunResult result;
+            result.name = runName;
+            result.itemLabel = definition.itemLabel;
+            result.iterations = iterations;
+            double seconds = std::max(state.getElapsedSeconds(), 1e-12);
+            result.nsPerIteration = seconds * 1e9 / static_cast<double>(iterations);
+            result.itemsPerSecond = static_cast<double>(state.getItemsProcessed()) / seconds;
+            result.bytesPerSecond = static_cast<double>(state.getBytesProcessed()) / seconds;
+            result.counters = state.getCounters();
+            results.push_back(result);
+
+            std::string throughput;
+            if (result.itemsPerSecond > 0.0) {
+                throughput = formatRate(result.itemsPerSecond) + " " + result.itemLabel + "/s";
+            }
+            if (result.bytesPerSecond > 0.0) {
+                throughput += (throughput.empty() ? "" : ", ") + formatRate(result.bytesPerSecond) + "B/s";
+            }
+
+            std::cout << std::left << std::setw(52) << runName
+                      << std::right << std::setw(14) << formatTime(result.nsPerIteration)
+                      << std::setw(14) << iterations
+                      << std::setw(32) << throughput;
+            for (const auto& counter : result.counters) {
+                std::cout << "  " << counter.first << "=" << formatRate(counter.second);
+            }
+            std::cout << std::endl;
+        }
+    }
+
+    if (!options.jsonPath.empty() && !options.listOnly) {
+        std::ofstream out(options.jsonPath);
+        if (!out.is_open()) {
+            std::cerr << "Cannot write " << options.jsonPath << std::endl;
+        } else {
+            out << std::fixed << std::setprecision(3);
+            out << "{\n  \"benchmarks\": [\n";
+            for (size_t i = 0; i < results.size(); i++) {
+                const RunResult& r = results[i];
+                out << "    { \"name\": \"" << r.name << "\""
+                    << ", \"iterations\": " << r.iterations
+                    << ", \"ns_per_iteration\": " << r.nsPerIteration
+                    << ", \"items_per_second\": " << r.itemsPerSecond
+                    << ", \"item\": \"" << r.itemLabel << "\""
+                    << ", \"bytes_per_second\": " << r.bytesPerSecond;
+                if (!r.counters.empty()) {
+                    out << ", \"counters\": {";
+                    for (size_t c = 0; c < r.counters.size(); c++) {
+                        out << (c > 0 ? ", " : " ") << "\"" << r.counters[c].first << "\": " << r.counters[c].second;
+                    }
+                    out << " }";
+                }
+                out << " }" << (i + 1 < results.size() ? "," : "") << "\n";
+            }
+            out << "  ]\n}\n";
+        }
+    }
+
+    return static_cast<int>(results.size());
+}
+
+} // namespace Bench
+} // namespace Engine
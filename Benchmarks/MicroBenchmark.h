@@ -0,0 +1,150 @@
+/**
+ * MicroBenchmark.h - Minimal Component Benchmark Harness
+ *
+ * OVERVIEW:
+ * Small self-contained harness for timing engine components in isolation,
+ * without a window or GL context. Benchmarks register themselves through
+ * WW3_BENCHMARK, are auto-calibrated to run for a minimum wall time and
+ * report time per iteration plus item/byte throughput.
+ *
+ * FEATURES:
+ * - Static registration with optional argument sets (e.g. P x N sweeps)
+ * - Iteration count calibration against a minimum run time
+ * - Paused regions for per-iteration setup
+ * - Throughput in items/s and bytes/s
+ * - Named counters for per-run values that are not rates (e.g. bytes/tick)
+ * - Name filtering so a single benchmark can be run on its own
+ * - Engine console output is muted while benchmark bodies run
+ *
+ * USAGE:
+ *   static void BM_Something(Engine::Bench::State& state) {
+ *       while (state.keepRunning()) { ... }
+ *       state.setItemsProcessed(state.iterations() * itemsPerIteration);
+ *   }
+ *   WW3_BENCHMARK(BM_Something, "items", {16}, {64});   // one argument set per {}
+ */
+
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Engine {
+namespace Bench {
+
+/**
+ * State - Per-run loop control and counters handed to each benchmark body
+ */
+class State {
+private:
+    using Clock = std::chrono::steady_clock;
+
+    uint64_t maxIterations;
+    uint64_t remaining;
+    std::vector<int64_t> args;
+    bool started;
+    bool finished;
+    bool paused;
+    Clock::time_point segmentStart;
+    double elapsedSeconds;
+    int64_t itemsProcessed;
+    int64_t bytesProcessed;
+    std::vector<std::pair<std::string, double>> counters;
+
+public:
+    State(uint64_t iterations, const std::vector<int64_t>& arguments);
+
+    // Loop condition: while (state.keepRunning()) { ... }
+    bool keepRunning();
+
+    // Exclude per-iteration setup from the measurement
+    void pauseTiming();
+    void resumeTiming();
+
+    // Arguments of the current argument set
+    int64_t range(size_t index = 0) const { return index < args.size() ? args[index] : 0; }
+    uint64_t iterations() const { return maxIterations; }
+
+    // Throughput counters (totals over all iterations)
+    void setItemsProcessed(int64_t items) { itemsProcessed = items; }
+    void setBytesProcessed(int64_t bytes) { bytesProcessed = bytes; }
+
+    // Reported as-is after the throughput (setting a name again replaces it)
+    void setCounter(const std::string& name, double value);
+
+    // Results
+    double getElapsedSeconds() const { return elapsedSeconds; }
+    int64_t getItemsProcessed() const { return itemsProcessed; }
+    int64_t getBytesProcessed() const { return bytesProcessed; }
+    const std::vector<std::pair<std::string, double>>& getCounters() const { return counters; }
+};
+
+using BenchmarkFunction = std::function<void(State&)>;
+
+/**
+ * A registered benchmark with its argument sets
+ */
+struct BenchmarkDefinition {
+    std::string name;
+    std::string itemLabel;                       // What one "item" is, e.g. "samples", "vertices"
+    BenchmarkFunction function;
+    std::vector<std::vector<int64_t>> argumentSets;
+};
+
+/**
+ * Registry - Holds all benchmarks registered in this executable
+ */
+class Registry {
+private:
+    std::vector<BenchmarkDefinition> benchmarks;
+
+public:
+    static Registry& getInstance();
+
+    void add(const BenchmarkDefinition& definition) { benchmarks.push_back(definition); }
+    const std::vector<BenchmarkDefinition>& getBenchmarks() const { return benchmarks; }
+};
+
+/**
+ * Registrar - Static helper used by WW3_BENCHMARK
+ */
+struct Registrar {
+    Registrar(const char* name, BenchmarkFunction function, const char* itemLabel,
+              std::vector<std::vector<int64_t>> argumentSets = {});
+};
+
+/**
+ * Runner options (parsed from the command line)
+ */
+struct RunOptions {
+    std::string filter;          // Substring match on "name/arg0/arg1"
+    double minTimeSeconds = 0.5; // Calibrated run time per benchmark
+    bool listOnly = false;
+    std::string jsonPath;        // Optional JSON report
+};
+
+// Runs all benchmarks matching options.filter; returns the number that ran
+int runBenchmarks(const RunOptions& options);
+
+// Prevents the optimizer from discarding a computed value
+template <typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    const volatile char* sink = reinterpret_cast<const volatile char*>(&value);
+    (void)*sink;
+#endif
+}
+
+} // namespace Bench
+} // namespace Engine
+
+#define WW3_BENCHMARK_CONCAT_INNER(a, b) a##b
+#define WW3_BENCHMARK_CONCAT(a, b) WW3_BENCHMARK_CONCAT_INNER(a, b)
+#define WW3_BENCHMARK(function, itemLabel, ...) \
+    static ::Engine::Bench::Registrar WW3_BENCHMARK_CONCAT(benchmarkRegistrar_, __LINE__)( \
+        #function, function, itemLabel, std::vector<std::vector<int64_t>>{__VA_ARGS__})
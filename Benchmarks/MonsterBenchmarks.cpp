@@ -0,0 +1,167 @@
+/**
+ * MonsterBenchmarks.cpp - Monster Simulation Microbenchmarks
+ *
+ * Covers MonsterSimulation::update (the batched per-state AI passes) with
+ * populations far beyond what the game spawns today, the kill/respawn
+ * churn that repartitions the live range, snapshot save/restore, the
+ * radius queries behind explosion damage, and crowd avoidance in a pack
+ * converging on the player.
+ */
+
+#include "MicroBenchmark.h"
+#include "Engine/Core/MonsterSimulation.h"
+#include "Engine/Core/StateBuffer.h"
+#include <cmath>
+#include <vector>
+
+using namespace Engine;
+using Engine::Bench::State;
+using Engine::Bench::doNotOptimize;
+
+namespace {
+
+// Monsters scattered over a square around the origin, mixed types
+void populate(MonsterSimulation& simulation, int monsterCount) {
+    simulation.reserve(static_cast<size_t>(monsterCount));
+    const int side = static_cast<int>(std::ceil(std::sqrt(static_cast<float>(monsterCount))));
+    for (int i = 0; i < monsterCount; i++) {
+        Vec3 position(static_cast<float>(i % side) * 3.0f - side * 1.5f, 0.0f,
+                      static_cast<float>(i / side) * 3.0f - side * 1.5f);
+        simulation.add(static_cast<MonsterType>(i % 3), position, static_cast<uint32_t>(i + 1) * 2654435761u);
+    }
+}
+
+} // namespace
+
+// One 60 Hz tick, monsterCount = range(0); the player orbits so states keep changing
+static void BM_MonsterSimulationUpdate(State& state) {
+    const int monsterCount = static_cast<int>(state.range(0));
+    MonsterSimulation simulation;
+    populate(simulation, monsterCount);
+    float time = 0.0f;
+
+    while (state.keepRunning()) {
+        time += 1.0f / 60.0f;
+        simulation.setPlayerPosition(Vec3(std::cos(time * 0.5f) * 20.0f, 0.0f, std::sin(time * 0.5f) * 20.0f));
+        simulation.update(1.0f / 60.0f);
+        simulation.clearEvents();
+        doNotOptimize(simulation.getCountInState(MonsterState::Chasing));
+    }
+
+    state.setItemsProcessed(static_cast<int64_t>(state.iterations()) * monsterCount);
+}
+WW3_BENCHMARK(BM_MonsterSimulationUpdate, "monsters", {64}, {1024}, {4096}, {16384});
+
+// Damage stream that kills and respawns monsters, monsterCount = range(0)
+static void BM_MonsterSimulationDamageChurn(State& state) {
+    const int monsterCount = static_cast<int>(state.range(0));
+    MonsterSimulation simulation;
+    populate(simulation, monsterCount);
+    uint32_t next = 0;
+
+    while (state.keepRunning()) {
+        uint32_t handle = next++ % static_cast<uint32_t>(monsterCount);
+        if (simulation.getState(handle) == MonsterState::Dead) {
+            simulation.respawn(handle, simulation.getPosition(handle));
+        } else {
+            doNotOptimize(simulation.applyDamage(handle, 40.0f));
+        }
+        if ((next & 63) == 0) {
+            simulation.clearEvents();
+        }
+    }
+
+    state.setItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+WW3_BENCHMARK(BM_MonsterSimulationDamageChurn, "hits", {1024});
+
+// Snapshot the whole simulation into a reused buffer and restore it, monsterCount = range(0)
+static void BM_MonsterSimulationSnapshotRestore(State& state) {
+    const int monsterCount = static_cast<int>(state.range(0));
+    MonsterSimulation simulation;
+    populate(simulation, monsterCount);
+    simulation.update(1.0f / 60.0f);
+    simulation.clearEvents();
+    std::vector<uint8_t> buffer;
+    int64_t bytes = 0;
+
+    while (state.keepRunning()) {
+        StateWriter writer(buffer);
+        simulation.saveState(writer);
+        StateReader reader(buffer.data(), buffer.size());
+        doNotOptimize(simulation.restoreState(reader));
+        bytes += static_cast<int64_t>(buffer.size());
+    }
+
+    state.setItemsProcessed(static_cast<int64_t>(state.iterations()) * monsterCount);
+    state.setBytesProcessed(bytes);
+    state.setCounter("bytes/snapshot", static_cast<double>(buffer.size()));
+}
+WW3_BENCHMARK(BM_MonsterSimulationSnapshotRestore, "monsters", {500}, {4096});
+
+// A pack closing in on the player from a ring, with crowd avoidance off
+// (range(1) = 0) or on; monsterCount = range(0)
+static void BM_MonsterCrowdAvoidance(State& state) {
+    const int monsterCount = static_cast<int>(state.range(0));
+    MonsterSimulation simulation;
+    CrowdAvoidanceConfig avoidance;
+    avoidance.enabled = state.range(1) != 0;
+    simulation.setCrowdAvoidance(avoidance);
+    simulation.reserve(static_cast<size_t>(monsterCount));
+    for (int i = 0; i < monsterCount; i++) {
+        float angle = static_cast<float>(i) * 6.2831853f / static_cast<float>(monsterCount);
+        float radius = 10.0f + static_cast<float>(i % 5) * 3.0f;
+        simulation.add(MonsterType::Runner, Vec3(std::cos(angle) * radius, 0.0f, std::sin(angle) * radius),
+                       static_cast<uint32_t>(i + 1) * 2654435761u);
+    }
+    simulation.setPlayerPosition(Vec3(0.0f, 0.0f, 0.0f));
+
+    while (state.keepRunning()) {
+        simulation.update(1.0f / 60.0f);
+        simulation.clearEvents();
+        doNotOptimize(simulation.getCountInState(MonsterState::Chasing));
+    }
+
+    state.setItemsProcessed(static_cast<int64_t>(state.iterations()) * monsterCount);
+}
+WW3_BENCHMARK(BM_MonsterCrowdAvoidance, "monsters", {256, 0}, {256, 1}, {1024, 1});
+
+// A 16-rocket volley into the wave after every tick: one grid rebuild, then
+// 16 radius queries (6 m blasts) with damage; the dead respawn before the
+// next tick, monsterCount = range(0)
+static void BM_MonsterSimulationExplosionVolley(State& state) {
+    const int monsterCount = static_cast<int>(state.range(0));
+    const int rocketsPerVolley = 16;
+    MonsterSimulation simulation;
+    populate(simulation, monsterCount);
+    const float halfExtent = std::ceil(std::sqrt(static_cast<float>(monsterCount))) * 1.5f;
+    std::vector<uint32_t> hits;
+    uint32_t random = 12345u;
+    int64_t totalHits = 0;
+
+    while (state.keepRunning()) {
+        while (simulation.getLiveCount() < simulation.size()) {
+            uint32_t handle = simulation.getHandleAt(simulation.getLiveCount());
+            simulation.respawn(handle, simulation.getPosition(handle));
+        }
+        simulation.update(1.0f / 60.0f);
+        for (int r = 0; r < rocketsPerVolley; r++) {
+            random = random * 1664525u + 1013904223u;
+            float x = (static_cast<float>(random >> 16) / 65535.0f * 2.0f - 1.0f) * halfExtent;
+            random = random * 1664525u + 1013904223u;
+            float z = (static_cast<float>(random >> 16) / 65535.0f * 2.0f - 1.0f) * halfExtent;
+
+            simulation.queryRadius(Vec3(x, 0.5f, z), 6.0f, hits);
+            for (uint32_t handle : hits) {
+                simulation.applyDamage(handle, 30.0f);
+            }
+            totalHits += static_cast<int64_t>(hits.size());
+        }
+        simulation.clearEvents();
+    }
+
+    state.setItemsProcessed(static_cast<int64_t>(state.iterations()) * rocketsPerVolley);
+    state.setCounter("hits/explosion", state.iterations() > 0
+        ? static_cast<double>(totalHits) / (static_cast<double>(state.iterations()) * rocketsPerVolley) : 0.0);
+}
+WW3_BENCHMARK(BM_MonsterSimulationExplosionVolley, "explosions", {1024}, {16384});
@@ -0,0 +1,232 @@
+/**
+ * NetworkBenchmarks.cpp - Snapshot Encoding Microbenchmarks
+ *
+ * Covers SnapshotEncoder/SnapshotDecoder on a synthetic world of range(0)
+ * entities (4 players, 80% monsters, the rest projectiles) advanced by one
+ * 20 Hz snapshot interval per iteration: most monsters walk, a quarter stand
+ * still, projectiles fly and 2% of them are replaced every snapshot.
+ * bytes/tick is the size of one client's Snapshot datagram.
+ */
+
+#include "MicroBenchmark.h"
+#include "Engine/Network/SnapshotEncoder.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+using namespace Engine;
+using Engine::Bench::State;
+using Engine::Bench::doNotOptimize;
+
+namespace {
+
+const uint32_t TICKS_PER_SNAPSHOT = 3;                  // 60 Hz tick, 20 Hz snapshots
+const float SNAPSHOT_INTERVAL = TICKS_PER_SNAPSHOT / 60.0f;
+const size_t UNLIMITED_BUDGET = 256 * 1024;             // Measures the whole delta
+
+class ReplicationWorld {
+private:
+    std::vector<Vec3> monsterOrigins;
+    uint32_t nextProjectileId;
+    float time;
+
+public:
+    WorldSnapshot snapshot;
+
+    explicit ReplicationWorld(int entityCount)
+        : nextProjectileId(1), time(0.0f) {
+        snapshot.tick = TICKS_PER_SNAPSHOT;
+        for (int i = 0; i < 4; i++) {
+            NetPlayerState player;
+            player.clientId = static_cast<uint8_t>(i);
+            player.position = Vec3(8.0f + 2.0f * i, 10.0f, 8.0f);
+            snapshot.players.push_back(player);
+        }
+
+        int monsterCount = (entityCount - 4) * 4 / 5;
+        for (int i = 0; i < monsterCount; i++) {
+            NetMonsterState monster;
+            monster.id = static_cast<uint32_t>(i * 3 + 1); // Handles of a partly churned pool
+            monster.type = static_cast<uint8_t>(i % 3);
+            monster.state = 3;
+            monster.position = Vec3(static_cast<float>(i % 40) * 2.5f - 50.0f, 0.0f, static_cast<float>(i / 40) * 2.5f - 50.0f);
+            monsterOrigins.push_back(monster.position);
+            snapshot.monsters.push_back(monster);
+        }
+
+        int projectileCount = entityCount - 4 - monsterCount;
+        for (int i = 0; i < projectileCount; i++) {
+            snapshot.projectiles.push_back(makeProjectile(i));
+        }
+    }
+
+    // One snapshot interval of movement
+    void advance() {
+        time += SNAPSHOT_INTERVAL;
+        snapshot.tick += TICKS_PER_SNAPSHOT;
+
+        for (size_t i = 0; i < snapshot.players.size(); i++) {
+            NetPlayerState& player = snapshot.players[i];
+            player.yaw = time * 0.6f + static_cast<float>(i);
+            player.position = player.position + getViewDirection(player.yaw, 0.0f) * (5.0f * SNAPSHOT_INTERVAL);
+        }
+
+        for (size_t i = 0; i < snapshot.monsters.size(); i++) {
+            if (i % 4 == 3) continue; // Idle
+            NetMonsterState& monster = snapshot.monsters[i];
+            float angle = time * 0.5f + static_cast<float>(i);
+            monster.position = monsterOrigins[i] + Vec3(std::cos(angle), 0.0f, std::sin(angle)) * 4.0f;
+            monster.yawDegrees = std::fmod(angle * 57.2958f + 90.0f, 360.0f);
+        }
+
+        for (size_t i = 0; i < snapshot.projectiles.size(); i++) {
+            NetProjectileState& projectile = snapshot.projectiles[i];
+            if (i % 50 == static_cast<size_t>(snapshot.tick / TICKS_PER_SNAPSHOT) % 50) {
+                projectile = makeProjectile(static_cast<int>(i)); // Expired, a new shot took its place
+                continue;
+            }
+            projectile.velocity.y -= 9.81f * SNAPSHOT_INTERVAL * (projectile.type == 3 ? 1.0f : 0.0f);
+            projectile.position = projectile.position + projectile.velocity * SNAPSHOT_INTERVAL;
+        }
+        std::sort(snapshot.projectiles.begin(), snapshot.projectiles.end(),
+                  [](const NetProjectileState& a, const NetProjectileState& b) { return a.id < b.id; });
+    }
+
+private:
+    NetProjectileState makeProjectile(int slot) {
+        NetProjectileState projectile;
+        projectile.id = nextProjectileId++;
+        projectile.type = static_cast<uint8_t>(slot % 4);
+        projectile.position = Vec3(static_cast<float>(slot % 16), 1.5f, static_cast<float>(slot / 16));
+        projectile.velocity = Vec3(30.0f, 2.0f, static_cast<float>(slot % 7) - 3.0f);
+        return projectile;
+    }
+};
+
+SnapshotViewer makeViewer(const WorldSnapshot& snapshot) {
+    SnapshotViewer viewer;
+    viewer.clientId = snapshot.players[0].clientId;
+    viewer.position = snapshot.players[0].position;
+    viewer.direction = getViewDirection(snapshot.players[0].yaw, snapshot.players[0].pitch);
+    return viewer;
+}
+
+// Encodes advancing snapshots for one client that acknowledges each as soon as it is sent
+void runEncode(State& state, size_t budget, bool delta) {
+    const int entityCount = static_cast<int>(state.range(0));
+    ReplicationWorld world(entityCount);
+    QuantizedWorld quantized;
+    SnapshotEncoder encoder(budget);
+    std::vector<uint8_t> packet(budget);
+    uint32_t acked = 0;
+    int64_t bytes = 0;
+    int64_t deferred = 0;
+
+    while (state.keepRunning()) {
+        state.pauseTiming();
+        world.advance();
+        QuantizedWorld::quantize(world.snapshot, quantized);
+        state.resumeTiming();
+
+        NetWriter writer(packet.data(), packet.size());
+        SnapshotEncodeStats stats;
+        encoder.encode(quantized, delta ? acked : 0, 0, makeViewer(world.snapshot), writer, &stats);
+        acked = quantized.tick;
+        bytes += static_cast<int64_t>(writer.getSize());
+        deferred += stats.entitiesDeferred;
+    }
+
+    state.setItemsProcessed(static_cast<int64_t>(state.iterations()) * entityCount);
+    state.setBytesProcessed(bytes);
+    state.setCounter("bytes/tick", static_cast<double>(bytes) / state.iterations());
+    state.setCounter("deferred/tick", static_cast<double>(deferred) / state.iterations());
+}
+
+} // namespace
+
+// Quantization of the shared world, once per snapshot tick on the server
+static void BM_SnapshotQuantize(State& state) {
+    const int entityCount = static_cast<int>(state.range(0));
+    ReplicationWorld world(entityCount);
+    QuantizedWorld quantized;
+
+    while (state.keepRunning()) {
+        QuantizedWorld::quantize(world.snapshot, quantized);
+        doNotOptimize(quantized.tick);
+    }
+
+    state.setItemsProcessed(static_cast<int64_t>(state.iterations()) * entityCount);
+}
+WW3_BENCHMARK(BM_SnapshotQuantize, "entities", {1000});
+
+// Against an empty world: what a client gets until its first acknowledgement
+static void BM_SnapshotEncodeFull(State& state) {
+    runEncode(state, UNLIMITED_BUDGET, false);
+}
+WW3_BENCHMARK(BM_SnapshotEncodeFull, "entities", {1000});
+
+// Against the previous snapshot, no byte budget
+static void BM_SnapshotEncodeDelta(State& state) {
+    runEncode(state, UNLIMITED_BUDGET, true);
+}
+WW3_BENCHMARK(BM_SnapshotEncodeDelta, "entities", {1000}, {4000});
+
+// Against the previous snapshot within one MTU-sized datagram (the server default)
+static void BM_SnapshotEncodeBudget(State& state) {
+    runEncode(state, NetProtocol::MAX_PACKET_SIZE, true);
+}
+WW3_BENCHMARK(BM_SnapshotEncodeBudget, "entities", {1000});
+
+// Client side of BM_SnapshotEncodeDelta: decode + rebuild the world
+static void BM_SnapshotDecodeDelta(State& state) {
+    const int entityCount = static_cast<int>(state.range(0));
+    const int packetCount = 64;
+
+    // A full snapshot followed by deltas, each against the one before
+    ReplicationWorld world(entityCount);
+    QuantizedWorld quantized;
+    SnapshotEncoder encoder(UNLIMITED_BUDGET);
+    std::vector<std::vector<uint8_t>> packets;
+    uint32_t acked = 0;
+    for (int i = 0; i < packetCount; i++) {
+        world.advance();
+        QuantizedWorld::quantize(world.snapshot, quantized);
+        std::vector<uint8_t> packet(UNLIMITED_BUDGET);
+        NetWriter writer(packet.data(), packet.size());
+        encoder.encode(quantized, acked, 0, makeViewer(world.snapshot), writer);
+        packet.resize(writer.getSize());
+        packets.push_back(packet);
+        acked = quantized.tick;
+    }
+
+    SnapshotDecoder decoder;
+    WorldSnapshot decoded;
+    size_t next = packetCount;
+    int64_t bytes = 0;
+
+    while (state.keepRunning()) {
+        if (next == packets.size()) {
+            state.pauseTiming();
+            decoder.reset();
+            NetReader reader(packets[0].data(), packets[0].size());
+            NetPacketType type;
+            reader.readHeader(type);
+            decoder.decode(reader, decoded);
+            next = 1;
+            state.resumeTiming();
+        }
+
+        NetReader reader(packets[next].data(), packets[next].size());
+        NetPacketType type;
+        reader.readHeader(type);
+        doNotOptimize(decoder.decode(reader, decoded));
+        bytes += static_cast<int64_t>(packets[next].size());
+        next++;
+    }
+
+    state.setItemsProcessed(static_cast<int64_t>(state.iterations()) * entityCount);
+    state.setBytesProcessed(bytes);
+    state.setCounter("bytes/tick", static_cast<double>(bytes) / state.iterations());
+}
+WW3_BENCHMARK(BM_SnapshotDecodeDelta, "entities", {1000});
@@ -0,0 +1,91 @@
+/**
+ * OBJLoaderBenchmarks.cpp - OBJLoader::loadOBJ Microbenchmarks on Synthetic Meshes
+ *
+ * Writes a tessellated grid to a temporary .obj file once per argument set and
+ * then times loadOBJ on it. Two variants: full "v/vt/vn" faces, and position-only
+ * faces that force OBJLoader to generate normals.
+ */
+
+#include "MicroBenchmark.h"
+#include "Engine/Utils/OBJLoader.h"
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
+using namespace Engine;
+using Engine::Bench::State;
+using Engine::Bench::doNotOptimize;
+
+namespace {
+
+// Writes a gridSize x gridSize quad grid with a sine height field; returns the file size in bytes
+int64_t writeSyntheticOBJ(const std::string& path, int gridSize, bool withNormalsAndTexCoords) {
+    std::ofstream out(path);
+    const int verticesPerSide = gridSize + 1;
+
+    out << "# Synthetic " << gridSize << "x" << gridSize << " grid\n";
+    for (int z = 0; z < verticesPerSide; z++) {
+        for (int x = 0; x < verticesPerSide; x++) {
+            float height = 0.5f * std::sin(x * 0.3f) * std::cos(z * 0.3f);
+            out << "v " << x * 0.1f << " " << height << " " << z * 0.1f << "\n";
+        }
+    }
+    if (withNormalsAndTexCoords) {
+        for (int z = 0; z < verticesPerSide; z++) {
+            for (int x = 0; x < verticesPerSide; x++) {
+                out << "vt " << static_cast<float>(x) / gridSize << " " << static_cast<float>(z) / gridSize << "\n";
+            }
+        }
+        for (int z = 0; z < verticesPerSide; z++) {
+            for (int x = 0; x < verticesPerSide; x++) {
+                out << "vn 0 1 0\n";
+            }
+        }
+    }
+    for (int z = 0; z < gridSize; z++) {
+        for (int x = 0; x < gridSize; x++) {
+            // OBJ indices are 1-based; quads are triangulated by the loader
+            int a = z * verticesPerSide + x + 1;
+            int b = a + 1;
+            int c = a + verticesPerSide + 1;
+            int d = a + verticesPerSide;
+            if (withNormalsAndTexCoords) {
+                out << "f " << a << "/" << a << "/" << a << " " << b << "/" << b << "/" << b << " "
+                    << c << "/" << c << "/" << c << " " << d << "/" << d << "/" << d << "\n";
+            } else {
+                out << "f " << a << " " << b << " " << c << " " << d << "\n";
+            }
+        }
+    }
+    out.close();
+
+    std::error_code error;
+    auto size = std::filesystem::file_size(path, error);
+    return error ? 0 : static_cast<int64_t>(size);
+}
+
+} // namespace
+
+// range(0) = grid size in quads per side, range(1) = 1 for v/vt/vn faces, 0 for position-only faces
+static void BM_OBJLoaderLoadOBJ(State& state) {
+    const int gridSize = static_cast<int>(state.range(0));
+    const bool fullFaces = state.range(1) != 0;
+
+    std::filesystem::path path = std::filesystem::temp_directory_path() /
+        ("ww3_bench_grid_" + std::to_string(gridSize) + (fullFaces ? "_full" : "_pos") + ".obj");
+    int64_t fileBytes = writeSyntheticOBJ(path.string(), gridSize, fullFaces);
+
+    size_t triangles = 0;
+    while (state.keepRunning()) {
+        OBJMeshData mesh = OBJLoader::loadOBJ(path.string());
+        triangles = mesh.indices.size() / 3;
+        doNotOptimize(mesh.vertices.data());
+    }
+
+    std::remove(path.string().c_str());
+
+    state.setItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(triangles));
+    state.setBytesProcessed(static_cast<int64_t>(state.iterations()) * fileBytes);
+}
+WW3_BENCHMARK(BM_OBJLoaderLoadOBJ, "triangles", {32, 1}, {128, 1}, {128, 0}, {256, 1});
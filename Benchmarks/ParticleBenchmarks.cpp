@@ -0,0 +1,123 @@
+/**
+ * ParticleBenchmarks.cpp - Particle Simulation Microbenchmarks
+ *
+ * Covers the ParticleSystem update kernel at steady-state populations and a
+ * full combat frame: impacts, tracer trails and explosions emitted, the
+ * pools updated and the billboard instances written as the renderer does.
+ * The GPU case measures what stays on the CPU for a ParticleSimulation::Gpu
+ * emitter: recording bursts and handing them to the renderer.
+ */
+
+#include "MicroBenchmark.h"
+#include "Engine/Core/ParticleSystem.h"
+#include <vector>
+
+using namespace Engine;
+using Engine::Bench::State;
+using Engine::Bench::doNotOptimize;
+
+namespace {
+
+ParticleEmitterDesc makeDesc(const char* name, size_t capacity, float lifetimeMin, float lifetimeMax,
+                             float spread, float drag, float gravity) {
+    ParticleEmitterDesc desc;
+    desc.name = name;
+    desc.capacity = capacity;
+    desc.lifetimeMin = lifetimeMin;
+    desc.lifetimeMax = lifetimeMax;
+    desc.speedMin = 2.0f;
+    desc.speedMax = 8.0f;
+    desc.spread = spread;
+    desc.drag = drag;
+    desc.gravity = gravity;
+    return desc;
+}
+
+} // namespace
+
+// One 60 Hz update with particleCount = range(0) live particles; expired ones are re-emitted
+static void BM_ParticleSystemUpdate(State& state) {
+    const int particleCount = static_cast<int>(state.range(0));
+    ParticleSystem particles;
+    ParticleEmitterId emitter = particles.createEmitter(
+        makeDesc("sparks", static_cast<size_t>(particleCount), 1.0f, 2.0f, 1.2f, 2.0f, 9.81f));
+    particles.emit(emitter, Vec3(0.0f, 1.0f, 0.0f), Vec3(0.0f, 1.0f, 0.0f), particleCount);
+
+    while (state.keepRunning()) {
+        particles.update(1.0f / 60.0f);
+        int refill = particleCount - static_cast<int>(particles.getParticleCount(emitter));
+        particles.emit(emitter, Vec3(0.0f, 1.0f, 0.0f), Vec3(0.0f, 1.0f, 0.0f), refill);
+    }
+
+    doNotOptimize(particles.getParticleCount());
+    state.setItemsProcessed(static_cast<int64_t>(state.iterations()) * particleCount);
+}
+WW3_BENCHMARK(BM_ParticleSystemUpdate, "particles", {4096}, {65536});
+
+// A full-wave combat frame: 30 impacts, 40 tracer trails and 2 explosions per frame
+// (emission as in Projectile), update, then instance writing for the renderer
+static void BM_ParticleCombatFrame(State& state) {
+    ParticleSystem particles;
+    ParticleEmitterId sparks = particles.createEmitter(makeDesc("sparks", 8192, 0.2f, 0.5f, 1.2f, 2.0f, 9.81f));
+    ParticleEmitterId trail = particles.createEmitter(makeDesc("trail", 4096, 0.3f, 0.6f, 0.3f, 0.0f, -0.3f));
+    ParticleEmitterId fire = particles.createEmitter(makeDesc("fire", 8192, 0.3f, 0.8f, 3.14159f, 4.0f, 1.0f));
+    ParticleEmitterId smoke = particles.createEmitter(makeDesc("smoke", 4096, 1.2f, 2.5f, 3.14159f, 1.5f, -1.5f));
+    std::vector<ParticleInstance> instances(8192 + 4096 + 8192 + 4096);
+    int frame = 0;
+
+    while (state.keepRunning()) {
+        frame++;
+        for (int i = 0; i < 30; i++) {
+            Vec3 hit(static_cast<float>((frame * 7 + i * 13) % 60) - 30.0f, 1.0f, static_cast<float>(i) - 15.0f);
+            particles.emit(sparks, hit, Vec3(0.0f, 0.3f, -1.0f), 16);
+        }
+        for (int i = 0; i < 40; i++) {
+            particles.emit(trail, Vec3(static_cast<float>(i), 1.5f, static_cast<float>(frame % 100)), Vec3(0.0f, 0.0f, -1.0f), 2);
+        }
+        for (int i = 0; i < 2; i++) {
+            Vec3 blast(static_cast<float>(frame % 40) - 20.0f, 0.5f, static_cast<float>(i * 10));
+            particles.emit(fire, blast, Vec3(0.0f, 1.0f, 0.0f), 80);
+            particles.emit(smoke, blast, Vec3(0.0f, 1.0f, 0.0f), 40);
+        }
+
+        particles.update(1.0f / 60.0f);
+
+        size_t written = 0;
+        for (ParticleEmitterId emitter = 0; emitter < static_cast<ParticleEmitterId>(particles.getEmitterCount()); emitter++) {
+            written += particles.writeInstances(emitter, instances.data() + written);
+        }
+        doNotOptimize(instances.data());
+        doNotOptimize(written);
+    }
+
+    doNotOptimize(particles.getDroppedCount());
+    state.setItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+WW3_BENCHMARK(BM_ParticleCombatFrame, "frames");
+
+// CPU side of a GPU emitter: 30 plasma impacts of 600 particles a frame recorded as bursts,
+// captured and drained as the renderer does (the simulation itself runs on the GPU)
+static void BM_ParticleGpuBurstQueue(State& state) {
+    ParticleSystem particles;
+    particles.setGpuSimulationAvailable(true);
+    ParticleEmitterDesc desc = makeDesc("plasma", 262144, 0.4f, 1.2f, 1.6f, 3.0f, 2.0f);
+    desc.simulation = ParticleSimulation::Gpu;
+    ParticleEmitterId plasma = particles.createEmitter(desc);
+    ParticleRenderState renderState;
+    int frame = 0;
+
+    while (state.keepRunning()) {
+        frame++;
+        for (int i = 0; i < 30; i++) {
+            Vec3 hit(static_cast<float>((frame * 7 + i * 13) % 60) - 30.0f, 1.0f, static_cast<float>(i) - 15.0f);
+            particles.emit(plasma, hit, Vec3(0.0f, 0.3f, -1.0f), 600);
+        }
+        particles.update(1.0f / 60.0f);
+        particles.captureRenderState(renderState);
+        doNotOptimize(renderState.gpuBursts.data());
+        renderState.clearEvents();
+    }
+
+    state.setItemsProcessed(static_cast<int64_t>(state.iterations()) * 30 * 600);
+}
+WW3_BENCHMARK(BM_ParticleGpuBurstQueue, "particles");
@@ -0,0 +1,93 @@
+/**
+ * TerrainBenchmarks.cpp - Noise and Terrain Generation Microbenchmarks
+ *
+ * Covers PerlinNoise::octaveNoise2D, TerrainGenerator::generateChunkTerrain and
+ * SimpleChunkTerrainGenerator::generateChunkMesh with the parameters the game uses.
+ */
+
+#include "MicroBenchmark.h"
+#include "Engine/Utils/PerlinNoise.h"
+#include "Engine/Utils/TerrainGenerator.h"
+#include "Engine/Utils/SimpleChunkTerrainGenerator.h"
+
+using namespace Engine;
+using Engine::Bench::State;
+using Engine::Bench::doNotOptimize;
+
+// Octave noise over a 64x64 grid, octaves = range(0)
+static void BM_PerlinOctaveNoise2D(State& state) {
+    PerlinNoise noise(12345);
+    const int gridSize = 64;
+    const int octaves = static_cast<int>(state.range(0));
+    double offset = 0.0;
+
+    while (state.keepRunning()) {
+        double sum = 0.0;
+        for (int z = 0; z < gridSize; z++) {
+            for (int x = 0; x < gridSize; x++) {
+                sum += noise.octaveNoise2D((x + offset) * 0.15, z * 0.15, octaves, 0.5, 2.0);
+            }
+        }
+        doNotOptimize(sum);
+        offset += gridSize; // Avoid sampling identical coordinates every iteration
+    }
+
+    state.setItemsProcessed(static_cast<int64_t>(state.iterations()) * gridSize * gridSize);
+}
+WW3_BENCHMARK(BM_PerlinOctaveNoise2D, "samples", {1}, {4}, {8});
+
+// Voxel chunk generation, chunkSize = range(0), chunkHeight = 64
+static void BM_TerrainGenerateChunkTerrain(State& state) {
+    TerrainGenerator generator;
+    const int chunkSize = static_cast<int>(state.range(0));
+    const int chunkHeight = 64;
+    std::vector<TerrainBlockType> blocks;
+    int chunkIndex = 0;
+
+    while (state.keepRunning()) {
+        Vec2 offset(static_cast<float>((chunkIndex % 64) * chunkSize),
+                    static_cast<float>((chunkIndex / 64 % 64) * chunkSize));
+        generator.generateChunkTerrain(blocks, chunkSize, chunkHeight, offset);
+        doNotOptimize(blocks.data());
+        chunkIndex++;
+    }
+
+    state.setItemsProcessed(static_cast<int64_t>(state.iterations()) * chunkSize * chunkSize * chunkHeight);
+    state.setBytesProcessed(static_cast<int64_t>(state.iterations()) * chunkSize * chunkSize * chunkHeight *
+                            static_cast<int64_t>(sizeof(TerrainBlockType)));
+}
+WW3_BENCHMARK(BM_TerrainGenerateChunkTerrain, "blocks", {16}, {32});
+
+// Heightfield chunk mesh generation, chunkResolution = range(0) vertices per side (game default: 32)
+static void BM_SimpleChunkGenerateChunkMesh(State& state) {
+    SimpleChunkTerrainParams params;
+    params.baseHeight = -8.0f;
+    params.amplitude = 8.0f;
+    params.frequency = 0.15f;
+    params.octaves = 4;
+    params.persistence = 0.5;
+    params.lacunarity = 2.0;
+    params.seed = 12345;
+    params.chunkSize = 16;
+    params.chunkResolution = static_cast<int>(state.range(0));
+
+    SimpleChunkTerrainGenerator generator(params);
+    const int chunksBeforeClear = 256;
+    int chunkIndex = 0;
+
+    while (state.keepRunning()) {
+        // Each chunk is generated once and cached, so always ask for a new coordinate
+        generator.generateChunkMesh(chunkIndex % 1024, chunkIndex / 1024);
+        chunkIndex++;
+
+        if (chunkIndex % chunksBeforeClear == 0) {
+            state.pauseTiming();
+            generator.clearAllChunks();
+            state.resumeTiming();
+        }
+    }
+
+    const int64_t verticesPerChunk = static_cast<int64_t>(params.chunkResolution) * params.chunkResolution;
+    state.setItemsProcessed(static_cast<int64_t>(state.iterations()) * verticesPerChunk);
+}
+WW3_BENCHMARK(BM_SimpleChunkGenerateChunkMesh, "vertices", {16}, {32}, {64});
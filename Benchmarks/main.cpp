@@ -0,0 +1,48 @@
+/**
+ * main.cpp - Microbenchmark Entry Point
+ *
+ * OVERVIEW:
+ * Runs the component microbenchmarks registered in this directory.
+ * No window or GL context is created.
+ *
+ * COMMAND LINE:
+ * - --filter <text>     Run only benchmarks whose name contains <text>
+ *                       (e.g. --filter BM_PerlinOctaveNoise2D/4)
+ * - --min-time <sec>    Minimum calibrated run time per benchmark (default 0.5)
+ * - --json <file>       Also write results as JSON
+ * - --list              List benchmark names and exit
+ */
+
+#include "MicroBenchmark.h"
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv) {
+    Engine::Bench::RunOptions options;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+
+        if (arg == "--filter" && hasValue) {
+            options.filter = argv[++i];
+        } else if (arg == "--min-time" && hasValue) {
+            options.minTimeSeconds = std::atof(argv[++i]);
+        } else if (arg == "--json" && hasValue) {
+            options.jsonPath = argv[++i];
+        } else if (arg == "--list") {
+            options.listOnly = true;
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--filter text] [--min-time sec] [--json file] [--list]" << std::endl;
+            return 2;
+        }
+    }
+
+    int ran = Engine::Bench::runBenchmarks(options);
+    if (ran == 0 && !options.listOnly) {
+        std::cerr << "No benchmark matched '" << options.filter << "'" << std::endl;
+        return 1;
+    }
+    return 0;
+}
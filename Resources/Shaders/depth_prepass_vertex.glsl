@@ -0,0 +1,30 @@
+/*
+ * DEPTH PREPASS VERTEX SHADER - Camera Depth for the Opaque Pass
+ * 
+ * PURPOSE:
+ * Writes the depth of opaque geometry before it is shaded. The shading pass
+ * then draws the same meshes with GL_EQUAL, so each pixel runs the lighting
+ * in the fragment shader only once. Paired with depth_map_fragment.glsl.
+ * 
+ * FEATURES:
+ * - Position math identical to vertex.glsl, terrain_vertex.glsl and
+ *   lighting_vertex.glsl, all declaring invariant gl_Position, so the
+ *   depths of both passes are bit-identical
+ * - Position attribute only; works with every Mesh vertex layout
+ */
+
+#version 330 core
+layout (location = 0) in vec3 aPos;    // Vertex position attribute
+
+// Transformation matrices (same uniforms as the shading shaders)
+uniform mat4 model;
+uniform mat4 view;
+uniform mat4 projection;
+
+invariant gl_Position;
+
+void main()
+{
+    vec4 worldPos = model * vec4(aPos, 1.0);
+    gl_Position = projection * view * worldPos;
+}
@@ -0,0 +1,38 @@
+#version 330 core
+in vec2 TexCoord;
+flat in float ViewIndex;
+flat in float Fade;
+out vec4 FragColor;
+
+uniform sampler2D atlas;
+uniform float viewCount;
+uniform float atlasColumns;
+uniform float atlasRows;
+
+// 4x4 ordered dither thresholds in (0, 1)
+const float BAYER[16] = float[16](
+     0.5 / 16.0,  8.5 / 16.0,  2.5 / 16.0, 10.5 / 16.0,
+    12.5 / 16.0,  4.5 / 16.0, 14.5 / 16.0,  6.5 / 16.0,
+     3.5 / 16.0, 11.5 / 16.0,  1.5 / 16.0,  9.5 / 16.0,
+    15.5 / 16.0,  7.5 / 16.0, 13.5 / 16.0,  5.5 / 16.0);
+
+vec4 sampleView(float index)
+{
+    vec2 cell = vec2(mod(index, atlasColumns), floor(index / atlasColumns));
+    return texture(atlas, (cell + TexCoord) / vec2(atlasColumns, atlasRows));
+}
+
+void main()
+{
+    float first = floor(ViewIndex);
+    vec4 color = mix(sampleView(first), sampleView(mod(first + 1.0, viewCount)), ViewIndex - first);
+
+    // Screen-door crossfade with the mesh: the impostor stays opaque and depth-written
+    ivec2 pixel = ivec2(gl_FragCoord.xy) & 3;
+    if (color.a < 0.5 || Fade <= BAYER[pixel.y * 4 + pixel.x]) {
+        discard;
+    }
+
+    // Silhouette texels were filtered against the transparent black background
+    FragColor = vec4(color.rgb / color.a, 1.0);
+}
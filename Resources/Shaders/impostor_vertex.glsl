@@ -0,0 +1,40 @@
+#version 330 core
+// Upright camera-facing quad per monster; strip corners come from gl_VertexID (no quad buffer)
+layout (location = 0) in vec4 aPositionYaw;  // xyz = feet, w = yaw (radians, as rotateY applies it)
+layout (location = 1) in vec2 aScaleFade;    // x = uniform model scale, y = dither coverage
+
+uniform mat4 view;
+uniform mat4 projection;
+uniform vec3 cameraPosition;
+uniform float frameCenterHeight;  // Model space, baked frame centre above the feet
+uniform float frameHalfExtent;    // Model space, half size of the square frame
+uniform float viewCount;
+
+out vec2 TexCoord;
+flat out float ViewIndex;  // Fractional baked view: blend floor and floor + 1
+flat out float Fade;
+
+void main()
+{
+    vec2 corner = vec2(gl_VertexID & 1, (gl_VertexID >> 1) & 1);
+    TexCoord = corner;
+    Fade = aScaleFade.y;
+
+    float scale = aScaleFade.x;
+    vec3 center = aPositionYaw.xyz + vec3(0.0, frameCenterHeight * scale, 0.0);
+
+    // Direction to the camera on the ground plane; the quad turns only around +Y
+    vec2 toCamera = cameraPosition.xz - center.xz;
+    float toCameraLength = length(toCamera);
+    vec2 direction = toCameraLength > 0.0001 ? toCamera / toCameraLength : vec2(0.0, 1.0);
+    vec3 right = vec3(direction.y, 0.0, -direction.x);
+
+    // The bake looked along -Z at views turned by k/viewCount; seen from this
+    // direction the monster shows the view turned by (yaw - camera angle)
+    float cameraAngle = atan(-direction.x, direction.y);
+    ViewIndex = fract((aPositionYaw.w - cameraAngle) / 6.28318530718) * viewCount;
+
+    float halfSize = frameHalfExtent * scale;
+    vec3 worldPosition = center + right * ((corner.x * 2.0 - 1.0) * halfSize) + vec3(0.0, (corner.y * 2.0 - 1.0) * halfSize, 0.0);
+    gl_Position = projection * view * vec4(worldPosition, 1.0);
+}
@@ -39,16 +39,20 @@ out vec3 FragPos;        // World space position
 out vec3 Normal;         // World space normal
 out vec4 ShadowCoords[4]; // Shadow coordinates for each light
 
+// The lit pass tests GL_EQUAL against the depth written by depth_prepass_vertex.glsl
+invariant gl_Position;
+
 void main()
 {
     // Transform position to world space
-    FragPos = vec3(model * vec4(aPos, 1.0));
+    vec4 worldPos = model * vec4(aPos, 1.0);
+    FragPos = worldPos.xyz;
     
     // Transform normal to world space using normal matrix
     Normal = normalMatrix * aNormal;
     
     // Transform to clip space
-    gl_Position = projection * view * vec4(FragPos, 1.0);
+    gl_Position = projection * view * worldPos;
     
     // Calculate shadow coordinates for each light
     for (int i = 0; i < numLightSpaceMatrices && i < 4; i++) {
@@ -0,0 +1,14 @@
+#version 330 core
+in vec2 TexCoord;
+in vec4 Color;
+out vec4 FragColor;
+
+uniform sampler2D sprite;
+
+void main()
+{
+    FragColor = texture(sprite, TexCoord) * Color;
+    if (FragColor.a < 0.004) {
+        discard; // Keep fully faded texels out of the blend
+    }
+}
@@ -0,0 +1,26 @@
+#version 330 core
+// Expands each particle point into a camera-facing quad (same output as particle_vertex.glsl)
+layout (points) in;
+layout (triangle_strip, max_vertices = 4) out;
+
+in vec4 vColor[];
+in float vSize[];
+
+uniform mat4 projection;
+
+out vec2 TexCoord;
+out vec4 Color;
+
+void main()
+{
+    for (int i = 0; i < 4; i++) {
+        vec2 corner = vec2(i & 1, (i >> 1) & 1);
+        vec4 viewPosition = gl_in[0].gl_Position;
+        viewPosition.xy += (corner - 0.5) * vSize[0];
+        TexCoord = corner;
+        Color = vColor[0];
+        gl_Position = projection * viewPosition;
+        EmitVertex();
+    }
+    EndPrimitive();
+}
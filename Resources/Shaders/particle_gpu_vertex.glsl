@@ -0,0 +1,24 @@
+#version 330 core
+// Draws GPU-simulated particles straight from the transform feedback buffer
+layout (location = 0) in vec3 aPosition;
+layout (location = 2) in float aAge;
+layout (location = 3) in float aLifetime;
+
+uniform mat4 view;
+uniform vec3 colorStart;
+uniform vec3 colorEnd;
+uniform float alphaStart;
+uniform float alphaEnd;
+uniform float sizeStart;
+uniform float sizeEnd;
+
+out vec4 vColor;
+out float vSize;
+
+void main()
+{
+    float t = clamp(aAge / aLifetime, 0.0, 1.0);
+    vColor = vec4(mix(colorStart, colorEnd, t), mix(alphaStart, alphaEnd, t));
+    vSize = mix(sizeStart, sizeEnd, t);
+    gl_Position = view * vec4(aPosition, 1.0); // View space, expanded by the geometry stage
+}
@@ -0,0 +1,84 @@
+#version 330 core
+// GPU particle update, captured with transform feedback (rasterizer discarded).
+// Live particles (lifetime > 0) are integrated and written back, expired ones are
+// simply not emitted. Burst records (lifetime = -count, age = 24-bit seed, velocity =
+// emit direction) expand into up to MAX_BURST new particles.
+layout (points) in;
+layout (points, max_vertices = 64) out;
+
+const int MAX_BURST = 64;
+const float TWO_PI = 6.28318530718;
+
+in vec3 vPosition[];
+in vec3 vVelocity[];
+in float vAge[];
+in float vLifetime[];
+
+out vec3 outPosition;
+out vec3 outVelocity;
+out float outAge;
+out float outLifetime;
+
+uniform float deltaTime;
+uniform float damping;      // 1 / (1 + drag * deltaTime)
+uniform float gravityStep;  // gravity * deltaTime
+uniform float lifetimeMin;
+uniform float lifetimeMax;
+uniform float speedMin;
+uniform float speedMax;
+uniform float minCosine;    // cos(spread)
+
+uint hash(uint x)
+{
+    x ^= x >> 16;
+    x *= 0x7feb352du;
+    x ^= x >> 15;
+    x *= 0x846ca68bu;
+    x ^= x >> 16;
+    return x;
+}
+
+float random(inout uint state)
+{
+    state = hash(state);
+    return float(state >> 8) * (1.0 / 16777216.0);
+}
+
+void main()
+{
+    if (vLifetime[0] > 0.0) {
+        float age = vAge[0] + deltaTime;
+        if (age >= vLifetime[0]) {
+            return; // Expired: dropped from the output buffer
+        }
+        vec3 velocity = vVelocity[0] * damping - vec3(0.0, gravityStep, 0.0);
+        outPosition = vPosition[0] + velocity * deltaTime;
+        outVelocity = velocity;
+        outAge = age;
+        outLifetime = vLifetime[0];
+        EmitVertex();
+        EndPrimitive();
+        return;
+    }
+
+    // Burst: orthonormal basis around the emit direction, samples uniform over the cone
+    vec3 axis = length(vVelocity[0]) > 1e-6 ? normalize(vVelocity[0]) : vec3(0.0, 1.0, 0.0);
+    vec3 reference = abs(axis.y) < 0.99 ? vec3(0.0, 1.0, 0.0) : vec3(1.0, 0.0, 0.0);
+    vec3 tangent = normalize(cross(axis, reference));
+    vec3 bitangent = cross(axis, tangent);
+    int count = min(int(-vLifetime[0]), MAX_BURST);
+    uint state = hash(uint(vAge[0]) + 1u);
+
+    for (int i = 0; i < count; i++) {
+        float cosTheta = mix(minCosine, 1.0, random(state));
+        float sinTheta = sqrt(max(0.0, 1.0 - cosTheta * cosTheta));
+        float phi = random(state) * TWO_PI;
+        float speed = mix(speedMin, speedMax, random(state));
+        outPosition = vPosition[0];
+        outVelocity = (tangent * (cos(phi) * sinTheta) + bitangent * (sin(phi) * sinTheta) + axis * cosTheta) * speed;
+        outAge = 0.0;
+        outLifetime = max(1e-3, mix(lifetimeMin, lifetimeMax, random(state)));
+        EmitVertex();
+        EndPrimitive();
+    }
+}
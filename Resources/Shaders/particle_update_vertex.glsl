@@ -0,0 +1,19 @@
+#version 330 core
+// GPU particle update: passes each particle (or burst record) to the geometry stage
+layout (location = 0) in vec3 aPosition;
+layout (location = 1) in vec3 aVelocity;
+layout (location = 2) in float aAge;
+layout (location = 3) in float aLifetime;
+
+out vec3 vPosition;
+out vec3 vVelocity;
+out float vAge;
+out float vLifetime;
+
+void main()
+{
+    vPosition = aPosition;
+    vVelocity = aVelocity;
+    vAge = aAge;
+    vLifetime = aLifetime;
+}
@@ -0,0 +1,22 @@
+#version 330 core
+// Camera-facing quad per instance; strip corners come from gl_VertexID (no quad buffer)
+layout (location = 0) in vec4 aPositionSize; // xyz = world centre, w = size
+layout (location = 1) in vec4 aColor;        // RGBA8, normalized
+
+uniform mat4 view;
+uniform mat4 projection;
+
+out vec2 TexCoord;
+out vec4 Color;
+
+void main()
+{
+    vec2 corner = vec2(gl_VertexID & 1, (gl_VertexID >> 1) & 1);
+    TexCoord = corner;
+    Color = aColor;
+
+    // Expand in view space so the quad always faces the camera
+    vec4 viewPosition = view * vec4(aPositionSize.xyz, 1.0);
+    viewPosition.xy += (corner - 0.5) * aPositionSize.w;
+    gl_Position = projection * viewPosition;
+}
@@ -7,7 +7,7 @@
  * 
  * FEATURES:
  * - Phong lighting model
- * - Shadow mapping with PCF filtering
+ * - Shadow mapping with hardware PCF (sampler2DShadow) and selectable tap kernels
  * - Support for multiple light sources
  * - Shadow bias to prevent shadow acne
  */
@@ -66,11 +66,38 @@ uniform int numPointLights;
 uniform int numAmbientLights;
 
 // Shadow mapping uniforms
-uniform sampler2D shadowMap;
+uniform sampler2DShadow shadowMap;  // Depth texture with GL_TEXTURE_COMPARE_MODE: each tap is a bilinear 2x2 PCF
 uniform float shadowBias;
 uniform float shadowBiasMin;
 uniform float shadowBiasMax;
 uniform int numLightSpaceMatrices;
+uniform int shadowKernel;           // 0: 1 tap, 1: 2x2, 2: 3x3, 3: 4x4 taps, 4: 16-tap Poisson disk
+uniform float shadowFilterRadius;   // Texels between taps (grids) or disk radius (Poisson)
+
+// Unit-disk Poisson samples for the Poisson kernel
+const vec2 poissonDisk[16] = vec2[](
+    vec2(-0.94201624, -0.39906216), vec2( 0.94558609, -0.76890725),
+    vec2(-0.09418410, -0.92938870), vec2( 0.34495938,  0.29387760),
+    vec2(-0.91588581,  0.45771432), vec2(-0.81544232, -0.87912464),
+    vec2(-0.38277543,  0.27676845), vec2( 0.97484398,  0.75648379),
+    vec2( 0.44323325, -0.97511554), vec2( 0.53742981, -0.47373420),
+    vec2(-0.26496911, -0.41893023), vec2( 0.79197514,  0.19090188),
+    vec2(-0.24188840,  0.99706507), vec2(-0.81409955,  0.91437590),
+    vec2( 0.19984126,  0.78641367), vec2( 0.14383161, -0.14100790)
+);
+
+// Mean of an n x n grid of hardware-filtered taps centred on the fragment
+float sampleShadowGrid(vec3 coords, vec2 texelStep, int n) {
+    float lit = 0.0;
+    float start = -0.5 * float(n - 1);
+    for (int y = 0; y < n; y++) {
+        for (int x = 0; x < n; x++) {
+            vec2 offset = vec2(start + float(x), start + float(y)) * texelStep;
+            lit += texture(shadowMap, vec3(coords.xy + offset, coords.z));
+        }
+    }
+    return lit / float(n * n);
+}
 
 // Shadow calculation function
 float calculateShadow(vec4 fragPosLightSpace, int lightIndex) {
@@ -85,19 +112,27 @@ float calculateShadow(vec4 fragPosLightSpace, int lightIndex) {
     // Check if fragment is outside light frustum
     if (projCoords.z > 1.0) return 0.0;
     
-    // Get closest depth from light's perspective
-    float closestDepth = texture(shadowMap, projCoords.xy).r;
-    
-    // Get current depth
-    float currentDepth = projCoords.z;
-    
     // Calculate shadow bias based on surface normal
     float bias = max(shadowBiasMax * (1.0 - dot(normalize(Normal), normalize(directionalLights[lightIndex].direction))), shadowBiasMin);
     
-    // Check whether current frag pos is in shadow
-    float shadow = currentDepth - bias > closestDepth ? 1.0 : 0.0;
+    // The comparison happens in the texture unit: texture() returns the lit
+    // fraction of the four texels around the tap, already bilinearly weighted
+    vec3 coords = vec3(projCoords.xy, projCoords.z - bias);
+    vec2 texelStep = shadowFilterRadius / vec2(textureSize(shadowMap, 0));
+    float lit;
+    if (shadowKernel == 4) {
+        lit = 0.0;
+        for (int i = 0; i < 16; i++) {
+            lit += texture(shadowMap, vec3(coords.xy + poissonDisk[i] * texelStep, coords.z));
+        }
+        lit /= 16.0;
+    } else if (shadowKernel > 0) {
+        lit = sampleShadowGrid(coords, texelStep, shadowKernel + 1);
+    } else {
+        lit = texture(shadowMap, coords);
+    }
     
-    return shadow;
+    return 1.0 - lit;
 }
 
 // Lighting calculation functions
@@ -33,6 +33,9 @@ uniform mat4 projection; // Camera-to-clip transformation
 out vec3 outPos;         // World position for fragment shader
 out vec3 outNormal;      // World normal for fragment shader
 
+// Terrain is shaded with GL_EQUAL against the prepass depth; keep in step with depth_prepass_vertex.glsl
+invariant gl_Position;
+
 void main()
 {
     // Apply complete MVP transformation pipeline
@@ -0,0 +1,35 @@
+#version 330 core
+in vec2 TexCoord;
+out vec4 FragColor;
+
+uniform sampler2D sceneTexture;
+uniform vec2 uvScale;    // Fraction of the texture holding the scaled render
+uniform vec2 texelSize;  // 1.0 / full texture size
+uniform float sharpness; // 0 = plain bilinear, 1 = strongest
+
+// Keep taps inside the rendered sub-rectangle so nothing bleeds in from stale texels
+vec3 sampleScene(vec2 uv)
+{
+    vec2 maxUV = uvScale - 0.5 * texelSize;
+    return texture(sceneTexture, clamp(uv, 0.5 * texelSize, maxUV)).rgb;
+}
+
+void main()
+{
+    vec3 center = sampleScene(TexCoord);
+    vec3 north  = sampleScene(TexCoord + vec2(0.0, texelSize.y));
+    vec3 south  = sampleScene(TexCoord - vec2(0.0, texelSize.y));
+    vec3 east   = sampleScene(TexCoord + vec2(texelSize.x, 0.0));
+    vec3 west   = sampleScene(TexCoord - vec2(texelSize.x, 0.0));
+
+    // Contrast-adaptive sharpening: weaker where local contrast is already high
+    vec3 minColor = min(center, min(min(north, south), min(east, west)));
+    vec3 maxColor = max(center, max(max(north, south), max(east, west)));
+    vec3 headroom = min(minColor, 1.0 - maxColor) / max(maxColor, vec3(0.0001));
+    vec3 amount = sqrt(clamp(headroom, 0.0, 1.0)) * mix(0.0, 0.2, sharpness);
+
+    vec3 sharpened = center + (4.0 * center - north - south - east - west) * amount;
+
+    // Clamp to the neighbourhood so sharpening cannot produce halos
+    FragColor = vec4(clamp(sharpened, minColor, maxColor), 1.0);
+}
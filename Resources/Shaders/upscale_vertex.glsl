@@ -0,0 +1,13 @@
+#version 330 core
+// Fullscreen triangle generated from gl_VertexID (no vertex buffer)
+
+uniform vec2 uvScale; // Fraction of the scene target covered by the scaled render
+
+out vec2 TexCoord;
+
+void main()
+{
+    vec2 position = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+    TexCoord = position * uvScale;
+    gl_Position = vec4(position * 2.0 - 1.0, 0.0, 1.0);
+}
@@ -36,6 +36,9 @@ uniform mat4 projection; // Camera-to-clip transformation
 out vec3 outPos;
 out vec2 outTexCoord;
 
+// Bit-identical to depth_prepass_vertex.glsl (shaded with GL_EQUAL after the depth prepass)
+invariant gl_Position;
+
 void main()
 {
     // Apply complete MVP transformation pipeline
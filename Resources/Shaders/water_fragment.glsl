@@ -5,6 +5,7 @@ in vec2 TexCoord;
 in vec3 toCameraVector;
 in vec3 fromLightVector;
 in vec3 worldPosition;
+in vec3 waveNormal;
 
 out vec4 FragColor;
 
@@ -20,6 +21,9 @@ uniform float distortionScale;
 uniform float shineDamper;
 uniform float reflectivity;
 uniform float waterHeight;
+uniform float cameraNear;
+uniform float cameraFar;
+uniform bool reverseDepth;  // Depth stored as near / distance (infinite far plane)
 
 // Water parameters
 const float WAVE_SPEED = 0.03;
@@ -28,6 +32,15 @@ const float REFLECTIVITY = 0.6;
 const vec3 lightColor = vec3(1.0, 1.0, 1.0);
 const vec3 waterColor = vec3(0.0, 0.3, 0.5);
 
+// Window-space depth back to distance along the view axis
+float linearizeDepth(float depth)
+{
+    if (reverseDepth) {
+        return cameraNear / max(depth, 1e-7);
+    }
+    return 2.0 * cameraNear * cameraFar / (cameraFar + cameraNear - (2.0 * depth - 1.0) * (cameraFar - cameraNear));
+}
+
 void main()
 {
     // Calculate texture coordinates for reflection/refraction
@@ -36,13 +49,8 @@ void main()
     vec2 refractionTexCoord = vec2(ndc.x, ndc.y);
 
     // Calculate depth for transparency
-    float near = 0.01;
-    float far = 1000.0;
-    float depth = texture(depthMap, refractionTexCoord).r;
-    float floorDistance = 2.0 * near * far / (far + near - (2.0 * depth - 1.0) * (far - near));
-
-    depth = gl_FragCoord.z;
-    float waterDistance = 2.0 * near * far / (far + near - (2.0 * depth - 1.0) * (far - near));
+    float floorDistance = linearizeDepth(texture(depthMap, refractionTexCoord).r);
+    float waterDistance = linearizeDepth(gl_FragCoord.z);
 
     float waterDepth = floorDistance - waterDistance;
 
@@ -63,14 +71,14 @@ void main()
     vec4 reflectColor = texture(reflectionTexture, reflectionTexCoord);
     vec4 refractColor = texture(refractionTexture, refractionTexCoord);
 
-    // Sample normal map and calculate normal
+    // Sample normal map and calculate normal: map detail tilts the Gerstner surface normal
     vec4 normalMapColor = texture(normalMap, distortedTexCoords);
-    vec3 normal = vec3(normalMapColor.r * 2.0 - 1.0, normalMapColor.b, normalMapColor.g * 2.0 - 1.0);
-    normal = normalize(normal);
+    vec3 detail = vec3(normalMapColor.r * 2.0 - 1.0, normalMapColor.b, normalMapColor.g * 2.0 - 1.0);
+    vec3 normal = normalize(waveNormal * detail.y + vec3(detail.x, 0.0, detail.z));
 
-    // Calculate Fresnel effect (reflection vs refraction based on view angle)
+    // Calculate Fresnel effect (reflection vs refraction based on view angle against the wave slope)
     vec3 viewVector = normalize(toCameraVector);
-    float refractiveFactor = dot(viewVector, vec3(0.0, 1.0, 0.0));
+    float refractiveFactor = max(dot(viewVector, normalize(waveNormal)), 0.0);
     refractiveFactor = pow(refractiveFactor, 0.75);
 
     // Calculate specular highlights
@@ -1,49 +1,80 @@
 #version 330 core
 
-layout (location = 0) in vec3 position;
-layout (location = 1) in vec3 normal;
-layout (location = 2) in vec2 texCoord;
+// Camera-following polar grid: rings at geometrically growing radii, so the
+// vertex spacing grows with distance like the screen area it covers and the
+// vertex count stays the same wherever the camera goes
+layout (location = 0) in vec3 position; // Offset from the grid origin on the XZ plane (y = 0)
 
 out vec4 clipSpace;
 out vec2 TexCoord;
 out vec3 toCameraVector;
 out vec3 fromLightVector;
 out vec3 worldPosition;
+out vec3 waveNormal;
 
-uniform mat4 model;
 uniform mat4 view;
 uniform mat4 projection;
 uniform vec3 cameraPosition;
 uniform float time;
 uniform float waterHeight;
 
+// Grid placement (WaterRenderer::setSurfaceGrid)
+uniform vec2 gridOrigin;        // Camera XZ snapped to the inner spacing
+uniform float gridInnerSpacing; // Ring spacing at the centre
+uniform float gridGrowth;       // Spacing at radius r is gridInnerSpacing + gridGrowth * r
+
+// Gerstner wave set (WaterRenderer::MAX_WAVES)
+const int MAX_WAVES = 8;
+struct GerstnerWave {
+    vec2 direction;     // Unit travel direction
+    float amplitude;
+    float wavenumber;   // 2 pi / wavelength
+    float angularSpeed; // Deep water: sqrt(g * wavenumber)
+    float sharpness;    // Horizontal pull towards the crests (Q / (k A) share)
+};
+uniform GerstnerWave waves[MAX_WAVES];
+uniform int waveCount;
+
 // Light direction (can be made uniform later)
 vec3 lightDir = normalize(vec3(-1.0, -1.0, -1.0));
 
-// Water parameters
-const float tiling = 8.0;
-const float waveAmplitude = 0.8;
-const float waveFrequency = 0.2;
+// Normal/DuDv map repeats: 8 tiles over 1000 m, as on the former fixed plane
+const float tiling = 8.0 / 1000.0;
 
 void main() 
 {
-    // First calculate the base world position without wave animation
-    vec3 baseWorldPosition = vec3(model * vec4(position, 1.0));
+    vec2 ground = gridOrigin + position.xz;
+    
+    // Waves shorter than a few vertex spacings fade out instead of aliasing
+    float spacing = gridInnerSpacing + gridGrowth * length(position.xz);
     
-    // Apply water height offset
-    baseWorldPosition.y += waterHeight;
+    vec3 displacement = vec3(0.0);
+    vec3 normal = vec3(0.0, 1.0, 0.0);
+    for (int i = 0; i < waveCount; i++) {
+        float wavelength = 6.28318530718 / waves[i].wavenumber;
+        float amplitude = waves[i].amplitude * smoothstep(2.0 * spacing, 4.0 * spacing, wavelength);
+        float phase = waves[i].wavenumber * dot(waves[i].direction, ground) - waves[i].angularSpeed * time;
+        float c = cos(phase);
+        float s = sin(phase);
+        
+        displacement.xz += waves[i].direction * (waves[i].sharpness * amplitude * c);
+        displacement.y += amplitude * s;
+        
+        // Analytic normal of the summed surface
+        float ka = waves[i].wavenumber * amplitude;
+        normal.xz -= waves[i].direction * (ka * c);
+        normal.y -= waves[i].sharpness * ka * s;
+    }
+    waveNormal = normalize(normal);
     
-    // Apply wave animation in world space (using world X coordinate)
-    float wave = sin(baseWorldPosition.x * waveFrequency + time) * waveAmplitude;
-    worldPosition = baseWorldPosition;
-    worldPosition.y += wave;
+    worldPosition = vec3(ground.x, waterHeight, ground.y) + displacement;
     
     // Calculate clip space position
     clipSpace = projection * view * vec4(worldPosition, 1.0);
     gl_Position = clipSpace;
 
-    // Apply tiling to texture coordinates
-    TexCoord = texCoord * tiling;
+    // World-space texture coordinates keep the detail maps fixed to the water, not the grid
+    TexCoord = ground * tiling;
     
     // Calculate vectors for lighting and reflection
     toCameraVector = cameraPosition - worldPosition;
@@ -0,0 +1,235 @@
+/**
+ * AudioSink.cpp - Implementation of the Mixer Output Endpoints
+ */
+
+#include "AudioSink.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <mmsystem.h>
+#ifdef _MSC_VER
+#pragma comment(lib, "winmm.lib")
+#endif
+#endif
+
+namespace Engine {
+
+void convertToPcm16(const float* samples, size_t count, int16_t* out) {
+    for (size_t i = 0; i < count; i++) {
+        float value = std::max(-1.0f, std::min(1.0f, samples[i]));
+        out[i] = static_cast<int16_t>(value * 32767.0f);
+    }
+}
+
+// ===== NullAudioSink =====
+
+NullAudioSink::NullAudioSink(bool realTimePacing)
+    : realTime(realTimePacing), bufferDuration(0) {
+}
+
+bool NullAudioSink::open(int sampleRate, int channels, int framesPerBuffer) {
+    (void)channels;
+    bufferDuration = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(static_cast<double>(framesPerBuffer) / sampleRate));
+    nextDeadline = std::chrono::steady_clock::now();
+    return true;
+}
+
+void NullAudioSink::write(const float* samples, int frames) {
+    (void)samples;
+    (void)frames;
+    if (!realTime) return;
+
+    // Absolute deadlines so sleep overshoot does not accumulate
+    nextDeadline += bufferDuration;
+    auto now = std::chrono::steady_clock::now();
+    if (nextDeadline < now) {
+        nextDeadline = now; // Fell behind (debugger, suspend) - do not race to catch up
+        return;
+    }
+    std::this_thread::sleep_until(nextDeadline);
+}
+
+// ===== WavFileAudioSink =====
+
+namespace {
+
+void writeU32(std::FILE* file, uint32_t value) { std::fwrite(&value, sizeof(value), 1, file); }
+void writeU16(std::FILE* file, uint16_t value) { std::fwrite(&value, sizeof(value), 1, file); }
+
+} // namespace
+
+WavFileAudioSink::WavFileAudioSink(const std::string& outputPath, bool realTime)
+    : path(outputPath), file(nullptr), channels(2), dataBytes(0), pacer(realTime) {
+}
+
+WavFileAudioSink::~WavFileAudioSink() {
+    close();
+}
+
+bool WavFileAudioSink::open(int sampleRate, int channelCount, int framesPerBuffer) {
+    close();
+    file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+        std::cerr << "Audio: cannot write " << path << std::endl;
+        return false;
+    }
+    channels = channelCount;
+    dataBytes = 0;
+    pcm.resize(static_cast<size_t>(framesPerBuffer) * channels);
+
+    // RIFF sizes are patched in close()
+    std::fwrite("RIFF", 1, 4, file);
+    writeU32(file, 0);
+    std::fwrite("WAVEfmt ", 1, 8, file);
+    writeU32(file, 16);
+    writeU16(file, 1); // PCM
+    writeU16(file, static_cast<uint16_t>(channels));
+    writeU32(file, static_cast<uint32_t>(sampleRate));
+    writeU32(file, static_cast<uint32_t>(sampleRate * channels * 2));
+    writeU16(file, static_cast<uint16_t>(channels * 2));
+    writeU16(file, 16);
+    std::fwrite("data", 1, 4, file);
+    writeU32(file, 0);
+
+    return pacer.open(sampleRate, channels, framesPerBuffer);
+}
+
+void WavFileAudioSink::write(const float* samples, int frames) {
+    if (!file) return;
+    size_t count = static_cast<size_t>(frames) * channels;
+    if (pcm.size() < count) pcm.resize(count);
+    convertToPcm16(samples, count, pcm.data());
+    std::fwrite(pcm.data(), sizeof(int16_t), count, file);
+    dataBytes += static_cast<uint32_t>(count * sizeof(int16_t));
+    pacer.write(samples, frames);
+}
+
+void WavFileAudioSink::close() {
+    if (!file) return;
+    std::fseek(file, 4, SEEK_SET);
+    writeU32(file, 36 + dataBytes);
+    std::fseek(file, 40, SEEK_SET);
+    writeU32(file, dataBytes);
+    std::fclose(file);
+    file = nullptr;
+}
+
+// ===== WaveOutAudioSink =====
+
+#ifdef _WIN32
+
+namespace {
+
+/**
+ * WaveOutAudioSink - waveOut device fed from a small ring of buffers
+ *
+ * write() waits on the device's completion event until the oldest buffer
+ * has played, so the queue depth (BUFFER_COUNT buffers) is the output
+ * latency on top of the mixer's own buffer.
+ */
+class WaveOutAudioSink : public AudioSink {
+private:
+    static const int BUFFER_COUNT = 3;
+
+    HWAVEOUT device;
+    HANDLE doneEvent;
+    WAVEHDR headers[BUFFER_COUNT];
+    std::vector<int16_t> buffers[BUFFER_COUNT];
+    int nextBuffer;
+    int channels;
+
+public:
+    WaveOutAudioSink() : device(nullptr), doneEvent(nullptr), nextBuffer(0), channels(2) {
+        std::memset(headers, 0, sizeof(headers));
+    }
+    ~WaveOutAudioSink() override { close(); }
+
+    bool open(int sampleRate, int channelCount, int framesPerBuffer) override {
+        channels = channelCount;
+        doneEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+        if (!doneEvent) return false;
+
+        WAVEFORMATEX format = {};
+        format.wFormatTag = WAVE_FORMAT_PCM;
+        format.nChannels = static_cast<WORD>(channels);
+        format.nSamplesPerSec = static_cast<DWORD>(sampleRate);
+        format.wBitsPerSample = 16;
+        format.nBlockAlign = static_cast<WORD>(channels * 2);
+        format.nAvgBytesPerSec = format.nSamplesPerSec * format.nBlockAlign;
+        if (waveOutOpen(&device, WAVE_MAPPER, &format, reinterpret_cast<DWORD_PTR>(doneEvent), 0, CALLBACK_EVENT) != MMSYSERR_NOERROR) {
+            device = nullptr;
+            CloseHandle(doneEvent);
+            doneEvent = nullptr;
+            return false;
+        }
+
+        for (int i = 0; i < BUFFER_COUNT; i++) {
+            buffers[i].assign(static_cast<size_t>(framesPerBuffer) * channels, 0);
+            std::memset(&headers[i], 0, sizeof(WAVEHDR));
+            headers[i].lpData = reinterpret_cast<LPSTR>(buffers[i].data());
+            headers[i].dwBufferLength = static_cast<DWORD>(buffers[i].size() * sizeof(int16_t));
+            waveOutPrepareHeader(device, &headers[i], sizeof(WAVEHDR));
+            headers[i].dwFlags |= WHDR_DONE; // Free until first written
+        }
+        nextBuffer = 0;
+        return true;
+    }
+
+    void write(const float* samples, int frames) override {
+        if (!device) return;
+        WAVEHDR& header = headers[nextBuffer];
+        while (!(header.dwFlags & WHDR_DONE)) {
+            WaitForSingleObject(doneEvent, 100);
+        }
+
+        size_t count = static_cast<size_t>(frames) * channels;
+        std::vector<int16_t>& buffer = buffers[nextBuffer];
+        if (count > buffer.size()) count = buffer.size();
+        convertToPcm16(samples, count, buffer.data());
+        header.dwBufferLength = static_cast<DWORD>(count * sizeof(int16_t));
+        header.dwFlags &= ~WHDR_DONE;
+        waveOutWrite(device, &header, sizeof(WAVEHDR));
+        nextBuffer = (nextBuffer + 1) % BUFFER_COUNT;
+    }
+
+    void close() override {
+        if (device) {
+            waveOutReset(device); // Marks every queued buffer done
+            for (int i = 0; i < BUFFER_COUNT; i++) {
+                waveOutUnprepareHeader(device, &headers[i], sizeof(WAVEHDR));
+            }
+            waveOutClose(device);
+            device = nullptr;
+        }
+        if (doneEvent) {
+            CloseHandle(doneEvent);
+            doneEvent = nullptr;
+        }
+    }
+
+    const char* getName() const override { return "waveout"; }
+};
+
+} // namespace
+
+std::unique_ptr<AudioSink> createDeviceAudioSink() {
+    return std::make_unique<WaveOutAudioSink>();
+}
+
+#else
+
+std::unique_ptr<AudioSink> createDeviceAudioSink() {
+    return nullptr; // No output device backend on this platform yet
+}
+
+#endif
+
+} // namespace Engine
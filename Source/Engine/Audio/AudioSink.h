@@ -0,0 +1,95 @@
+/**
+ * AudioSink.h - Output Endpoints for the Audio Mixer
+ *
+ * OVERVIEW:
+ * The mixer thread hands every finished buffer (interleaved stereo float)
+ * to an AudioSink. write() is also what paces the mixer: a device sink
+ * blocks until the device has room for another buffer, the null sink can
+ * sleep for one buffer's duration to stand in for a device, or return at
+ * once so benchmarks measure pure mixing throughput.
+ *
+ * SINKS:
+ * - NullAudioSink: discards samples (headless runs, benchmarks)
+ * - WavFileAudioSink: writes a 16-bit PCM .wav file (offline listening,
+ *   regression diffs)
+ * - WaveOutAudioSink: Windows waveOut device with a short buffer queue;
+ *   createDeviceAudioSink() returns null on other platforms
+ *
+ * THREADING:
+ * open() and close() are called by AudioSystem around the mixer thread;
+ * write() only ever runs on the mixer thread.
+ */
+
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Engine {
+
+/**
+ * AudioSink - Receives mixed buffers from the mixer thread
+ */
+class AudioSink {
+public:
+    virtual ~AudioSink() = default;
+
+    virtual bool open(int sampleRate, int channels, int framesPerBuffer) = 0;
+    // Interleaved samples in [-1, 1]; may block to pace the mixer
+    virtual void write(const float* samples, int frames) = 0;
+    virtual void close() = 0;
+
+    virtual const char* getName() const = 0;
+};
+
+/**
+ * NullAudioSink - Discards everything
+ */
+class NullAudioSink : public AudioSink {
+private:
+    bool realTime;
+    std::chrono::steady_clock::duration bufferDuration;
+    std::chrono::steady_clock::time_point nextDeadline;
+
+public:
+    // realTime = sleep one buffer per write, like a device would
+    explicit NullAudioSink(bool realTime = true);
+
+    bool open(int sampleRate, int channels, int framesPerBuffer) override;
+    void write(const float* samples, int frames) override;
+    void close() override {}
+    const char* getName() const override { return "null"; }
+};
+
+/**
+ * WavFileAudioSink - Records the mix to a 16-bit PCM .wav file
+ */
+class WavFileAudioSink : public AudioSink {
+private:
+    std::string path;
+    std::FILE* file;
+    int channels;
+    uint32_t dataBytes;
+    NullAudioSink pacer;
+    std::vector<int16_t> pcm;
+
+public:
+    WavFileAudioSink(const std::string& outputPath, bool realTime = true);
+    ~WavFileAudioSink() override;
+
+    bool open(int sampleRate, int channels, int framesPerBuffer) override;
+    void write(const float* samples, int frames) override;
+    void close() override; // Patches the RIFF sizes
+    const char* getName() const override { return "wav"; }
+};
+
+// Platform output device, or null if this platform has none built in
+std::unique_ptr<AudioSink> createDeviceAudioSink();
+
+// Float [-1, 1] to 16-bit PCM with clamping
+void convertToPcm16(const float* samples, size_t count, int16_t* out);
+
+} // namespace Engine
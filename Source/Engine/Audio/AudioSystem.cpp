@@ -0,0 +1,561 @@
+/**
+ * AudioSystem.cpp - Implementation of the Real-Time Mixer
+ */
+
+#include "AudioSystem.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define WW3_AUDIO_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace Engine {
+
+namespace {
+
+const float QUARTER_PI = 0.78539816340f;
+const float CENTER_GAIN = 0.70710678118f; // Constant-power centre
+const float SILENT_GAIN = 1.0e-5f;
+
+// Mixer threads get a real-time class where the OS allows it; without the
+// privilege (most Linux desktops) the call fails and the thread stays normal
+void raiseThreadPriority() {
+#ifdef _WIN32
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL);
+#else
+    sched_param param;
+    std::memset(&param, 0, sizeof(param));
+    param.sched_priority = sched_get_priority_min(SCHED_FIFO) + 1;
+    pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+#endif
+}
+
+// left/right += source * gain, gain ramping by step per frame
+void mixSpan(const float* source, int count, float gainLeft, float stepLeft, float gainRight, float stepRight,
+             float* left, float* right) {
+    int i = 0;
+#ifdef WW3_AUDIO_SSE2
+    const __m128 ramp = _mm_set_ps(3.0f, 2.0f, 1.0f, 0.0f);
+    __m128 gainL = _mm_add_ps(_mm_set1_ps(gainLeft), _mm_mul_ps(ramp, _mm_set1_ps(stepLeft)));
+    __m128 gainR = _mm_add_ps(_mm_set1_ps(gainRight), _mm_mul_ps(ramp, _mm_set1_ps(stepRight)));
+    const __m128 stepL4 = _mm_set1_ps(stepLeft * 4.0f);
+    const __m128 stepR4 = _mm_set1_ps(stepRight * 4.0f);
+    for (; i + 4 <= count; i += 4) {
+        __m128 sample = _mm_loadu_ps(source + i);
+        _mm_storeu_ps(left + i, _mm_add_ps(_mm_loadu_ps(left + i), _mm_mul_ps(sample, gainL)));
+        _mm_storeu_ps(right + i, _mm_add_ps(_mm_loadu_ps(right + i), _mm_mul_ps(sample, gainR)));
+        gainL = _mm_add_ps(gainL, stepL4);
+        gainR = _mm_add_ps(gainR, stepR4);
+    }
+#endif
+    for (; i < count; i++) {
+        float sample = source[i];
+        left[i] += sample * (gainLeft + stepLeft * i);
+        right[i] += sample * (gainRight + stepRight * i);
+    }
+}
+
+// Planar to interleaved stereo with master gain and clipping
+void writeInterleaved(const float* left, const float* right, int frames, float gain, float* output) {
+    int i = 0;
+#ifdef WW3_AUDIO_SSE2
+    const __m128 gainV = _mm_set1_ps(gain);
+    const __m128 upper = _mm_set1_ps(1.0f);
+    const __m128 lower = _mm_set1_ps(-1.0f);
+    for (; i + 4 <= frames; i += 4) {
+        __m128 l = _mm_min_ps(upper, _mm_max_ps(lower, _mm_mul_ps(_mm_loadu_ps(left + i), gainV)));
+        __m128 r = _mm_min_ps(upper, _mm_max_ps(lower, _mm_mul_ps(_mm_loadu_ps(right + i), gainV)));
+        _mm_storeu_ps(output + i * 2, _mm_unpacklo_ps(l, r));
+        _mm_storeu_ps(output + i * 2 + 4, _mm_unpackhi_ps(l, r));
+    }
+#endif
+    for (; i < frames; i++) {
+        output[i * 2] = std::max(-1.0f, std::min(1.0f, left[i] * gain));
+        output[i * 2 + 1] = std::max(-1.0f, std::min(1.0f, right[i] * gain));
+    }
+}
+
+uint16_t readU16(const uint8_t* bytes) { return static_cast<uint16_t>(bytes[0] | (bytes[1] << 8)); }
+uint32_t readU32(const uint8_t* bytes) {
+    return static_cast<uint32_t>(bytes[0]) | (static_cast<uint32_t>(bytes[1]) << 8) |
+           (static_cast<uint32_t>(bytes[2]) << 16) | (static_cast<uint32_t>(bytes[3]) << 24);
+}
+
+// One sample of a PCM/float frame as [-1, 1]
+float decodeSample(const uint8_t* bytes, int bits, bool isFloat) {
+    if (isFloat) {
+        float value;
+        std::memcpy(&value, bytes, sizeof(value));
+        return value;
+    }
+    switch (bits) {
+        case 8:  return (static_cast<int>(bytes[0]) - 128) / 128.0f;
+        case 16: return static_cast<int16_t>(readU16(bytes)) / 32768.0f;
+        case 24: {
+            uint32_t value = (static_cast<uint32_t>(bytes[0]) << 8) | (static_cast<uint32_t>(bytes[1]) << 16) |
+                             (static_cast<uint32_t>(bytes[2]) << 24);
+            return static_cast<int32_t>(value) / 2147483648.0f;
+        }
+        case 32: return static_cast<int32_t>(readU32(bytes)) / 2147483648.0f;
+        default: return 0.0f;
+    }
+}
+
+} // namespace
+
+const int AudioSystem::CHANNELS;
+
+AudioSystem::AudioSystem(const AudioConfig& audioConfig)
+    : config(audioConfig),
+      nextHandle(1),
+      commands(audioConfig.commandCapacity),
+      listenerPosition(0.0f, 0.0f, 0.0f),
+      listenerRight(1.0f, 0.0f, 0.0f),
+      masterGain(1.0f),
+      running(false),
+      buffersMixed(0),
+      totalMixNanos(0),
+      lastMixNanos(0),
+      maxMixNanos(0),
+      activeVoiceCount(0),
+      voicesStolen(0),
+      playsDropped(0) {
+    voices.resize(static_cast<size_t>(std::max(1, config.maxVoices)));
+    mixLeft.resize(static_cast<size_t>(config.framesPerBuffer));
+    mixRight.resize(static_cast<size_t>(config.framesPerBuffer));
+}
+
+AudioSystem::~AudioSystem() {
+    shutdown();
+}
+
+// ===== Sound bank =====
+
+SoundId AudioSystem::loadSound(const std::string& name, const std::string& path) {
+    SoundId existing = findSound(name);
+    if (existing >= 0) return existing;
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return -1;
+    std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (bytes.size() < 12 || std::memcmp(bytes.data(), "RIFF", 4) != 0 || std::memcmp(bytes.data() + 8, "WAVE", 4) != 0) {
+        std::cerr << "Audio: " << path << " is not a RIFF/WAVE file" << std::endl;
+        return -1;
+    }
+
+    int format = 0, channels = 0, sampleRate = 0, bits = 0;
+    const uint8_t* data = nullptr;
+    size_t dataSize = 0;
+    size_t offset = 12;
+    while (offset + 8 <= bytes.size()) {
+        const uint8_t* chunk = bytes.data() + offset;
+        size_t chunkSize = readU32(chunk + 4);
+        size_t body = offset + 8;
+        chunkSize = std::min(chunkSize, bytes.size() - body);
+        if (std::memcmp(chunk, "fmt ", 4) == 0 && chunkSize >= 16) {
+            format = readU16(chunk + 8);
+            channels = readU16(chunk + 10);
+            sampleRate = static_cast<int>(readU32(chunk + 12));
+            bits = readU16(chunk + 22);
+            if (format == 0xFFFE && chunkSize >= 26) {
+                format = readU16(chunk + 32); // WAVE_FORMAT_EXTENSIBLE: sub-format GUID starts with the tag
+            }
+        } else if (std::memcmp(chunk, "data", 4) == 0) {
+            data = chunk + 8;
+            dataSize = chunkSize;
+        }
+        offset = body + chunkSize + (chunkSize & 1); // Chunks are word-aligned
+    }
+
+    bool isFloat = format == 3 && bits == 32;
+    bool isPcm = format == 1 && (bits == 8 || bits == 16 || bits == 24 || bits == 32);
+    if (!data || channels <= 0 || sampleRate <= 0 || (!isFloat && !isPcm)) {
+        std::cerr << "Audio: unsupported format in " << path << std::endl;
+        return -1;
+    }
+
+    size_t bytesPerSample = static_cast<size_t>(bits / 8);
+    size_t frameBytes = bytesPerSample * channels;
+    size_t frames = dataSize / frameBytes;
+    std::vector<float> mono(frames);
+    for (size_t frame = 0; frame < frames; frame++) {
+        const uint8_t* samples = data + frame * frameBytes;
+        float sum = 0.0f;
+        for (int channel = 0; channel < channels; channel++) {
+            sum += decodeSample(samples + channel * bytesPerSample, bits, isFloat);
+        }
+        mono[frame] = sum / channels;
+    }
+    return addSound(name, mono, sampleRate);
+}
+
+SoundId AudioSystem::addSound(const std::string& name, const std::vector<float>& monoSamples, int sampleRate) {
+    SoundId existing = findSound(name);
+    if (existing >= 0) return existing; // The mixer may be playing it - never replace
+
+    auto sound = std::make_unique<Sound>();
+    sound->name = name;
+    if (sampleRate == config.sampleRate || sampleRate <= 0 || monoSamples.empty()) {
+        sound->samples = monoSamples;
+    } else {
+        // Linear resample once at load time so the mixer copies 1:1
+        double ratio = static_cast<double>(sampleRate) / config.sampleRate;
+        size_t frames = static_cast<size_t>(monoSamples.size() / ratio);
+        sound->samples.resize(frames);
+        for (size_t i = 0; i < frames; i++) {
+            double position = i * ratio;
+            size_t index = static_cast<size_t>(position);
+            float t = static_cast<float>(position - index);
+            float a = monoSamples[std::min(index, monoSamples.size() - 1)];
+            float b = monoSamples[std::min(index + 1, monoSamples.size() - 1)];
+            sound->samples[i] = a + (b - a) * t;
+        }
+    }
+
+    SoundId id = static_cast<SoundId>(sounds.size());
+    sounds.push_back(std::move(sound));
+    soundsByName[name] = id;
+    return id;
+}
+
+SoundId AudioSystem::findSound(const std::string& name) const {
+    auto it = soundsByName.find(name);
+    return it != soundsByName.end() ? it->second : -1;
+}
+
+std::vector<float> AudioSystem::makePlaceholderSound(uint32_t seed, float durationSeconds, int sampleRate) {
+    size_t frames = static_cast<size_t>(std::max(0.0f, durationSeconds) * sampleRate);
+    std::vector<float> samples(frames);
+    uint32_t state = seed * 2654435761u + 1u;
+    // Seed picks the tone: lower cutoff = duller thud, higher = sharper crack
+    float smoothing = 0.15f + static_cast<float>(seed % 7) * 0.1f;
+    float decay = 6.0f / std::max(durationSeconds, 0.01f);
+    float attackFrames = sampleRate * 0.001f;
+    float filtered = 0.0f;
+    for (size_t i = 0; i < frames; i++) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        float noise = static_cast<float>(state) / 2147483648.0f - 1.0f;
+        filtered += (noise - filtered) * smoothing;
+        float t = static_cast<float>(i) / sampleRate;
+        float attack = std::min(1.0f, i / attackFrames);
+        samples[i] = filtered * attack * std::exp(-t * decay) * 0.5f;
+    }
+    return samples;
+}
+
+// ===== Commands =====
+
+VoiceHandle AudioSystem::play(SoundId soundId, const SoundPlayParams& params) {
+    if (soundId < 0 || soundId >= static_cast<SoundId>(sounds.size())) return 0;
+
+    Command command;
+    command.type = CommandType::Play;
+    command.handle = nextHandle++;
+    if (nextHandle == 0) nextHandle = 1;
+    command.sound = sounds[soundId].get();
+    command.params = params;
+    if (!commands.push(command)) {
+        playsDropped.fetch_add(1, std::memory_order_relaxed);
+        return 0;
+    }
+    return command.handle;
+}
+
+VoiceHandle AudioSystem::play(const std::string& name, const Vec3& position, SoundPriority priority) {
+    SoundPlayParams params;
+    params.position = position;
+    params.priority = priority;
+    return play(findSound(name), params);
+}
+
+void AudioSystem::stop(VoiceHandle handle) {
+    if (handle == 0) return;
+    Command command;
+    command.type = CommandType::Stop;
+    command.handle = handle;
+    command.sound = nullptr;
+    commands.push(command);
+}
+
+void AudioSystem::setVoicePosition(VoiceHandle handle, const Vec3& position) {
+    if (handle == 0) return;
+    Command command;
+    command.type = CommandType::SetPosition;
+    command.handle = handle;
+    command.sound = nullptr;
+    command.params.position = position;
+    commands.push(command);
+}
+
+void AudioSystem::setListener(const Vec3& position, const Vec3& right) {
+    Command command;
+    command.type = CommandType::SetListener;
+    command.handle = 0;
+    command.sound = nullptr;
+    command.params.position = position;
+    command.right = right;
+    commands.push(command);
+}
+
+void AudioSystem::setMasterGain(float gain) {
+    Command command;
+    command.type = CommandType::SetMasterGain;
+    command.handle = 0;
+    command.sound = nullptr;
+    command.params.gain = gain;
+    commands.push(command);
+}
+
+// ===== Mixer thread =====
+
+bool AudioSystem::start(std::unique_ptr<AudioSink> outputSink) {
+    if (isRunning() || !outputSink) return false;
+    if (!outputSink->open(config.sampleRate, CHANNELS, config.framesPerBuffer)) {
+        std::cerr << "Audio: could not open the " << outputSink->getName() << " output" << std::endl;
+        return false;
+    }
+    sink = std::move(outputSink);
+    running.store(true, std::memory_order_release);
+    mixerThread = std::thread(&AudioSystem::mixerLoop, this);
+    return true;
+}
+
+void AudioSystem::shutdown() {
+    running.store(false, std::memory_order_release);
+    if (mixerThread.joinable()) {
+        mixerThread.join();
+    }
+    if (sink) {
+        sink->close();
+        sink.reset();
+    }
+}
+
+void AudioSystem::mixerLoop() {
+    raiseThreadPriority();
+    std::vector<float> output(static_cast<size_t>(config.framesPerBuffer) * CHANNELS);
+    while (running.load(std::memory_order_acquire)) {
+        mixBuffer(output.data());
+        sink->write(output.data(), config.framesPerBuffer); // Blocks until the sink wants more
+    }
+}
+
+void AudioSystem::mixBuffer(float* output) {
+    auto mixStart = std::chrono::steady_clock::now();
+
+    processCommands();
+
+    const int frames = config.framesPerBuffer;
+    std::fill(mixLeft.begin(), mixLeft.end(), 0.0f);
+    std::fill(mixRight.begin(), mixRight.end(), 0.0f);
+
+    int active = 0;
+    for (Voice& voice : voices) {
+        if (!voice.sound) continue;
+        mixVoice(voice, frames);
+        if (voice.sound) active++;
+    }
+    writeInterleaved(mixLeft.data(), mixRight.data(), frames, masterGain, output);
+
+    activeVoiceCount.store(active, std::memory_order_relaxed);
+    recordMixTime(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - mixStart).count()));
+}
+
+void AudioSystem::processCommands() {
+    Command command;
+    while (commands.pop(command)) {
+        switch (command.type) {
+            case CommandType::Play:
+                startVoice(command);
+                break;
+            case CommandType::Stop:
+                if (Voice* voice = findVoice(command.handle)) voice->fadingOut = true;
+                break;
+            case CommandType::SetPosition:
+                if (Voice* voice = findVoice(command.handle)) voice->params.position = command.params.position;
+                break;
+            case CommandType::SetListener: {
+                listenerPosition = command.params.position;
+                float length = command.right.length();
+                if (length > 1.0e-6f) listenerRight = command.right * (1.0f / length);
+                break;
+            }
+            case CommandType::SetMasterGain:
+                masterGain = std::max(0.0f, command.params.gain);
+                break;
+        }
+    }
+}
+
+void AudioSystem::startVoice(const Command& command) {
+    if (!command.sound || command.sound->samples.empty()) return;
+
+    // Free voice, else the least important one: fading voices first, then
+    // lowest priority, then quietest, then oldest
+    Voice* target = nullptr;
+    for (Voice& voice : voices) {
+        if (!voice.sound) {
+            target = &voice;
+            break;
+        }
+        if (!target) {
+            target = &voice;
+            continue;
+        }
+        if (voice.fadingOut != target->fadingOut) {
+            if (voice.fadingOut) target = &voice;
+            continue;
+        }
+        if (voice.params.priority != target->params.priority) {
+            if (voice.params.priority < target->params.priority) target = &voice;
+            continue;
+        }
+        float loudness = std::max(voice.gainLeft, voice.gainRight);
+        float targetLoudness = std::max(target->gainLeft, target->gainRight);
+        if (loudness < targetLoudness || (loudness == targetLoudness && voice.handle < target->handle)) {
+            target = &voice;
+        }
+    }
+
+    if (target->sound) {
+        if (!target->fadingOut && target->params.priority > command.params.priority) {
+            playsDropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        voicesStolen.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    target->sound = command.sound;
+    target->handle = command.handle;
+    target->cursor = 0;
+    target->params = command.params;
+    target->fadingOut = false;
+    // Start at the target gains: no ramp-in, the attack of the sound is kept
+    computeTargetGains(*target, target->gainLeft, target->gainRight);
+}
+
+AudioSystem::Voice* AudioSystem::findVoice(VoiceHandle handle) {
+    for (Voice& voice : voices) {
+        if (voice.sound && voice.handle == handle) return &voice;
+    }
+    return nullptr;
+}
+
+void AudioSystem::computeTargetGains(const Voice& voice, float& left, float& right) const {
+    float gain = voice.params.gain;
+    if (!voice.params.positional) {
+        left = right = gain * CENTER_GAIN;
+        return;
+    }
+
+    Vec3 offset = voice.params.position - listenerPosition;
+    float distance = offset.length();
+    if (distance >= config.maxDistance) {
+        left = right = 0.0f;
+        return;
+    }
+
+    float attenuation = 1.0f;
+    if (distance > config.referenceDistance) {
+        attenuation = config.referenceDistance /
+                      (config.referenceDistance + config.rolloffFactor * (distance - config.referenceDistance));
+    }
+    float pan = distance > 1.0e-4f ? offset.dot(listenerRight) / distance : 0.0f; // -1 left, +1 right
+    float angle = (pan + 1.0f) * QUARTER_PI;
+    left = std::cos(angle) * gain * attenuation;
+    right = std::sin(angle) * gain * attenuation;
+}
+
+void AudioSystem::mixVoice(Voice& voice, int frames) {
+    float targetLeft = 0.0f, targetRight = 0.0f;
+    if (!voice.fadingOut) {
+        computeTargetGains(voice, targetLeft, targetRight);
+    }
+    const float startLeft = voice.gainLeft;
+    const float startRight = voice.gainRight;
+    const float stepLeft = (targetLeft - startLeft) / frames;
+    const float stepRight = (targetRight - startRight) / frames;
+    const bool audible = std::max(std::max(startLeft, startRight), std::max(targetLeft, targetRight)) > SILENT_GAIN;
+
+    const std::vector<float>& samples = voice.sound->samples;
+    int written = 0;
+    bool finished = false;
+    while (written < frames) {
+        int count = static_cast<int>(std::min<size_t>(static_cast<size_t>(frames - written), samples.size() - voice.cursor));
+        if (audible) {
+            mixSpan(samples.data() + voice.cursor, count,
+                    startLeft + stepLeft * written, stepLeft, startRight + stepRight * written, stepRight,
+                    mixLeft.data() + written, mixRight.data() + written);
+        }
+        written += count;
+        voice.cursor += count;
+        if (voice.cursor >= samples.size()) {
+            if (!voice.params.loop) {
+                finished = true;
+                break;
+            }
+            voice.cursor = 0;
+        }
+    }
+
+    voice.gainLeft = targetLeft;
+    voice.gainRight = targetRight;
+    if (finished || voice.fadingOut) {
+        voice.sound = nullptr; // Out of samples, or the fade-out buffer has been mixed
+    }
+}
+
+// ===== Stats =====
+
+void AudioSystem::recordMixTime(uint64_t nanos) {
+    buffersMixed.fetch_add(1, std::memory_order_relaxed);
+    totalMixNanos.fetch_add(nanos, std::memory_order_relaxed);
+    lastMixNanos.store(nanos, std::memory_order_relaxed);
+    if (nanos > maxMixNanos.load(std::memory_order_relaxed)) {
+        maxMixNanos.store(nanos, std::memory_order_relaxed); // Single writer
+    }
+}
+
+AudioMixStats AudioSystem::getStats() const {
+    AudioMixStats stats;
+    stats.buffersMixed = buffersMixed.load(std::memory_order_relaxed);
+    stats.lastMixMicros = lastMixNanos.load(std::memory_order_relaxed) / 1000.0;
+    stats.maxMixMicros = maxMixNanos.load(std::memory_order_relaxed) / 1000.0;
+    stats.avgMixMicros = stats.buffersMixed > 0
+        ? totalMixNanos.load(std::memory_order_relaxed) / 1000.0 / stats.buffersMixed : 0.0;
+    stats.bufferMicros = config.framesPerBuffer * 1.0e6 / config.sampleRate;
+    stats.activeVoices = activeVoiceCount.load(std::memory_order_relaxed);
+    stats.voicesStolen = voicesStolen.load(std::memory_order_relaxed);
+    stats.playsDropped = playsDropped.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void AudioSystem::resetStats() {
+    buffersMixed.store(0, std::memory_order_relaxed);
+    totalMixNanos.store(0, std::memory_order_relaxed);
+    lastMixNanos.store(0, std::memory_order_relaxed);
+    maxMixNanos.store(0, std::memory_order_relaxed);
+    voicesStolen.store(0, std::memory_order_relaxed);
+    playsDropped.store(0, std::memory_order_relaxed);
+}
+
+} // namespace Engine
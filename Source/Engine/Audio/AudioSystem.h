@@ -0,0 +1,233 @@
+/**
+ * AudioSystem.h - Real-Time Mixer Thread with Positional Voices
+ *
+ * OVERVIEW:
+ * Sound effects are mixed on a dedicated mixer thread so that a burst of
+ * gunfire never costs the game thread more than a queue push. The game
+ * thread preloads sounds into a bank (mono float PCM at the mixer rate, so
+ * mixing never resamples), then sends play/stop/listener commands through
+ * a lock-free SPSC queue. The mixer thread drains the queue at the start
+ * of every buffer, places each voice relative to the listener and sums the
+ * voices into a stereo buffer that it hands to an AudioSink.
+ *
+ * FEATURES:
+ * - Fixed voice pool (AudioConfig::maxVoices); when it is full a new sound
+ *   steals the lowest-priority voice (quietest, then oldest, among equals)
+ *   or is dropped if every voice outranks it
+ * - Distance attenuation (inverse distance with rolloff, silent past
+ *   maxDistance) and constant-power panning from the listener's right
+ *   vector; gains ramp over one buffer so moving sources do not click
+ * - SSE2 mixing kernel, four frames per instruction (scalar fallback)
+ * - Mix time per buffer (last/avg/max), voices stolen and commands dropped
+ * - Sinks: output device, null, or .wav file (see AudioSink.h)
+ * - GL-free: part of ww3_core and benchmarked headless
+ *
+ * USAGE:
+ *   AudioSystem audio;
+ *   audio.loadSound("bullet_fire.wav", "Resources/Sounds/bullet_fire.wav");
+ *   audio.start(createDeviceAudioSink());
+ *   audio.setListener(camera.getPosition(), camera.getRight());
+ *   audio.play("bullet_fire.wav", muzzlePosition, SoundPriority::Normal);
+ *
+ * THREADING:
+ * loadSound/addSound, play/stop/setVoicePosition, setListener and
+ * setMasterGain belong to the game thread (the queue's only producer).
+ * Sounds must stay loaded while the mixer runs. getStats() is safe from
+ * any thread.
+ */
+
+#pragma once
+#include "AudioSink.h"
+#include "../Core/SpscQueue.h"
+#include "../Math/Math.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine {
+
+/**
+ * SoundId - Index of a sound in the bank (-1 = none)
+ */
+typedef int SoundId;
+
+/**
+ * VoiceHandle - Identifies one play() call (0 = none); stays unique after
+ * the voice ends or is stolen, so stale handles are harmless
+ */
+typedef uint32_t VoiceHandle;
+
+/**
+ * SoundPriority - Which voices survive when the pool is full
+ */
+enum class SoundPriority : uint8_t {
+    Low,        // Impacts, ambience
+    Normal,     // Weapon fire
+    High,       // Explosions
+    Critical    // UI and player feedback, never stolen by lower priorities
+};
+
+/**
+ * SoundPlayParams - How one voice is played
+ */
+struct SoundPlayParams {
+    Vec3 position;
+    float gain = 1.0f;
+    SoundPriority priority = SoundPriority::Normal;
+    bool positional = true;     // false = centred, no distance attenuation
+    bool loop = false;
+};
+
+/**
+ * AudioConfig - Mixer format and limits
+ */
+struct AudioConfig {
+    int sampleRate = 48000;
+    int framesPerBuffer = 256;      // 5.3 ms at 48 kHz
+    int maxVoices = 32;
+    size_t commandCapacity = 1024;  // Commands per buffer the game thread may queue
+    float referenceDistance = 2.0f; // Full volume inside this radius
+    float rolloffFactor = 1.0f;
+    float maxDistance = 150.0f;     // Silent (and skipped) beyond this
+};
+
+/**
+ * AudioMixStats - Mixer timing and voice counters
+ */
+struct AudioMixStats {
+    uint64_t buffersMixed = 0;
+    double lastMixMicros = 0.0;
+    double avgMixMicros = 0.0;
+    double maxMixMicros = 0.0;
+    double bufferMicros = 0.0;      // Real-time budget per buffer
+    int activeVoices = 0;
+    uint64_t voicesStolen = 0;
+    uint64_t playsDropped = 0;      // Pool full of higher priorities, or queue full
+};
+
+/**
+ * AudioSystem - Sound bank, command queue and mixer thread
+ */
+class AudioSystem {
+public:
+    static const int CHANNELS = 2;
+
+private:
+    struct Sound {
+        std::string name;
+        std::vector<float> samples; // Mono, at config.sampleRate
+    };
+
+    enum class CommandType : uint8_t {
+        Play,
+        Stop,
+        SetPosition,
+        SetListener,
+        SetMasterGain
+    };
+
+    struct Command {
+        CommandType type;
+        VoiceHandle handle;
+        const Sound* sound;
+        SoundPlayParams params;     // Play: everything; SetPosition: position
+        Vec3 right;                 // SetListener (position in params)
+    };
+
+    struct Voice {
+        const Sound* sound = nullptr;   // null = free
+        VoiceHandle handle = 0;
+        size_t cursor = 0;
+        SoundPlayParams params;
+        float gainLeft = 0.0f;          // Gains reached at the end of the last buffer
+        float gainRight = 0.0f;
+        bool fadingOut = false;         // Stopped: ramp to silence over one buffer, then free
+    };
+
+    AudioConfig config;
+
+    // Game thread
+    std::vector<std::unique_ptr<Sound>> sounds;
+    std::unordered_map<std::string, SoundId> soundsByName;
+    VoiceHandle nextHandle;
+    SpscQueue<Command> commands;
+
+    // Mixer thread
+    std::vector<Voice> voices;
+    Vec3 listenerPosition;
+    Vec3 listenerRight;
+    float masterGain;
+    std::vector<float> mixLeft;     // Planar accumulation buffers
+    std::vector<float> mixRight;
+
+    // Thread
+    std::unique_ptr<AudioSink> sink;
+    std::thread mixerThread;
+    std::atomic<bool> running;
+
+    // Stats (written by the mixer, read anywhere)
+    std::atomic<uint64_t> buffersMixed;
+    std::atomic<uint64_t> totalMixNanos;
+    std::atomic<uint64_t> lastMixNanos;
+    std::atomic<uint64_t> maxMixNanos;
+    std::atomic<int> activeVoiceCount;
+    std::atomic<uint64_t> voicesStolen;
+    std::atomic<uint64_t> playsDropped;
+
+public:
+    explicit AudioSystem(const AudioConfig& config = AudioConfig());
+    ~AudioSystem();
+
+    AudioSystem(const AudioSystem&) = delete;
+    AudioSystem& operator=(const AudioSystem&) = delete;
+
+    // Sound bank (game thread). 8/16/24/32-bit PCM or float .wav, mixed down to
+    // mono and resampled to the mixer rate. -1 if the file cannot be read.
+    SoundId loadSound(const std::string& name, const std::string& path);
+    SoundId addSound(const std::string& name, const std::vector<float>& monoSamples, int sampleRate);
+    SoundId findSound(const std::string& name) const;
+    size_t getSoundCount() const { return sounds.size(); }
+
+    // Decaying noise burst, a stand-in when a sound file is missing
+    static std::vector<float> makePlaceholderSound(uint32_t seed, float durationSeconds, int sampleRate);
+
+    // Commands (game thread). play() returns 0 if the sound is unknown or
+    // the queue is full; a voice the mixer cannot fit is dropped there.
+    VoiceHandle play(SoundId sound, const SoundPlayParams& params);
+    VoiceHandle play(const std::string& name, const Vec3& position, SoundPriority priority = SoundPriority::Normal);
+    void stop(VoiceHandle handle);
+    void setVoicePosition(VoiceHandle handle, const Vec3& position);
+    void setListener(const Vec3& position, const Vec3& right);
+    void setMasterGain(float gain);
+
+    // Mixer thread
+    bool start(std::unique_ptr<AudioSink> outputSink);
+    void shutdown();
+    bool isRunning() const { return running.load(std::memory_order_acquire); }
+    const AudioSink* getSink() const { return sink.get(); }
+
+    // Drains the queue and mixes one buffer (config.framesPerBuffer interleaved
+    // stereo frames) on the calling thread. The mixer thread's loop body;
+    // benchmarks call it directly. Must not run concurrently with the thread.
+    void mixBuffer(float* output);
+
+    AudioMixStats getStats() const;
+    void resetStats();
+    const AudioConfig& getConfig() const { return config; }
+
+private:
+    void mixerLoop();
+    void processCommands();
+    void startVoice(const Command& command);
+    Voice* findVoice(VoiceHandle handle);
+    void computeTargetGains(const Voice& voice, float& left, float& right) const;
+    void mixVoice(Voice& voice, int frames);
+    void recordMixTime(uint64_t nanos);
+};
+
+} // namespace Engine
@@ -0,0 +1,571 @@
+/**
+ * BenchmarkRunner.cpp - Implementation of Built-in Scripted Benchmark Scenarios
+ *
+ * Each scenario resets the world to a known state, configures it through the
+ * public Game/Camera/MonsterSpawner/ProjectileManager APIs, runs a warmup and
+ * then a fixed number of measured frames with a fixed simulation delta.
+ */
+
+#include "BenchmarkRunner.h"
+#include "Game.h"
+#include "../../GameObjects/Monster.h"
+#include "../../GameObjects/Weapon.h"
+#include "../../GameObjects/SimpleChunkTerrainGround.h"
+#include "../Rendering/BasicRenderer.h"
+#include "../Rendering/RendererFactory.h"
+#include <GL/glew.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__linux__)
+#include <unistd.h>
+#endif
+
+namespace Engine {
+
+namespace {
+
+const float BENCH_PI = 3.14159265f;
+const char* TERRAIN_OBJECT_NAME = "SimpleChunkTerrain";
+const int DEFAULT_RENDER_DISTANCE = 8;
+
+SimpleChunkTerrainGround* findTerrain(Game& game) {
+    Scene* scene = game.getScene();
+    if (!scene) return nullptr;
+    return dynamic_cast<SimpleChunkTerrainGround*>(scene->getGameObject(TERRAIN_OBJECT_NAME));
+}
+
+BasicRenderer* findOpaqueRenderer() {
+    return dynamic_cast<BasicRenderer*>(RendererFactory::getInstance().getDefaultRenderer());
+}
+
+std::string escapeJSON(const std::string& text) {
+    std::string escaped;
+    escaped.reserve(text.size());
+    for (char c : text) {
+        switch (c) {
+            case '"':  escaped += "\\\""; break;
+            case '\\': escaped += "\\\\"; break;
+            case '\n': escaped += "\\n"; break;
+            case '\t': escaped += "\\t"; break;
+            default:   escaped += c; break;
+        }
+    }
+    return escaped;
+}
+
+// Reads the number following "key": starting at 'from', not past 'limit'
+bool readJSONNumber(const std::string& text, const std::string& key, size_t from, size_t limit, double& value) {
+    std::string pattern = "\"" + key + "\":";
+    size_t pos = text.find(pattern, from);
+    if (pos == std::string::npos || pos >= limit) return false;
+    value = std::strtod(text.c_str() + pos + pattern.size(), nullptr);
+    return true;
+}
+
+double percentile(const std::vector<double>& sorted, double fraction) {
+    if (sorted.empty()) return 0.0;
+    // Nearest-rank percentile
+    size_t rank = static_cast<size_t>(std::ceil(fraction * static_cast<double>(sorted.size())));
+    if (rank == 0) rank = 1;
+    if (rank > sorted.size()) rank = sorted.size();
+    return sorted[rank - 1];
+}
+
+} // namespace
+
+// ===== BenchmarkOptions =====
+
+bool BenchmarkOptions::parseCommandLine(int argc, char** argv, BenchmarkOptions& options) {
+    bool benchmarkRequested = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+
+        if (arg == "--benchmark") {
+            benchmarkRequested = true;
+        } else if (arg == "--benchmark-out" && hasValue) {
+            options.outputPath = argv[++i];
+        } else if (arg == "--benchmark-baseline" && hasValue) {
+            options.baselinePath = argv[++i];
+        } else if (arg == "--benchmark-threshold" && hasValue) {
+            options.regressionThreshold = std::atof(argv[++i]);
+        } else if (arg == "--benchmark-scenario" && hasValue) {
+            options.scenarioFilter = argv[++i];
+        } else if (arg == "--benchmark-frames" && hasValue) {
+            options.frameCount = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--benchmark-warmup" && hasValue) {
+            options.warmupFrames = std::max(0, std::atoi(argv[++i]));
+        } else if (arg == "--benchmark-compare-prepass") {
+            options.compareDepthPrepass = true;
+        }
+    }
+
+    return benchmarkRequested;
+}
+
+// ===== BenchmarkRunner =====
+
+BenchmarkRunner::BenchmarkRunner(Game& game, const BenchmarkOptions& options)
+    : game(game), options(options) {}
+
+void BenchmarkRunner::addScenario(const BenchmarkScenario& scenario) {
+    scenarios.push_back(scenario);
+}
+
+void BenchmarkRunner::registerDefaultScenarios() {
+    // Terrain flythrough: straight line across chunk boundaries with a gentle yaw sway,
+    // repeated at increasing render distance to expose chunk generation and draw cost
+    const int renderDistances[] = { 2, 4, 8, 12 };
+    for (int renderDistance : renderDistances) {
+        BenchmarkScenario flythrough;
+        flythrough.name = "terrain_flythrough_rd" + std::to_string(renderDistance);
+        flythrough.description = "Camera flythrough across terrain at render distance " + std::to_string(renderDistance);
+        flythrough.setup = [renderDistance](Game& g) {
+            if (auto* terrain = findTerrain(g)) {
+                terrain->setRenderDistance(renderDistance);
+            }
+            g.getCamera()->setPosition(Vec3(0.0f, 6.0f, 0.0f));
+            g.getCamera()->setRotation(Vec3(-10.0f, 0.0f, 0.0f));
+        };
+        flythrough.step = [this](Game& g, int frame, int /*totalFrames*/) {
+            const float speed = 24.0f; // units per second, crosses a 16-unit chunk every ~0.7s
+            float t = frame * options.fixedDeltaTime;
+            g.getCamera()->setPosition(Vec3(t * speed, 6.0f, 8.0f * std::sin(t * 0.5f)));
+            g.getCamera()->setRotation(Vec3(-10.0f, 20.0f * std::sin(t * 0.7f), 0.0f));
+        };
+        flythrough.teardown = [](Game& g) {
+            if (auto* terrain = findTerrain(g)) {
+                terrain->setRenderDistance(DEFAULT_RENDER_DISTANCE);
+            }
+        };
+        scenarios.push_back(flythrough);
+    }
+
+    // Monster wave: N monsters on rings around the player, camera pans a full circle
+    const int monsterCounts[] = { 16, 64 };
+    for (int monsterCount : monsterCounts) {
+        BenchmarkScenario wave;
+        wave.name = "monster_wave_" + std::to_string(monsterCount);
+        wave.description = "Wave of " + std::to_string(monsterCount) + " monsters surrounding the player";
+        wave.setup = [monsterCount](Game& g) {
+            Camera* camera = g.getCamera();
+            camera->setPosition(Vec3(0.0f, 4.0f, 0.0f));
+            camera->setRotation(Vec3(-5.0f, 0.0f, 0.0f));
+
+            MonsterSpawner* spawner = g.getMonsterSpawner();
+            if (!spawner) return;
+            spawner->setMaxMonsters(monsterCount);
+
+            const int perRing = 16;
+            for (int i = 0; i < monsterCount; i++) {
+                int ring = i / perRing;
+                float angle = (2.0f * BENCH_PI * (i % perRing)) / perRing + ring * 0.2f;
+                float radius = 6.0f + ring * 4.0f;
+                spawner->spawnMonsterAt(Vec3(radius * std::cos(angle), 0.0f, radius * std::sin(angle)),
+                                        MonsterType::Xenomorph);
+            }
+        };
+        wave.step = [](Game& g, int frame, int totalFrames) {
+            float yaw = 360.0f * static_cast<float>(frame) / static_cast<float>(std::max(1, totalFrames));
+            g.getCamera()->setRotation(Vec3(-5.0f, yaw, 0.0f));
+        };
+        scenarios.push_back(wave);
+    }
+
+    // Sustained full-auto fire: weapon fires normally and the projectile pool is topped up
+    // to M live projectiles in a fixed fan, with a few monsters downrange as collision targets
+    const int projectileCounts[] = { 64, 256 };
+    for (int projectileCount : projectileCounts) {
+        BenchmarkScenario fire;
+        fire.name = "full_auto_" + std::to_string(projectileCount);
+        fire.description = "Sustained full-auto fire with " + std::to_string(projectileCount) + " live projectiles";
+        fire.setup = [](Game& g) {
+            g.getCamera()->setPosition(Vec3(0.0f, 4.0f, 0.0f));
+            g.getCamera()->setRotation(Vec3(0.0f, 0.0f, 0.0f));
+
+            if (MonsterSpawner* spawner = g.getMonsterSpawner()) {
+                spawner->setMaxMonsters(8);
+                for (int i = 0; i < 8; i++) {
+                    spawner->spawnMonsterAt(Vec3(20.0f + 3.0f * i, 0.0f, -10.0f + 3.0f * i), MonsterType::Xenomorph);
+                }
+            }
+            if (Weapon* weapon = g.getWeapon()) {
+                weapon->startFiring();
+            }
+        };
+        fire.step = [projectileCount](Game& g, int frame, int /*totalFrames*/) {
+            ProjectileManager* projectiles = g.getProjectileManager();
+            Camera* camera = g.getCamera();
+            if (!projectiles || !camera) return;
+
+            int missing = projectileCount - static_cast<int>(projectiles->getActiveProjectileCount());
+            for (int i = 0; i < missing; i++) {
+                Projectile* projectile = projectiles->createMonsterHunterProjectile("BenchProjectile");
+                if (!projectile) break;
+                float spreadYaw = 0.25f * std::sin(0.37f * static_cast<float>(frame * 7 + i));
+                float spreadPitch = 0.05f * std::cos(0.53f * static_cast<float>(frame * 3 + i));
+                Vec3 direction(std::cos(spreadYaw), spreadPitch, std::sin(spreadYaw));
+                projectile->fire(camera->getPosition(), direction, nullptr);
+            }
+        };
+        fire.teardown = [](Game& g) {
+            if (Weapon* weapon = g.getWeapon()) {
+                weapon->stopFiring();
+            }
+        };
+        scenarios.push_back(fire);
+    }
+
+    // Water-facing view: low camera looking across the water plane, slow pan
+    BenchmarkScenario water;
+    water.name = "water_view";
+    water.description = "Camera facing the water surface with reflection/refraction passes";
+    water.setup = [](Game& g) {
+        g.getCamera()->setPosition(Vec3(0.0f, -4.0f, 0.0f));
+        g.getCamera()->setRotation(Vec3(-25.0f, 0.0f, 0.0f));
+    };
+    water.step = [](Game& g, int frame, int totalFrames) {
+        float yaw = 90.0f * static_cast<float>(frame) / static_cast<float>(std::max(1, totalFrames));
+        g.getCamera()->setRotation(Vec3(-25.0f, yaw, 0.0f));
+    };
+    scenarios.push_back(water);
+}
+
+int BenchmarkRunner::run() {
+    if (!game.isValid()) {
+        std::cerr << "Benchmark: game is not initialized" << std::endl;
+        return 2;
+    }
+
+    FrameProfiler* profiler = game.getFrameProfiler();
+    if (profiler) {
+        profiler->setEnabled(true);
+    }
+    game.setVSync(false);
+    Input::getInstance().setLateLatchEnabled(false); // Scenarios script the camera; keep stray mouse motion out
+    if (game.getDynamicResolution()) {
+        game.getDynamicResolution()->setScaleRange(1.0f, 1.0f); // Pin native scale so runs stay comparable
+    }
+
+    results.clear();
+    initialState.capture(game.getSimulationWorld());
+    for (const auto& scenario : scenarios) {
+        if (!options.scenarioFilter.empty() && scenario.name.find(options.scenarioFilter) == std::string::npos) {
+            continue;
+        }
+        if (!game.isValid()) break; // Window closed mid-run
+
+        results.push_back(runScenario(scenario));
+    }
+
+    if (results.empty()) {
+        std::cerr << "Benchmark: no scenario matched '" << options.scenarioFilter << "'" << std::endl;
+        return 2;
+    }
+
+    bool baselineOk = true;
+    if (!options.baselinePath.empty()) {
+        baselineOk = applyBaseline(options.baselinePath);
+    }
+
+    bool reportOk = writeReport(options.outputPath);
+    printSummary();
+
+    if (!baselineOk || !reportOk) return 2;
+    for (const auto& result : results) {
+        if (result.regressed) return 1;
+    }
+    return 0;
+}
+
+BenchmarkResult BenchmarkRunner::runScenario(const BenchmarkScenario& scenario) {
+    BenchmarkResult result;
+    result.name = scenario.name;
+    result.description = scenario.description;
+
+    resetWorld();
+    if (scenario.setup) {
+        scenario.setup(game);
+    }
+
+    int totalFrames = options.warmupFrames + options.frameCount;
+    FrameProfiler* profiler = game.getFrameProfiler();
+
+    // Prepass A/B: even frames without, odd frames with, on the same camera path
+    BasicRenderer* opaqueRenderer = options.compareDepthPrepass ? findOpaqueRenderer() : nullptr;
+    const bool depthPrepassWasEnabled = opaqueRenderer && opaqueRenderer->isDepthPrepassEnabled();
+
+    // Warmup: lets chunk streaming, shader caches and GPU query latency settle
+    for (int frame = 0; frame < options.warmupFrames && game.isValid(); frame++) {
+        if (scenario.step) scenario.step(game, frame, totalFrames);
+        if (opaqueRenderer) opaqueRenderer->setDepthPrepassEnabled(frame % 2 == 1);
+        game.stepFrame(options.fixedDeltaTime);
+    }
+
+    if (profiler) profiler->resetTotals();
+    if (AudioSystem* audio = game.getAudioSystem()) audio->resetStats();
+    result.memoryStartBytes = sampleProcessMemory();
+    result.memoryPeakBytes = result.memoryStartBytes;
+
+    std::vector<double> frameTimesMs;
+    frameTimesMs.reserve(options.frameCount);
+
+    for (int i = 0; i < options.frameCount && game.isValid(); i++) {
+        int frame = options.warmupFrames + i;
+        if (scenario.step) scenario.step(game, frame, totalFrames);
+        if (opaqueRenderer) opaqueRenderer->setDepthPrepassEnabled(frame % 2 == 1);
+
+        auto frameStart = std::chrono::steady_clock::now();
+        game.stepFrame(options.fixedDeltaTime);
+        auto frameEnd = std::chrono::steady_clock::now();
+        frameTimesMs.push_back(std::chrono::duration<double, std::milli>(frameEnd - frameStart).count());
+
+        // /proc and GetProcessMemoryInfo are cheap but not free - sample twice a second
+        if (i % 30 == 0) {
+            result.memoryPeakBytes = std::max(result.memoryPeakBytes, sampleProcessMemory());
+        }
+    }
+
+    result.memoryEndBytes = sampleProcessMemory();
+    result.memoryPeakBytes = std::max(result.memoryPeakBytes, result.memoryEndBytes);
+    result.frames = static_cast<int>(frameTimesMs.size());
+    result.frameTime = computeStats(frameTimesMs);
+    if (profiler) result.passes = profiler->getPassTimings();
+    if (opaqueRenderer) opaqueRenderer->setDepthPrepassEnabled(depthPrepassWasEnabled);
+
+    if (MonsterSpawner* spawner = game.getMonsterSpawner()) {
+        result.monsterCount = spawner->getActiveMonsterCount();
+    }
+    if (ProjectileManager* projectiles = game.getProjectileManager()) {
+        result.projectileCount = projectiles->getActiveProjectileCount();
+    }
+    if (auto* terrain = findTerrain(game)) {
+        result.loadedChunks = terrain->getLoadedChunkCount();
+    }
+    if (AudioSystem* audio = game.getAudioSystem()) {
+        AudioMixStats audioStats = audio->getStats();
+        result.audioMixAvgUs = audioStats.avgMixMicros;
+        result.audioMixMaxUs = audioStats.maxMixMicros;
+        result.audioBufferUs = audioStats.bufferMicros;
+        result.audioVoicesStolen = audioStats.voicesStolen;
+    }
+
+    if (scenario.teardown) {
+        scenario.teardown(game);
+    }
+
+    std::cout << "Benchmark '" << result.name << "': avg " << std::fixed << std::setprecision(3)
+              << result.frameTime.avgMs << " ms, p95 " << result.frameTime.p95Ms << " ms" << std::endl;
+    return result;
+}
+
+void BenchmarkRunner::resetWorld() {
+    if (Weapon* weapon = game.getWeapon()) {
+        weapon->stopFiring();
+    }
+
+    // Every scenario starts from the world as it was before the first one
+    if (!initialState.restore(game.getSimulationWorld())) {
+        // Remove spawned monsters from the scene first - the spawner only holds raw pointers
+        if (MonsterSpawner* spawner = game.getMonsterSpawner()) {
+            if (Scene* scene = game.getScene()) {
+                std::vector<Monster*> monsters = spawner->getActiveMonsters();
+                for (Monster* monster : monsters) {
+                    if (monster) scene->removeGameObject(monster);
+                }
+            }
+            spawner->clearAllMonsters();
+        }
+
+        if (ProjectileManager* projectiles = game.getProjectileManager()) {
+            projectiles->destroyAllProjectiles();
+        }
+    }
+
+    if (Camera* camera = game.getCamera()) {
+        camera->setPosition(Vec3(8.0f, 10.0f, 8.0f));
+        camera->setRotation(Vec3(0.0f, -90.0f, 0.0f));
+    }
+}
+
+FrameTimeStats BenchmarkRunner::computeStats(std::vector<double> frameTimesMs) {
+    FrameTimeStats stats;
+    if (frameTimesMs.empty()) return stats;
+
+    std::sort(frameTimesMs.begin(), frameTimesMs.end());
+
+    double total = 0.0;
+    for (double ms : frameTimesMs) total += ms;
+
+    stats.avgMs = total / static_cast<double>(frameTimesMs.size());
+    stats.p50Ms = percentile(frameTimesMs, 0.50);
+    stats.p95Ms = percentile(frameTimesMs, 0.95);
+    stats.p99Ms = percentile(frameTimesMs, 0.99);
+    stats.maxMs = frameTimesMs.back();
+    stats.minMs = frameTimesMs.front();
+    return stats;
+}
+
+size_t BenchmarkRunner::sampleProcessMemory() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return static_cast<size_t>(counters.WorkingSetSize);
+    }
+    return 0;
+#elif defined(__linux__)
+    // statm: size resident shared ... (in pages)
+    std::ifstream statm("/proc/self/statm");
+    size_t sizePages = 0, residentPages = 0;
+    if (statm >> sizePages >> residentPages) {
+        return residentPages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    }
+    return 0;
+#else
+    return 0;
+#endif
+}
+
+bool BenchmarkRunner::writeReport(const std::string& path) const {
+    std::ofstream out(path);
+    if (!out.is_open()) {
+        std::cerr << "Benchmark: cannot write report to " << path << std::endl;
+        return false;
+    }
+
+    const GLubyte* renderer = glGetString(GL_RENDERER);
+    const GLubyte* version = glGetString(GL_VERSION);
+
+    out << std::fixed << std::setprecision(4);
+    out << "{\n";
+    out << "  \"format_version\": 1,\n";
+    out << "  \"build\": \"" << __DATE__ << " " << __TIME__ << "\",\n";
+    out << "  \"gl_renderer\": \"" << escapeJSON(renderer ? reinterpret_cast<const char*>(renderer) : "unknown") << "\",\n";
+    out << "  \"gl_version\": \"" << escapeJSON(version ? reinterpret_cast<const char*>(version) : "unknown") << "\",\n";
+    out << "  \"fixed_delta_time\": " << options.fixedDeltaTime << ",\n";
+    out << "  \"warmup_frames\": " << options.warmupFrames << ",\n";
+    out << "  \"regression_threshold\": " << options.regressionThreshold << ",\n";
+    out << "  \"scenarios\": [\n";
+
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchmarkResult& r = results[i];
+        out << "    {\n";
+        out << "      \"scenario\": \"" << escapeJSON(r.name) << "\",\n";
+        out << "      \"description\": \"" << escapeJSON(r.description) << "\",\n";
+        out << "      \"frames\": " << r.frames << ",\n";
+        out << "      \"frame_time_ms\": { \"avg_ms\": " << r.frameTime.avgMs
+            << ", \"p50_ms\": " << r.frameTime.p50Ms
+            << ", \"p95_ms\": " << r.frameTime.p95Ms
+            << ", \"p99_ms\": " << r.frameTime.p99Ms
+            << ", \"max_ms\": " << r.frameTime.maxMs
+            << ", \"min_ms\": " << r.frameTime.minMs << " },\n";
+        out << "      \"memory_bytes\": { \"start\": " << r.memoryStartBytes
+            << ", \"end\": " << r.memoryEndBytes
+            << ", \"peak\": " << r.memoryPeakBytes << " },\n";
+        out << "      \"load\": { \"monsters\": " << r.monsterCount
+            << ", \"projectiles\": " << r.projectileCount
+            << ", \"loaded_chunks\": " << r.loadedChunks << " },\n";
+        out << "      \"audio\": { \"mix_avg_us\": " << r.audioMixAvgUs
+            << ", \"mix_max_us\": " << r.audioMixMaxUs
+            << ", \"buffer_us\": " << r.audioBufferUs
+            << ", \"voices_stolen\": " << r.audioVoicesStolen << " },\n";
+
+        out << "      \"passes\": [\n";
+        for (size_t p = 0; p < r.passes.size(); p++) {
+            const PassTiming& pass = r.passes[p];
+            out << "        { \"pass\": \"" << escapeJSON(pass.name) << "\""
+                << ", \"cpu_avg_ms\": " << pass.getAverageCpuMs()
+                << ", \"gpu_avg_ms\": " << pass.getAverageGpuMs()
+                << ", \"gpu_samples\": " << pass.gpuSamples << " }"
+                << (p + 1 < r.passes.size() ? "," : "") << "\n";
+        }
+        out << "      ],\n";
+
+        out << "      \"baseline\": ";
+        if (r.hasBaseline) {
+            out << "{ \"avg_ms\": " << r.baselineAvgMs << ", \"p95_ms\": " << r.baselineP95Ms << " },\n";
+        } else {
+            out << "null,\n";
+        }
+        out << "      \"regressed\": " << (r.regressed ? "true" : "false") << "\n";
+        out << "    }" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+
+    out << "  ]\n";
+    out << "}\n";
+    return true;
+}
+
+bool BenchmarkRunner::applyBaseline(const std::string& path) {
+    std::ifstream in(path);
+    if (!in.is_open()) {
+        std::cerr << "Benchmark: cannot read baseline " << path << std::endl;
+        return false;
+    }
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    const std::string text = buffer.str();
+
+    // The baseline is a previous report from writeReport(): locate each scenario block by its
+    // "scenario" key and read the frame_time_ms fields that follow it
+    for (auto& result : results) {
+        std::string key = "\"scenario\": \"" + escapeJSON(result.name) + "\"";
+        size_t start = text.find(key);
+        if (start == std::string::npos) continue;
+
+        size_t limit = text.find("\"scenario\":", start + key.size());
+        if (limit == std::string::npos) limit = text.size();
+
+        double baselineAvg = 0.0, baselineP95 = 0.0;
+        if (!readJSONNumber(text, "avg_ms", start, limit, baselineAvg) ||
+            !readJSONNumber(text, "p95_ms", start, limit, baselineP95)) {
+            continue;
+        }
+
+        result.hasBaseline = true;
+        result.baselineAvgMs = baselineAvg;
+        result.baselineP95Ms = baselineP95;
+
+        double factor = 1.0 + options.regressionThreshold;
+        result.regressed = (baselineAvg > 0.0 && result.frameTime.avgMs > baselineAvg * factor) ||
+                           (baselineP95 > 0.0 && result.frameTime.p95Ms > baselineP95 * factor);
+    }
+    return true;
+}
+
+void BenchmarkRunner::printSummary() const {
+    std::cout << "=== BENCHMARK SUMMARY ===" << std::endl;
+    std::cout << std::fixed << std::setprecision(3);
+    for (const auto& r : results) {
+        std::cout << std::left << std::setw(26) << r.name << std::right
+                  << " avg " << std::setw(8) << r.frameTime.avgMs
+                  << " p50 " << std::setw(8) << r.frameTime.p50Ms
+                  << " p95 " << std::setw(8) << r.frameTime.p95Ms
+                  << " p99 " << std::setw(8) << r.frameTime.p99Ms
+                  << " max " << std::setw(8) << r.frameTime.maxMs
+                  << " peakMB " << std::setw(8) << (r.memoryPeakBytes / (1024.0 * 1024.0));
+        if (r.hasBaseline) {
+            std::cout << (r.regressed ? "  REGRESSED" : "  ok")
+                      << " (baseline p95 " << r.baselineP95Ms << ")";
+        }
+        std::cout << std::endl;
+    }
+    std::cout << "Report written to " << options.outputPath << std::endl;
+    std::cout << "=========================" << std::endl;
+}
+
+} // namespace Engine
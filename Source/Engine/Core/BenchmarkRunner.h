@@ -0,0 +1,152 @@
+/**
+ * BenchmarkRunner.h - Built-in Scripted Benchmark Scenarios
+ *
+ * OVERVIEW:
+ * Drives a fully initialized Game through named, repeatable scenarios and
+ * records frame-time statistics for each one. Scenarios manipulate Camera,
+ * MonsterSpawner, ProjectileManager and the terrain directly, step the game
+ * with a fixed simulation delta and measure the real wall-clock frame time.
+ *
+ * FEATURES:
+ * - Default scenarios: terrain flythrough at increasing render distance,
+ *   monster waves around the player, sustained full-auto fire, water view
+ * - avg/p50/p95/p99/max frame time per scenario
+ * - Per-pass CPU/GPU averages from FrameProfiler
+ * - Optional A/B of the depth prepass: alternating frames with and without
+ *   it report main_scene and main_scene_prepass side by side per scenario
+ * - Process memory at start/end/peak of each scenario
+ * - Audio mix time per buffer (avg/max against the buffer's real-time budget)
+ * - JSON report for diffing between builds
+ * - Baseline comparison that fails the run on regressions past a threshold
+ *
+ * USAGE:
+ *   WW3 --benchmark [--benchmark-out report.json]
+ *       [--benchmark-baseline previous.json] [--benchmark-threshold 0.10]
+ *       [--benchmark-scenario name] [--benchmark-frames 600]
+ *       [--benchmark-compare-prepass]
+ */
+
+#pragma once
+#include <functional>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include "FrameProfiler.h"
+#include "SimulationState.h"
+
+namespace Engine {
+
+class Game;
+
+/**
+ * Command-line options controlling a benchmark run
+ */
+struct BenchmarkOptions {
+    std::string outputPath = "benchmark_results.json";
+    std::string baselinePath;           // Empty = no regression check
+    std::string scenarioFilter;         // Empty = all scenarios, otherwise substring match
+    double regressionThreshold = 0.10;  // Fail when avg or p95 grows by more than 10%
+    int frameCount = 600;               // Measured frames per scenario
+    int warmupFrames = 60;              // Unmeasured frames before each scenario
+    float fixedDeltaTime = 1.0f / 60.0f;
+    bool compareDepthPrepass = false;   // Alternate the depth prepass every frame (frame-time stats mix both)
+
+    // Parses --benchmark* arguments; returns false if --benchmark was not given
+    static bool parseCommandLine(int argc, char** argv, BenchmarkOptions& options);
+};
+
+/**
+ * One scripted scenario. setup() runs once before warmup, step() before
+ * every frame (warmup included) and teardown() after the last frame.
+ */
+struct BenchmarkScenario {
+    std::string name;
+    std::string description;
+    std::function<void(Game&)> setup;
+    std::function<void(Game&, int frame, int totalFrames)> step;
+    std::function<void(Game&)> teardown;
+};
+
+/**
+ * Frame-time distribution of one scenario (milliseconds)
+ */
+struct FrameTimeStats {
+    double avgMs = 0.0;
+    double p50Ms = 0.0;
+    double p95Ms = 0.0;
+    double p99Ms = 0.0;
+    double maxMs = 0.0;
+    double minMs = 0.0;
+};
+
+/**
+ * Result record of one scenario, written to the JSON report
+ */
+struct BenchmarkResult {
+    std::string name;
+    std::string description;
+    int frames = 0;
+    FrameTimeStats frameTime;
+    std::vector<PassTiming> passes;
+
+    // Process memory in bytes
+    size_t memoryStartBytes = 0;
+    size_t memoryEndBytes = 0;
+    size_t memoryPeakBytes = 0;
+
+    // Scene load at the end of the scenario
+    size_t monsterCount = 0;
+    size_t projectileCount = 0;
+    int loadedChunks = 0;
+
+    // Audio mixer (zero when the game runs without audio)
+    double audioMixAvgUs = 0.0;
+    double audioMixMaxUs = 0.0;
+    double audioBufferUs = 0.0;
+    uint64_t audioVoicesStolen = 0;
+
+    // Baseline comparison
+    bool hasBaseline = false;
+    double baselineAvgMs = 0.0;
+    double baselineP95Ms = 0.0;
+    bool regressed = false;
+};
+
+/**
+ * BenchmarkRunner - Executes scenarios against a Game instance
+ */
+class BenchmarkRunner {
+private:
+    Game& game;
+    BenchmarkOptions options;
+    std::vector<BenchmarkScenario> scenarios;
+    std::vector<BenchmarkResult> results;
+    SimulationState initialState; // Captured before the first scenario, restored before each one
+
+public:
+    BenchmarkRunner(Game& game, const BenchmarkOptions& options);
+
+    // Scenario registration
+    void registerDefaultScenarios();
+    void addScenario(const BenchmarkScenario& scenario);
+
+    // Runs all matching scenarios. Returns 0 on success, 1 on regression, 2 on error.
+    int run();
+
+    const std::vector<BenchmarkResult>& getResults() const { return results; }
+
+    // Statistics helpers
+    static FrameTimeStats computeStats(std::vector<double> frameTimesMs);
+    static size_t sampleProcessMemory();
+
+private:
+    BenchmarkResult runScenario(const BenchmarkScenario& scenario);
+    void resetWorld();
+
+    bool writeReport(const std::string& path) const;
+    bool applyBaseline(const std::string& path);
+    void printSummary() const;
+};
+
+} // namespace Engine
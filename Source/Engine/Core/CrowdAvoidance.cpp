@@ -0,0 +1,195 @@
+/**
+ * CrowdAvoidance.cpp - Implementation of Reciprocal Velocity Obstacles (ORCA)
+ */
+
+#include "CrowdAvoidance.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Engine {
+
+namespace {
+
+const float EPSILON = 0.00001f;
+
+struct V2 {
+    float x, z;
+};
+
+inline V2 operator+(V2 a, V2 b) { return { a.x + b.x, a.z + b.z }; }
+inline V2 operator-(V2 a, V2 b) { return { a.x - b.x, a.z - b.z }; }
+inline V2 operator*(V2 a, float s) { return { a.x * s, a.z * s }; }
+inline float dot(V2 a, V2 b) { return a.x * b.x + a.z * b.z; }
+inline float det(V2 a, V2 b) { return a.x * b.z - a.z * b.x; }
+inline float lengthSquared(V2 a) { return dot(a, a); }
+inline V2 normalize(V2 a) {
+    float length = std::sqrt(lengthSquared(a));
+    return length > EPSILON ? a * (1.0f / length) : V2{ 0.0f, 0.0f };
+}
+
+/**
+ * Half-plane of permitted velocities: the left side of the directed line
+ */
+struct Line {
+    V2 point;
+    V2 direction;
+};
+
+// Optimizes along line lineNo subject to lines [0, lineNo) and the speed circle
+bool linearProgram1(const Line* lines, int lineNo, float radius, V2 optVelocity, bool directionOpt, V2& result) {
+    const Line& line = lines[lineNo];
+    float dotProduct = dot(line.point, line.direction);
+    float discriminant = dotProduct * dotProduct + radius * radius - lengthSquared(line.point);
+    if (discriminant < 0.0f) return false; // The speed circle misses the line
+
+    float sqrtDiscriminant = std::sqrt(discriminant);
+    float tLeft = -dotProduct - sqrtDiscriminant;
+    float tRight = -dotProduct + sqrtDiscriminant;
+
+    for (int i = 0; i < lineNo; i++) {
+        float denominator = det(line.direction, lines[i].direction);
+        float numerator = det(lines[i].direction, line.point - lines[i].point);
+        if (std::fabs(denominator) <= EPSILON) {
+            if (numerator < 0.0f) return false; // Parallel and on the forbidden side
+            continue;
+        }
+        float t = numerator / denominator;
+        if (denominator >= 0.0f) {
+            tRight = std::min(tRight, t);
+        } else {
+            tLeft = std::max(tLeft, t);
+        }
+        if (tLeft > tRight) return false;
+    }
+
+    if (directionOpt) {
+        result = line.point + line.direction * (dot(optVelocity, line.direction) > 0.0f ? tRight : tLeft);
+    } else {
+        float t = dot(line.direction, optVelocity - line.point);
+        t = std::max(tLeft, std::min(tRight, t));
+        result = line.point + line.direction * t;
+    }
+    return true;
+}
+
+// Velocity closest to optVelocity (or furthest along it if directionOpt) inside
+// every half-plane. Returns lineCount on success, else the line that failed.
+int linearProgram2(const Line* lines, int lineCount, float radius, V2 optVelocity, bool directionOpt, V2& result) {
+    if (directionOpt) {
+        result = optVelocity * radius; // optVelocity is a unit direction here
+    } else if (lengthSquared(optVelocity) > radius * radius) {
+        result = normalize(optVelocity) * radius;
+    } else {
+        result = optVelocity;
+    }
+
+    for (int i = 0; i < lineCount; i++) {
+        if (det(lines[i].direction, lines[i].point - result) > 0.0f) {
+            V2 previous = result;
+            if (!linearProgram1(lines, i, radius, optVelocity, directionOpt, result)) {
+                result = previous;
+                return i;
+            }
+        }
+    }
+    return lineCount;
+}
+
+// Infeasible crowd: minimizes the largest penetration into any half-plane
+void linearProgram3(const Line* lines, int lineCount, int beginLine, float radius, V2& result) {
+    Line projected[MAX_AVOIDANCE_NEIGHBOURS];
+    float distance = 0.0f;
+
+    for (int i = beginLine; i < lineCount; i++) {
+        if (det(lines[i].direction, lines[i].point - result) <= distance) continue;
+
+        int projectedCount = 0;
+        for (int j = 0; j < i; j++) {
+            Line line;
+            float determinant = det(lines[i].direction, lines[j].direction);
+            if (std::fabs(determinant) <= EPSILON) {
+                if (dot(lines[i].direction, lines[j].direction) > 0.0f) continue; // Same direction
+                line.point = (lines[i].point + lines[j].point) * 0.5f;            // Opposite direction
+            } else {
+                line.point = lines[i].point +
+                    lines[i].direction * (det(lines[j].direction, lines[i].point - lines[j].point) / determinant);
+            }
+            line.direction = normalize(lines[j].direction - lines[i].direction);
+            projected[projectedCount++] = line;
+        }
+
+        V2 previous = result;
+        V2 outward = { -lines[i].direction.z, lines[i].direction.x };
+        if (linearProgram2(projected, projectedCount, radius, outward, true, result) < projectedCount) {
+            result = previous; // Floating point error only; keep the last result
+        }
+        distance = det(lines[i].direction, lines[i].point - result);
+    }
+}
+
+} // namespace
+
+void computeAvoidanceVelocity(const AvoidanceAgent& self, float preferredX, float preferredZ, float maxSpeed,
+                              const AvoidanceAgent* neighbours, int count, float timeHorizon, float timeStep,
+                              float& resultX, float& resultZ) {
+    count = std::min(count, MAX_AVOIDANCE_NEIGHBOURS);
+    const float invTimeHorizon = 1.0f / std::max(timeHorizon, EPSILON);
+    const float invTimeStep = 1.0f / std::max(timeStep, EPSILON);
+    const V2 velocity = { self.velocityX, self.velocityZ };
+
+    Line lines[MAX_AVOIDANCE_NEIGHBOURS];
+    for (int n = 0; n < count; n++) {
+        const AvoidanceAgent& other = neighbours[n];
+        V2 relativePosition = { other.positionX - self.positionX, other.positionZ - self.positionZ };
+        V2 relativeVelocity = velocity - V2{ other.velocityX, other.velocityZ };
+        float distanceSquared = lengthSquared(relativePosition);
+        float combinedRadius = self.radius + other.radius;
+        float combinedRadiusSquared = combinedRadius * combinedRadius;
+
+        Line& line = lines[n];
+        V2 u;
+        if (distanceSquared > combinedRadiusSquared) {
+            // Apart: velocity obstacle is a truncated cone
+            V2 w = relativeVelocity - relativePosition * invTimeHorizon;
+            float wLengthSquared = lengthSquared(w);
+            float dotProduct = dot(w, relativePosition);
+
+            if (dotProduct < 0.0f && dotProduct * dotProduct > combinedRadiusSquared * wLengthSquared) {
+                // Closest to the cut-off circle
+                float wLength = std::sqrt(wLengthSquared);
+                V2 unitW = w * (1.0f / wLength);
+                line.direction = { unitW.z, -unitW.x };
+                u = unitW * (combinedRadius * invTimeHorizon - wLength);
+            } else {
+                // Closest to one of the legs
+                float leg = std::sqrt(distanceSquared - combinedRadiusSquared);
+                if (det(relativePosition, w) > 0.0f) {
+                    line.direction = V2{ relativePosition.x * leg - relativePosition.z * combinedRadius,
+                                         relativePosition.x * combinedRadius + relativePosition.z * leg } * (1.0f / distanceSquared);
+                } else {
+                    line.direction = V2{ relativePosition.x * leg + relativePosition.z * combinedRadius,
+                                         -relativePosition.x * combinedRadius + relativePosition.z * leg } * (-1.0f / distanceSquared);
+                }
+                u = line.direction * dot(relativeVelocity, line.direction) - relativeVelocity;
+            }
+        } else {
+            // Already overlapping: separate within one time step
+            V2 w = relativeVelocity - relativePosition * invTimeStep;
+            float wLength = std::sqrt(lengthSquared(w));
+            V2 unitW = wLength > EPSILON ? w * (1.0f / wLength) : V2{ 1.0f, 0.0f };
+            line.direction = { unitW.z, -unitW.x };
+            u = unitW * (combinedRadius * invTimeStep - wLength);
+        }
+        line.point = velocity + u * 0.5f; // Reciprocal: this agent takes half
+    }
+
+    V2 result;
+    int failed = linearProgram2(lines, count, maxSpeed, V2{ preferredX, preferredZ }, false, result);
+    if (failed < count) {
+        linearProgram3(lines, count, failed, maxSpeed, result);
+    }
+    resultX = result.x;
+    resultZ = result.z;
+}
+
+} // namespace Engine
@@ -0,0 +1,58 @@
+/**
+ * CrowdAvoidance.h - Reciprocal Velocity Obstacles (ORCA) on the Ground Plane
+ *
+ * OVERVIEW:
+ * Turns an agent's preferred velocity into one that will not collide with
+ * its neighbours within a time horizon, assuming every neighbour runs the
+ * same rule (each side takes half of the avoidance). Every neighbour adds
+ * one half-plane of permitted velocities; a small 2D linear program picks
+ * the permitted velocity closest to the preferred one, or the least
+ * penetrating one when the crowd is too dense for any velocity to be safe.
+ *
+ * FEATURES:
+ * - Stateless: computeAvoidanceVelocity reads only its arguments, so a
+ *   batch of agents can be split over any number of workers as long as
+ *   the neighbours' velocities come from the previous tick
+ * - Fixed-size constraint storage (MAX_AVOIDANCE_NEIGHBOURS), no allocation
+ * - GL-free: part of ww3_core; MonsterSimulation runs it as a batched pass
+ *
+ * Based on "Reciprocal n-Body Collision Avoidance" (van den Berg et al.)
+ * and the structure of the RVO2 reference solver, without static obstacles.
+ */
+
+#pragma once
+
+namespace Engine {
+
+const int MAX_AVOIDANCE_NEIGHBOURS = 16;
+
+/**
+ * AvoidanceAgent - One agent on the XZ plane
+ */
+struct AvoidanceAgent {
+    float positionX, positionZ;
+    float velocityX, velocityZ;     // Current (last tick's) velocity
+    float radius;
+};
+
+/**
+ * CrowdAvoidanceConfig - Tuning of the avoidance pass
+ */
+struct CrowdAvoidanceConfig {
+    bool enabled = true;
+    int maxNeighbours = 8;              // K nearest considered (<= MAX_AVOIDANCE_NEIGHBOURS)
+    float neighbourDistance = 5.0f;     // Neighbours further than this are ignored
+    float timeHorizon = 1.5f;           // Seconds ahead that must be collision-free
+};
+
+/**
+ * Velocity closest to (preferredX, preferredZ) with speed <= maxSpeed that
+ * avoids every neighbour for timeHorizon seconds. timeStep resolves agents
+ * that already overlap (they separate within one step). count is clamped to
+ * MAX_AVOIDANCE_NEIGHBOURS.
+ */
+void computeAvoidanceVelocity(const AvoidanceAgent& self, float preferredX, float preferredZ, float maxSpeed,
+                              const AvoidanceAgent* neighbours, int count, float timeHorizon, float timeStep,
+                              float& resultX, float& resultZ);
+
+} // namespace Engine
@@ -0,0 +1,120 @@
+/**
+ * ExplosionSystem.cpp - Implementation of Area Damage for Explosive Projectiles
+ */
+
+#include "ExplosionSystem.h"
+#include "MonsterSimulation.h"
+#include "../../GameObjects/Monster.h"
+#include "../../GameObjects/Player.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Engine {
+
+namespace {
+
+const float PLAYER_RADIUS = 0.5f;
+const float MONSTER_AIM_HEIGHT = 1.0f;      // Monster positions are at the feet; aim at the torso
+const float OCCLUSION_STEP = 2.0f;          // Metres between terrain samples
+const int MAX_OCCLUSION_SAMPLES = 8;
+const float OCCLUSION_TOLERANCE = 0.25f;    // Grazing the ground does not block
+
+} // namespace
+
+ExplosionSystem::ExplosionSystem()
+    : monsterSpawner(nullptr) {
+}
+
+void ExplosionSystem::addPlayer(Player* player) {
+    if (player && std::find(players.begin(), players.end(), player) == players.end()) {
+        players.push_back(player);
+    }
+}
+
+void ExplosionSystem::removePlayer(Player* player) {
+    players.erase(std::remove(players.begin(), players.end(), player), players.end());
+}
+
+float ExplosionSystem::computeFalloff(const ExplosionParams& params, float distance) {
+    if (params.radius <= 0.0f || distance >= params.radius) return 0.0f;
+    float inner = params.radius * std::max(0.0f, std::min(1.0f, params.innerRadiusFraction));
+    if (distance <= inner) return params.damage;
+    return params.damage * (params.radius - distance) / (params.radius - inner);
+}
+
+ExplosionResult ExplosionSystem::explode(const ExplosionParams& params) {
+    ExplosionResult result;
+    if (params.radius <= 0.0f || params.damage <= 0.0f) return result;
+
+    bool occlusion = params.occludedByTerrain && static_cast<bool>(terrainHeight);
+
+    // Applies falloff and occlusion for one target; returns the damage to deal
+    auto damageFor = [&](const Vec3& aimPoint, float distance) {
+        float damage = computeFalloff(params, distance);
+        if (damage <= 0.0f) return 0.0f;
+        result.candidates++;
+        if (occlusion && isOccluded(params.center, aimPoint)) {
+            result.occluded++;
+            return 0.0f;
+        }
+        result.targetsHit++;
+        result.totalDamage += damage;
+        return damage;
+    };
+
+    // Monsters: grid lookup in the simulation. Handles stay valid while
+    // kills repartition the dense arrays inside the loop.
+    if (monsterSpawner) {
+        MonsterSimulation& simulation = monsterSpawner->getSimulation();
+        simulation.queryRadius(params.center, params.radius, monsterHits);
+        for (uint32_t handle : monsterHits) {
+            if (!simulation.isValid(handle) || simulation.getState(handle) == MonsterState::Dead) continue;
+
+            Vec3 position = simulation.getPosition(handle);
+            float collisionRadius = MonsterSimulation::getArchetype(simulation.getType(handle)).collisionRadius;
+            float distance = std::max(0.0f, (position - params.center).length() - collisionRadius);
+            float damage = damageFor(position + Vec3(0.0f, MONSTER_AIM_HEIGHT, 0.0f), distance);
+            if (damage <= 0.0f) continue;
+
+            if (Monster* monster = monsterSpawner->getMonsterByHandle(handle)) {
+                monster->takeDamage(damage, params.instigator);
+            } else {
+                simulation.applyDamage(handle, damage);
+            }
+        }
+    }
+
+    // Players: a handful at most, tested directly
+    for (Player* player : players) {
+        if (!player->getActive() || player->isDead()) continue;
+        Vec3 position = player->getPosition();
+        float distance = std::max(0.0f, (position - params.center).length() - PLAYER_RADIUS);
+        float damage = damageFor(position, distance);
+        if (damage > 0.0f) {
+            player->takeDamage(damage, params.instigator);
+        }
+    }
+
+    stats.explosions++;
+    stats.candidates += static_cast<uint64_t>(result.candidates);
+    stats.targetsHit += static_cast<uint64_t>(result.targetsHit);
+    stats.occluded += static_cast<uint64_t>(result.occluded);
+    return result;
+}
+
+bool ExplosionSystem::isOccluded(const Vec3& from, const Vec3& to) const {
+    // Interior samples only: the endpoints sit on or just above the ground
+    Vec3 delta = to - from;
+    float length = delta.length();
+    int samples = std::max(1, std::min(MAX_OCCLUSION_SAMPLES, static_cast<int>(std::ceil(length / OCCLUSION_STEP))));
+    for (int i = 0; i < samples; i++) {
+        float t = (static_cast<float>(i) + 0.5f) / static_cast<float>(samples);
+        Vec3 point = from + delta * t;
+        if (point.y < terrainHeight(point.x, point.z) - OCCLUSION_TOLERANCE) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace Engine
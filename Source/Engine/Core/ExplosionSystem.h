@@ -0,0 +1,107 @@
+/**
+ * ExplosionSystem.h - Area Damage for Explosive Projectiles
+ *
+ * OVERVIEW:
+ * Applies blast damage around a point to monsters and players. Monsters are
+ * found through MonsterSimulation::queryRadius (a grid lookup over the SoA
+ * positions), players through a short list registered by the game, so the
+ * cost of an explosion depends on how many targets it reaches rather than
+ * on the size of the scene. Projectile::performExplosion calls explode()
+ * when a rocket or grenade detonates.
+ *
+ * FEATURES:
+ * - Full damage inside innerRadiusFraction of the radius, then a linear
+ *   falloff to zero at the edge, measured to the target's collision sphere
+ * - Optional terrain occlusion: the segment from the blast to the target is
+ *   sampled against a height query, and a hill in between blocks the damage
+ * - Damage goes through Monster::takeDamage / Player::takeDamage, so kills,
+ *   stuns, pack alerts and damage flashes behave as for direct hits
+ * - Per-explosion and running counters (targets tested, hit, occluded)
+ */
+
+#pragma once
+#include "../Math/Math.h"
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace Engine {
+
+// Forward declarations
+class GameObject;
+class MonsterSpawner;
+class Player;
+
+/**
+ * ExplosionParams - One detonation
+ */
+struct ExplosionParams {
+    Vec3 center;
+    float radius = 5.0f;
+    float damage = 100.0f;              // At the centre
+    float innerRadiusFraction = 0.25f;  // Full damage inside radius * this
+    GameObject* instigator = nullptr;   // Passed to takeDamage as the attacker
+    bool occludedByTerrain = true;      // Ignored without a height query
+};
+
+/**
+ * ExplosionResult - What one detonation did
+ */
+struct ExplosionResult {
+    int candidates = 0;     // Targets inside the radius
+    int targetsHit = 0;
+    int occluded = 0;       // Inside the radius but behind terrain
+    float totalDamage = 0.0f;
+};
+
+/**
+ * ExplosionStats - Totals since the last resetStats()
+ */
+struct ExplosionStats {
+    uint64_t explosions = 0;
+    uint64_t candidates = 0;
+    uint64_t targetsHit = 0;
+    uint64_t occluded = 0;
+};
+
+/**
+ * ExplosionSystem - Radius damage against monsters and players
+ */
+class ExplosionSystem {
+public:
+    // Terrain height at (x, z)
+    typedef std::function<float(float, float)> HeightQuery;
+
+private:
+    MonsterSpawner* monsterSpawner;
+    std::vector<Player*> players;
+    HeightQuery terrainHeight;
+    ExplosionStats stats;
+
+    std::vector<uint32_t> monsterHits; // Scratch: handles from the radius query
+
+public:
+    ExplosionSystem();
+
+    // Targets
+    void setMonsterSpawner(MonsterSpawner* spawner) { monsterSpawner = spawner; }
+    void addPlayer(Player* player);
+    void removePlayer(Player* player);
+    void clearPlayers() { players.clear(); }
+
+    // Occlusion (null = blasts pass through terrain)
+    void setTerrainHeightQuery(const HeightQuery& query) { terrainHeight = query; }
+
+    ExplosionResult explode(const ExplosionParams& params);
+
+    // Damage at a given distance from the centre, before occlusion
+    static float computeFalloff(const ExplosionParams& params, float distance);
+
+    const ExplosionStats& getStats() const { return stats; }
+    void resetStats() { stats = ExplosionStats(); }
+
+private:
+    bool isOccluded(const Vec3& from, const Vec3& to) const;
+};
+
+} // namespace Engine
@@ -0,0 +1,245 @@
+/**
+ * FramePacer.cpp - Implementation of Presentation and Frame Timing Control
+ */
+
+#include "FramePacer.h"
+#include <GL/glew.h>
+#define GLFW_INCLUDE_NONE
+#include <glfw3.h>
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <timeapi.h>
+#ifdef _MSC_VER
+#pragma comment(lib, "winmm.lib")
+#endif
+#endif
+
+namespace Engine {
+
+// ===== FrameTimeHistogram =====
+
+FrameTimeHistogram::FrameTimeHistogram() {
+    reset();
+}
+
+void FrameTimeHistogram::addSample(double frameMs) {
+    int bucket = static_cast<int>(frameMs);
+    bucket = std::max(0, std::min(BUCKET_COUNT - 1, bucket));
+    buckets[bucket]++;
+
+    if (sampleCount == 0 || frameMs < minMs) minMs = frameMs;
+    if (frameMs > maxMs) maxMs = frameMs;
+    totalMs += frameMs;
+    sampleCount++;
+}
+
+void FrameTimeHistogram::reset() {
+    std::fill(buckets, buckets + BUCKET_COUNT, 0);
+    sampleCount = 0;
+    totalMs = 0.0;
+    minMs = 0.0;
+    maxMs = 0.0;
+}
+
+double FrameTimeHistogram::getPercentileMs(double percentile) const {
+    if (sampleCount == 0) return 0.0;
+
+    int rank = static_cast<int>(percentile / 100.0 * sampleCount + 0.5);
+    rank = std::max(1, std::min(sampleCount, rank));
+
+    int seen = 0;
+    for (int i = 0; i < BUCKET_COUNT; i++) {
+        seen += buckets[i];
+        if (seen >= rank) {
+            return (i == BUCKET_COUNT - 1) ? maxMs : static_cast<double>(i + 1);
+        }
+    }
+    return maxMs;
+}
+
+int FrameTimeHistogram::countAbove(double frameMs) const {
+    int first = std::max(0, std::min(BUCKET_COUNT - 1, static_cast<int>(frameMs)));
+    int count = 0;
+    for (int i = first; i < BUCKET_COUNT; i++) {
+        count += buckets[i];
+    }
+    return count;
+}
+
+// ===== FramePacer =====
+
+FramePacer::FramePacer()
+    : presentMode(PresentMode::VSync), adaptiveSupported(false),
+      frameRateLimit(0.0f), framePeriod(Clock::duration::zero()),
+      spinThreshold(std::chrono::microseconds(1500)),
+      hasLastFrame(false), rawDeltaTime(0.0f), smoothedDeltaTime(0.0f), maxDeltaTime(0.1f),
+      smoothingWindow(1), historyIndex(0), historyCount(0) {
+    setSmoothingWindow(4);
+
+#ifdef _WIN32
+    // Default Windows timer resolution is ~15.6 ms, far too coarse for the limiter's sleep
+    timeBeginPeriod(1);
+#endif
+}
+
+FramePacer::~FramePacer() {
+#ifdef _WIN32
+    timeEndPeriod(1);
+#endif
+}
+
+void FramePacer::initialize() {
+    adaptiveSupported = glfwExtensionSupported("WGL_EXT_swap_control_tear") ||
+                        glfwExtensionSupported("GLX_EXT_swap_control_tear");
+    setPresentMode(presentMode);
+}
+
+void FramePacer::setPresentMode(PresentMode mode) {
+    presentMode = mode;
+
+    switch (mode) {
+        case PresentMode::VSync:
+            glfwSwapInterval(1);
+            break;
+        case PresentMode::AdaptiveVSync:
+            glfwSwapInterval(adaptiveSupported ? -1 : 1);
+            break;
+        case PresentMode::Uncapped:
+            glfwSwapInterval(0);
+            break;
+    }
+}
+
+void FramePacer::setFrameRateLimit(float framesPerSecond) {
+    frameRateLimit = std::max(0.0f, framesPerSecond);
+    if (frameRateLimit > 0.0f) {
+        framePeriod = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / frameRateLimit));
+    } else {
+        framePeriod = Clock::duration::zero();
+    }
+    nextDeadline = Clock::now();
+}
+
+void FramePacer::waitForNextFrame() {
+    if (frameRateLimit <= 0.0f) return;
+
+    Clock::time_point now = Clock::now();
+
+    // Coarse sleep, leaving the last stretch for the spin below
+    if (nextDeadline - now > spinThreshold) {
+        std::this_thread::sleep_until(nextDeadline - spinThreshold);
+    }
+    while (Clock::now() < nextDeadline) {
+        std::this_thread::yield();
+    }
+
+    // Advance by exactly one period to keep the cadence; resync if we fell more than a frame behind
+    nextDeadline += framePeriod;
+    now = Clock::now();
+    if (now > nextDeadline) {
+        nextDeadline = now + framePeriod;
+    }
+}
+
+float FramePacer::beginFrame() {
+    Clock::time_point now = Clock::now();
+    if (!hasLastFrame) {
+        lastFrameStart = now;
+        hasLastFrame = true;
+        return smoothedDeltaTime;
+    }
+
+    rawDeltaTime = std::chrono::duration<float>(now - lastFrameStart).count();
+    lastFrameStart = now;
+    histogram.addSample(rawDeltaTime * 1000.0);
+
+    // Hitches are clamped before they enter the average so one stall cannot skew several frames
+    float clampedDelta = std::min(rawDeltaTime, maxDeltaTime);
+    deltaHistory[historyIndex] = clampedDelta;
+    historyIndex = (historyIndex + 1) % smoothingWindow;
+    historyCount = std::min(historyCount + 1, smoothingWindow);
+
+    float sum = 0.0f;
+    for (int i = 0; i < historyCount; i++) {
+        sum += deltaHistory[i];
+    }
+    smoothedDeltaTime = sum / historyCount;
+    return smoothedDeltaTime;
+}
+
+void FramePacer::setSmoothingWindow(int frames) {
+    smoothingWindow = std::max(1, std::min(32, frames));
+    deltaHistory.assign(smoothingWindow, 0.0f);
+    historyIndex = 0;
+    historyCount = 0;
+}
+
+std::string FramePacer::getSummary() const {
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(2);
+    out << "=== FRAME PACING ===" << std::endl;
+    out << "Present mode: " << getPresentModeName(presentMode);
+    if (presentMode == PresentMode::AdaptiveVSync && !adaptiveSupported) {
+        out << " (unsupported, using vsync)";
+    }
+    out << std::endl;
+    out << "Frame cap: ";
+    if (frameRateLimit > 0.0f) out << frameRateLimit << " fps"; else out << "off";
+    out << ", dt smoothing: " << smoothingWindow << " frames" << std::endl;
+
+    int samples = histogram.getSampleCount();
+    out << "Frames: " << samples
+        << "  avg " << histogram.getAverageMs() << " ms"
+        << "  min " << histogram.getMinMs() << " ms"
+        << "  max " << histogram.getMaxMs() << " ms" << std::endl;
+    out << "p50 <= " << histogram.getPercentileMs(50.0) << " ms"
+        << "  p95 <= " << histogram.getPercentileMs(95.0) << " ms"
+        << "  p99 <= " << histogram.getPercentileMs(99.0) << " ms" << std::endl;
+
+    // One row per non-empty bucket, bar scaled to the fullest bucket
+    int fullest = 0;
+    for (int i = 0; i < FrameTimeHistogram::BUCKET_COUNT; i++) {
+        fullest = std::max(fullest, histogram.getBucket(i));
+    }
+    for (int i = 0; i < FrameTimeHistogram::BUCKET_COUNT && fullest > 0; i++) {
+        int count = histogram.getBucket(i);
+        if (count == 0) continue;
+        int barLength = std::max(1, count * 50 / fullest);
+        out << std::setw(3) << i << (i == FrameTimeHistogram::BUCKET_COUNT - 1 ? "+" : " ")
+            << " ms | " << std::string(barLength, '#') << " " << count << std::endl;
+    }
+    out << "====================" << std::endl;
+    return out.str();
+}
+
+const char* FramePacer::getPresentModeName(PresentMode mode) {
+    switch (mode) {
+        case PresentMode::VSync:         return "vsync";
+        case PresentMode::AdaptiveVSync: return "adaptive";
+        case PresentMode::Uncapped:      return "uncapped";
+    }
+    return "unknown";
+}
+
+bool FramePacer::parsePresentMode(const std::string& name, PresentMode& mode) {
+    if (name == "vsync" || name == "on") {
+        mode = PresentMode::VSync;
+    } else if (name == "adaptive") {
+        mode = PresentMode::AdaptiveVSync;
+    } else if (name == "uncapped" || name == "off") {
+        mode = PresentMode::Uncapped;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+} // namespace Engine
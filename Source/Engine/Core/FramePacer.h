@@ -0,0 +1,127 @@
+/**
+ * FramePacer.h - Presentation Mode, Frame Limiter and Frame-Time Statistics
+ *
+ * OVERVIEW:
+ * Owns everything about when a frame starts: the swap interval used by
+ * glfwSwapBuffers, an optional frame-rate cap, and the delta time handed to
+ * the simulation. Game asks the pacer to wait before each frame and to
+ * measure the frame that just finished.
+ *
+ * FEATURES:
+ * - Present modes: vsync, adaptive vsync (late frames tear instead of
+ *   halving the rate, when the driver supports swap_control_tear), uncapped
+ * - Frame limiter: coarse sleep until shortly before the deadline, then
+ *   spin for the remainder (sleep alone overshoots by up to a scheduler tick)
+ * - Deadlines advance by exactly one frame period so the cap does not drift
+ * - Delta-time smoothing: moving average over the last N frames with
+ *   outliers (hitches, breakpoints) clamped
+ * - Frame-time histogram (1 ms buckets) with percentiles and a console summary
+ */
+
+#pragma once
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace Engine {
+
+/**
+ * FrameTimeHistogram - Fixed 1 ms buckets from 0 to BUCKET_COUNT ms, last bucket open-ended
+ */
+class FrameTimeHistogram {
+public:
+    static const int BUCKET_COUNT = 100;
+
+private:
+    int buckets[BUCKET_COUNT];
+    int sampleCount;
+    double totalMs;
+    double minMs;
+    double maxMs;
+
+public:
+    FrameTimeHistogram();
+
+    void addSample(double frameMs);
+    void reset();
+
+    int getSampleCount() const { return sampleCount; }
+    int getBucket(int index) const { return buckets[index]; }
+    double getAverageMs() const { return sampleCount > 0 ? totalMs / sampleCount : 0.0; }
+    double getMinMs() const { return sampleCount > 0 ? minMs : 0.0; }
+    double getMaxMs() const { return maxMs; }
+    double getPercentileMs(double percentile) const; // Upper edge of the bucket holding the percentile
+    int countAbove(double frameMs) const;            // Frames in buckets starting at or above frameMs
+};
+
+/**
+ * FramePacer - Controls presentation and frame timing for the main loop
+ */
+class FramePacer {
+public:
+    enum class PresentMode {
+        VSync,          // Swap interval 1
+        AdaptiveVSync,  // Swap interval -1 (falls back to 1 without swap_control_tear)
+        Uncapped        // Swap interval 0
+    };
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    PresentMode presentMode;
+    bool adaptiveSupported;
+
+    // Frame limiter
+    float frameRateLimit;           // 0 = no cap
+    Clock::duration framePeriod;
+    Clock::time_point nextDeadline;
+    Clock::duration spinThreshold;  // Remaining time that is spun instead of slept
+
+    // Delta time
+    Clock::time_point lastFrameStart;
+    bool hasLastFrame;
+    float rawDeltaTime;
+    float smoothedDeltaTime;
+    float maxDeltaTime;             // Clamp for hitches so the simulation does not jump
+    std::vector<float> deltaHistory;
+    int smoothingWindow;
+    int historyIndex;
+    int historyCount;
+
+    FrameTimeHistogram histogram;
+
+public:
+    FramePacer();
+    ~FramePacer();
+
+    // Call with the GL context current (queries swap_control_tear and applies the swap interval)
+    void initialize();
+
+    // Presentation
+    void setPresentMode(PresentMode mode);
+    PresentMode getPresentMode() const { return presentMode; }
+    bool isAdaptiveVSyncSupported() const { return adaptiveSupported; }
+
+    // Frame limiter
+    void setFrameRateLimit(float framesPerSecond); // 0 disables the cap
+    float getFrameRateLimit() const { return frameRateLimit; }
+    void waitForNextFrame(); // Blocks until the next frame may start (no-op without a cap)
+
+    // Delta time
+    float beginFrame(); // Measures the previous frame; returns the smoothed delta in seconds
+    void setSmoothingWindow(int frames); // 1 disables smoothing
+    int getSmoothingWindow() const { return smoothingWindow; }
+    void setMaxDeltaTime(float seconds) { maxDeltaTime = seconds; }
+    float getRawDeltaTime() const { return rawDeltaTime; }
+    float getSmoothedDeltaTime() const { return smoothedDeltaTime; }
+
+    // Statistics
+    const FrameTimeHistogram& getHistogram() const { return histogram; }
+    void resetHistogram() { histogram.reset(); }
+    std::string getSummary() const;
+
+    static const char* getPresentModeName(PresentMode mode);
+    static bool parsePresentMode(const std::string& name, PresentMode& mode);
+};
+
+} // namespace Engine
@@ -0,0 +1,138 @@
+/**
+ * FrameProfiler.cpp - Implementation of Per-Pass CPU/GPU Frame Timing
+ */
+
+#include "FrameProfiler.h"
+
+namespace Engine {
+
+FrameProfiler::FrameProfiler()
+    : frameIndex(0), enabled(false), gpuTimingSupported(false) {}
+
+FrameProfiler::~FrameProfiler() {
+    cleanup();
+}
+
+bool FrameProfiler::initialize() {
+    // Timestamp queries are core in GL 3.3; older drivers expose them through ARB_timer_query
+    gpuTimingSupported = (GLEW_VERSION_3_3 || GLEW_ARB_timer_query) && glQueryCounter != nullptr;
+    return true;
+}
+
+void FrameProfiler::cleanup() {
+    if (gpuTimingSupported) {
+        for (auto& slot : passes) {
+            if (slot.measureGpu) {
+                glDeleteQueries(QUERY_LATENCY * 2, &slot.queries[0][0]);
+            }
+        }
+    }
+    passes.clear();
+    frameIndex = 0;
+}
+
+void FrameProfiler::beginFrame() {
+    if (!enabled) return;
+
+    frameIndex++;
+    int ringIndex = frameIndex % QUERY_LATENCY;
+
+    // The ring slot is about to be reused, so its queries are QUERY_LATENCY frames old
+    for (auto& slot : passes) {
+        if (slot.issued[ringIndex]) {
+            resolveQueries(slot, ringIndex);
+        }
+    }
+}
+
+void FrameProfiler::endFrame() {
+    // Nothing to flush - results are picked up lazily in beginFrame()
+}
+
+void FrameProfiler::beginPass(const std::string& name, bool measureGpu) {
+    if (!enabled) return;
+
+    PassSlot* slot = findPass(name);
+    if (!slot) {
+        PassSlot newSlot;
+        newSlot.timing.name = name;
+        newSlot.measureGpu = measureGpu && gpuTimingSupported;
+        for (int i = 0; i < QUERY_LATENCY; i++) {
+            newSlot.issued[i] = false;
+            newSlot.queries[i][0] = newSlot.queries[i][1] = 0;
+        }
+        if (newSlot.measureGpu) {
+            glGenQueries(QUERY_LATENCY * 2, &newSlot.queries[0][0]);
+        }
+        passes.push_back(newSlot);
+        slot = &passes.back();
+    }
+
+    slot->cpuStart = std::chrono::steady_clock::now();
+    if (slot->measureGpu) {
+        glQueryCounter(slot->queries[frameIndex % QUERY_LATENCY][0], GL_TIMESTAMP);
+    }
+}
+
+void FrameProfiler::endPass(const std::string& name) {
+    if (!enabled) return;
+
+    PassSlot* slot = findPass(name);
+    if (!slot) return;
+
+    auto cpuEnd = std::chrono::steady_clock::now();
+    double cpuMs = std::chrono::duration<double, std::milli>(cpuEnd - slot->cpuStart).count();
+    slot->timing.lastCpuMs = cpuMs;
+    slot->timing.totalCpuMs += cpuMs;
+    slot->timing.cpuSamples++;
+
+    if (slot->measureGpu) {
+        int ringIndex = frameIndex % QUERY_LATENCY;
+        glQueryCounter(slot->queries[ringIndex][1], GL_TIMESTAMP);
+        slot->issued[ringIndex] = true;
+    }
+}
+
+std::vector<PassTiming> FrameProfiler::getPassTimings() const {
+    std::vector<PassTiming> result;
+    result.reserve(passes.size());
+    for (const auto& slot : passes) {
+        result.push_back(slot.timing);
+    }
+    return result;
+}
+
+void FrameProfiler::resetTotals() {
+    for (auto& slot : passes) {
+        slot.timing.totalCpuMs = 0.0;
+        slot.timing.totalGpuMs = 0.0;
+        slot.timing.cpuSamples = 0;
+        slot.timing.gpuSamples = 0;
+    }
+}
+
+FrameProfiler::PassSlot* FrameProfiler::findPass(const std::string& name) {
+    // Linear search - a frame has about a dozen passes
+    for (auto& slot : passes) {
+        if (slot.timing.name == name) {
+            return &slot;
+        }
+    }
+    return nullptr;
+}
+
+void FrameProfiler::resolveQueries(PassSlot& slot, int ringIndex) {
+    GLuint64 startNs = 0, endNs = 0;
+    glGetQueryObjectui64v(slot.queries[ringIndex][0], GL_QUERY_RESULT, &startNs);
+    glGetQueryObjectui64v(slot.queries[ringIndex][1], GL_QUERY_RESULT, &endNs);
+    slot.issued[ringIndex] = false;
+
+    if (endNs < startNs) return;
+
+    double gpuMs = static_cast<double>(endNs - startNs) / 1000000.0;
+    slot.timing.lastGpuMs = gpuMs;
+    slot.timing.totalGpuMs += gpuMs;
+    slot.timing.gpuSamples++;
+}
+
+} // namespace Engine
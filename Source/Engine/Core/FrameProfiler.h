@@ -0,0 +1,114 @@
+/**
+ * FrameProfiler.h - Per-Pass CPU/GPU Frame Timing
+ *
+ * OVERVIEW:
+ * Lightweight profiler used by Game to time the individual passes of a frame
+ * (simulation, water reflection/refraction, main scene, weapon, monsters, UI).
+ * CPU time is measured with a steady clock around each pass, GPU time with
+ * GL_TIMESTAMP queries (core since OpenGL 3.3).
+ *
+ * FEATURES:
+ * - Named passes, created on first use and kept in submission order
+ * - Ring of query objects so GPU results are read back QUERY_LATENCY frames
+ *   later without stalling the pipeline
+ * - Per-pass running totals for averaging over a benchmark run
+ * - Zero cost when disabled (the default outside of benchmark runs)
+ */
+
+#pragma once
+#include <GL/glew.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace Engine {
+
+/**
+ * Timing of one pass, as seen by callers of FrameProfiler
+ */
+struct PassTiming {
+    std::string name;
+    double lastCpuMs = 0.0;     // CPU time of the most recent frame
+    double lastGpuMs = 0.0;     // GPU time of the most recently resolved frame
+    double totalCpuMs = 0.0;    // Accumulated since the last resetTotals()
+    double totalGpuMs = 0.0;
+    int cpuSamples = 0;
+    int gpuSamples = 0;
+
+    double getAverageCpuMs() const { return cpuSamples > 0 ? totalCpuMs / cpuSamples : 0.0; }
+    double getAverageGpuMs() const { return gpuSamples > 0 ? totalGpuMs / gpuSamples : 0.0; }
+};
+
+/**
+ * FrameProfiler - Collects CPU/GPU time per named frame pass
+ */
+class FrameProfiler {
+public:
+    static const int QUERY_LATENCY = 4; // Frames between issuing and reading GPU queries
+
+private:
+    struct PassSlot {
+        PassTiming timing;
+        bool measureGpu;
+        std::chrono::steady_clock::time_point cpuStart;
+        GLuint queries[QUERY_LATENCY][2];
+        bool issued[QUERY_LATENCY];
+    };
+
+    std::vector<PassSlot> passes;
+    int frameIndex;
+    bool enabled;
+    bool gpuTimingSupported;
+
+public:
+    FrameProfiler();
+    ~FrameProfiler();
+
+    // Lifecycle (requires a current GL context for GPU timing)
+    bool initialize();
+    void cleanup();
+
+    // Frame boundaries - resolves GPU queries issued QUERY_LATENCY frames ago
+    void beginFrame();
+    void endFrame();
+
+    // Pass scopes (passes must not be nested under the same name)
+    void beginPass(const std::string& name, bool measureGpu = true);
+    void endPass(const std::string& name);
+
+    // Configuration
+    void setEnabled(bool enable) { enabled = enable; }
+    bool isEnabled() const { return enabled; }
+    bool hasGpuTiming() const { return gpuTimingSupported; }
+
+    // Results
+    std::vector<PassTiming> getPassTimings() const;
+    void resetTotals();
+
+private:
+    PassSlot* findPass(const std::string& name);
+    void resolveQueries(PassSlot& slot, int ringIndex);
+};
+
+/**
+ * ProfileScope - RAII helper pairing beginPass/endPass
+ */
+class ProfileScope {
+private:
+    FrameProfiler* profiler;
+    const char* passName;
+
+public:
+    ProfileScope(FrameProfiler* profiler, const char* name, bool measureGpu = true)
+        : profiler(profiler), passName(name) {
+        if (profiler) profiler->beginPass(passName, measureGpu);
+    }
+    ~ProfileScope() {
+        if (profiler) profiler->endPass(passName);
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+};
+
+} // namespace Engine
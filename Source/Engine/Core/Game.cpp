@@ -16,6 +16,8 @@
 #include "../Rendering/MonsterRenderer.h"
 #include "../Rendering/LightingRenderer.h"
 #include "../Rendering/WaterRenderer.h"
+#include "../Rendering/ReverseZ.h"
+#include "../Rendering/TextureHealthBar.h"
 #include "../../GameObjects/Crosshair.h"
 #include "../../GameObjects/Minimap.h"
 #include "../../GameObjects/Arrow.h"
@@ -23,9 +25,15 @@
 #include "../../GameObjects/AmmoUI.h"
 #include "../../GameObjects/Monster.h"
 #include "../Input/Input.h"
+#include "../Network/NetClient.h"
+#include "TimerWheel.h"
+#include "TaskScheduler.h"
 #include <GL/glew.h>
 #include <glfw3.h>
+#include <algorithm>
+#include <chrono>
 #include <iostream>
+#include <limits>
 
 // Define M_PI if not already defined
 #ifndef M_PI
@@ -34,11 +42,32 @@
 
 namespace Engine {
 
+namespace {
+
+// Entity transform at the frame's point between two ticks, as placeDraw() places its draws
+void placeEntity(const EntityRenderState& entity, const RenderSnapshot* previous, float alpha,
+                 Vec3& position, Vec3& rotation, Vec3& scale) {
+    const EntityRenderState* from = previous ? previous->findEntity(entity.id) : nullptr;
+    if (!from) {
+        position = entity.position;
+        rotation = entity.rotation;
+        scale = entity.scale;
+        return;
+    }
+    position = interpolatePosition(from->position, entity.position, alpha);
+    rotation = interpolateEulerDegrees(from->rotation, entity.rotation, alpha);
+    scale = interpolatePosition(from->scale, entity.scale, alpha);
+}
+
+} // namespace
+
 Game::Game(int width, int height, const char* title)
     : window(nullptr), windowWidth(width), windowHeight(height), windowTitle(title),
       isRunning(false), isInitialized(false), deltaTime(0.0f), lastFrame(0.0f),
       isFullscreen(false), windowed_width(width), windowed_height(height),
-      crosshair(nullptr) {}
+      crosshair(nullptr), threadedMode(false), simulationTickRate(60.0f), loaderContext(nullptr),
+      simulationActive(false), pendingUploadFence(nullptr), simulationTick(0),
+      networkStatsTimer(0.0f) {}
 
 Game::~Game() {
     cleanup();
@@ -107,8 +136,23 @@ bool Game::initializeGLEW() {
 }
 
 void Game::setupSystems() {
-    // Initialize camera
+    // Initialize camera (reverse-Z projection when clip control is available)
     camera = std::make_unique<Camera>();
+    camera->setAspectRatio(windowWidth, windowHeight);
+    ReverseZ::initialize();
+    camera->setReverseZ(ReverseZ::isEnabled());
+    
+    // Frames are drawn through their own camera, posed from the render snapshots
+    renderCamera.setAspectRatio(windowWidth, windowHeight);
+    renderCamera.setReverseZ(ReverseZ::isEnabled());
+    
+    // Initialize frame profiler (disabled until a benchmark enables it)
+    frameProfiler = std::make_unique<FrameProfiler>();
+    frameProfiler->initialize();
+    
+    // Initialize frame pacing (applies the default vsync swap interval)
+    framePacer = std::make_unique<FramePacer>();
+    framePacer->initialize();
     
     // Initialize renderer factory (creates and manages all renderers)
     if (!RendererFactory::getInstance().initialize(windowWidth, windowHeight)) {
@@ -116,6 +160,12 @@ void Game::setupSystems() {
         return;
     }
     
+    // Initialize dynamic resolution (the game still runs at native resolution if this fails)
+    dynamicResolution = std::make_unique<DynamicResolution>();
+    if (!dynamicResolution->initialize(windowWidth, windowHeight)) {
+        dynamicResolution.reset();
+    }
+    
     // Initialize scene
     scene = std::make_unique<Scene>("MainScene");
     if (!scene->initialize()) {
@@ -123,9 +173,32 @@ void Game::setupSystems() {
         return;
     }
     
+    // Initialize particles (the game still runs without drawing them if the renderer fails)
+    particleSystem = std::make_unique<ParticleSystem>();
+    particleRenderer = std::make_unique<ParticleRenderer>();
+    if (!particleRenderer->initialize()) {
+        particleRenderer.reset();
+    }
+    particleSystem->setGpuSimulationAvailable(particleRenderer && particleRenderer->supportsGpuSimulation());
+    
+    // Distant monsters as baked billboards (every monster keeps its mesh if this fails)
+    monsterImpostors = std::make_unique<MonsterImpostorRenderer>();
+    if (!monsterImpostors->initialize()) {
+        monsterImpostors.reset();
+    }
+    
+    // Monster health bars: one bar, drawn at each monster's health (the game runs without them if this fails)
+    healthBar = std::make_unique<TextureHealthBar>(2.5f, 0.5f, 2.5f); // 2.5 units above the monster
+    if (!healthBar->initialize()) {
+        healthBar.reset();
+    }
+    
+    // Start the mixer thread (the game runs silent without an output device)
+    setupAudio();
+    
     // Initialize projectile manager (before scene objects so weapon can use it)
     projectileManager = std::make_unique<ProjectileManager>();
-    projectileManager->initialize(nullptr, nullptr, nullptr); // No collision, particles, or audio for now
+    projectileManager->initialize(nullptr, particleSystem.get(), audioSystem.get()); // No collision system yet
     
     // Setup scene objects
     setupSceneObjects();
@@ -154,25 +227,291 @@ void Game::run() {
         return;
     }
     
+    if (threadedMode) {
+        runThreaded();
+        return;
+    }
+    
     // Main game loop
     while (isRunning && !glfwWindowShouldClose(window)) {
+        framePacer->waitForNextFrame();
         calculateDeltaTime();
+        stepFrame(deltaTime);
+    }
+}
+
+void Game::runThreaded() {
+    // Hidden 1x1 window whose context shares objects with the main one; the simulation
+    // thread makes it current so chunk/monster/projectile resources can still be created there
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    loaderContext = glfwCreateWindow(1, 1, "WW3 Loader", nullptr, window);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE);
+    if (!loaderContext) {
+        std::cout << "Shared loader context unavailable - falling back to single-threaded loop" << std::endl;
+        threadedMode = false;
+        run();
+        return;
+    }
+    glfwMakeContextCurrent(window);
+    
+    renderSnapshots.reset();
+    simulationTick = 0;
+    simulationActive = true;
+    simulationThread = std::thread(&Game::simulationLoop, this);
+    
+    // Render loop: owns the window, input events and the GL context. It only reads published
+    // snapshots, so it never waits for a tick and the ticks never wait for it
+    while (isRunning && !glfwWindowShouldClose(window)) {
+        // The simulation keeps its own fixed tick; the pacer only caps and measures render frames
+        framePacer->waitForNextFrame();
+        deltaTime = framePacer->beginFrame();
+        frameProfiler->beginFrame();
         
-        // Process input
+        // Input callbacks only queue events; the simulation drains them at its next tick
         glfwPollEvents();
         
-        // Update game logic
-        update(deltaTime);
+        // Make the simulation thread's uploads visible before drawing with them
+        GLsync uploadFence = pendingUploadFence.exchange(nullptr);
+        if (uploadFence) {
+            glWaitSync(uploadFence, 0, GL_TIMEOUT_IGNORED);
+            glDeleteSync(uploadFence);
+        }
+        Mesh::releaseDeferredVertexArrays();
+        
+        // Particles advance once per tick, from the snapshot that tick produced
+        if (renderSnapshots.acquireLatest() && particleRenderer) {
+            particleRenderer->simulate(renderSnapshots.getCurrent().particles);
+        }
+        
+        // Draw one tick behind, interpolating from the previous snapshot towards the newest
+        Renderer* defaultRenderer = RendererFactory::getInstance().getDefaultRenderer();
+        if (renderSnapshots.hasSnapshot() && defaultRenderer) {
+            const RenderSnapshot& current = renderSnapshots.getCurrent();
+            const RenderSnapshot* previous = nullptr;
+            float alpha = 1.0f;
+            if (renderSnapshots.hasInterpolationPair()) {
+                previous = &renderSnapshots.getPrevious();
+                float tickDelta = 1.0f / simulationTickRate;
+                alpha = static_cast<float>((glfwGetTime() - current.simulationTime) / tickDelta);
+                alpha = std::max(0.0f, std::min(1.0f, alpha));
+            }
+            renderPasses(previous, current, alpha);
+            
+            ProfileScope presentScope(frameProfiler.get(), "present");
+            defaultRenderer->endFrame(window);
+        }
         
-        // Render frame
-        render();
+        frameProfiler->endFrame();
+    }
+    
+    simulationActive = false;
+    if (simulationThread.joinable()) {
+        simulationThread.join();
     }
+    
+    GLsync uploadFence = pendingUploadFence.exchange(nullptr);
+    if (uploadFence) {
+        glDeleteSync(uploadFence);
+    }
+    Mesh::releaseDeferredVertexArrays();
+    glfwDestroyWindow(loaderContext);
+    loaderContext = nullptr;
+    isRunning = false;
 }
 
-void Game::update(float deltaTime) {
+void Game::simulationLoop() {
+    glfwMakeContextCurrent(loaderContext);
+    Mesh::setDeferVertexArrays(true);
+    
+    using Clock = std::chrono::steady_clock;
+    const float tickDelta = 1.0f / simulationTickRate;
+    const auto tickDuration = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(tickDelta));
+    const int maxCatchUpTicks = 5; // Beyond this the simulation slows down instead of spiralling
+    
+    auto nextTick = Clock::now();
+    while (simulationActive) {
+        auto now = Clock::now();
+        if (now < nextTick) {
+            std::this_thread::sleep_until(nextTick);
+            continue;
+        }
+        
+        int ticksRun = 0;
+        while (now >= nextTick && ticksRun < maxCatchUpTicks && simulationActive) {
+            runSimulationTick(tickDelta);
+            nextTick += tickDuration;
+            ticksRun++;
+            now = Clock::now();
+        }
+        if (now >= nextTick) {
+            nextTick = now + tickDuration; // Drop the backlog after a long stall
+        }
+    }
+    
+    Mesh::setDeferVertexArrays(false);
+    glfwMakeContextCurrent(nullptr);
+}
+
+void Game::runSimulationTick(float tickDelta) {
+    // The world belongs to this thread; the render thread only sees the published snapshot
+    auto tickStart = std::chrono::steady_clock::now();
+    
+    update(tickDelta);
+    
+    RenderSnapshot& snapshot = renderSnapshots.beginWrite();
+    captureRenderSnapshot(snapshot);
+    snapshot.tick = ++simulationTick;
+    snapshot.simulationTime = glfwGetTime();
+    snapshot.tickMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - tickStart).count();
+    renderSnapshots.publish();
+    fenceSimulationUploads();
+}
+
+void Game::fenceSimulationUploads() {
+    // Fence the uploads made so far; the render thread waits on it before drawing
+    GLsync uploadFence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glFlush();
+    GLsync previousFence = pendingUploadFence.exchange(uploadFence);
+    if (previousFence) {
+        glDeleteSync(previousFence); // Later fence on the same context covers it
+    }
+}
+
+void Game::captureRenderSnapshot(RenderSnapshot& snapshot) {
+    if (camera) {
+        snapshot.camera.position = camera->getPosition();
+        snapshot.camera.yaw = camera->getYaw();
+        snapshot.camera.pitch = camera->getPitch();
+    }
+    // Late latching measures the cursor movement from where this tick's mouse look ended
+    snapshot.camera.hasCursor = Input::getInstance().getTickCursorPosition(snapshot.camera.cursorX, snapshot.camera.cursorY);
+    
+    auto captureObject = [&snapshot](const GameObject* object, RenderEntityKind kind) {
+        EntityRenderState state;
+        state.id = object->getId();
+        state.kind = kind;
+        state.position = object->getPosition();
+        state.rotation = object->getRotation();
+        state.scale = object->getScale();
+        snapshot.entities.push_back(state);
+        return &snapshot.entities.back();
+    };
+    
+    if (scene) {
+        for (GameObject* object : scene->getAllGameObjects()) {
+            if (dynamic_cast<Monster*>(object)) continue; // Captured with their gameplay state below
+            captureObject(object, RenderEntityKind::Object);
+        }
+        scene->captureDraws(snapshot.sceneDraws, snapshot.overlayDraws);
+    }
+    
+    if (monsterSpawner) {
+        for (Monster* monster : monsterSpawner->getActiveMonsters()) {
+            if (!monster || !monster->getActive()) continue;
+            EntityRenderState* state = captureObject(monster, RenderEntityKind::Monster);
+            state->healthPercent = monster->getHealthPercentage();
+            state->state = static_cast<int>(monster->getViewState());
+            state->alive = monster->isViewAlive();
+            state->showHealthBar = monster->getShowHealthBar();
+            state->damageFlash = monster->isDamageFlashing();
+            state->drawBegin = static_cast<uint32_t>(snapshot.monsterDraws.size());
+            monster->captureDraws(snapshot.monsterDraws);
+            state->drawEnd = static_cast<uint32_t>(snapshot.monsterDraws.size());
+            if (state->alive) {
+                snapshot.hud.activeMonsters++;
+            }
+        }
+    }
+    
+    if (projectileManager) {
+        for (const auto& projectile : projectileManager->getActiveProjectiles()) {
+            if (projectile && projectile->isActive()) {
+                captureObject(projectile.get(), RenderEntityKind::Projectile);
+                snapshot.hud.activeProjectiles++;
+            }
+        }
+        projectileManager->captureDraws(snapshot.projectileDraws);
+    }
+    
+    if (weapon) {
+        weapon->captureDraws(snapshot.viewModelDraws);
+        
+        // The values AmmoUI used to read from the weapon itself
+        snapshot.hud.hasWeapon = true;
+        snapshot.hud.currentAmmo = weapon->getCurrentAmmo();
+        snapshot.hud.reserveAmmo = weapon->getReserveAmmo();
+        snapshot.hud.reloading = weapon->isReloading();
+        const ShootingSystem* shootingSystem = weapon->getShootingComponent().getShootingSystem();
+        if (shootingSystem) {
+            const WeaponStats& stats = shootingSystem->getWeaponStats();
+            snapshot.hud.maxAmmo = stats.maxAmmo;
+            snapshot.hud.maxReserveAmmo = stats.maxReserveAmmo;
+            if (snapshot.hud.reloading && stats.reloadTime > 0.0f) {
+                snapshot.hud.reloadProgress = std::max(0.0f, std::min(1.0f, shootingSystem->getReloadRemaining() / stats.reloadTime));
+            }
+        }
+        snapshot.hud.barrelTip = weapon->getBarrelTipPosition();
+    }
+    
+    if (particleSystem) {
+        particleSystem->captureRenderState(snapshot.particles);
+    }
+    
+    snapshot.finalize();
+}
+
+void Game::setSimulationTickRate(float ticksPerSecond) {
+    simulationTickRate = std::max(10.0f, std::min(1000.0f, ticksPerSecond));
+}
+
+void Game::stepFrame(float frameDeltaTime) {
+    deltaTime = frameDeltaTime;
+    frameProfiler->beginFrame();
+    
     // Process input
+    glfwPollEvents();
+    
+    // Update game logic, then capture what the frame draws
+    {
+        ProfileScope simulationScope(frameProfiler.get(), "simulation", false);
+        update(deltaTime);
+        frameSnapshot.clear();
+        captureRenderSnapshot(frameSnapshot);
+    }
+    if (particleRenderer) {
+        particleRenderer->simulate(frameSnapshot.particles);
+    }
+    
+    // Render frame
+    render();
+    
+    frameProfiler->endFrame();
+    
+    if (glfwWindowShouldClose(window)) {
+        isRunning = false;
+    }
+}
+
+void Game::update(float deltaTime) {
+    // Drain the events queued since the last tick into this tick's snapshot; everything
+    // below reads the same input, with press/release edges instead of debounce flags
     Input& input = Input::getInstance();
-    input.processInput(deltaTime);
+    input.beginTick(glfwGetTime());
+    const InputSnapshot& actions = input.getSnapshot();
+    input.processMouseLook();
+    if (!networkClient) {
+        input.processInput(deltaTime);
+    }
+    
+    // Fire gameplay timers (reloads, damage flashes, ...) that came due,
+    // then resume the tasks they and last frame's events woke
+    TimerWheel::getInstance().advance(deltaTime);
+    TaskScheduler::getInstance().update();
+    
+    // Network client: movement and shooting are sent to the server, the world comes back
+    if (networkClient) {
+        updateNetworkClient(deltaTime);
+    }
     
     // Update scene
     if (scene) {
@@ -190,22 +529,10 @@ void Game::update(float deltaTime) {
         }
     }
     
-    // Update minimap
-    if (minimap) {
-        minimap->setPlayerPosition(camera->getPosition());
-        minimap->update(deltaTime);
-    }
-    
     // Update weapon
     if (weapon) {
         weapon->update(deltaTime);
         
-        // Update AmmoUI
-        if (ammoUI) {
-            ammoUI->update(deltaTime);
-        }
-        
-        
         // Update camera recoil recovery
         if (camera) {
             camera->updateRecoil(deltaTime);
@@ -250,111 +577,84 @@ void Game::update(float deltaTime) {
             projectileManager->checkAllCollisions(allGameObjects);
         }
         
-        // Handle shooting with mouse buttons
-        static bool leftMousePressed = false, rightMousePressed = false;
-        
-        // Left mouse button for firing
-        if (input.isMouseButtonPressed(GLFW_MOUSE_BUTTON_LEFT) && !leftMousePressed) {
-            weapon->startFiring();
-            leftMousePressed = true;
-        } else if (!input.isMouseButtonPressed(GLFW_MOUSE_BUTTON_LEFT) && leftMousePressed) {
-            weapon->stopFiring();
-            leftMousePressed = false;
-        }
-        
-        // Right mouse button for single shot (alternative firing)
-        if (input.isMouseButtonPressed(GLFW_MOUSE_BUTTON_RIGHT) && !rightMousePressed) {
-            weapon->fireSingleShot();
-            rightMousePressed = true;
-        } else if (!input.isMouseButtonPressed(GLFW_MOUSE_BUTTON_RIGHT)) {
-            rightMousePressed = false;
-        }
-        
-        // Middle mouse button for monster hunter shot
-        static bool middleMousePressed = false;
-        if (input.isMouseButtonPressed(GLFW_MOUSE_BUTTON_MIDDLE) && !middleMousePressed) {
-            weapon->fireMonsterHunterShot();
-            middleMousePressed = true;
-        } else if (!input.isMouseButtonPressed(GLFW_MOUSE_BUTTON_MIDDLE)) {
-            middleMousePressed = false;
-        }
-        
-        // R key for reload
-        static bool reloadKeyPressed = false;
-        if (input.isKeyPressed(GLFW_KEY_R) && !reloadKeyPressed) {
-            weapon->reload();
-            reloadKeyPressed = true;
-        } else if (!input.isKeyPressed(GLFW_KEY_R)) {
-            reloadKeyPressed = false;
-        }
-        
-        // H key for monster hunter shot
-        static bool monsterHunterKeyPressed = false;
-        if (input.isKeyPressed(GLFW_KEY_H) && !monsterHunterKeyPressed) {
-            weapon->fireMonsterHunterShot();
-            monsterHunterKeyPressed = true;
-        } else if (!input.isKeyPressed(GLFW_KEY_H)) {
-            monsterHunterKeyPressed = false;
-        }
-        
-        // Handle weapon switching with number keys 1-5
-        static bool key1Pressed = false, key2Pressed = false, key3Pressed = false, key4Pressed = false, key5Pressed = false;
-        
-        if (input.isKeyPressed(GLFW_KEY_1) && !key1Pressed) {
-            weapon->switchToWeapon(0); // Assault Rifle
-            key1Pressed = true;
-        } else if (!input.isKeyPressed(GLFW_KEY_1)) {
-            key1Pressed = false;
-        }
-        
-        if (input.isKeyPressed(GLFW_KEY_2) && !key2Pressed) {
-            weapon->switchToWeapon(1); // Sniper Rifle
-            key2Pressed = true;
-        } else if (!input.isKeyPressed(GLFW_KEY_2)) {
-            key2Pressed = false;
-        }
-        
-        if (input.isKeyPressed(GLFW_KEY_3) && !key3Pressed) {
-            weapon->switchToWeapon(2); // Submachine Gun
-            key3Pressed = true;
-        } else if (!input.isKeyPressed(GLFW_KEY_3)) {
-            key3Pressed = false;
-        }
-        
-        if (input.isKeyPressed(GLFW_KEY_4) && !key4Pressed) {
-            weapon->switchToWeapon(3); // Pistol
-            key4Pressed = true;
-        } else if (!input.isKeyPressed(GLFW_KEY_4)) {
-            key4Pressed = false;
-        }
-        
-        if (input.isKeyPressed(GLFW_KEY_5) && !key5Pressed) {
-            weapon->switchToWeapon(4); // Shotgun
-            key5Pressed = true;
-        } else if (!input.isKeyPressed(GLFW_KEY_5)) {
-            key5Pressed = false;
+        // Shooting (the server fires for us in network client mode)
+        if (!networkClient) {
+            // Shots spawn at the end of the tick; lead them by the time since the press
+            auto pressLead = [&](InputAction action) {
+                return (1.0f - actions.getTickFraction(actions.getPressTime(action))) * deltaTime;
+            };
+            
+            // Fire is held for automatic weapons: start on press, stop on release.
+            // A click that ended within the tick fires once instead.
+            if (actions.wasPressed(InputAction::Fire)) {
+                if (actions.isHeld(InputAction::Fire)) {
+                    weapon->startFiring();
+                } else {
+                    weapon->fireSingleShot(pressLead(InputAction::Fire));
+                }
+            }
+            if (actions.wasReleased(InputAction::Fire) && !actions.isHeld(InputAction::Fire)) {
+                weapon->stopFiring();
+            }
+            
+            if (actions.wasPressed(InputAction::FireSingle)) {
+                weapon->fireSingleShot(pressLead(InputAction::FireSingle));
+            }
+            if (actions.wasPressed(InputAction::HunterShot)) {
+                weapon->fireMonsterHunterShot();
+            }
+            if (actions.wasPressed(InputAction::Reload)) {
+                weapon->reload();
+            }
+            
+            // Quick-save and quick-load (falls back to the file from an earlier session)
+            if (actions.wasPressed(InputAction::QuickSave)) {
+                quickSave.capture(getSimulationWorld());
+                quickSave.saveToFile("quicksave.ww3s");
+            }
+            if (actions.wasPressed(InputAction::QuickLoad)) {
+                if (!quickSave.isEmpty() || quickSave.loadFromFile("quicksave.ww3s")) {
+                    weapon->stopFiring();
+                    if (quickSave.restore(getSimulationWorld()) && monsterSpawner) {
+                        weapon->setRandomKey(monsterSpawner->getWorldSeed()); // Shot counter restarts with the restored world
+                    }
+                }
+            }
         }
         
-        // T key for terrain statistics
-        static bool terrainStatsKeyPressed = false;
-        if (input.isKeyPressed(GLFW_KEY_T) && !terrainStatsKeyPressed) {
-            terrainStatsKeyPressed = true;
-        } else if (!input.isKeyPressed(GLFW_KEY_T)) {
-            terrainStatsKeyPressed = false;
+        // Weapon switching: assault rifle, sniper rifle, submachine gun, pistol, shotgun
+        const InputAction weaponSlots[] = { InputAction::Weapon1, InputAction::Weapon2, InputAction::Weapon3,
+                                            InputAction::Weapon4, InputAction::Weapon5 };
+        for (int slot = 0; slot < 5; slot++) {
+            if (actions.wasPressed(weaponSlots[slot])) {
+                weapon->switchToWeapon(slot);
+            }
         }
         
-        // W key for water statistics
-        static bool waterStatsKeyPressed = false;
-        if (input.isKeyPressed(GLFW_KEY_W) && !waterStatsKeyPressed) {
-            waterStatsKeyPressed = true;
-        } else if (!input.isKeyPressed(GLFW_KEY_W)) {
-            waterStatsKeyPressed = false;
+        // Toggle the depth prepass of the opaque scene pass
+        if (actions.wasPressed(InputAction::ToggleDepthPrepass)) {
+            if (auto* opaqueRenderer = dynamic_cast<BasicRenderer*>(RendererFactory::getInstance().getDefaultRenderer())) {
+                opaqueRenderer->setDepthPrepassEnabled(!opaqueRenderer->isDepthPrepassEnabled());
+            }
         }
     }
     
+    // Advance particles, including the ones projectiles emitted this frame
+    if (particleSystem) {
+        particleSystem->update(deltaTime);
+    }
+    
+    // Sounds queued this frame are placed relative to the camera
+    if (audioSystem && camera) {
+        audioSystem->setListener(camera->getPosition(), camera->getRight());
+    }
+    
     // Update monster spawner
     if (monsterSpawner) {
-        monsterSpawner->update(deltaTime);
+        // Replicated monsters are driven by updateNetworkClient instead
+        if (!networkClient) {
+            monsterSpawner->update(deltaTime);
+        }
         
         // Debug monster spawner status
         static int spawnerDebugCount = 0;
@@ -377,94 +677,323 @@ void Game::update(float deltaTime) {
     }
 }
 
-void Game::render() {
+bool Game::connectToServer(const std::string& address) {
+    NetAddress server;
+    if (!NetAddress::parse(address, NetProtocol::DEFAULT_PORT, server)) {
+        std::cerr << "Cannot resolve server address '" << address << "'" << std::endl;
+        return false;
+    }
+    
+    auto client = std::make_unique<NetClient>();
+    if (!client->connect(server)) {
+        return false;
+    }
+    
+    // The server owns the monsters from now on: retire the locally spawned ones
+    if (monsterSpawner) {
+        for (Monster* monster : monsterSpawner->getActiveMonsters()) {
+            if (monster && !monster->isDead()) {
+                monster->die();
+            }
+        }
+    }
+    
+    networkClient = std::move(client);
+    networkStatsTimer = 0.0f;
+    std::cout << "Connecting to " << server.toString() << "..." << std::endl;
+    return true;
+}
+
+void Game::updateNetworkClient(float deltaTime) {
+    networkClient->update();
+    if (networkClient->getState() == NetClient::State::Disconnected) {
+        // Safe from the simulation thread; both game loops check it
+        glfwSetWindowShouldClose(window, GLFW_TRUE);
+        return;
+    }
+    if (!networkClient->isConnected()) return; // Handshake in progress
+    
+    // This tick's command; the client predicts it immediately
+    const InputSnapshot& actions = Input::getInstance().getSnapshot();
+    NetPlayerInput command;
+    if (actions.isHeld(InputAction::MoveForward)) command.buttons |= NetButtons::Forward;
+    if (actions.isHeld(InputAction::MoveBack)) command.buttons |= NetButtons::Back;
+    if (actions.isHeld(InputAction::StrafeLeft)) command.buttons |= NetButtons::Left;
+    if (actions.isHeld(InputAction::StrafeRight)) command.buttons |= NetButtons::Right;
+    if (actions.isHeld(InputAction::MoveUp)) command.buttons |= NetButtons::Up;
+    if (actions.isHeld(InputAction::MoveDown)) command.buttons |= NetButtons::Down;
+    // A click shorter than the tick still fires once
+    if (actions.isHeld(InputAction::Fire) || actions.wasPressed(InputAction::Fire)) command.buttons |= NetButtons::Fire;
+    command.yaw = camera->getYaw();
+    command.pitch = camera->getPitch();
+    command.deltaTime = deltaTime;
+    networkClient->sendInput(command);
+    camera->setPosition(networkClient->getPredictedPlayer().position);
+    
+    // Everything else is shown a little in the past, interpolated between snapshots
+    if (networkClient->sampleWorld(replicatedWorld)) {
+        if (monsterSpawner) {
+            monsterSpawner->applyReplicatedMonsters(replicatedWorld.monsters);
+        }
+        updateRemotePlayers();
+        if (projectileManager) {
+            for (const NetProjectileState& projectile : replicatedWorld.projectiles) {
+                projectileManager->emitTracer(static_cast<ProjectileType>(projectile.type), projectile.position, projectile.velocity);
+            }
+        }
+    }
+    
+    networkStatsTimer += deltaTime;
+    if (networkStatsTimer >= 5.0f) {
+        const NetClientStats& stats = networkClient->getStats();
+        std::cout << "=== NETWORK ===" << std::endl;
+        std::cout << "Input ack: " << stats.inputAckMs << " ms, interpolation delay: "
+                  << networkClient->getInterpolationDelay() * 1000.0f << " ms" << std::endl;
+        std::cout << "Snapshots: " << stats.snapshotsReceived << ", corrections: " << stats.predictionCorrections
+                  << " (last " << stats.lastCorrection << ")" << std::endl;
+        std::cout << "Received " << stats.bytesReceived << " B, sent " << stats.bytesSent << " B" << std::endl;
+        std::cout << "===============" << std::endl;
+        networkStatsTimer = 0.0f;
+    }
+}
+
+void Game::updateRemotePlayers() {
     if (!scene) return;
     
+    for (GameObject* avatar : remotePlayers) {
+        if (avatar) avatar->setActive(false);
+    }
+    
+    for (const NetPlayerState& player : replicatedWorld.players) {
+        if (player.clientId == networkClient->getClientId()) continue; // That one is the camera
+        
+        if (player.clientId >= remotePlayers.size()) {
+            remotePlayers.resize(player.clientId + 1, nullptr);
+        }
+        GameObject*& avatar = remotePlayers[player.clientId];
+        if (!avatar) {
+            std::string name = "RemotePlayer_" + std::to_string(player.clientId);
+            scene->addGameObject(std::make_unique<Cube>(name, Vec3(0.2f, 0.6f, 1.0f)));
+            avatar = scene->getGameObject(name); // Null if it failed to initialize
+            if (!avatar) continue;
+        }
+        avatar->setActive(player.health > 0.0f);
+        avatar->setPosition(player.position);
+        avatar->setRotation(Vec3(0.0f, -player.yaw * 180.0f / static_cast<float>(M_PI), 0.0f));
+    }
+}
+
+void Game::render() {
+    Renderer* defaultRenderer = RendererFactory::getInstance().getDefaultRenderer();
+    if (!scene || !defaultRenderer) return;
+    
+    renderPasses(nullptr, frameSnapshot, 1.0f);
+    
+    frameProfiler->beginPass("present");
+    defaultRenderer->endFrame(window);
+    frameProfiler->endPass("present");
+}
+
+void Game::renderPasses(const RenderSnapshot* previous, const RenderSnapshot& current, float alpha) {
     // Get the default renderer for frame control
     Renderer* defaultRenderer = RendererFactory::getInstance().getDefaultRenderer();
     if (!defaultRenderer) return;
     
+    // Everything below is drawn from the snapshots: draws at this frame's point between the two ticks
+    placeDraws(current.sceneDraws, previous, current, alpha, placedSceneDraws);
+    placeDraws(current.monsterDraws, previous, current, alpha, placedMonsterDraws);
+    placeDraws(current.projectileDraws, previous, current, alpha, placedProjectileDraws);
+    
+    // Camera position follows the ticks; the orientation is latched before the main pass
+    renderCamera.setPosition(previous ? interpolatePosition(previous->camera.position, current.camera.position, alpha)
+                                      : current.camera.position);
+    renderCamera.setOrientation(current.camera.yaw, current.camera.pitch);
+    
+    // Outside the scene timing: the bake renders into its own target once (conventional depth)
+    if (monsterImpostors && !monsterImpostors->isBaked()) {
+        bakeMonsterImpostors(current);
+    }
+    
+    // Reversed depth for the world passes; switched before the clears so depth clears to 0
+    ReverseZ::beginScene();
     defaultRenderer->beginFrame();
     
+    // World passes render into the scaled scene target; HUD passes below stay at native resolution
+    if (dynamicResolution) {
+        dynamicResolution->beginScene();
+    }
+    
     // Get water renderer for reflection/refraction passes
     WaterRenderer* waterRenderer = dynamic_cast<WaterRenderer*>(RendererFactory::getInstance().getRenderer(RendererType::Water));
     
     // Render reflection pass if water renderer is available
     if (waterRenderer) {
+        ProfileScope reflectionScope(frameProfiler.get(), "water_reflection");
         waterRenderer->bindReflectionFramebuffer();
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
         
         // Render scene from reflection camera (flipped Y)
         // For now, just render normally - we'll enhance this later
-        scene->render(*camera, *defaultRenderer);
+        drawMeshes(placedSceneDraws, *defaultRenderer, renderCamera);
         
         waterRenderer->unbindCurrentFramebuffer();
+    }
+    
+    if (waterRenderer) {
+        ProfileScope refractionScope(frameProfiler.get(), "water_refraction");
         
         // Render refraction pass
         waterRenderer->bindRefractionFramebuffer();
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
         
         // Render scene normally for refraction
-        scene->render(*camera, *defaultRenderer);
+        drawMeshes(placedSceneDraws, *defaultRenderer, renderCamera);
         
         waterRenderer->unbindCurrentFramebuffer();
     }
     
     // Try to get LightingRenderer for shadow rendering
     LightingRenderer* lightingRenderer = dynamic_cast<LightingRenderer*>(defaultRenderer);
+    
+    // Late latch: apply mouse movement that arrived since the tick before the camera is
+    // read for the main pass (view matrices are built from the camera at draw time)
+    latchRenderCamera(current);
+    
+    // Timed under separate names per mode so benchmark reports can compare the two
+    BasicRenderer* opaqueRenderer = dynamic_cast<BasicRenderer*>(defaultRenderer);
+    const bool depthPrepass = opaqueRenderer && opaqueRenderer->isDepthPrepassEnabled();
+    const char* mainScenePass = depthPrepass ? "main_scene_prepass" : "main_scene";
+    frameProfiler->beginPass(mainScenePass);
     if (lightingRenderer) {
-        // Use shadow rendering if available
-        std::vector<GameObject*> sceneObjects = scene->getAllGameObjects();
-        lightingRenderer->renderSceneWithShadows(sceneObjects, *camera);
+        // Use shadow rendering if available (runs its own prepass). It skips the water surface,
+        // which is drawn translucent below and must not occlude in the prepass
+        lightingRenderer->renderSceneWithShadows(placedSceneDraws, renderCamera);
+    } else if (depthPrepass) {
+        // Depth only, then shade with GL_EQUAL; draws with their own shader use the same
+        // program in both passes, so they match as well
+        opaqueRenderer->beginDepthPrepass();
+        drawMeshes(placedSceneDraws, *defaultRenderer, renderCamera);
+        opaqueRenderer->beginPrepassShading();
+        drawMeshes(placedSceneDraws, *defaultRenderer, renderCamera);
+        opaqueRenderer->endPrepassShading();
     } else {
         // Fall back to regular scene rendering
-        scene->render(*camera, *defaultRenderer);
+        drawMeshes(placedSceneDraws, *defaultRenderer, renderCamera);
     }
+    frameProfiler->endPass(mainScenePass);
     
     // Render water separately after the main scene
     // This ensures water is rendered on top of terrain with proper depth testing
     if (waterRenderer) {
+        ProfileScope waterScope(frameProfiler.get(), "water_surface");
+        
         // Enable depth testing for water
         glEnable(GL_DEPTH_TEST);
-        glDepthFunc(GL_LESS);
+        glDepthFunc(ReverseZ::depthLess());
         
         // Enable blending for water transparency
         glEnable(GL_BLEND);
         glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
         
-        // Get water GameObject from scene and render it
-        GameObject* waterObj = scene->getGameObject("WaterSurface");
-        if (waterObj && waterObj->getActive()) {
-            waterObj->render(*waterRenderer, *camera);
+        for (const MeshDrawState& draw : placedSceneDraws) {
+            if (draw.style == DrawStyle::Water) {
+                drawMesh(draw, *waterRenderer, renderCamera);
+            }
         }
         
         // Disable blending after water rendering
         glDisable(GL_BLEND);
     }
     
+    // Render monsters: meshes up close, impostors queued for the far ones
+    if (!placedMonsterDraws.empty()) {
+        ProfileScope monsterScope(frameProfiler.get(), "monsters");
+        if (monsterImpostors) {
+            monsterImpostors->beginFrame(renderCamera);
+        }
+        for (const EntityRenderState& monster : current.entities) {
+            if (monster.kind != RenderEntityKind::Monster || monster.drawBegin == monster.drawEnd) continue;
+            
+            bool meshInRange = true;
+            if (monsterImpostors) {
+                Vec3 position, rotation, scale;
+                placeEntity(monster, previous, alpha, position, rotation, scale);
+                meshInRange = monsterImpostors->add(position, rotation.y, scale.x);
+            }
+            if (meshInRange) {
+                for (uint32_t i = monster.drawBegin; i < monster.drawEnd; i++) {
+                    drawMesh(placedMonsterDraws[i], *defaultRenderer, renderCamera);
+                }
+            }
+        }
+        if (monsterImpostors) {
+            monsterImpostors->render(renderCamera);
+        }
+    }
+    
+    // Render projectiles
+    {
+        ProfileScope projectileScope(frameProfiler.get(), "projectiles");
+        drawMeshes(placedProjectileDraws, *defaultRenderer, renderCamera);
+    }
+    
+    // Render particles after all opaque world geometry (depth tested, no depth writes)
+    if (particleRenderer) {
+        ProfileScope particleScope(frameProfiler.get(), "particles");
+        particleRenderer->render(current.particles, renderCamera);
+    }
+    
+    // Render health bars - after all other world geometry for maximum visibility
+    if (healthBar) {
+        ProfileScope healthBarScope(frameProfiler.get(), "health_bars");
+        
+        // Impostor-range monsters are too small for a readable bar
+        const float healthBarRange = monsterImpostors && monsterImpostors->getSettings().enabled
+            ? monsterImpostors->getSettings().startDistance : std::numeric_limits<float>::max();
+        for (const EntityRenderState& monster : current.entities) {
+            if (monster.kind != RenderEntityKind::Monster || !monster.alive || !monster.showHealthBar) continue;
+            
+            Vec3 position, rotation, scale;
+            placeEntity(monster, previous, alpha, position, rotation, scale);
+            if ((position - renderCamera.getPosition()).length() <= healthBarRange) {
+                healthBar->setHealth(monster.healthPercent, 1.0f);
+                healthBar->render(position, renderCamera);
+            }
+        }
+    }
+    
+    // Back to conventional depth for the HUD passes and their orthographic projections
+    const bool reversedScene = ReverseZ::isActive();
+    ReverseZ::endScene();
+    
+    // Upscale the scene to the window; everything after this is HUD at native resolution
+    if (dynamicResolution && dynamicResolution->isSceneActive()) {
+        ProfileScope upscaleScope(frameProfiler.get(), "upscale");
+        dynamicResolution->endScene();
+    } else if (reversedScene) {
+        glClear(GL_DEPTH_BUFFER_BIT); // The window depth holds reversed values
+    }
+    
     // Render minimap (UI overlay)
     if (minimap) {
+        ProfileScope minimapScope(frameProfiler.get(), "minimap");
+        
         // Update minimap with current player position and camera direction
-        minimap->setPlayerPosition(camera->getPosition());
-        minimap->setPlayerDirectionFromYaw(camera->getYaw() * 180.0f / 3.14159f); // Convert radians to degrees
-        minimap->render(*defaultRenderer, *camera);
+        minimap->setPlayerPosition(renderCamera.getPosition());
+        minimap->setPlayerDirectionFromYaw(renderCamera.getYaw() * 180.0f / 3.14159f); // Convert radians to degrees
+        minimap->update(deltaTime);
+        minimap->render(placedSceneDraws);
     }
     
-    // Render weapon (FPS-style weapon overlay)
-    if (weapon) {
-        // Get the weapon-specific renderer
-        Renderer* weaponRenderer = RendererFactory::getInstance().getRenderer(RendererType::Weapon);
-        if (weaponRenderer) {
-            weapon->render(*weaponRenderer, *camera);
-        } else {
-            // Fallback to default renderer
-            weapon->render(*defaultRenderer, *camera);
-        }
+    // Render weapon (FPS-style weapon overlay) - drawn after all world geometry since it ignores depth
+    if (!current.viewModelDraws.empty()) {
+        ProfileScope weaponScope(frameProfiler.get(), "weapon");
+        drawMeshes(current.viewModelDraws, *defaultRenderer, renderCamera);
     }
     
     // DEBUG: Render projectile start position marker
-    if (weapon) {
-        renderProjectileStartPositionDebug(*defaultRenderer, *camera);
+    if (current.hud.hasWeapon) {
+        renderProjectileStartPositionDebug(*defaultRenderer, renderCamera, current.hud.barrelTip);
     } else {
         // Debug: Check if weapon is available
         static int weaponDebugCounter = 0;
@@ -476,103 +1005,155 @@ void Game::render() {
         }
     }
     
-    // Render monsters with MonsterRenderer for multi-material support
-    if (monsterSpawner) {
-        Renderer* monsterRenderer = RendererFactory::getInstance().getRenderer(RendererType::Monster);
-        if (monsterRenderer) {
-            const auto& activeMonsters = monsterSpawner->getActiveMonsters();
-            // Debug rendering every few seconds to avoid spam
-            static float renderDebugTimer = 0.0f;
-            renderDebugTimer += 0.016f; // Approximate frame time
-            if (renderDebugTimer > 3.0f) {
-                // std::cout << "=== MONSTER RENDERING ===" << std::endl;
-                // std::cout << "MonsterRenderer available: YES" << std::endl;
-                // std::cout << "Active monsters count: " << activeMonsters.size() << std::endl;
-                renderDebugTimer = 0.0f;
-            }
-            
-            // First, render all monsters
-            for (const auto& monster : activeMonsters) {
-                if (monster && monster->isAlive() && monster->getActive()) {
-                    monster->render(*monsterRenderer, *camera);
-                }
-            }
-        } else {
-            // std::cout << "=== MONSTER RENDERING ===" << std::endl;
-            // std::cout << "MonsterRenderer NOT AVAILABLE!" << std::endl;
-            // std::cout << "========================" << std::endl;
-        }
-        
-    }
-    
-    // Render projectiles
-    if (projectileManager) {
-        projectileManager->render(*defaultRenderer, *camera);
-    }
-    
-    // Render health bars - AFTER EVERYTHING ELSE for maximum visibility
-    if (monsterSpawner) {
-        const auto& activeMonsters = monsterSpawner->getActiveMonsters();
-        static int healthBarDebugCount = 0;
-        healthBarDebugCount++;
-        std::cout << "=== HEALTH BAR RENDERING DEBUG ===" << std::endl;
-        if (healthBarDebugCount % 300 == 0) { // Print every 5 seconds
-            std::cout << "Active monsters count: " << activeMonsters.size() << std::endl;
-            for (size_t i = 0; i < activeMonsters.size(); ++i) {
-                if (activeMonsters[i]) {
-                    std::cout << "Monster " << i << ": alive=" << activeMonsters[i]->isAlive() 
-                              << ", active=" << activeMonsters[i]->getActive() << std::endl;
-                }
-            }
-            std::cout << "================================" << std::endl;
-        }
-        
-        for (const auto& monster : activeMonsters) {
-            if (monster && monster->getActive() && monster->isAlive()) {
-                // Only render health bars for alive monsters
-                monster->renderHealthBar(*camera);
-            }
-        }
+    // Render crosshair and other screen-space overlays owned by the scene
+    {
+        ProfileScope overlayScope(frameProfiler.get(), "overlays");
+        drawMeshes(current.overlayDraws, *defaultRenderer, renderCamera);
     }
     
     // Render AmmoUI (UI overlay)
     if (ammoUI) {
+        ProfileScope uiScope(frameProfiler.get(), "ui");
+        
+        const HudRenderState& hud = current.hud;
+        if (hud.hasWeapon) {
+            ammoUI->setAmmunition(hud.currentAmmo, hud.maxAmmo, hud.reserveAmmo, hud.maxReserveAmmo,
+                                  hud.reloading, hud.reloadProgress);
+        }
+        ammoUI->update(deltaTime);
+        
         // Get the text renderer for UI elements
         Renderer* textRenderer = RendererFactory::getInstance().getRenderer(RendererType::Text);
         if (textRenderer) {
-            ammoUI->render(*textRenderer, *camera);
+            ammoUI->render(*textRenderer, renderCamera);
         } else {
             // Fallback to crosshair renderer
             Renderer* uiRenderer = RendererFactory::getInstance().getRenderer(RendererType::Crosshair);
             if (uiRenderer) {
-                ammoUI->render(*uiRenderer, *camera);
+                ammoUI->render(*uiRenderer, renderCamera);
             } else {
                 // Final fallback to default renderer
-                ammoUI->render(*defaultRenderer, *camera);
+                ammoUI->render(*defaultRenderer, renderCamera);
             }
         }
     }
+}
+
+void Game::drawMeshes(const std::vector<MeshDrawState>& draws, const Renderer& passRenderer, const Camera& view) const {
+    for (const MeshDrawState& draw : draws) {
+        // The water surface has its own pass after the opaque scene
+        if (draw.style != DrawStyle::Water) {
+            drawMesh(draw, passRenderer, view);
+        }
+    }
+}
+
+void Game::drawMesh(const MeshDrawState& draw, const Renderer& passRenderer, const Camera& view) const {
+    if (!draw.mesh) return;
+    const Renderer& renderer = draw.renderer ? *draw.renderer : passRenderer;
+    
+    // Same submission the objects' own render() used for these draws
+    if (draw.style == DrawStyle::Water) {
+        if (const WaterRenderer* waterRenderer = dynamic_cast<const WaterRenderer*>(&renderer)) {
+            waterRenderer->renderWater(*draw.mesh, draw.modelMatrix, view, draw.waterHeight);
+            return;
+        }
+    } else if (draw.style == DrawStyle::HeightColored) {
+        if (const BasicRenderer* basicRenderer = dynamic_cast<const BasicRenderer*>(&renderer)) {
+            basicRenderer->renderMesh(*draw.mesh, draw.modelMatrix, view, draw.color, true);
+            return;
+        }
+    } else if (const MonsterRenderer* monsterRenderer = dynamic_cast<const MonsterRenderer*>(&renderer)) {
+        if (draw.triangles) {
+            monsterRenderer->renderMonsterTriangles(*draw.mesh, draw.modelMatrix, view, draw.color, *draw.triangles, true);
+            return;
+        }
+    } else if (const WeaponRenderer* weaponRenderer = dynamic_cast<const WeaponRenderer*>(&renderer)) {
+        if (draw.triangles) {
+            weaponRenderer->renderWeaponTriangles(*draw.mesh, draw.modelMatrix, view, draw.color, *draw.triangles, true);
+        } else {
+            weaponRenderer->renderWeaponMesh(*draw.mesh, draw.modelMatrix, view, draw.color, true);
+        }
+        return;
+    }
+    renderer.renderMesh(*draw.mesh, draw.modelMatrix, view, draw.color);
+}
+
+void Game::latchRenderCamera(const RenderSnapshot& current) {
+    // The tick turned the camera by the cursor movement up to cursorX/Y; anything newer is
+    // still queued for the next tick, so turn the drawn view by it now. Only GLFW's cursor
+    // position is read, no events are processed
+    Input& input = Input::getInstance();
+    double cursorX = 0.0, cursorY = 0.0;
+    if (!current.camera.hasCursor || !input.sampleCursor(cursorX, cursorY)) return;
     
-    
-    defaultRenderer->endFrame(window);
+    float sensitivity = input.getMouseSensitivity();
+    renderCamera.rotate(static_cast<float>(cursorX - current.camera.cursorX) * sensitivity,
+                        static_cast<float>(current.camera.cursorY - cursorY) * sensitivity);
 }
 
 void Game::calculateDeltaTime() {
     float currentFrame = static_cast<float>(glfwGetTime());
-    deltaTime = currentFrame - lastFrame;
     lastFrame = currentFrame;
+    
+    // Smoothed and clamped by the pacer, which also records the frame-time histogram
+    deltaTime = framePacer->beginFrame();
+}
+
+void Game::bakeMonsterImpostors(const RenderSnapshot& snapshot) {
+    MonsterRenderer* monsterRenderer = dynamic_cast<MonsterRenderer*>(RendererFactory::getInstance().getRenderer(RendererType::Monster));
+    if (!monsterRenderer || !monsterRenderer->getShader()) return;
+    
+    // Every monster view loads the same model; the first one drawn with its materials is the
+    // bake source (not while a damage flash has replaced their colours)
+    for (const EntityRenderState& monster : snapshot.entities) {
+        if (monster.kind != RenderEntityKind::Monster || monster.damageFlash || monster.drawBegin == monster.drawEnd) continue;
+        if (!snapshot.monsterDraws[monster.drawBegin].triangles) continue;
+        
+        std::vector<ImpostorMaterial> materials;
+        for (uint32_t i = monster.drawBegin; i < monster.drawEnd; i++) {
+            const MeshDrawState& draw = snapshot.monsterDraws[i];
+            materials.push_back(ImpostorMaterial{ draw.triangles.get(), draw.color });
+        }
+        if (!monsterImpostors->bake(*snapshot.monsterDraws[monster.drawBegin].mesh, materials, *monsterRenderer->getShader())) {
+            std::cerr << "Monster impostor bake failed, distant monsters keep their meshes" << std::endl;
+            monsterImpostors.reset();
+        }
+        return;
+    }
 }
 
 void Game::cleanup() {
+    // Threaded mode normally joins in runThreaded(); make sure nothing outlives the systems
+    simulationActive = false;
+    if (simulationThread.joinable()) {
+        simulationThread.join();
+    }
+    
+    // Snapshots share the objects' meshes; drop them while the context is still current
+    frameSnapshot.clear();
+    renderSnapshots.reset();
     
     // Clean up systems
+    if (audioSystem) {
+        audioSystem->shutdown(); // Projectiles keep a pointer; the object goes with the Game
+    }
+    networkClient.reset(); // Tells the server we are leaving
     weapon.reset();
     minimap.reset();
     ammoUI.reset();
     monsterSpawner.reset();
     scene.reset();
     camera.reset();
+    frameProfiler.reset(); // Owns GL query objects - release before the context goes away
+    dynamicResolution.reset();
+    particleRenderer.reset();
+    monsterImpostors.reset();
+    healthBar.reset();
+    framePacer.reset();
     Input::cleanup();
+    TaskScheduler::getInstance().clear();
+    TimerWheel::getInstance().clear();
     
     // Clean up renderer factory
     RendererFactory::getInstance().cleanup();
@@ -664,7 +1245,6 @@ void Game::setupSceneObjects() {
     
     // Add minimap (UI element, not part of 3D scene)
     minimap = std::make_unique<Minimap>("Minimap", 0.25f);
-    minimap->setScene(scene.get());
     
     // Assign renderer to minimap (needed for child objects like arrow)
     Renderer* defaultRenderer = RendererFactory::getInstance().getDefaultRenderer();
@@ -673,18 +1253,6 @@ void Game::setupSceneObjects() {
     } else {
     }
     
-    // Store minimap reference for ground reference setup
-    Minimap* minimapPtr = minimap.get();
-    
-    // Set ground reference in minimap for entity visibility checking
-    minimapPtr->setGroundReference(groundPtr);
-    
-    // Set minimap reference in ground for chunk change notifications
-    groundPtr->setMinimapReference(minimapPtr);
-    
-    // Store minimap reference for camera direction updates
-    // Note: minimapPtr is already owned by the unique_ptr, so we don't need to store it separately
-    
     // Configure minimap dimensions and scope
     minimap->setMinimapDimensions(512, 512);  // Higher resolution for better quality
     minimap->setScopeSize(12.0f);  // Smaller scope for larger entities (was 24.0f)
@@ -767,7 +1335,7 @@ void Game::setupSceneObjects() {
         }
     }
     
-    // Create and initialize AmmoUI
+    // Create and initialize AmmoUI (fed the weapon's values from the render snapshots)
     ammoUI = std::make_unique<AmmoUI>("AmmoUI");
     
     // Configure AmmoUI properties
@@ -780,11 +1348,6 @@ void Game::setupSceneObjects() {
     ammoUI->setLowAmmoThreshold(0.25f);                  // 25% threshold
     
     
-    // Connect AmmoUI to weapon
-    if (weapon) {
-        ammoUI->setWeapon(weapon.get());
-    }
-    
     // Initialize AmmoUI
     if (!ammoUI->initialize()) {
     } else {
@@ -793,6 +1356,18 @@ void Game::setupSceneObjects() {
     
     // Initialize monster spawner
     monsterSpawner = std::make_unique<MonsterSpawner>(scene.get(), weapon.get());
+    monsterSpawner->setWorldSeed(static_cast<uint64_t>(terrainParams.seed)); // One seed for the terrain and the gameplay draws
+    weapon->setRandomKey(monsterSpawner->getWorldSeed());
+    
+    // Rocket and grenade blasts damage the monsters around them; hills in between block it.
+    // There is no Player object locally (the weapon stands in for it), so only monsters are targets.
+    if (projectileManager) {
+        ExplosionSystem& explosions = projectileManager->getExplosionSystem();
+        explosions.setMonsterSpawner(monsterSpawner.get());
+        if (auto* terrain = dynamic_cast<SimpleChunkTerrainGround*>(groundPtr)) {
+            explosions.setTerrainHeightQuery([terrain](float x, float z) { return terrain->getHeightAt(x, z); });
+        }
+    }
     
     
     // TESTING: Directly spawn 3 monsters for health bar testing
@@ -841,7 +1416,50 @@ void Game::toggleFullscreen() {
     
     // Update all renderers with new dimensions
     RendererFactory::getInstance().setViewport(windowWidth, windowHeight);
+    if (dynamicResolution) {
+        dynamicResolution->resize(windowWidth, windowHeight);
+    }
+}
+
+void Game::setupAudio() {
+    audioSystem = std::make_unique<AudioSystem>();
+    const int sampleRate = audioSystem->getConfig().sampleRate;
+    
+    // Preload every projectile sound; missing files get a placeholder burst
+    const ProjectileType soundTypes[] = {
+        ProjectileType::Bullet, ProjectileType::Rocket, ProjectileType::Laser,
+        ProjectileType::Grenade, ProjectileType::Plasma, ProjectileType::Arrow
+    };
+    uint32_t placeholderSeed = 1;
+    for (ProjectileType type : soundTypes) {
+        ProjectileConfig defaults = ProjectileFactory::getDefaultConfig(type);
+        for (const std::string& name : { defaults.fireSound, defaults.impactSound }) {
+            if (name.empty() || audioSystem->findSound(name) >= 0) continue;
+            if (audioSystem->loadSound(name, "Resources/Sounds/" + name) < 0) {
+                audioSystem->addSound(name, AudioSystem::makePlaceholderSound(placeholderSeed, 0.25f, sampleRate), sampleRate);
+            }
+            placeholderSeed++;
+        }
+    }
     
+    if (!audioSystem->start(createDeviceAudioSink())) {
+        audioSystem.reset();
+    }
+}
+
+SimulationWorld Game::getSimulationWorld() const {
+    SimulationWorld world;
+    world.scene = scene.get();
+    world.camera = camera.get();
+    world.monsterSpawner = monsterSpawner.get();
+    world.projectileManager = projectileManager.get();
+    if (weapon) world.owners.push_back(weapon.get());
+    return world;
+}
+
+void Game::setVSync(bool enabled) {
+    if (!window || !framePacer) return;
+    framePacer->setPresentMode(enabled ? FramePacer::PresentMode::VSync : FramePacer::PresentMode::Uncapped);
 }
 
 void Game::printControls() {
@@ -855,6 +1473,10 @@ void Game::onWindowResize(int width, int height) {
     
     // Update all renderers with new dimensions
     RendererFactory::getInstance().setViewport(width, height);
+    if (dynamicResolution) {
+        dynamicResolution->resize(width, height);
+    }
+    renderCamera.setAspectRatio(width, height); // The simulation camera only aims, frames use this one
     
     
     // Additional debugging information
@@ -885,17 +1507,12 @@ void Game::windowIconifyCallback(GLFWwindow* window, int iconified) {
     }
 }
 
-void Game::renderProjectileStartPositionDebug(const Renderer& renderer, const Camera& camera) {
-    if (!weapon) {
-        std::cout << "DEBUG: Weapon is NULL in renderProjectileStartPositionDebug!" << std::endl;
-        return;
-    }
-    
+void Game::renderProjectileStartPositionDebug(const Renderer& renderer, const Camera& camera, const Vec3& barrelTip) {
     // SCREEN-SPACE APPROACH: Render a fixed point on screen
     // This simulates where the projectile would start from the player's perspective
     
-    // Get the projectile start position from the weapon (for debug output)
-    Vec3 startPos = weapon->getBarrelTipPosition();
+    // The projectile start position the weapon reported at the end of the tick (for debug output)
+    Vec3 startPos = barrelTip;
     
     // Debug: Always print when this method is called
     static int methodCallCounter = 0;
@@ -10,7 +10,20 @@
  * - Engine initialization and cleanup
  * - Main game loop management
  * - System coordination (renderer, input, camera)
- * - Frame timing and delta time calculation
+ * - Frame timing and delta time calculation (FramePacer: present mode, frame cap, dt smoothing)
+ * - Per-pass CPU/GPU profiling hooks for the benchmark runner
+ * - Dynamic resolution: 3D scene rendered at a GPU-time driven scale and
+ *   upscaled, HUD drawn at native resolution
+ * - Particle effects simulated with the game and drawn as instanced billboards
+ * - Frames are drawn from RenderSnapshots only (draw lists, monster health,
+ *   particles, HUD values), never from the live game objects
+ * - Threaded mode: fixed-tick simulation thread publishing RenderSnapshots,
+ *   render thread (main thread, owns the window and the GL context)
+ *   interpolating between them; the two share no lock, input reaches the
+ *   simulation through the Input event queue
+ * - Network client mode: movement and shooting go to a dedicated server as
+ *   input commands; the local player is predicted, monsters, projectiles and
+ *   other players are interpolated from the server's snapshots
  * - Window management integration
  */
 
@@ -18,12 +31,24 @@
 #include <GL/glew.h>
 #define GLFW_INCLUDE_NONE  // Prevent GLFW from including OpenGL headers
 #include <glfw3.h>
+#include <atomic>
 #include <memory>
+#include <string>
+#include <thread>
+#include <vector>
 #include "../Rendering/Renderer.h"
+#include "../Rendering/DynamicResolution.h"
+#include "../Rendering/ParticleRenderer.h"
+#include "../Rendering/MonsterImpostorRenderer.h"
+#include "../Network/NetProtocol.h"
 #include "../Math/Camera.h"
 #include "../Input/Input.h"
 #include "Scene.h"
 #include "Projectile.h"
+#include "FrameProfiler.h"
+#include "FramePacer.h"
+#include "RenderSnapshot.h"
+#include "SimulationState.h"
 
 namespace Engine {
 
@@ -33,6 +58,8 @@ class Weapon;
 class Crosshair;
 class AmmoUI;
 class MonsterSpawner;
+class NetClient;
+class TextureHealthBar;
 
 /**
  * Game Class - Engine Root and Main Coordinator
@@ -61,8 +88,16 @@ private:
     std::unique_ptr<Weapon> weapon; // Weapon for FPS-style weapon rendering
     Crosshair* crosshair; // Crosshair for FPS-style aiming (owned by scene)
     std::unique_ptr<AmmoUI> ammoUI; // Ammunition UI display
+    std::unique_ptr<ParticleSystem> particleSystem; // Impact, trail and explosion particles
+    std::unique_ptr<ParticleRenderer> particleRenderer; // Instanced particle billboards (null if unsupported)
+    std::unique_ptr<MonsterImpostorRenderer> monsterImpostors; // Baked billboards for distant monsters (null if unsupported)
+    std::unique_ptr<AudioSystem> audioSystem; // Mixer thread (null without an output device)
     std::unique_ptr<ProjectileManager> projectileManager; // Projectile system for shooting
     std::unique_ptr<MonsterSpawner> monsterSpawner; // Monster spawning system
+    std::unique_ptr<FrameProfiler> frameProfiler; // Per-pass CPU/GPU timing (enabled by benchmarks)
+    std::unique_ptr<FramePacer> framePacer; // Swap interval, frame cap, delta smoothing, frame-time histogram
+    std::unique_ptr<DynamicResolution> dynamicResolution; // Scaled scene target (null if unsupported)
+    std::unique_ptr<NetClient> networkClient; // Connection to a dedicated server (null when playing locally)
     
     // Game state
     bool isRunning; // Whether the game is running
@@ -72,6 +107,30 @@ private:
     float deltaTime; // Time between frames
     float lastFrame; // Time of the last frame
     
+    // Threaded mode (simulation thread + render thread)
+    bool threadedMode; // Selected before run()
+    float simulationTickRate; // Fixed simulation ticks per second
+    GLFWwindow* loaderContext; // Hidden context shared with the window, current on the simulation thread
+    std::thread simulationThread;
+    std::atomic<bool> simulationActive;
+    std::atomic<GLsync> pendingUploadFence; // Last tick's GL uploads on the loader context
+    RenderSnapshotBuffer renderSnapshots;
+    uint64_t simulationTick;
+    
+    // Frame rendering (render thread only)
+    RenderSnapshot frameSnapshot; // Single-threaded mode: captured after every update
+    Camera renderCamera; // Interpolated position, snapshot orientation plus late-latched look
+    std::unique_ptr<TextureHealthBar> healthBar; // One bar, drawn once per monster at its health
+    std::vector<MeshDrawState> placedSceneDraws, placedMonsterDraws, placedProjectileDraws; // Interpolated copies
+    
+    // Network client mode
+    WorldSnapshot replicatedWorld; // Interpolated server state of the current tick
+    std::vector<GameObject*> remotePlayers; // Index = server client id (owned by scene)
+    float networkStatsTimer;
+    
+    // Quick-save (F5 captures and writes quicksave.ww3s, F8 restores)
+    SimulationState quickSave;
+    
 public:
     // Constructor/Destructor
     Game(int width = 1200, int height = 800, const char* title = "Game Engine");
@@ -84,7 +143,8 @@ public:
     
     // Game loop components
     void update(float deltaTime);
-    void render();
+    void render(); // Draws the snapshot captured by the last stepFrame()
+    void stepFrame(float deltaTime); // Poll events, update and render one frame with the given delta
     
     // Utility
     bool isValid() const { return isInitialized && isRunning; }
@@ -96,6 +156,31 @@ public:
     // Window resize handling
     void onWindowResize(int width, int height);
     float getAspectRatio() const { return static_cast<float>(windowWidth) / static_cast<float>(windowHeight); }
+    void setVSync(bool enabled);
+    
+    // Threading (call before run(); the benchmark runner always steps single-threaded)
+    void setThreadedMode(bool enabled) { threadedMode = enabled; }
+    bool isThreadedMode() const { return threadedMode; }
+    void setSimulationTickRate(float ticksPerSecond);
+    float getSimulationTickRate() const { return simulationTickRate; }
+    
+    // Network client (call after initialize(); "host[:port]", default port NetProtocol::DEFAULT_PORT)
+    bool connectToServer(const std::string& address);
+    bool isNetworkClient() const { return networkClient != nullptr; }
+    
+    // System access (used by the benchmark runner and tools)
+    Camera* getCamera() const { return camera.get(); }
+    Scene* getScene() const { return scene.get(); }
+    Weapon* getWeapon() const { return weapon.get(); }
+    ProjectileManager* getProjectileManager() const { return projectileManager.get(); }
+    ParticleSystem* getParticleSystem() const { return particleSystem.get(); }
+    AudioSystem* getAudioSystem() const { return audioSystem.get(); }
+    MonsterSpawner* getMonsterSpawner() const { return monsterSpawner.get(); }
+    FrameProfiler* getFrameProfiler() const { return frameProfiler.get(); }
+    FramePacer* getFramePacer() const { return framePacer.get(); }
+    DynamicResolution* getDynamicResolution() const { return dynamicResolution.get(); }
+    MonsterImpostorRenderer* getMonsterImpostors() const { return monsterImpostors.get(); }
+    SimulationWorld getSimulationWorld() const; // Subsystems covered by SimulationState
     
 private:
     // Helper methods
@@ -104,11 +189,30 @@ private:
     bool initializeGLEW();
     void setupSystems();
     void setupSceneObjects();
+    void setupAudio();
     void calculateDeltaTime();
     void printControls();
     
+    // Frame rendering (render() = renderPasses() + present); previous = null draws current as captured
+    void renderPasses(const RenderSnapshot* previous, const RenderSnapshot& current, float alpha);
+    void drawMeshes(const std::vector<MeshDrawState>& draws, const Renderer& passRenderer, const Camera& view) const; // Skips water
+    void drawMesh(const MeshDrawState& draw, const Renderer& passRenderer, const Camera& view) const;
+    void latchRenderCamera(const RenderSnapshot& current); // Snapshot orientation + cursor movement since its tick
+    void bakeMonsterImpostors(const RenderSnapshot& snapshot); // Once, from the first monster draws with materials
+    
+    // Threaded mode
+    void runThreaded();
+    void simulationLoop();
+    void runSimulationTick(float tickDelta);
+    void fenceSimulationUploads();
+    void captureRenderSnapshot(RenderSnapshot& snapshot); // Also used by stepFrame() for frameSnapshot
+    
+    // Network client mode
+    void updateNetworkClient(float deltaTime);
+    void updateRemotePlayers();
+    
     // Debug methods
-    void renderProjectileStartPositionDebug(const Renderer& renderer, const Camera& camera);
+    void renderProjectileStartPositionDebug(const Renderer& renderer, const Camera& camera, const Vec3& barrelTip);
     
     // Static callback functions
     static void framebufferSizeCallback(GLFWwindow* window, int width, int height);
@@ -3,6 +3,7 @@
  */
 
 #include "GameObject.h"
+#include "RenderSnapshot.h"
 #include "../Rendering/Mesh.h"
 #include "../Rendering/Renderer.h"
 #include <iostream>
@@ -10,9 +11,11 @@
 
 namespace Engine {
 
+std::atomic<uint32_t> GameObject::nextObjectId{1};
+
 GameObject::GameObject(const std::string& objectName)
     : position(0.0f, 0.0f, 0.0f), rotation(0.0f, 0.0f, 0.0f), scale(1.0f, 1.0f, 1.0f),
-      parent(nullptr), color(1.0f, 1.0f, 1.0f), name(objectName), isActive(true), isInitialized(false), isEntity(false), 
+      parent(nullptr), color(1.0f, 1.0f, 1.0f), name(objectName), objectId(nextObjectId++), isActive(true), isInitialized(false), isEntity(false), 
       lastUpdateTime(0.0f), objectRenderer(nullptr), owningScene(nullptr) {}
 
 GameObject::~GameObject() {
@@ -60,6 +63,27 @@ void GameObject::render(const Renderer& renderer, const Camera& camera) {
     selectedRenderer->renderMesh(*mesh, modelMatrix, camera, getColor());
 }
 
+void GameObject::captureDraws(std::vector<MeshDrawState>& draws) const {
+    if (!isActive || !isInitialized || !mesh) return;
+    
+    // Same renderer selection as render()
+    const Renderer* selectedRenderer = objectRenderer;
+    if (!selectedRenderer) {
+        selectedRenderer = RendererFactory::getInstance().getRenderer(getPreferredRendererType());
+    }
+    if (!selectedRenderer) return;
+    
+    MeshDrawState draw;
+    draw.mesh = mesh;
+    draw.modelMatrix = getModelMatrix();
+    draw.color = getColor();
+    draw.renderer = selectedRenderer;
+    draw.entityId = objectId;
+    draw.placement = DrawPlacement::Transform;
+    draw.entity = isEntity;
+    draws.push_back(draw);
+}
+
 void GameObject::cleanup() {
     if (!isInitialized) return;
     
@@ -70,9 +94,6 @@ void GameObject::cleanup() {
 }
 
 Mat4 GameObject::getModelMatrix() const {
-    // FIXED: Correct transformation order: Translation * Rotation * Scale
-    Mat4 model = Mat4(); // Identity matrix
-    
     // DEBUG: Add extensive logging for transformation steps
     static int debugCount = 0;
     debugCount++;
@@ -86,42 +107,37 @@ Mat4 GameObject::getModelMatrix() const {
         std::cout << "Raw scale: (" << scale.x << ", " << scale.y << ", " << scale.z << ")" << std::endl;
     }
     
-    // STEP 1: Apply scale first
-    Vec3 scaleVector = scale;
-    Mat4 scaleMatrix = Engine::scale(scaleVector);
-    model = model * scaleMatrix;
+    Mat4 model = composeModelMatrix(position, rotation, scale);
     
     if (shouldDebug) {
-        std::cout << "After scale - matrix position: (" << model.m[12] << ", " << model.m[13] << ", " << model.m[14] << ")" << std::endl;
+        std::cout << "After translation - final position: (" << model.m[12] << ", " << model.m[13] << ", " << model.m[14] << ")" << std::endl;
+        std::cout << "Position difference from raw: (" << (model.m[12] - position.x) << ", " << (model.m[13] - position.y) << ", " << (model.m[14] - position.z) << ")" << std::endl;
+        std::cout << "============================" << std::endl;
     }
     
+    return model;
+}
+
+Mat4 GameObject::composeModelMatrix(const Vec3& position, const Vec3& rotation, const Vec3& scale) {
+    // FIXED: Correct transformation order: Translation * Rotation * Scale
+    Mat4 model = Mat4(); // Identity matrix
+    
+    // STEP 1: Apply scale first
+    model = model * Engine::scale(scale);
+    
     // STEP 2: Apply rotation (convert degrees to radians)
     if (rotation.x != 0.0f) {
-        Mat4 rotX = Engine::rotateX(rotation.x * 3.14159f / 180.0f);
-        model = model * rotX;
+        model = model * Engine::rotateX(rotation.x * 3.14159f / 180.0f);
     }
     if (rotation.y != 0.0f) {
-        Mat4 rotY = Engine::rotateY(rotation.y * 3.14159f / 180.0f);
-        model = model * rotY;
-        if (shouldDebug) {
-            std::cout << "After Y rotation (" << rotation.y << " degrees) - matrix position: (" << model.m[12] << ", " << model.m[13] << ", " << model.m[14] << ")" << std::endl;
-        }
+        model = model * Engine::rotateY(rotation.y * 3.14159f / 180.0f);
     }
     if (rotation.z != 0.0f) {
-        Mat4 rotZ = Engine::rotateZ(rotation.z * 3.14159f / 180.0f);
-        model = model * rotZ;
+        model = model * Engine::rotateZ(rotation.z * 3.14159f / 180.0f);
     }
     
     // STEP 3: Apply translation last
-    model = Engine::translate(model, position);
-    
-    if (shouldDebug) {
-        std::cout << "After translation - final position: (" << model.m[12] << ", " << model.m[13] << ", " << model.m[14] << ")" << std::endl;
-        std::cout << "Position difference from raw: (" << (model.m[12] - position.x) << ", " << (model.m[13] - position.y) << ", " << (model.m[14] - position.z) << ")" << std::endl;
-        std::cout << "============================" << std::endl;
-    }
-    
-    return model;
+    return Engine::translate(model, position);
 }
 
 void GameObject::updateTransform() {
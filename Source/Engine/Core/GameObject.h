@@ -10,11 +10,16 @@
  * - Lifecycle management (initialize, update, render, cleanup)
  * - Component-based architecture foundation
  * - Delta time integration
+ * - Stable per-object id (render snapshots, interpolation)
+ * - Draw capture: objects describe their draws for the render snapshot, the
+ *   mesh is shared so a snapshot keeps it alive after the object replaces it
  */
 
 #pragma once
 #include "../Math/Math.h"
 #include "../Rendering/RendererFactory.h"
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -25,6 +30,7 @@ class Mesh;
 class Renderer;
 class Shader; // forward declaration for header completeness where referenced in inline getters previously
 class Camera;
+struct MeshDrawState;
 
 /**
  * GameObject - Base Class for All Scene Objects
@@ -46,13 +52,14 @@ protected:
     GameObject* parent;
     std::vector<std::unique_ptr<GameObject>> children;
     
-    // Rendering
-    std::unique_ptr<Mesh> mesh;
+    // Rendering (shared with the render snapshots that draw it)
+    std::shared_ptr<Mesh> mesh;
     Renderer* objectRenderer; // non-owning; set by game/scene
     Vec3 color; // Object color for rendering
     
     // Object state
     std::string name;
+    uint32_t objectId; // Unique for the process lifetime, never reused
     bool isActive;
     bool isInitialized;
     bool isEntity;  // Flag to identify entity objects (cubes, NPCs, etc.) vs system objects (ground, UI, etc.)
@@ -74,6 +81,10 @@ public:
     virtual void render(const Renderer& renderer, const Camera& camera);
     virtual void cleanup();
     
+    // Render snapshot capture: appends what render() would draw (the mesh with the
+    // model matrix, colour and renderer); derived classes with custom drawing override it
+    virtual void captureDraws(std::vector<MeshDrawState>& draws) const;
+    
     // Transform methods
     void setPosition(const Vec3& pos) { position = pos; }
     void setRotation(const Vec3& rot) { rotation = rot; }
@@ -85,6 +96,7 @@ public:
     
     // Transform matrix
     virtual Mat4 getModelMatrix() const;
+    static Mat4 composeModelMatrix(const Vec3& position, const Vec3& rotation, const Vec3& scale); // Scale, X/Y/Z rotation, translation
     
     // World transform (includes parent transforms)
     Vec3 getWorldPosition() const;
@@ -98,6 +110,7 @@ public:
     
     void setName(const std::string& objectName) { name = objectName; }
     const std::string& getName() const { return name; }
+    uint32_t getId() const { return objectId; }
     
     // Entity system
     void setEntity(bool entity) { isEntity = entity; }
@@ -127,6 +140,13 @@ public:
     // Renderer selection - derived classes can override to choose their renderer
     virtual RendererType getPreferredRendererType() const { return RendererType::Basic; }
     
+    // Screen-space overlays are skipped by Scene::render() and drawn by Scene::renderOverlays()
+    // at native resolution after the 3D scene has been upscaled
+    virtual bool isScreenSpaceOverlay() const { return false; }
+    
+private:
+    static std::atomic<uint32_t> nextObjectId;
+    
 protected:
     // Helper methods for derived classes
     virtual void updateTransform();
@@ -0,0 +1,190 @@
+/**
+ * HitboxHistory.cpp - Implementation of the Rewindable Collision History
+ */
+
+#include "HitboxHistory.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Engine {
+
+namespace {
+
+const float INT16_LIMIT = 32767.0f;
+
+int16_t quantizeOffset(float offset, float step) {
+    float value = std::max(-INT16_LIMIT, std::min(INT16_LIMIT, offset / step));
+    return static_cast<int16_t>(std::lround(value));
+}
+
+// Distance along a unit direction to first contact with the sphere, or -1
+float sweepSphere(const Vec3& start, const Vec3& direction, float length, const Vec3& center, float radius) {
+    Vec3 offset = start - center;
+    float c = offset.dot(offset) - radius * radius;
+    if (c <= 0.0f) return 0.0f; // Starts inside
+    float b = offset.dot(direction);
+    if (b > 0.0f) return -1.0f; // Moving away
+    float discriminant = b * b - c;
+    if (discriminant < 0.0f) return -1.0f;
+    float distance = -b - std::sqrt(discriminant);
+    return distance <= length ? distance : -1.0f;
+}
+
+} // namespace
+
+const float HitboxHistory::MIN_POSITION_STEP = 1.0f / 64.0f;
+const float HitboxHistory::RADIUS_STEP = 1.0f / 16.0f;
+
+HitboxHistory::HitboxHistory(size_t frameCount, size_t capacity)
+    : frameCount(std::max<size_t>(2, frameCount)), capacity(std::max<size_t>(1, capacity)),
+      frames(this->frameCount), ids(this->frameCount * this->capacity),
+      centerX(ids.size()), centerY(ids.size()), centerZ(ids.size()), radii(ids.size()),
+      pendingTick(0), recording(false), oldestTick(0), latestTick(0), empty(true) {
+    pending.reserve(this->capacity);
+}
+
+void HitboxHistory::clear() {
+    for (Frame& frame : frames) {
+        frame.valid = false;
+    }
+    pending.clear();
+    recording = false;
+    oldestTick = 0;
+    latestTick = 0;
+    empty = true;
+}
+
+void HitboxHistory::beginFrame(uint32_t tick) {
+    pending.clear();
+    pendingTick = tick;
+    recording = true;
+}
+
+void HitboxHistory::add(uint32_t id, const Vec3& center, float radius) {
+    if (!recording || pending.size() >= capacity) return;
+    pending.push_back(PendingSphere{id, center, radius});
+}
+
+void HitboxHistory::endFrame() {
+    if (!recording) return;
+    recording = false;
+
+    // Interpolation needs consecutive ticks
+    if (!empty && pendingTick != latestTick + 1) {
+        if (pendingTick <= latestTick) return;
+        clear();
+    }
+
+    std::sort(pending.begin(), pending.end(),
+              [](const PendingSphere& a, const PendingSphere& b) { return a.id < b.id; });
+
+    Vec3 minimum, maximum;
+    if (!pending.empty()) {
+        minimum = maximum = pending[0].center;
+        for (const PendingSphere& sphere : pending) {
+            minimum = Vec3(std::min(minimum.x, sphere.center.x), std::min(minimum.y, sphere.center.y), std::min(minimum.z, sphere.center.z));
+            maximum = Vec3(std::max(maximum.x, sphere.center.x), std::max(maximum.y, sphere.center.y), std::max(maximum.z, sphere.center.z));
+        }
+    }
+    Vec3 halfExtent = (maximum - minimum) * 0.5f;
+
+    Frame& frame = frames[pendingTick % frameCount];
+    frame.tick = pendingTick;
+    frame.origin = (minimum + maximum) * 0.5f;
+    frame.step = std::max(MIN_POSITION_STEP, std::max(halfExtent.x, std::max(halfExtent.y, halfExtent.z)) / INT16_LIMIT);
+    frame.count = static_cast<uint32_t>(pending.size());
+    frame.valid = true;
+
+    size_t base = (pendingTick % frameCount) * capacity;
+    for (size_t i = 0; i < pending.size(); i++) {
+        const PendingSphere& sphere = pending[i];
+        Vec3 offset = sphere.center - frame.origin;
+        ids[base + i] = sphere.id;
+        centerX[base + i] = quantizeOffset(offset.x, frame.step);
+        centerY[base + i] = quantizeOffset(offset.y, frame.step);
+        centerZ[base + i] = quantizeOffset(offset.z, frame.step);
+        radii[base + i] = static_cast<uint8_t>(std::min(255L, std::lround(std::max(0.0f, sphere.radius) / RADIUS_STEP)));
+    }
+
+    if (empty) {
+        oldestTick = pendingTick;
+        empty = false;
+    }
+    latestTick = pendingTick;
+    if (latestTick - oldestTick >= frameCount) {
+        oldestTick = latestTick - static_cast<uint32_t>(frameCount) + 1;
+    }
+}
+
+const HitboxHistory::Frame* HitboxHistory::findFrame(uint32_t tick) const {
+    if (empty || tick < oldestTick || tick > latestTick) return nullptr;
+    const Frame& frame = frames[tick % frameCount];
+    return (frame.valid && frame.tick == tick) ? &frame : nullptr;
+}
+
+Vec3 HitboxHistory::decodeCenter(const Frame& frame, size_t entry) const {
+    return frame.origin + Vec3(centerX[entry], centerY[entry], centerZ[entry]) * frame.step;
+}
+
+bool HitboxHistory::sweep(double time, const Vec3& start, const Vec3& end, float sweepRadius, RewindHit& hit) const {
+    if (empty) return false;
+
+    time = std::max(static_cast<double>(oldestTick), std::min(static_cast<double>(latestTick), time));
+    uint32_t tick = static_cast<uint32_t>(std::floor(time));
+    float fraction = static_cast<float>(time - tick);
+    const Frame* before = findFrame(tick);
+    const Frame* after = fraction > 0.0f ? findFrame(tick + 1) : nullptr;
+    if (!before) return false;
+
+    Vec3 path = end - start;
+    float length = path.length();
+    Vec3 direction = length > 1e-6f ? path * (1.0f / length) : Vec3(0.0f, 0.0f, 0.0f);
+
+    bool found = false;
+    float nearest = 0.0f;
+    auto test = [&](uint32_t id, const Vec3& center, float radius) {
+        float distance = sweepSphere(start, direction, length, center, radius + sweepRadius);
+        if (distance >= 0.0f && (!found || distance < nearest)) {
+            found = true;
+            nearest = distance;
+            hit.id = id;
+        }
+    };
+
+    size_t a = (tick % frameCount) * capacity;
+    size_t aEnd = a + before->count;
+    if (!after) {
+        for (size_t i = a; i < aEnd; i++) {
+            test(ids[i], decodeCenter(*before, i), radii[i] * RADIUS_STEP);
+        }
+    } else {
+        // Both frames in id order: interpolate spheres present in both, take
+        // the others from whichever frame is nearer in time
+        size_t b = ((tick + 1) % frameCount) * capacity;
+        size_t bEnd = b + after->count;
+        while (a < aEnd || b < bEnd) {
+            if (b == bEnd || (a < aEnd && ids[a] < ids[b])) {
+                if (fraction < 0.5f) test(ids[a], decodeCenter(*before, a), radii[a] * RADIUS_STEP);
+                a++;
+            } else if (a == aEnd || ids[b] < ids[a]) {
+                if (fraction >= 0.5f) test(ids[b], decodeCenter(*after, b), radii[b] * RADIUS_STEP);
+                b++;
+            } else {
+                Vec3 from = decodeCenter(*before, a);
+                Vec3 center = from + (decodeCenter(*after, b) - from) * fraction;
+                float radius = (radii[a] + (radii[b] - radii[a]) * fraction) * RADIUS_STEP;
+                test(ids[a], center, radius);
+                a++;
+                b++;
+            }
+        }
+    }
+
+    if (found) {
+        hit.distance = nearest;
+        hit.point = start + direction * nearest;
+    }
+    return found;
+}
+
+} // namespace Engine
@@ -0,0 +1,112 @@
+/**
+ * HitboxHistory.h - Rewindable History of Monster Collision Spheres
+ *
+ * OVERVIEW:
+ * Lag compensation for the dedicated server. A client renders the world
+ * an interpolation delay plus half a round trip behind the server, so a
+ * shot aimed at a monster on its screen would miss the monster's live
+ * position. The server records every monster's collision sphere
+ * (Monster::getCollisionCenter / getCollisionRadius) once per tick into a
+ * fixed ring of frames, and tests the shooter's projectile against the
+ * spheres as they were at the tick the shooter was looking at, interpolated
+ * between the two recorded frames around it. Queries never touch live
+ * objects; only the id of the sphere that was hit comes back.
+ *
+ * LAYOUT (SoA, quantized, allocated once):
+ * Frame f owns entries [f * capacity, f * capacity + count) of shared arrays:
+ * - id: uint32, ascending within a frame so two frames merge without lookups
+ * - centerX/Y/Z: int16 offsets from the frame's origin in steps of the
+ *   frame's quantum (1/64 unit until the monsters span more than ~1 km)
+ * - radius: uint8 in 1/16 unit steps
+ * 11 bytes per sphere per tick: 64 ticks x 256 monsters is 180 KB.
+ *
+ * FEATURES:
+ * - Swept-sphere queries (a projectile's movement over one tick), nearest
+ *   hit along the sweep
+ * - Times outside the recorded range clamp to the oldest/newest frame
+ * - Entities past the per-frame capacity are left out of that frame
+ * - GL-free (ww3_core)
+ */
+
+#pragma once
+#include "../Math/Math.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Engine {
+
+/**
+ * Result of a rewind query
+ */
+struct RewindHit {
+    uint32_t id = 0;
+    float distance = 0.0f;      // Along the sweep, from its start
+    Vec3 point;                 // Sweep center at first contact
+};
+
+/**
+ * HitboxHistory - Ring of per-tick collision sphere frames
+ */
+class HitboxHistory {
+public:
+    static const float MIN_POSITION_STEP;   // Finest center quantum (units)
+    static const float RADIUS_STEP;         // Radius quantum (units)
+
+private:
+    struct Frame {
+        uint32_t tick = 0;
+        Vec3 origin;
+        float step = 0.0f;
+        uint32_t count = 0;
+        bool valid = false;
+    };
+
+    struct PendingSphere {
+        uint32_t id;
+        Vec3 center;
+        float radius;
+    };
+
+    size_t frameCount;
+    size_t capacity;
+    std::vector<Frame> frames;
+    std::vector<uint32_t> ids;
+    std::vector<int16_t> centerX;
+    std::vector<int16_t> centerY;
+    std::vector<int16_t> centerZ;
+    std::vector<uint8_t> radii;
+
+    std::vector<PendingSphere> pending;     // Current frame before quantization
+    uint32_t pendingTick;
+    bool recording;
+    uint32_t oldestTick;
+    uint32_t latestTick;
+    bool empty;
+
+public:
+    // frameCount ticks of history, up to capacity spheres per tick
+    HitboxHistory(size_t frameCount = 64, size_t capacity = 256);
+
+    // Recording, once per tick; ticks must increase (a gap clears the history)
+    void beginFrame(uint32_t tick);
+    void add(uint32_t id, const Vec3& center, float radius);
+    void endFrame();
+    void clear();
+
+    // Sweeps a sphere of sweepRadius from start to end against the spheres at
+    // time (in ticks, fractions interpolate); true with the nearest hit
+    bool sweep(double time, const Vec3& start, const Vec3& end, float sweepRadius, RewindHit& hit) const;
+
+    bool isEmpty() const { return empty; }
+    uint32_t getOldestTick() const { return oldestTick; }
+    uint32_t getLatestTick() const { return latestTick; }
+    size_t getFrameCount() const { return frameCount; }
+    size_t getCapacity() const { return capacity; }
+
+private:
+    const Frame* findFrame(uint32_t tick) const;
+    Vec3 decodeCenter(const Frame& frame, size_t entry) const;
+};
+
+} // namespace Engine
@@ -0,0 +1,1011 @@
+/**
+ * MonsterSimulation.cpp - Implementation of Data-Oriented Monster State and Batched AI
+ */
+
+#include "MonsterSimulation.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Engine {
+
+namespace {
+
+const float RADIANS_TO_DEGREES = 180.0f / 3.14159265359f;
+const float TWO_PI = 6.28318530718f;
+
+const float PATROL_RETARGET_TIME = 3.0f;     // Seconds before a patrolling monster picks a new target
+const float PATROL_ARRIVE_DISTANCE = 2.0f;
+const float PATROL_MIN_DISTANCE = 5.0f;      // Patrol targets are at least this far away
+const float ALERT_SEARCH_TIME = 5.0f;        // Alert without sight for this long -> back to patrolling
+const float RETREAT_DURATION = 3.0f;
+const float RETREAT_SPEED_FACTOR = 0.7f;
+const float RETREAT_HEALTH = 0.3f;           // Retreat below this health fraction when fearful
+const float RETREAT_RECOVERED_HEALTH = 0.5f;
+const float RETREAT_FEAR = 0.5f;
+const float LOST_SIGHT_DISTANCE = 2.0f;      // Chasers still this far from the last sighting turn Alert
+
+// Indexed by MonsterType
+const MonsterArchetype ARCHETYPES[] = {
+    // maxHealth, baseSpeed, chargeSpeed, attackRange, attackDamage, attackCooldown,
+    // detectionRange, dangerRange, patrolRadius, collisionRadius, aggression, fear, xp, score
+    { 100.0f, 2.0f, 4.0f, 2.0f, 25.0f, 2.0f,  5.0f,  8.0f, 15.0f, 1.5f, 0.6f, 0.2f, 10, 100 }, // Xenomorph
+    {  50.0f, 3.0f, 6.0f, 1.5f, 15.0f, 2.0f, 15.0f, 22.0f, 15.0f, 1.2f, 0.8f, 0.1f, 15, 150 }, // Runner
+    { 200.0f, 1.5f, 3.0f, 3.0f, 40.0f, 2.0f,  8.0f, 12.0f, 15.0f, 2.0f, 0.4f, 0.3f, 25, 250 }  // Tank
+};
+const size_t ARCHETYPE_COUNT = sizeof(ARCHETYPES) / sizeof(ARCHETYPES[0]);
+
+const float MAX_COLLISION_RADIUS = 2.0f;     // Largest archetype collisionRadius (grid query margin)
+const uint32_t MIN_GRID_BUCKETS = 64;
+
+float clamp01(float value) {
+    return std::max(0.0f, std::min(1.0f, value));
+}
+
+int gridCell(float coordinate) {
+    return static_cast<int>(std::floor(coordinate * (1.0f / MonsterSimulation::GRID_CELL_SIZE)));
+}
+
+uint32_t gridHash(int cellX, int cellZ) {
+    return static_cast<uint32_t>(cellX) * 73856093u ^ static_cast<uint32_t>(cellZ) * 19349663u;
+}
+
+} // namespace
+
+const uint32_t MonsterSimulation::INVALID_HANDLE;
+const int MonsterSimulation::STATE_COUNT;
+const uint32_t MonsterSimulation::STATE_TAG = makeStateTag('M', 'S', 'I', 'M');
+const uint16_t MonsterSimulation::STATE_VERSION = 2;
+const float MonsterSimulation::GRID_CELL_SIZE = 4.0f;
+
+MonsterSimulation::MonsterSimulation()
+    : retiredBelow(0), count(0), liveCount(0), playerPosition(0.0f, 0.0f, 0.0f), hasPlayer(false),
+      groupAlertRadius(10.0f), worldSeed(0), gridMask(0), gridDirty(true) {
+    std::fill(stateStart, stateStart + STATE_COUNT + 1, 0);
+}
+
+const MonsterArchetype& MonsterSimulation::getArchetype(MonsterType monsterType) {
+    return ARCHETYPES[static_cast<int>(monsterType)];
+}
+
+// ===== Population =====
+
+void MonsterSimulation::resizeArrays(size_t newSize) {
+    positionX.resize(newSize); positionY.resize(newSize); positionZ.resize(newSize);
+    velocityX.resize(newSize); velocityZ.resize(newSize);
+    yawDegrees.resize(newSize);
+    health.resize(newSize);
+    state.resize(newSize);
+    type.resize(newSize);
+    stateTimer.resize(newSize);
+    moveTimer.resize(newSize);
+    stunTimer.resize(newSize);
+    distanceToPlayer.resize(newSize);
+    lineOfSight.resize(newSize);
+    charging.resize(newSize);
+    alertedGroup.resize(newSize);
+    aggression.resize(newSize);
+    fear.resize(newSize);
+    targetX.resize(newSize); targetZ.resize(newSize);
+    lastKnownX.resize(newSize); lastKnownZ.resize(newSize);
+    randomKey.resize(newSize);
+    randomDraws.resize(newSize);
+    handleOf.resize(newSize);
+    nextState.resize(newSize);
+    preferredX.resize(newSize); preferredZ.resize(newSize);
+    avoidedX.resize(newSize); avoidedZ.resize(newSize);
+}
+
+void MonsterSimulation::reserve(size_t capacity) {
+    positionX.reserve(capacity); positionY.reserve(capacity); positionZ.reserve(capacity);
+    velocityX.reserve(capacity); velocityZ.reserve(capacity);
+    yawDegrees.reserve(capacity);
+    health.reserve(capacity);
+    state.reserve(capacity);
+    type.reserve(capacity);
+    stateTimer.reserve(capacity);
+    moveTimer.reserve(capacity);
+    stunTimer.reserve(capacity);
+    distanceToPlayer.reserve(capacity);
+    lineOfSight.reserve(capacity);
+    charging.reserve(capacity);
+    alertedGroup.reserve(capacity);
+    aggression.reserve(capacity);
+    fear.reserve(capacity);
+    targetX.reserve(capacity); targetZ.reserve(capacity);
+    lastKnownX.reserve(capacity); lastKnownZ.reserve(capacity);
+    randomKey.reserve(capacity);
+    randomDraws.reserve(capacity);
+    handleOf.reserve(capacity);
+    nextState.reserve(capacity);
+    preferredX.reserve(capacity); preferredZ.reserve(capacity);
+    avoidedX.reserve(capacity); avoidedZ.reserve(capacity);
+    stateOrder.reserve(capacity);
+    indexOf.reserve(capacity);
+}
+
+uint32_t MonsterSimulation::add(MonsterType monsterType, const Vec3& position, uint32_t seed) {
+    uint32_t handle;
+    if (!freeHandles.empty()) {
+        handle = freeHandles.back();
+        freeHandles.pop_back();
+    } else {
+        handle = static_cast<uint32_t>(indexOf.size());
+        indexOf.push_back(INVALID_HANDLE);
+    }
+
+    // Append, then swap into the live range (dead monsters stay behind the live ones)
+    size_t index = count;
+    if (count == positionX.capacity()) {
+        reserve(std::max<size_t>(16, count * 2)); // Grow every array together, geometrically
+    }
+    resizeArrays(count + 1);
+    count++;
+    handleOf[index] = handle;
+    indexOf[handle] = static_cast<uint32_t>(index);
+    type[index] = static_cast<uint8_t>(monsterType);
+    randomKey[index] = seed;
+    randomDraws[index] = 0;
+
+    if (index != liveCount) {
+        swapSlots(index, liveCount);
+    }
+    liveCount++;
+
+    respawn(handle, position);
+    return handle;
+}
+
+void MonsterSimulation::remove(uint32_t handle) {
+    if (!isValid(handle)) return;
+
+    size_t index = indexOf[handle];
+    if (index < liveCount) {
+        swapSlots(index, liveCount - 1);
+        liveCount--;
+        index = liveCount;
+    }
+    swapSlots(index, count - 1);
+    count--;
+    resizeArrays(count);
+
+    indexOf[handle] = INVALID_HANDLE;
+    freeHandles.push_back(handle);
+    gridDirty = true;
+}
+
+void MonsterSimulation::clear() {
+    count = 0;
+    liveCount = 0;
+    resizeArrays(0);
+
+    // Retire every handle instead of recycling them, so views that outlive a clear read as dead
+    std::fill(indexOf.begin(), indexOf.end(), INVALID_HANDLE);
+    freeHandles.clear();
+    retiredBelow = static_cast<uint32_t>(indexOf.size());
+    stateOrder.clear();
+    attackEvents.clear();
+    stateChanges.clear();
+    std::fill(stateStart, stateStart + STATE_COUNT + 1, 0);
+    gridDirty = true;
+}
+
+bool MonsterSimulation::isValid(uint32_t handle) const {
+    return handle < indexOf.size() && indexOf[handle] != INVALID_HANDLE;
+}
+
+void MonsterSimulation::respawn(uint32_t handle, const Vec3& position) {
+    if (!isValid(handle)) return;
+
+    size_t index = indexOf[handle];
+    if (index >= liveCount) {
+        swapSlots(index, liveCount);
+        index = liveCount;
+        liveCount++;
+    }
+
+    const MonsterArchetype& archetype = ARCHETYPES[type[index]];
+    positionX[index] = position.x;
+    positionY[index] = position.y;
+    positionZ[index] = position.z;
+    velocityX[index] = 0.0f;
+    velocityZ[index] = 0.0f;
+    health[index] = archetype.maxHealth;
+    state[index] = static_cast<uint8_t>(MonsterState::Idle);
+    stateTimer[index] = 0.0f;
+    moveTimer[index] = 0.0f;
+    stunTimer[index] = 0.0f;
+    distanceToPlayer[index] = 0.0f;
+    lineOfSight[index] = 0;
+    charging[index] = 0;
+    alertedGroup[index] = 0;
+    aggression[index] = archetype.initialAggression;
+    fear[index] = archetype.initialFear;
+    lastKnownX[index] = position.x;
+    lastKnownZ[index] = position.z;
+
+    // Face the first patrol target straight away
+    pickPatrolTarget(index);
+    faceDirection(index, targetX[index] - position.x, targetZ[index] - position.z);
+    gridDirty = true;
+}
+
+void MonsterSimulation::swapSlots(size_t a, size_t b) {
+    if (a == b) return;
+
+    std::swap(positionX[a], positionX[b]);
+    std::swap(positionY[a], positionY[b]);
+    std::swap(positionZ[a], positionZ[b]);
+    std::swap(velocityX[a], velocityX[b]);
+    std::swap(velocityZ[a], velocityZ[b]);
+    std::swap(yawDegrees[a], yawDegrees[b]);
+    std::swap(health[a], health[b]);
+    std::swap(state[a], state[b]);
+    std::swap(type[a], type[b]);
+    std::swap(stateTimer[a], stateTimer[b]);
+    std::swap(moveTimer[a], moveTimer[b]);
+    std::swap(stunTimer[a], stunTimer[b]);
+    std::swap(distanceToPlayer[a], distanceToPlayer[b]);
+    std::swap(lineOfSight[a], lineOfSight[b]);
+    std::swap(charging[a], charging[b]);
+    std::swap(alertedGroup[a], alertedGroup[b]);
+    std::swap(aggression[a], aggression[b]);
+    std::swap(fear[a], fear[b]);
+    std::swap(targetX[a], targetX[b]);
+    std::swap(targetZ[a], targetZ[b]);
+    std::swap(lastKnownX[a], lastKnownX[b]);
+    std::swap(lastKnownZ[a], lastKnownZ[b]);
+    std::swap(randomKey[a], randomKey[b]);
+    std::swap(randomDraws[a], randomDraws[b]);
+    std::swap(handleOf[a], handleOf[b]);
+
+    indexOf[handleOf[a]] = static_cast<uint32_t>(a);
+    indexOf[handleOf[b]] = static_cast<uint32_t>(b);
+}
+
+// ===== Snapshots =====
+
+void MonsterSimulation::saveState(StateWriter& writer) const {
+    writer.beginSection(STATE_TAG, STATE_VERSION);
+    writer.write(static_cast<uint32_t>(count));
+    writer.write(static_cast<uint32_t>(liveCount));
+    writer.write(groupAlertRadius);
+    writer.write(worldSeed);
+    writer.writeArray(positionX); writer.writeArray(positionY); writer.writeArray(positionZ);
+    writer.writeArray(velocityX); writer.writeArray(velocityZ);
+    writer.writeArray(yawDegrees);
+    writer.writeArray(health);
+    writer.writeArray(state);
+    writer.writeArray(type);
+    writer.writeArray(stateTimer);
+    writer.writeArray(moveTimer);
+    writer.writeArray(stunTimer);
+    writer.writeArray(distanceToPlayer);
+    writer.writeArray(lineOfSight);
+    writer.writeArray(charging);
+    writer.writeArray(alertedGroup);
+    writer.writeArray(aggression);
+    writer.writeArray(fear);
+    writer.writeArray(targetX); writer.writeArray(targetZ);
+    writer.writeArray(lastKnownX); writer.writeArray(lastKnownZ);
+    writer.writeArray(randomKey);
+    writer.writeArray(randomDraws);
+    writer.writeArray(handleOf);
+    writer.writeArray(indexOf);
+    writer.writeArray(freeHandles);
+    writer.endSection();
+}
+
+bool MonsterSimulation::restoreState(StateReader& reader) {
+    if (!reader.openSection(STATE_TAG, STATE_VERSION)) return false;
+
+    uint32_t storedCount = reader.read<uint32_t>();
+    uint32_t storedLiveCount = reader.read<uint32_t>();
+    float storedAlertRadius = reader.read<float>();
+    uint64_t storedWorldSeed = reader.read<uint64_t>();
+    std::vector<uint32_t> storedIndexOf;
+    std::vector<uint32_t> storedFreeHandles;
+
+    reader.readArray(positionX); reader.readArray(positionY); reader.readArray(positionZ);
+    reader.readArray(velocityX); reader.readArray(velocityZ);
+    reader.readArray(yawDegrees);
+    reader.readArray(health);
+    reader.readArray(state);
+    reader.readArray(type);
+    reader.readArray(stateTimer);
+    reader.readArray(moveTimer);
+    reader.readArray(stunTimer);
+    reader.readArray(distanceToPlayer);
+    reader.readArray(lineOfSight);
+    reader.readArray(charging);
+    reader.readArray(alertedGroup);
+    reader.readArray(aggression);
+    reader.readArray(fear);
+    reader.readArray(targetX); reader.readArray(targetZ);
+    reader.readArray(lastKnownX); reader.readArray(lastKnownZ);
+    reader.readArray(randomKey);
+    reader.readArray(randomDraws);
+    reader.readArray(handleOf);
+    reader.readArray(storedIndexOf);
+    reader.readArray(storedFreeHandles);
+
+    // A short or inconsistent section leaves an empty simulation rather than a corrupt one:
+    // every array has one entry per monster, and state/type index fixed-size tables
+    const size_t n = storedCount;
+    bool consistent = reader.isValid() && storedLiveCount <= storedCount &&
+        positionX.size() == n && positionY.size() == n && positionZ.size() == n &&
+        velocityX.size() == n && velocityZ.size() == n && yawDegrees.size() == n && health.size() == n &&
+        state.size() == n && type.size() == n && stateTimer.size() == n && moveTimer.size() == n &&
+        stunTimer.size() == n && distanceToPlayer.size() == n && lineOfSight.size() == n &&
+        charging.size() == n && alertedGroup.size() == n && aggression.size() == n && fear.size() == n &&
+        targetX.size() == n && targetZ.size() == n && lastKnownX.size() == n && lastKnownZ.size() == n &&
+        randomKey.size() == n && randomDraws.size() == n && handleOf.size() == n;
+    for (size_t i = 0; consistent && i < n; i++) {
+        consistent = handleOf[i] < storedIndexOf.size() && storedIndexOf[handleOf[i]] == i &&
+                     state[i] < STATE_COUNT && type[i] < ARCHETYPE_COUNT;
+    }
+    if (!consistent) {
+        clear();
+        reader.fail();
+        return false;
+    }
+
+    count = storedCount;
+    liveCount = storedLiveCount;
+    groupAlertRadius = storedAlertRadius;
+    worldSeed = storedWorldSeed;
+    resizeArrays(count); // Scratch arrays; the restored ones already have this size
+
+    // Handles only ever grow: the table keeps every handle issued since the
+    // capture (now free-but-unused), and retired handles get fresh numbers
+    size_t handleCount = std::max(indexOf.size(), storedIndexOf.size());
+    for (size_t i = 0; i < count; i++) {
+        if (handleOf[i] < retiredBelow) {
+            handleOf[i] = static_cast<uint32_t>(handleCount++);
+        }
+    }
+    indexOf.assign(handleCount, INVALID_HANDLE);
+    for (size_t i = 0; i < count; i++) {
+        indexOf[handleOf[i]] = static_cast<uint32_t>(i);
+    }
+    freeHandles.clear();
+    for (uint32_t handle : storedFreeHandles) {
+        if (handle >= retiredBelow && handle < handleCount && indexOf[handle] == INVALID_HANDLE) {
+            freeHandles.push_back(handle);
+        }
+    }
+
+    // Per-tick results are stale; the next update() rebuilds them
+    stateOrder.clear();
+    std::fill(stateStart, stateStart + STATE_COUNT + 1, 0);
+    attackEvents.clear();
+    stateChanges.clear();
+    gridDirty = true;
+    return true;
+}
+
+bool MonsterSimulation::validateState(StateReader& reader) {
+    // Parsing into a scratch simulation runs exactly the checks restoreState applies
+    MonsterSimulation scratch;
+    return scratch.restoreState(reader);
+}
+
+// ===== Tick =====
+
+void MonsterSimulation::setPlayerPosition(const Vec3& position) {
+    playerPosition = position;
+    hasPlayer = true;
+}
+
+void MonsterSimulation::update(float deltaTime) {
+    if (liveCount == 0) {
+        std::fill(stateStart, stateStart + STATE_COUNT + 1, 0);
+        return;
+    }
+
+    updateTimers(deltaTime);
+    updatePerception(deltaTime);
+    evaluateTransitions();
+    bucketByState();
+
+    // One kernel per state over that state's contiguous bucket
+    auto bucket = [this](MonsterState s, int& begin, int& end) {
+        begin = stateStart[static_cast<int>(s)];
+        end = stateStart[static_cast<int>(s) + 1];
+    };
+    int begin, end;
+    bucket(MonsterState::Idle, begin, end);       updateIdle(begin, end);
+    bucket(MonsterState::Alert, begin, end);      updateIdle(begin, end);
+    bucket(MonsterState::Stunned, begin, end);    updateIdle(begin, end);
+    bucket(MonsterState::Patrolling, begin, end); updatePatrolling(begin, end);
+    bucket(MonsterState::Chasing, begin, end);    updateChasing(begin, end);
+    bucket(MonsterState::Attacking, begin, end);  updateAttacking(begin, end);
+    bucket(MonsterState::Retreating, begin, end); updateRetreating(begin, end);
+
+    avoidCollisions(deltaTime);
+    integrate(deltaTime);
+    gridDirty = true;
+}
+
+void MonsterSimulation::clearEvents() {
+    attackEvents.clear();
+    stateChanges.clear();
+}
+
+void MonsterSimulation::updateTimers(float deltaTime) {
+    for (size_t i = 0; i < liveCount; i++) {
+        stateTimer[i] += deltaTime;
+        moveTimer[i] += deltaTime;
+        stunTimer[i] = std::max(0.0f, stunTimer[i] - deltaTime);
+    }
+}
+
+void MonsterSimulation::updatePerception(float deltaTime) {
+    if (!hasPlayer) {
+        std::fill(lineOfSight.begin(), lineOfSight.begin() + liveCount, static_cast<uint8_t>(0));
+        std::fill(distanceToPlayer.begin(), distanceToPlayer.begin() + liveCount, 1.0e9f);
+        return;
+    }
+
+    const float px = playerPosition.x, py = playerPosition.y, pz = playerPosition.z;
+    for (size_t i = 0; i < liveCount; i++) {
+        const MonsterArchetype& archetype = ARCHETYPES[type[i]];
+        float dx = px - positionX[i];
+        float dy = py - positionY[i];
+        float dz = pz - positionZ[i];
+        float distance = std::sqrt(dx * dx + dy * dy + dz * dz);
+        distanceToPlayer[i] = distance;
+
+        // Range-based sight (no occluders in the world yet)
+        bool sees = distance <= archetype.detectionRange;
+        lineOfSight[i] = sees ? 1 : 0;
+        if (sees) {
+            lastKnownX[i] = px;
+            lastKnownZ[i] = pz;
+        }
+
+        // Threat grows as the player closes in and health drops
+        float healthFraction = health[i] / archetype.maxHealth;
+        float threat = ((1.0f - distance / archetype.detectionRange) + (1.0f - healthFraction)) * 0.5f;
+        if (threat > 0.5f) {
+            aggression[i] = std::min(1.0f, aggression[i] + deltaTime * 0.5f);
+        } else {
+            aggression[i] = std::max(0.1f, aggression[i] - deltaTime * 0.1f);
+        }
+        if (healthFraction < RETREAT_HEALTH) {
+            fear[i] = std::min(1.0f, fear[i] + deltaTime * 0.3f);
+        } else {
+            fear[i] = std::max(0.0f, fear[i] - deltaTime * 0.1f);
+        }
+    }
+}
+
+MonsterState MonsterSimulation::determineNextState(size_t i) const {
+    const MonsterArchetype& archetype = ARCHETYPES[type[i]];
+    MonsterState current = static_cast<MonsterState>(state[i]);
+
+    // Stunned until the timer runs out
+    if (stunTimer[i] > 0.0f) {
+        return MonsterState::Stunned;
+    }
+
+    // Low health + high fear: retreat for a while or until health recovers
+    float healthFraction = health[i] / archetype.maxHealth;
+    if (current == MonsterState::Retreating) {
+        if (stateTimer[i] < RETREAT_DURATION && healthFraction <= RETREAT_RECOVERED_HEALTH) {
+            return MonsterState::Retreating;
+        }
+    } else if (healthFraction < RETREAT_HEALTH && fear[i] > RETREAT_FEAR) {
+        return MonsterState::Retreating;
+    }
+
+    if (lineOfSight[i]) {
+        if (distanceToPlayer[i] <= archetype.attackRange) {
+            return MonsterState::Attacking;
+        }
+        if (distanceToPlayer[i] <= archetype.dangerRange) {
+            return MonsterState::Chasing;
+        }
+        // Just spotted the player: alert first
+        if (current == MonsterState::Patrolling || current == MonsterState::Idle) {
+            return MonsterState::Alert;
+        }
+        return MonsterState::Chasing;
+    }
+
+    // Lost sight while hunting: search around the last sighting
+    if (current == MonsterState::Chasing || current == MonsterState::Attacking) {
+        float dx = lastKnownX[i] - positionX[i];
+        float dz = lastKnownZ[i] - positionZ[i];
+        if (dx * dx + dz * dz > LOST_SIGHT_DISTANCE * LOST_SIGHT_DISTANCE) {
+            return MonsterState::Alert;
+        }
+    }
+    if (current == MonsterState::Alert && stateTimer[i] <= ALERT_SEARCH_TIME) {
+        return MonsterState::Alert;
+    }
+
+    return MonsterState::Patrolling;
+}
+
+void MonsterSimulation::evaluateTransitions() {
+    // Decide for everyone first, then apply, so no monster sees a half-updated neighbour
+    for (size_t i = 0; i < liveCount; i++) {
+        nextState[i] = static_cast<uint8_t>(determineNextState(i));
+    }
+    for (size_t i = 0; i < liveCount; i++) {
+        if (nextState[i] != state[i]) {
+            enterState(i, static_cast<MonsterState>(nextState[i]));
+        }
+    }
+}
+
+void MonsterSimulation::enterState(size_t i, MonsterState newState) {
+    MonsterState oldState = static_cast<MonsterState>(state[i]);
+    if (oldState == newState) return;
+
+    state[i] = static_cast<uint8_t>(newState);
+    stateTimer[i] = 0.0f;
+    moveTimer[i] = 0.0f;
+    charging[i] = 0;
+    stateChanges.push_back({ handleOf[i], oldState, newState });
+
+    if (newState == MonsterState::Patrolling) {
+        pickPatrolTarget(i);
+    } else if (newState == MonsterState::Chasing && hasPlayer) {
+        faceDirection(i, playerPosition.x - positionX[i], playerPosition.z - positionZ[i]);
+    }
+}
+
+void MonsterSimulation::bucketByState() {
+    int counts[STATE_COUNT] = {};
+    for (size_t i = 0; i < liveCount; i++) {
+        counts[state[i]]++;
+    }
+
+    stateStart[0] = 0;
+    for (int s = 0; s < STATE_COUNT; s++) {
+        stateStart[s + 1] = stateStart[s] + counts[s];
+    }
+
+    int cursor[STATE_COUNT];
+    std::copy(stateStart, stateStart + STATE_COUNT, cursor);
+    stateOrder.resize(liveCount);
+    for (size_t i = 0; i < liveCount; i++) {
+        stateOrder[cursor[state[i]]++] = static_cast<uint32_t>(i);
+    }
+}
+
+void MonsterSimulation::updateIdle(int begin, int end) {
+    for (int k = begin; k < end; k++) {
+        uint32_t i = stateOrder[k];
+        preferredX[i] = 0.0f;
+        preferredZ[i] = 0.0f;
+    }
+}
+
+void MonsterSimulation::updatePatrolling(int begin, int end) {
+    for (int k = begin; k < end; k++) {
+        uint32_t i = stateOrder[k];
+        float dx = targetX[i] - positionX[i];
+        float dz = targetZ[i] - positionZ[i];
+        float distance = std::sqrt(dx * dx + dz * dz);
+
+        if (moveTimer[i] > PATROL_RETARGET_TIME || distance < PATROL_ARRIVE_DISTANCE) {
+            pickPatrolTarget(i);
+            moveTimer[i] = 0.0f;
+            dx = targetX[i] - positionX[i];
+            dz = targetZ[i] - positionZ[i];
+            distance = std::sqrt(dx * dx + dz * dz);
+        }
+
+        float speed = distance > 0.1f ? ARCHETYPES[type[i]].baseSpeed / distance : 0.0f;
+        preferredX[i] = dx * speed;
+        preferredZ[i] = dz * speed;
+        faceDirection(i, dx, dz);
+    }
+}
+
+void MonsterSimulation::updateChasing(int begin, int end) {
+    for (int k = begin; k < end; k++) {
+        uint32_t i = stateOrder[k];
+        const MonsterArchetype& archetype = ARCHETYPES[type[i]];
+
+        // Head for the player while in sight, otherwise for the last sighting (on the ground plane)
+        float goalX = lineOfSight[i] ? playerPosition.x : lastKnownX[i];
+        float goalZ = lineOfSight[i] ? playerPosition.z : lastKnownZ[i];
+        float dx = goalX - positionX[i];
+        float dz = goalZ - positionZ[i];
+        float distance = std::sqrt(dx * dx + dz * dz);
+
+        charging[i] = (distanceToPlayer[i] <= archetype.dangerRange) ? 1 : 0;
+        float speed = charging[i] ? archetype.chargeSpeed : archetype.baseSpeed;
+        float scale = distance > 0.1f ? speed / distance : 0.0f;
+        preferredX[i] = dx * scale;
+        preferredZ[i] = dz * scale;
+        faceDirection(i, dx, dz);
+    }
+}
+
+void MonsterSimulation::updateAttacking(int begin, int end) {
+    for (int k = begin; k < end; k++) {
+        uint32_t i = stateOrder[k];
+        const MonsterArchetype& archetype = ARCHETYPES[type[i]];
+        preferredX[i] = 0.0f;
+        preferredZ[i] = 0.0f;
+        if (hasPlayer) {
+            faceDirection(i, playerPosition.x - positionX[i], playerPosition.z - positionZ[i]);
+        }
+
+        // The state timer doubles as the cooldown clock
+        if (stateTimer[i] >= archetype.attackCooldown) {
+            attackEvents.push_back({ handleOf[i], archetype.attackDamage });
+            stateTimer[i] = 0.0f;
+        }
+    }
+}
+
+void MonsterSimulation::updateRetreating(int begin, int end) {
+    for (int k = begin; k < end; k++) {
+        uint32_t i = stateOrder[k];
+        float dx = positionX[i] - playerPosition.x;
+        float dz = positionZ[i] - playerPosition.z;
+        float distance = std::sqrt(dx * dx + dz * dz);
+
+        float speed = ARCHETYPES[type[i]].baseSpeed * RETREAT_SPEED_FACTOR;
+        float scale = (hasPlayer && distance > 0.1f) ? speed / distance : 0.0f;
+        preferredX[i] = dx * scale;
+        preferredZ[i] = dz * scale;
+        faceDirection(i, dx, dz);
+    }
+}
+
+void MonsterSimulation::avoidCollisions(float deltaTime) {
+    if (!avoidance.enabled || avoidance.maxNeighbours <= 0) {
+        std::copy(preferredX.begin(), preferredX.begin() + liveCount, avoidedX.begin());
+        std::copy(preferredZ.begin(), preferredZ.begin() + liveCount, avoidedZ.begin());
+        return;
+    }
+
+    // Positions have not moved since the last integrate: one rebuild serves every agent
+    if (gridDirty) rebuildGrid();
+    avoidRange(0, liveCount, deltaTime, avoidanceScratch);
+}
+
+void MonsterSimulation::avoidRange(size_t begin, size_t end, float deltaTime, std::vector<uint32_t>& candidates) {
+    const int maxNeighbours = std::min(avoidance.maxNeighbours, MAX_AVOIDANCE_NEIGHBOURS);
+    const float rangeSquared = avoidance.neighbourDistance * avoidance.neighbourDistance;
+    AvoidanceAgent neighbours[MAX_AVOIDANCE_NEIGHBOURS];
+    float neighbourDistance[MAX_AVOIDANCE_NEIGHBOURS];
+
+    for (size_t i = begin; i < end; i++) {
+        MonsterState current = static_cast<MonsterState>(state[i]);
+        if (current == MonsterState::Stunned) {
+            avoidedX[i] = 0.0f; // Held in place; the others still steer around it
+            avoidedZ[i] = 0.0f;
+            continue;
+        }
+
+        // Idle and attacking monsters may still step aside at walking pace
+        const MonsterArchetype& archetype = ARCHETYPES[type[i]];
+        float preferredSpeed = std::sqrt(preferredX[i] * preferredX[i] + preferredZ[i] * preferredZ[i]);
+        float maxSpeed = std::max(preferredSpeed, archetype.baseSpeed);
+        float selfReach = archetype.collisionRadius + maxSpeed * avoidance.timeHorizon;
+
+        // K nearest live monsters that could touch this one within the time horizon
+        // (at their archetype's top speed), kept sorted by insertion
+        int neighbourCount = 0;
+        auto consider = [&](size_t j) {
+            if (j == i) return;
+            float dx = positionX[j] - positionX[i];
+            float dz = positionZ[j] - positionZ[i];
+            float distanceSquared = dx * dx + dz * dz;
+            if (distanceSquared >= rangeSquared) return;
+            if (neighbourCount == maxNeighbours && distanceSquared >= neighbourDistance[neighbourCount - 1]) return;
+            const MonsterArchetype& other = ARCHETYPES[type[j]];
+            float reach = selfReach + other.collisionRadius + other.chargeSpeed * avoidance.timeHorizon;
+            if (distanceSquared > reach * reach) return;
+
+            int slot = neighbourCount < maxNeighbours ? neighbourCount++ : neighbourCount - 1;
+            while (slot > 0 && neighbourDistance[slot - 1] > distanceSquared) {
+                neighbourDistance[slot] = neighbourDistance[slot - 1];
+                neighbours[slot] = neighbours[slot - 1];
+                slot--;
+            }
+            neighbourDistance[slot] = distanceSquared;
+            neighbours[slot] = { positionX[j], positionZ[j], velocityX[j], velocityZ[j], other.collisionRadius };
+        };
+        if (gatherNearbyCurrent(positionX[i], positionZ[i], avoidance.neighbourDistance, candidates)) {
+            for (uint32_t j : candidates) consider(j);
+        } else {
+            for (size_t j = 0; j < liveCount; j++) consider(j);
+        }
+
+        if (neighbourCount == 0) {
+            avoidedX[i] = preferredX[i];
+            avoidedZ[i] = preferredZ[i];
+            continue;
+        }
+
+        AvoidanceAgent self = { positionX[i], positionZ[i], velocityX[i], velocityZ[i], archetype.collisionRadius };
+        computeAvoidanceVelocity(self, preferredX[i], preferredZ[i], maxSpeed, neighbours, neighbourCount,
+                                 avoidance.timeHorizon, deltaTime, avoidedX[i], avoidedZ[i]);
+    }
+}
+
+void MonsterSimulation::integrate(float deltaTime) {
+    for (size_t i = 0; i < liveCount; i++) {
+        velocityX[i] = avoidedX[i];
+        velocityZ[i] = avoidedZ[i];
+        positionX[i] += velocityX[i] * deltaTime;
+        positionZ[i] += velocityZ[i] * deltaTime;
+    }
+}
+
+// ===== Helpers =====
+
+void MonsterSimulation::pickPatrolTarget(size_t i) {
+    const MonsterArchetype& archetype = ARCHETYPES[type[i]];
+    float angle = nextRandom(i, RandomStream::Patrol) * TWO_PI;
+    float distance = PATROL_MIN_DISTANCE + nextRandom(i, RandomStream::Patrol) * std::max(0.0f, archetype.patrolRadius - PATROL_MIN_DISTANCE);
+    targetX[i] = positionX[i] + std::cos(angle) * distance;
+    targetZ[i] = positionZ[i] + std::sin(angle) * distance;
+}
+
+void MonsterSimulation::faceDirection(size_t i, float directionX, float directionZ) {
+    if (directionX == 0.0f && directionZ == 0.0f) return;
+    // atan2(x, z): angle from +Z towards +X, matching the model's forward axis
+    yawDegrees[i] = std::atan2(directionX, directionZ) * RADIANS_TO_DEGREES;
+}
+
+float MonsterSimulation::nextRandom(size_t i, RandomStream stream) {
+    // The counter is shared by the streams, so it only has to be unique per draw
+    return randomFloat(worldSeed, randomKey[i], randomDraws[i]++, stream);
+}
+
+int MonsterSimulation::getCountInState(MonsterState monsterState) const {
+    if (monsterState == MonsterState::Dead) {
+        return static_cast<int>(count - liveCount);
+    }
+    int s = static_cast<int>(monsterState);
+    return stateStart[s + 1] - stateStart[s];
+}
+
+// ===== Combat =====
+
+bool MonsterSimulation::applyDamage(uint32_t handle, float damage) {
+    if (!isValid(handle)) return false;
+    size_t i = indexOf[handle];
+    if (i >= liveCount) return false; // Already dead
+
+    health[i] = std::max(0.0f, health[i] - damage);
+    aggression[i] = clamp01(aggression[i] + 0.2f);
+
+    // First hit alerts the pack
+    if (!alertedGroup[i]) {
+        alertedGroup[i] = 1;
+        alertNeighbours(handle);
+    }
+
+    if (health[i] <= 0.0f) {
+        kill(handle);
+        return true;
+    }
+
+    // Heavy hits have a 30% chance to stun, longer for bigger hits
+    if (damage > 15.0f && nextRandom(i, RandomStream::Stun) < 0.3f) {
+        stun(handle, 1.0f + damage / 50.0f);
+    }
+    return false;
+}
+
+void MonsterSimulation::kill(uint32_t handle) {
+    if (!isValid(handle)) return;
+    size_t i = indexOf[handle];
+    if (i >= liveCount) return;
+
+    MonsterState oldState = static_cast<MonsterState>(state[i]);
+    health[i] = 0.0f;
+    velocityX[i] = 0.0f;
+    velocityZ[i] = 0.0f;
+    state[i] = static_cast<uint8_t>(MonsterState::Dead);
+    stateChanges.push_back({ handle, oldState, MonsterState::Dead });
+
+    // Move behind the live range
+    swapSlots(i, liveCount - 1);
+    liveCount--;
+}
+
+void MonsterSimulation::stun(uint32_t handle, float duration) {
+    if (!isValid(handle)) return;
+    size_t i = indexOf[handle];
+    if (i >= liveCount) return;
+
+    stunTimer[i] = std::max(stunTimer[i], duration);
+    enterState(i, MonsterState::Stunned);
+    velocityX[i] = 0.0f;
+    velocityZ[i] = 0.0f;
+}
+
+void MonsterSimulation::alertNeighbours(uint32_t handle) {
+    if (!isValid(handle)) return;
+    size_t source = indexOf[handle];
+    const float sx = positionX[source], sz = positionZ[source];
+    const float radiusSquared = groupAlertRadius * groupAlertRadius;
+
+    auto alert = [&](size_t i) {
+        if (i == source) return;
+        float dx = positionX[i] - sx;
+        float dz = positionZ[i] - sz;
+        if (dx * dx + dz * dz > radiusSquared) return;
+
+        MonsterState current = static_cast<MonsterState>(state[i]);
+        if (current == MonsterState::Idle || current == MonsterState::Patrolling) {
+            enterState(i, MonsterState::Alert);
+        }
+        if (hasPlayer) {
+            lastKnownX[i] = playerPosition.x;
+            lastKnownZ[i] = playerPosition.z;
+        }
+        aggression[i] = clamp01(aggression[i] + 0.1f);
+    };
+
+    if (gatherNearby(sx, sz, groupAlertRadius, false, gridScratch)) {
+        for (uint32_t i : gridScratch) alert(i);
+    } else {
+        for (size_t i = 0; i < liveCount; i++) alert(i);
+    }
+}
+
+// ===== Radius queries =====
+
+void MonsterSimulation::rebuildGrid() {
+    // Power-of-two bucket count, about two buckets per live monster
+    uint32_t bucketCount = MIN_GRID_BUCKETS;
+    while (bucketCount < liveCount * 2) bucketCount <<= 1;
+    gridMask = bucketCount - 1;
+
+    // Counting sort of live handles by bucket
+    gridStart.assign(bucketCount + 1, 0);
+    gridBucketOf.resize(liveCount);
+    for (size_t i = 0; i < liveCount; i++) {
+        uint32_t bucket = gridHash(gridCell(positionX[i]), gridCell(positionZ[i])) & gridMask;
+        gridBucketOf[i] = bucket;
+        gridStart[bucket + 1]++;
+    }
+    for (uint32_t b = 0; b < bucketCount; b++) {
+        gridStart[b + 1] += gridStart[b];
+    }
+    gridEntries.resize(liveCount);
+    for (size_t i = 0; i < liveCount; i++) {
+        // gridStart[b] doubles as the write cursor and ends at the next bucket's start
+        GridEntry& entry = gridEntries[gridStart[gridBucketOf[i]]++];
+        entry.x = positionX[i];
+        entry.z = positionZ[i];
+        entry.cellX = gridCell(positionX[i]);
+        entry.cellZ = gridCell(positionZ[i]);
+        entry.handle = handleOf[i];
+    }
+    for (uint32_t b = bucketCount; b > 0; b--) {
+        gridStart[b] = gridStart[b - 1];
+    }
+    gridStart[0] = 0;
+
+    gridDirty = false;
+}
+
+bool MonsterSimulation::gatherNearby(float x, float z, float reach, bool allowRebuild, std::vector<uint32_t>& indices) {
+    if (gridDirty) {
+        if (!allowRebuild) return false; // A single lookup is cheaper as a scan than a rebuild
+        rebuildGrid();
+    }
+    return gatherNearbyCurrent(x, z, reach, indices);
+}
+
+bool MonsterSimulation::gatherNearbyCurrent(float x, float z, float reach, std::vector<uint32_t>& indices) const {
+    int minX = gridCell(x - reach), maxX = gridCell(x + reach);
+    int minZ = gridCell(z - reach), maxZ = gridCell(z + reach);
+    size_t cellCount = static_cast<size_t>(maxX - minX + 1) * static_cast<size_t>(maxZ - minZ + 1);
+    if (cellCount >= liveCount) return false; // An area wider than the population is cheaper as a scan
+
+    // Cached entry positions keep rejected candidates off the SoA arrays
+    const float reachSquared = reach * reach;
+    indices.clear();
+    for (int cellZ = minZ; cellZ <= maxZ; cellZ++) {
+        for (int cellX = minX; cellX <= maxX; cellX++) {
+            uint32_t bucket = gridHash(cellX, cellZ) & gridMask;
+            for (uint32_t e = gridStart[bucket]; e < gridStart[bucket + 1]; e++) {
+                const GridEntry& entry = gridEntries[e];
+                // Colliding cells share a bucket; take each entry only from its own cell
+                if (entry.cellX != cellX || entry.cellZ != cellZ) continue;
+                float dx = entry.x - x;
+                float dz = entry.z - z;
+                if (dx * dx + dz * dz > reachSquared) continue;
+                uint32_t i = indexOf[entry.handle];
+                if (i >= liveCount) continue; // Killed since the rebuild
+                indices.push_back(i);
+            }
+        }
+    }
+    return true;
+}
+
+size_t MonsterSimulation::queryRadius(const Vec3& center, float radius, std::vector<uint32_t>& handles) {
+    handles.clear();
+    if (liveCount == 0 || radius < 0.0f) return 0;
+
+    auto test = [&](size_t i) {
+        float reach = radius + ARCHETYPES[type[i]].collisionRadius;
+        float dx = positionX[i] - center.x;
+        float dy = positionY[i] - center.y;
+        float dz = positionZ[i] - center.z;
+        if (dx * dx + dy * dy + dz * dz <= reach * reach) {
+            handles.push_back(handleOf[i]);
+        }
+    };
+
+    if (gatherNearby(center.x, center.z, radius + MAX_COLLISION_RADIUS, true, gridScratch)) {
+        for (uint32_t i : gridScratch) test(i);
+    } else {
+        for (size_t i = 0; i < liveCount; i++) test(i);
+    }
+    return handles.size();
+}
+
+// ===== Per-monster access =====
+
+void MonsterSimulation::setState(uint32_t handle, MonsterState newState) {
+    if (!isValid(handle)) return;
+    if (newState == MonsterState::Dead) {
+        kill(handle);
+        return;
+    }
+    size_t i = indexOf[handle];
+    if (i >= liveCount) return; // Dead monsters only come back through respawn()
+    enterState(i, newState);
+}
+
+Vec3 MonsterSimulation::getPosition(uint32_t handle) const {
+    size_t i = indexOf[handle];
+    return Vec3(positionX[i], positionY[i], positionZ[i]);
+}
+
+void MonsterSimulation::setPosition(uint32_t handle, const Vec3& position) {
+    size_t i = indexOf[handle];
+    positionX[i] = position.x;
+    positionY[i] = position.y;
+    positionZ[i] = position.z;
+    gridDirty = true;
+}
+
+void MonsterSimulation::setHealth(uint32_t handle, float value) {
+    if (!isValid(handle)) return;
+    size_t i = indexOf[handle];
+    if (i >= liveCount) return;
+
+    health[i] = std::max(0.0f, std::min(ARCHETYPES[type[i]].maxHealth, value));
+    if (health[i] <= 0.0f) {
+        kill(handle);
+    }
+}
+
+void MonsterSimulation::setAggression(uint32_t handle, float level) {
+    aggression[indexOf[handle]] = clamp01(level);
+}
+
+void MonsterSimulation::setFear(uint32_t handle, float level) {
+    fear[indexOf[handle]] = clamp01(level);
+}
+
+Vec3 MonsterSimulation::getPatrolTarget(uint32_t handle) const {
+    size_t i = indexOf[handle];
+    return Vec3(targetX[i], positionY[i], targetZ[i]);
+}
+
+void MonsterSimulation::setPatrolTarget(uint32_t handle, const Vec3& target) {
+    size_t i = indexOf[handle];
+    targetX[i] = target.x;
+    targetZ[i] = target.z;
+    moveTimer[i] = 0.0f;
+}
+
+} // namespace Engine
@@ -0,0 +1,290 @@
+/**
+ * MonsterSimulation.h - Data-Oriented Monster State and Batched AI
+ *
+ * OVERVIEW:
+ * Holds the hot per-monster state (position, velocity, heading, health,
+ * state machine, timers, perception) in contiguous structure-of-arrays
+ * storage and advances every monster with a fixed sequence of batched
+ * passes. MonsterSpawner owns one instance; Monster GameObjects are thin
+ * views that read their gameplay state through a handle and only keep
+ * rendering data (mesh, materials, health bar, visual effects).
+ *
+ * FEATURES:
+ * - SoA arrays, one element per monster, live monsters packed in [0, liveCount)
+ *   and dead ones moved behind them so passes never branch over corpses
+ * - Per-type tuning in a small archetype table (MonsterArchetype) instead of
+ *   copies in every monster
+ * - Tick passes: timers -> perception -> state transitions -> bucket by state
+ *   -> per-state movement/attack kernels (preferred velocities) -> crowd
+ *   avoidance -> integration
+ * - Crowd avoidance: ORCA (CrowdAvoidance.h) against the K nearest monsters
+ *   from the spatial grid, so chasing packs flow around each other instead
+ *   of stacking. Reads only last tick's velocities, so ranges of agents are
+ *   independent (avoidRange) and can be split across workers
+ * - Stable handles (slot indices) for views, dense indices for iteration
+ * - Attack and state-change events collected per tick for the spawner to
+ *   apply to the player and the views
+ * - Counter-based random numbers (Random.h): every draw is a hash of the
+ *   world seed, the monster's spawn key and its draw counter, with separate
+ *   streams for patrol targets and stun rolls; no global rand() state
+ * - Radius queries (explosions) over a hashed uniform grid on the XZ plane,
+ *   rebuilt lazily with a counting sort the first time it is queried after
+ *   monsters moved, so a volley of explosions shares one rebuild per tick;
+ *   the damage group alert reuses the grid while it is current
+ * - saveState/restoreState copy the arrays to and from a StateBuffer in
+ *   one memcpy each (SimulationState snapshots)
+ * - GL-free: part of ww3_core and benchmarked headless with thousands of monsters
+ */
+
+#pragma once
+#include "../Math/Math.h"
+#include "StateBuffer.h"
+#include "CrowdAvoidance.h"
+#include "../Math/Random.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Engine {
+
+/**
+ * MonsterType - Different types of monsters
+ */
+enum class MonsterType {
+    Xenomorph,      // Standard alien monster
+    Runner,         // Fast moving monster
+    Tank            // Slow but tough monster
+};
+
+/**
+ * MonsterState - Current state of the monster
+ */
+enum class MonsterState {
+    Idle,           // Standing still
+    Patrolling,     // Moving around
+    Alert,          // Aware of player but not yet chasing
+    Chasing,        // Moving towards player
+    Attacking,      // Performing attack
+    Stunned,        // Temporarily disabled (e.g., after taking damage)
+    Retreating,     // Moving away from player when low health
+    Dead            // Dead monster
+};
+
+/**
+ * MonsterArchetype - Tuning shared by every monster of one type
+ */
+struct MonsterArchetype {
+    float maxHealth;
+    float baseSpeed;        // Patrol/chase speed
+    float chargeSpeed;      // Chase speed inside the danger range
+    float attackRange;
+    float attackDamage;
+    float attackCooldown;   // Seconds between attacks
+    float detectionRange;   // Player is seen inside this range
+    float dangerRange;      // Monster charges inside this range
+    float patrolRadius;
+    float collisionRadius;
+    float initialAggression;
+    float initialFear;
+    int experienceReward;
+    int scoreReward;
+};
+
+/**
+ * Attack landed on the player this tick
+ */
+struct MonsterAttackEvent {
+    uint32_t handle;
+    float damage;
+};
+
+/**
+ * State transition made this tick (lets views run their onStateChange hooks)
+ */
+struct MonsterStateChange {
+    uint32_t handle;
+    MonsterState oldState;
+    MonsterState newState;
+};
+
+/**
+ * MonsterSimulation - SoA monster storage and batched state machine
+ */
+class MonsterSimulation {
+public:
+    static const uint32_t INVALID_HANDLE = 0xFFFFFFFFu;
+    static const int STATE_COUNT = static_cast<int>(MonsterState::Dead) + 1;
+
+private:
+    // ===== Hot state (dense, index = position in the arrays) =====
+    std::vector<float> positionX, positionY, positionZ;
+    std::vector<float> velocityX, velocityZ;
+    std::vector<float> yawDegrees;
+    std::vector<float> health;
+    std::vector<uint8_t> state;       // MonsterState
+    std::vector<uint8_t> type;        // MonsterType, indexes the archetype table
+    std::vector<float> stateTimer;    // Time in the current state (also the attack cooldown clock)
+    std::vector<float> moveTimer;     // Time since the last patrol target
+    std::vector<float> stunTimer;     // Remaining stun time
+    std::vector<float> distanceToPlayer;
+    std::vector<uint8_t> lineOfSight;
+    std::vector<uint8_t> charging;
+    std::vector<uint8_t> alertedGroup; // Damage already alerted the neighbours
+    std::vector<float> aggression;
+    std::vector<float> fear;
+    std::vector<float> targetX, targetZ;       // Patrol target
+    std::vector<float> lastKnownX, lastKnownZ; // Last seen player position
+    std::vector<uint32_t> randomKey;   // Spawn key: the entity half of the random key
+    std::vector<uint32_t> randomDraws; // Draws taken so far (the counter)
+    std::vector<uint32_t> handleOf;   // Dense index -> handle
+
+    // ===== Handle table =====
+    std::vector<uint32_t> indexOf;    // Handle -> dense index (INVALID_HANDLE when free)
+    std::vector<uint32_t> freeHandles;
+    uint32_t retiredBelow;  // Handles below this were retired by clear() and are never revived
+
+    size_t count;      // All monsters, live and dead
+    size_t liveCount;  // Monsters in [0, liveCount) are alive
+
+    // ===== Per-tick scratch =====
+    Vec3 playerPosition;
+    bool hasPlayer;
+    std::vector<uint8_t> nextState;
+    std::vector<float> preferredX, preferredZ;  // Velocity the state kernels asked for
+    std::vector<float> avoidedX, avoidedZ;      // After crowd avoidance (becomes velocity)
+    std::vector<uint32_t> stateOrder;   // Live indices grouped by state
+    int stateStart[STATE_COUNT + 1];    // Bucket bounds into stateOrder
+    std::vector<MonsterAttackEvent> attackEvents;
+    std::vector<MonsterStateChange> stateChanges;
+
+    float groupAlertRadius;
+    CrowdAvoidanceConfig avoidance;
+    uint64_t worldSeed;
+
+    // ===== Spatial grid (handles bucketed by hashed XZ cell) =====
+    struct GridEntry {
+        float x, z;             // Position at the rebuild (current while the grid is not dirty)
+        int32_t cellX, cellZ;   // Colliding cells share a bucket
+        uint32_t handle;        // Survives kills between rebuilds, unlike the dense index
+    };
+    std::vector<uint32_t> gridStart;    // Bucket -> first entry in gridEntries (bucketCount + 1)
+    std::vector<GridEntry> gridEntries; // Live monsters grouped by bucket
+    std::vector<uint32_t> gridBucketOf; // Scratch: bucket of each live index during a rebuild
+    std::vector<uint32_t> gridScratch;  // Scratch: candidate indices of one query
+    std::vector<uint32_t> avoidanceScratch; // Scratch: neighbour candidates of the avoidance pass
+    uint32_t gridMask;
+    bool gridDirty;     // Positions or population changed since the last rebuild
+
+public:
+    MonsterSimulation();
+
+    // Population
+    uint32_t add(MonsterType monsterType, const Vec3& position, uint32_t seed);
+    void remove(uint32_t handle);
+    void clear(); // Handles are retired, never reused
+    void reserve(size_t capacity);
+    bool isValid(uint32_t handle) const;
+    void respawn(uint32_t handle, const Vec3& position); // Full health, Idle, new patrol target
+
+    // Simulation
+    void setPlayerPosition(const Vec3& position);
+    void clearPlayer() { hasPlayer = false; }
+    void update(float deltaTime);
+
+    // Events since the last clearEvents() (ticks plus damage/kills applied between ticks)
+    const std::vector<MonsterAttackEvent>& getAttackEvents() const { return attackEvents; }
+    const std::vector<MonsterStateChange>& getStateChanges() const { return stateChanges; }
+    void clearEvents();
+
+    // Combat
+    bool applyDamage(uint32_t handle, float damage); // True if this damage killed the monster
+    void kill(uint32_t handle);
+    void stun(uint32_t handle, float duration);
+    void alertNeighbours(uint32_t handle);
+
+    // Live monsters whose collision sphere overlaps the sphere (center, radius).
+    // Replaces the contents of handles and returns the count. Rebuilds the
+    // grid first if anything moved since the last query.
+    size_t queryRadius(const Vec3& center, float radius, std::vector<uint32_t>& handles);
+    static const float GRID_CELL_SIZE;
+
+    // Per-monster access by handle
+    MonsterType getType(uint32_t handle) const { return static_cast<MonsterType>(type[indexOf[handle]]); }
+    MonsterState getState(uint32_t handle) const { return static_cast<MonsterState>(state[indexOf[handle]]); }
+    void setState(uint32_t handle, MonsterState newState);
+    Vec3 getPosition(uint32_t handle) const;
+    void setPosition(uint32_t handle, const Vec3& position);
+    float getYawDegrees(uint32_t handle) const { return yawDegrees[indexOf[handle]]; }
+    void setYawDegrees(uint32_t handle, float degrees) { yawDegrees[indexOf[handle]] = degrees; }
+    float getHealth(uint32_t handle) const { return health[indexOf[handle]]; }
+    void setHealth(uint32_t handle, float value);
+    float getMaxHealth(uint32_t handle) const { return getArchetype(getType(handle)).maxHealth; }
+    float getAggression(uint32_t handle) const { return aggression[indexOf[handle]]; }
+    void setAggression(uint32_t handle, float level);
+    float getFear(uint32_t handle) const { return fear[indexOf[handle]]; }
+    void setFear(uint32_t handle, float level);
+    float getStunTimer(uint32_t handle) const { return stunTimer[indexOf[handle]]; }
+    bool hasLineOfSight(uint32_t handle) const { return lineOfSight[indexOf[handle]] != 0; }
+    bool isCharging(uint32_t handle) const { return charging[indexOf[handle]] != 0; }
+    Vec3 getPatrolTarget(uint32_t handle) const;
+    void setPatrolTarget(uint32_t handle, const Vec3& target);
+
+    // Dense iteration (indices are only stable until the next add/remove/kill)
+    size_t size() const { return count; }
+    size_t getLiveCount() const { return liveCount; }
+    uint32_t getHandleAt(size_t index) const { return handleOf[index]; }
+    Vec3 getPositionAt(size_t index) const { return Vec3(positionX[index], positionY[index], positionZ[index]); }
+    float getYawDegreesAt(size_t index) const { return yawDegrees[index]; }
+    int getCountInState(MonsterState monsterState) const; // From the last update()
+
+    // Snapshots: every monster, the handle table and the random streams.
+    // Restored handles that clear() has retired since are given new numbers
+    // (views bound to the old ones keep reading as dead).
+    static const uint32_t STATE_TAG;
+    static const uint16_t STATE_VERSION;
+    void saveState(StateWriter& writer) const;
+    bool restoreState(StateReader& reader);
+    static bool validateState(StateReader& reader); // Same checks as restoreState, changes nothing
+
+    // Configuration
+    void setGroupAlertRadius(float radius) { groupAlertRadius = radius; }
+    void setWorldSeed(uint64_t seed) { worldSeed = seed; }
+    uint64_t getWorldSeed() const { return worldSeed; }
+    void setCrowdAvoidance(const CrowdAvoidanceConfig& config) { avoidance = config; }
+    const CrowdAvoidanceConfig& getCrowdAvoidance() const { return avoidance; }
+    static const MonsterArchetype& getArchetype(MonsterType monsterType);
+
+private:
+    // Tick passes
+    void updateTimers(float deltaTime);
+    void updatePerception(float deltaTime);
+    void evaluateTransitions();
+    void bucketByState();
+    void updateIdle(int begin, int end);
+    void updatePatrolling(int begin, int end);
+    void updateChasing(int begin, int end);
+    void updateAttacking(int begin, int end);
+    void updateRetreating(int begin, int end);
+    void avoidCollisions(float deltaTime);
+    // Avoided velocities of live indices [begin, end). Reads positions and last
+    // tick's velocities and writes only avoidedX/Z[begin, end), so disjoint
+    // ranges may run concurrently (one candidates buffer each) once the grid
+    // is current
+    void avoidRange(size_t begin, size_t end, float deltaTime, std::vector<uint32_t>& candidates);
+    void integrate(float deltaTime);
+
+    MonsterState determineNextState(size_t index) const;
+    void enterState(size_t index, MonsterState newState);
+    void pickPatrolTarget(size_t index);
+    void faceDirection(size_t index, float directionX, float directionZ);
+    float nextRandom(size_t index, RandomStream stream); // [0, 1)
+    void swapSlots(size_t a, size_t b);
+    void rebuildGrid();
+    // Live indices within reach (XZ) of the point. False = the caller should scan
+    // [0, liveCount) instead (area too wide, or grid stale and !allowRebuild).
+    bool gatherNearby(float x, float z, float reach, bool allowRebuild, std::vector<uint32_t>& indices);
+    bool gatherNearbyCurrent(float x, float z, float reach, std::vector<uint32_t>& indices) const; // Grid must be current
+    void resizeArrays(size_t newSize);
+};
+
+} // namespace Engine
@@ -0,0 +1,295 @@
+/**
+ * ParticleSystem.cpp - Implementation of SoA Particle Emitters
+ */
+
+#include "ParticleSystem.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define WW3_PARTICLES_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace Engine {
+
+namespace {
+
+const float TWO_PI = 6.28318530718f;
+const float PI = 3.14159265359f;
+
+uint8_t toColorByte(float value) {
+    value = std::max(0.0f, std::min(1.0f, value));
+    return static_cast<uint8_t>(value * 255.0f + 0.5f);
+}
+
+} // namespace
+
+const int ParticleSystem::SIMD_WIDTH;
+const size_t ParticleSystem::MAX_PENDING_BURSTS;
+
+ParticleSystem::ParticleSystem(uint32_t seed)
+    : randomState(seed ? seed : 1u), droppedCount(0), gpuAvailable(false), pendingGpuTime(0.0f) {
+}
+
+ParticleEmitterId ParticleSystem::createEmitter(const ParticleEmitterDesc& desc) {
+    ParticlePool pool;
+    pool.desc = desc;
+    pool.count = 0;
+    pool.gpu = desc.simulation == ParticleSimulation::Gpu && gpuAvailable;
+    pool.capacity = pool.gpu ? 0 : std::max<size_t>(desc.capacity, 1);
+
+    std::vector<float>* arrays[] = {
+        &pool.positionX, &pool.positionY, &pool.positionZ,
+        &pool.velocityX, &pool.velocityY, &pool.velocityZ,
+        &pool.age, &pool.lifetime
+    };
+    for (std::vector<float>* array : arrays) {
+        array->assign(pool.capacity, 0.0f);
+    }
+
+    pools.push_back(std::move(pool));
+    return static_cast<ParticleEmitterId>(pools.size() - 1);
+}
+
+ParticleEmitterId ParticleSystem::findEmitter(const std::string& name) const {
+    for (size_t i = 0; i < pools.size(); i++) {
+        if (pools[i].desc.name == name) {
+            return static_cast<ParticleEmitterId>(i);
+        }
+    }
+    return -1;
+}
+
+void ParticleSystem::emit(ParticleEmitterId emitter, const Vec3& position, const Vec3& direction, int count) {
+    if (emitter < 0 || emitter >= static_cast<ParticleEmitterId>(pools.size()) || count <= 0) return;
+
+    ParticlePool& pool = pools[emitter];
+    const ParticleEmitterDesc& desc = pool.desc;
+    size_t requested = static_cast<size_t>(count);
+
+    if (pool.gpu) {
+        // Emitted on the GPU; capacity overflow is dropped there
+        if (pendingBursts.size() >= MAX_PENDING_BURSTS) {
+            droppedCount += requested;
+            return;
+        }
+        pendingBursts.push_back(ParticleBurst{emitter, position, direction, static_cast<uint32_t>(count), nextRandom()});
+        return;
+    }
+
+    size_t accepted = std::min(requested, pool.capacity - pool.count);
+    droppedCount += requested - accepted;
+
+    // Orthonormal basis around the emit direction for the cone samples
+    Vec3 axis = direction.length() > 1e-6f ? direction.normalize() : Vec3(0.0f, 1.0f, 0.0f);
+    Vec3 reference = std::fabs(axis.y) < 0.99f ? Vec3(0.0f, 1.0f, 0.0f) : Vec3(1.0f, 0.0f, 0.0f);
+    Vec3 tangent = axis.cross(reference).normalize();
+    Vec3 bitangent = axis.cross(tangent);
+    float minCosine = std::cos(std::min(desc.spread, PI));
+
+    for (size_t k = 0; k < accepted; k++) {
+        // Uniform over the spherical cap: cosine uniform in [cos(spread), 1]
+        float cosTheta = randomFloat(minCosine, 1.0f);
+        float sinTheta = std::sqrt(std::max(0.0f, 1.0f - cosTheta * cosTheta));
+        float phi = randomFloat(0.0f, TWO_PI);
+        float speed = randomFloat(desc.speedMin, desc.speedMax);
+        Vec3 velocity = (tangent * (std::cos(phi) * sinTheta) +
+                         bitangent * (std::sin(phi) * sinTheta) +
+                         axis * cosTheta) * speed;
+
+        size_t i = pool.count++;
+        pool.positionX[i] = position.x;
+        pool.positionY[i] = position.y;
+        pool.positionZ[i] = position.z;
+        pool.velocityX[i] = velocity.x;
+        pool.velocityY[i] = velocity.y;
+        pool.velocityZ[i] = velocity.z;
+        pool.age[i] = 0.0f;
+        pool.lifetime[i] = std::max(1e-3f, randomFloat(desc.lifetimeMin, desc.lifetimeMax));
+    }
+}
+
+void ParticleSystem::clear() {
+    for (ParticlePool& pool : pools) {
+        pool.count = 0;
+    }
+    pendingBursts.clear();
+}
+
+void ParticleSystem::captureRenderState(ParticleRenderState& state) {
+    // Only new emitters are copied; a state from another system starts over
+    if (state.emitters.size() > pools.size()) {
+        state.emitters.clear();
+    }
+    for (size_t i = state.emitters.size(); i < pools.size(); i++) {
+        state.emitters.push_back(pools[i].desc);
+        state.emitters.back().simulation = pools[i].gpu ? ParticleSimulation::Gpu : ParticleSimulation::Cpu;
+    }
+
+    state.emitterOffsets.resize(pools.size() + 1);
+    state.instances.resize(getParticleCount());
+    size_t written = 0;
+    for (size_t i = 0; i < pools.size(); i++) {
+        state.emitterOffsets[i] = written;
+        written += writeInstances(static_cast<ParticleEmitterId>(i), state.instances.data() + written);
+    }
+    state.emitterOffsets[pools.size()] = written;
+
+    // Bursts beyond the cap are dropped, as they are while nothing drains them
+    size_t room = MAX_PENDING_BURSTS - std::min(MAX_PENDING_BURSTS, state.gpuBursts.size());
+    state.gpuBursts.insert(state.gpuBursts.end(), pendingBursts.begin(),
+                           pendingBursts.begin() + std::min(room, pendingBursts.size()));
+    state.gpuElapsed += pendingGpuTime;
+    pendingBursts.clear();
+    pendingGpuTime = 0.0f;
+}
+
+void ParticleRenderState::clearEvents() {
+    gpuBursts.clear();
+    gpuElapsed = 0.0f;
+}
+
+void ParticleSystem::update(float deltaTime) {
+    if (deltaTime <= 0.0f) return;
+    pendingGpuTime += deltaTime;
+    for (ParticlePool& pool : pools) {
+        if (pool.count == 0) continue;
+        updatePool(pool, deltaTime);
+        if (!expired.empty()) {
+            removeExpired(pool);
+        }
+    }
+}
+
+void ParticleSystem::updatePool(ParticlePool& pool, float deltaTime) {
+    // Implicit drag stays stable for any drag * deltaTime
+    const float damping = 1.0f / (1.0f + pool.desc.drag * deltaTime);
+    const float gravityStep = pool.desc.gravity * deltaTime;
+    const size_t count = pool.count;
+
+    float* px = pool.positionX.data();
+    float* py = pool.positionY.data();
+    float* pz = pool.positionZ.data();
+    float* vx = pool.velocityX.data();
+    float* vy = pool.velocityY.data();
+    float* vz = pool.velocityZ.data();
+    float* age = pool.age.data();
+    const float* lifetime = pool.lifetime.data();
+
+    expired.clear();
+    size_t i = 0;
+
+#ifdef WW3_PARTICLES_SSE2
+    const __m128 dampingV = _mm_set1_ps(damping);
+    const __m128 gravityV = _mm_set1_ps(gravityStep);
+    const __m128 dtV = _mm_set1_ps(deltaTime);
+    const size_t blockEnd = count - count % SIMD_WIDTH;
+
+    for (; i < blockEnd; i += SIMD_WIDTH) {
+        __m128 velX = _mm_mul_ps(_mm_loadu_ps(vx + i), dampingV);
+        __m128 velY = _mm_sub_ps(_mm_mul_ps(_mm_loadu_ps(vy + i), dampingV), gravityV);
+        __m128 velZ = _mm_mul_ps(_mm_loadu_ps(vz + i), dampingV);
+        _mm_storeu_ps(vx + i, velX);
+        _mm_storeu_ps(vy + i, velY);
+        _mm_storeu_ps(vz + i, velZ);
+
+        _mm_storeu_ps(px + i, _mm_add_ps(_mm_loadu_ps(px + i), _mm_mul_ps(velX, dtV)));
+        _mm_storeu_ps(py + i, _mm_add_ps(_mm_loadu_ps(py + i), _mm_mul_ps(velY, dtV)));
+        _mm_storeu_ps(pz + i, _mm_add_ps(_mm_loadu_ps(pz + i), _mm_mul_ps(velZ, dtV)));
+
+        __m128 ageV = _mm_add_ps(_mm_loadu_ps(age + i), dtV);
+        _mm_storeu_ps(age + i, ageV);
+
+        int expiredMask = _mm_movemask_ps(_mm_cmpge_ps(ageV, _mm_loadu_ps(lifetime + i)));
+        while (expiredMask) {
+            int lane = 0;
+            while (!(expiredMask & (1 << lane))) lane++;
+            expired.push_back(static_cast<uint32_t>(i + lane));
+            expiredMask &= expiredMask - 1;
+        }
+    }
+#endif
+
+    // Scalar tail (and the whole pool without SSE2)
+    for (; i < count; i++) {
+        vx[i] *= damping;
+        vy[i] = vy[i] * damping - gravityStep;
+        vz[i] *= damping;
+        px[i] += vx[i] * deltaTime;
+        py[i] += vy[i] * deltaTime;
+        pz[i] += vz[i] * deltaTime;
+        age[i] += deltaTime;
+        if (age[i] >= lifetime[i]) {
+            expired.push_back(static_cast<uint32_t>(i));
+        }
+    }
+}
+
+void ParticleSystem::removeExpired(ParticlePool& pool) {
+    // Highest index first: every slot above the current one is already live,
+    // so the particle swapped in from the end never needs another look
+    for (auto it = expired.rbegin(); it != expired.rend(); ++it) {
+        size_t i = *it;
+        size_t last = --pool.count;
+        if (i == last) continue;
+
+        pool.positionX[i] = pool.positionX[last];
+        pool.positionY[i] = pool.positionY[last];
+        pool.positionZ[i] = pool.positionZ[last];
+        pool.velocityX[i] = pool.velocityX[last];
+        pool.velocityY[i] = pool.velocityY[last];
+        pool.velocityZ[i] = pool.velocityZ[last];
+        pool.age[i] = pool.age[last];
+        pool.lifetime[i] = pool.lifetime[last];
+    }
+    expired.clear();
+}
+
+size_t ParticleSystem::writeInstances(ParticleEmitterId emitter, ParticleInstance* out) const {
+    if (emitter < 0 || emitter >= static_cast<ParticleEmitterId>(pools.size())) return 0;
+
+    const ParticlePool& pool = pools[emitter];
+    const ParticleEmitterDesc& desc = pool.desc;
+    const Vec3 colorRange = desc.colorEnd - desc.colorStart;
+    const float alphaRange = desc.alphaEnd - desc.alphaStart;
+    const float sizeRange = desc.sizeEnd - desc.sizeStart;
+
+    for (size_t i = 0; i < pool.count; i++) {
+        float t = std::min(1.0f, pool.age[i] / pool.lifetime[i]);
+        ParticleInstance& instance = out[i];
+        instance.position[0] = pool.positionX[i];
+        instance.position[1] = pool.positionY[i];
+        instance.position[2] = pool.positionZ[i];
+        instance.size = desc.sizeStart + sizeRange * t;
+        instance.color[0] = toColorByte(desc.colorStart.x + colorRange.x * t);
+        instance.color[1] = toColorByte(desc.colorStart.y + colorRange.y * t);
+        instance.color[2] = toColorByte(desc.colorStart.z + colorRange.z * t);
+        instance.color[3] = toColorByte(desc.alphaStart + alphaRange * t);
+    }
+    return pool.count;
+}
+
+size_t ParticleSystem::getParticleCount() const {
+    size_t total = 0;
+    for (const ParticlePool& pool : pools) {
+        total += pool.count;
+    }
+    return total;
+}
+
+uint32_t ParticleSystem::nextRandom() {
+    // xorshift32
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    return randomState;
+}
+
+float ParticleSystem::randomFloat(float minimum, float maximum) {
+    // Top 24 bits as a [0, 1) fraction
+    float unit = static_cast<float>(nextRandom() >> 8) * (1.0f / 16777216.0f);
+    return minimum + (maximum - minimum) * unit;
+}
+
+} // namespace Engine
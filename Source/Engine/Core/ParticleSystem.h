@@ -0,0 +1,198 @@
+/**
+ * ParticleSystem.h - SoA Particle Emitters with SIMD Update Kernels
+ *
+ * OVERVIEW:
+ * Short-lived visual effects (bullet impacts, tracer trails, explosions)
+ * are particles in per-emitter pools instead of GameObjects. Each emitter
+ * owns one pool in structure-of-arrays layout and a shared description
+ * (colour/size ramps, lifetime and speed ranges, drag, gravity, sprite).
+ * update() advances every pool with one kernel that integrates four
+ * particles per instruction and removes expired particles by swapping the
+ * last live particle into their slot, so pools stay dense. ParticleRenderer
+ * turns the pools into one instanced billboard draw per sprite texture.
+ *
+ * FEATURES:
+ * - SoA pools (position, velocity, age, lifetime), live particles packed
+ *   in [0, count)
+ * - SSE2 kernel for integration, drag, gravity and lifetime over blocks of
+ *   four particles (scalar tail, scalar fallback on other targets);
+ *   expired particles found with one mask test per block
+ * - Swap-remove compaction: O(expired) per update, no per-particle branches
+ *   in the kernel
+ * - Cone/sphere bursts from a deterministic xorshift stream (no rand() state)
+ * - writeInstances(): packed per-particle billboard data for streaming to
+ *   the GPU (position, size, RGBA8 colour from the age ramps)
+ * - GPU emitters (ParticleSimulation::Gpu): same description and emit()
+ *   call, but emit() only records a burst; ParticleRenderer simulates those
+ *   particles entirely on the GPU from the bursts and elapsed game time of
+ *   each render state. Without GPU support they fall back to CPU pools.
+ * - captureRenderState(): everything ParticleRenderer needs (emitter
+ *   descriptions, billboard instances, GPU work) as plain data
+ * - GL-free: part of ww3_core and benchmarked headless
+ *
+ * THREADING:
+ * Not thread-safe. Emitted, updated and captured by Game::update on the
+ * simulation thread; the render pass only reads the captured state.
+ */
+
+#pragma once
+#include "../Math/Math.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Engine {
+
+/**
+ * ParticleEmitterId - Index of an emitter in its ParticleSystem (-1 = none)
+ */
+typedef int ParticleEmitterId;
+
+/**
+ * ParticleSimulation - Where an emitter's particles are simulated
+ */
+enum class ParticleSimulation {
+    Cpu,        // SoA pool in ParticleSystem (small, frequent effects)
+    Gpu         // Transform feedback buffers in ParticleRenderer (very large effects)
+};
+
+/**
+ * ParticleEmitterDesc - Look and motion shared by every particle of an emitter
+ */
+struct ParticleEmitterDesc {
+    std::string name;
+    std::string texture;            // Sprite image, empty = built-in soft disc
+    bool additive = false;          // Additive (sparks, fire) or alpha blending (smoke)
+    size_t capacity = 1024;         // Further particles are dropped while the pool is full
+    ParticleSimulation simulation = ParticleSimulation::Cpu;
+
+    // Appearance over the particle's life (linear ramps)
+    Vec3 colorStart = Vec3(1.0f, 1.0f, 1.0f);
+    Vec3 colorEnd = Vec3(1.0f, 1.0f, 1.0f);
+    float alphaStart = 1.0f;
+    float alphaEnd = 0.0f;
+    float sizeStart = 0.1f;
+    float sizeEnd = 0.1f;
+
+    // Emission
+    float lifetimeMin = 0.5f;
+    float lifetimeMax = 1.0f;
+    float speedMin = 1.0f;
+    float speedMax = 2.0f;
+    float spread = 0.5f;            // Cone half-angle around the emit direction in radians (pi = sphere)
+
+    // Motion
+    float drag = 0.0f;              // Velocity damping per second
+    float gravity = 9.81f;          // Downward acceleration (negative rises, e.g. smoke)
+};
+
+/**
+ * ParticleInstance - Billboard data for one particle (20 bytes)
+ */
+struct ParticleInstance {
+    float position[3];
+    float size;
+    uint8_t color[4];               // RGBA8
+};
+
+/**
+ * ParticleBurst - Emission recorded for a GPU emitter
+ */
+struct ParticleBurst {
+    ParticleEmitterId emitter;
+    Vec3 position;
+    Vec3 direction;
+    uint32_t count;
+    uint32_t seed;                  // Per-burst random seed for the GPU emission
+};
+
+/**
+ * ParticleRenderState - What ParticleRenderer draws from one capture
+ *
+ * Emitter descriptions never change once created, so a state that is
+ * captured into again only copies the emitters added since.
+ */
+struct ParticleRenderState {
+    std::vector<ParticleEmitterDesc> emitters;  // simulation = where the emitter actually runs
+    std::vector<ParticleInstance> instances;    // CPU particles, grouped by emitter
+    std::vector<size_t> emitterOffsets;         // Emitter e owns instances [offsets[e], offsets[e + 1])
+    std::vector<ParticleBurst> gpuBursts;       // GPU emissions since the previous capture
+    float gpuElapsed = 0.0f;                    // Game time the GPU emitters have to advance
+
+    size_t getInstanceCount(ParticleEmitterId emitter) const {
+        size_t next = static_cast<size_t>(emitter) + 1;
+        return next < emitterOffsets.size() ? emitterOffsets[next] - emitterOffsets[next - 1] : 0;
+    }
+    void clearEvents();                         // Drops the GPU work once it has been simulated
+};
+
+/**
+ * ParticleSystem - Emitters with SoA pools and batched updates
+ */
+class ParticleSystem {
+public:
+    static const int SIMD_WIDTH = 4;
+    static const size_t MAX_PENDING_BURSTS = 4096; // GPU bursts kept while nothing drains them
+
+private:
+    struct ParticlePool {
+        ParticleEmitterDesc desc;
+        std::vector<float> positionX, positionY, positionZ;
+        std::vector<float> velocityX, velocityY, velocityZ;
+        std::vector<float> age;
+        std::vector<float> lifetime;
+        size_t count;                // Live particles, packed in [0, count)
+        size_t capacity;             // 0 for GPU emitters
+        bool gpu;
+    };
+
+    std::vector<ParticlePool> pools;
+    std::vector<uint32_t> expired;   // Scratch: indices that expired this update
+    uint32_t randomState;
+    size_t droppedCount;             // Particles rejected by full pools
+
+    // GPU emitters
+    bool gpuAvailable;
+    std::vector<ParticleBurst> pendingBursts;
+    float pendingGpuTime;            // Game time not yet simulated on the GPU
+
+public:
+    explicit ParticleSystem(uint32_t seed = 0x9E3779B9u);
+
+    // Emitters (set GPU availability before creating GPU emitters)
+    void setGpuSimulationAvailable(bool available) { gpuAvailable = available; }
+    ParticleEmitterId createEmitter(const ParticleEmitterDesc& desc);
+    ParticleEmitterId findEmitter(const std::string& name) const;
+    size_t getEmitterCount() const { return pools.size(); }
+    const ParticleEmitterDesc& getEmitterDesc(ParticleEmitterId emitter) const { return pools[emitter].desc; }
+    bool isGpuEmitter(ParticleEmitterId emitter) const { return pools[emitter].gpu; }
+
+    // Emission: count particles at position, inside the emitter's cone around direction
+    void emit(ParticleEmitterId emitter, const Vec3& position, const Vec3& direction, int count);
+    void clear(); // Removes every particle, keeps the emitters
+
+    // Advances every pool: drag, gravity, integration, aging and removal of expired particles
+    void update(float deltaTime);
+
+    // Writes the live particles of one emitter; out needs room for getParticleCount(emitter)
+    size_t writeInstances(ParticleEmitterId emitter, ParticleInstance* out) const;
+
+    // Writes the live CPU particles into state and moves the GPU work since the last capture
+    // onto its pending work (appended, so work of a state that was never drawn is kept)
+    void captureRenderState(ParticleRenderState& state);
+
+    // Status (CPU particles only; GPU counts stay on the GPU)
+    size_t getParticleCount(ParticleEmitterId emitter) const { return pools[emitter].count; }
+    size_t getParticleCount() const;
+    size_t getPendingBurstCount() const { return pendingBursts.size(); }
+    size_t getDroppedCount() const { return droppedCount; }
+
+private:
+    void updatePool(ParticlePool& pool, float deltaTime);
+    void removeExpired(ParticlePool& pool);
+    uint32_t nextRandom();
+    float randomFloat(float minimum, float maximum);
+};
+
+} // namespace Engine
@@ -8,6 +8,8 @@
 #include "../Rendering/Shader.h"
 #include "../Math/Math.h"
 #include "../../GameObjects/Monster.h"
+#include "ParticleSystem.h"
+#include "RenderSnapshot.h"
 
 #include <iostream>
 #include <algorithm>
@@ -20,8 +22,202 @@ namespace Engine {
 
 // Forward declarations for systems that will be implemented later
 class CollisionSystem {};
-class ParticleSystem {};
-class AudioSystem {};
+
+namespace {
+
+// Emitters registered by ProjectileManager::initialize
+const char* const IMPACT_EMITTER = "projectile_impact";
+const char* const TRAIL_EMITTER = "projectile_trail";
+const char* const EXPLOSION_FIRE_EMITTER = "explosion_fire";
+const char* const EXPLOSION_SMOKE_EMITTER = "explosion_smoke";
+const char* const PLASMA_EMITTER = "plasma_burst";
+
+const int IMPACT_PARTICLES = 16;
+const int TRAIL_PARTICLES_PER_UPDATE = 2;
+const int EXPLOSION_FIRE_PARTICLES = 80;
+const int EXPLOSION_SMOKE_PARTICLES = 40;
+const int PLASMA_IMPACT_PARTICLES = 600;        // GPU-simulated when the renderer supports it
+const int PLASMA_TRAIL_PARTICLES_PER_UPDATE = 24;
+
+void registerProjectileEmitters(ParticleSystem& particles) {
+    if (particles.findEmitter(IMPACT_EMITTER) < 0) {
+        ParticleEmitterDesc sparks;
+        sparks.name = IMPACT_EMITTER;
+        sparks.additive = true;
+        sparks.capacity = 8192;
+        sparks.colorStart = Vec3(1.0f, 0.85f, 0.4f);
+        sparks.colorEnd = Vec3(0.9f, 0.25f, 0.05f);
+        sparks.sizeStart = 0.08f;
+        sparks.sizeEnd = 0.02f;
+        sparks.lifetimeMin = 0.2f;
+        sparks.lifetimeMax = 0.5f;
+        sparks.speedMin = 3.0f;
+        sparks.speedMax = 9.0f;
+        sparks.spread = 1.2f;
+        sparks.drag = 2.0f;
+        particles.createEmitter(sparks);
+    }
+    
+    if (particles.findEmitter(TRAIL_EMITTER) < 0) {
+        ParticleEmitterDesc trail;
+        trail.name = TRAIL_EMITTER;
+        trail.capacity = 4096;
+        trail.colorStart = Vec3(0.8f, 0.8f, 0.8f);
+        trail.colorEnd = Vec3(0.5f, 0.5f, 0.5f);
+        trail.alphaStart = 0.5f;
+        trail.sizeStart = 0.06f;
+        trail.sizeEnd = 0.18f;
+        trail.lifetimeMin = 0.3f;
+        trail.lifetimeMax = 0.6f;
+        trail.speedMin = 0.2f;
+        trail.speedMax = 0.6f;
+        trail.spread = 0.3f;
+        trail.gravity = -0.3f; // Drifts up
+        particles.createEmitter(trail);
+    }
+    
+    if (particles.findEmitter(EXPLOSION_FIRE_EMITTER) < 0) {
+        ParticleEmitterDesc fire;
+        fire.name = EXPLOSION_FIRE_EMITTER;
+        fire.additive = true;
+        fire.capacity = 8192;
+        fire.colorStart = Vec3(1.0f, 0.8f, 0.3f);
+        fire.colorEnd = Vec3(0.8f, 0.2f, 0.05f);
+        fire.sizeStart = 0.5f;
+        fire.sizeEnd = 1.2f;
+        fire.lifetimeMin = 0.3f;
+        fire.lifetimeMax = 0.8f;
+        fire.speedMin = 4.0f;
+        fire.speedMax = 12.0f;
+        fire.spread = 3.14159f;
+        fire.drag = 4.0f;
+        fire.gravity = 1.0f;
+        particles.createEmitter(fire);
+    }
+    
+    if (particles.findEmitter(EXPLOSION_SMOKE_EMITTER) < 0) {
+        ParticleEmitterDesc smoke;
+        smoke.name = EXPLOSION_SMOKE_EMITTER;
+        smoke.capacity = 4096;
+        smoke.colorStart = Vec3(0.25f, 0.25f, 0.25f);
+        smoke.colorEnd = Vec3(0.1f, 0.1f, 0.1f);
+        smoke.alphaStart = 0.6f;
+        smoke.sizeStart = 0.6f;
+        smoke.sizeEnd = 2.2f;
+        smoke.lifetimeMin = 1.2f;
+        smoke.lifetimeMax = 2.5f;
+        smoke.speedMin = 1.0f;
+        smoke.speedMax = 4.0f;
+        smoke.spread = 3.14159f;
+        smoke.drag = 1.5f;
+        smoke.gravity = -1.5f; // Rises
+        particles.createEmitter(smoke);
+    }
+    
+    if (particles.findEmitter(PLASMA_EMITTER) < 0) {
+        ParticleEmitterDesc plasma;
+        plasma.name = PLASMA_EMITTER;
+        plasma.simulation = ParticleSimulation::Gpu;
+        plasma.additive = true;
+        plasma.capacity = 262144;
+        plasma.colorStart = Vec3(0.5f, 0.8f, 1.0f);
+        plasma.colorEnd = Vec3(0.2f, 0.1f, 0.9f);
+        plasma.sizeStart = 0.06f;
+        plasma.sizeEnd = 0.01f;
+        plasma.lifetimeMin = 0.4f;
+        plasma.lifetimeMax = 1.2f;
+        plasma.speedMin = 2.0f;
+        plasma.speedMax = 14.0f;
+        plasma.spread = 1.6f;
+        plasma.drag = 3.0f;
+        plasma.gravity = 2.0f;
+        particles.createEmitter(plasma);
+    }
+}
+
+// Config fields a restored projectile is rebuilt from (callbacks and sound names are not stored)
+struct ProjectileConfigRecord {
+    uint8_t type;
+    uint8_t damageType;
+    uint8_t flags;
+    int32_t maxBounces;
+    int32_t maxPenetrations;
+    float speed, maxDistance, lifetime, size;
+    float gravity, bounceEnergy, ricochetChance;
+    float damage, armorPenetration, explosionRadius, explosionForce;
+    Vec3 color;
+    float trailLength, glowIntensity;
+};
+
+enum ProjectileConfigFlags : uint8_t {
+    CONFIG_GRAVITY = 1 << 0,
+    CONFIG_BOUNCES = 1 << 1,
+    CONFIG_RICOCHETS = 1 << 2,
+    CONFIG_EXPLOSIVE = 1 << 3,
+    CONFIG_TRAIL = 1 << 4,
+    CONFIG_GLOW = 1 << 5,
+    CONFIG_DESTROY_ON_COLLISION = 1 << 6,
+    CONFIG_PENETRATES = 1 << 7
+};
+
+ProjectileConfigRecord makeConfigRecord(const ProjectileConfig& config) {
+    ProjectileConfigRecord record;
+    record.type = static_cast<uint8_t>(config.type);
+    record.damageType = static_cast<uint8_t>(config.damageType);
+    record.flags = (config.affectedByGravity ? CONFIG_GRAVITY : 0) | (config.bounces ? CONFIG_BOUNCES : 0) |
+                   (config.ricochets ? CONFIG_RICOCHETS : 0) | (config.explosive ? CONFIG_EXPLOSIVE : 0) |
+                   (config.hasTrail ? CONFIG_TRAIL : 0) | (config.hasGlow ? CONFIG_GLOW : 0) |
+                   (config.destroyOnCollision ? CONFIG_DESTROY_ON_COLLISION : 0) | (config.penetrateTargets ? CONFIG_PENETRATES : 0);
+    record.maxBounces = config.maxBounces;
+    record.maxPenetrations = config.maxPenetrations;
+    record.speed = config.speed;
+    record.maxDistance = config.maxDistance;
+    record.lifetime = config.lifetime;
+    record.size = config.size;
+    record.gravity = config.gravity;
+    record.bounceEnergy = config.bounceEnergy;
+    record.ricochetChance = config.ricochetChance;
+    record.damage = config.damage;
+    record.armorPenetration = config.armorPenetration;
+    record.explosionRadius = config.explosionRadius;
+    record.explosionForce = config.explosionForce;
+    record.color = config.color;
+    record.trailLength = config.trailLength;
+    record.glowIntensity = config.glowIntensity;
+    return record;
+}
+
+ProjectileConfig makeConfig(const ProjectileConfigRecord& record) {
+    ProjectileConfig config = ProjectileFactory::getDefaultConfig(static_cast<ProjectileType>(record.type));
+    config.damageType = static_cast<DamageType>(record.damageType);
+    config.affectedByGravity = (record.flags & CONFIG_GRAVITY) != 0;
+    config.bounces = (record.flags & CONFIG_BOUNCES) != 0;
+    config.ricochets = (record.flags & CONFIG_RICOCHETS) != 0;
+    config.explosive = (record.flags & CONFIG_EXPLOSIVE) != 0;
+    config.hasTrail = (record.flags & CONFIG_TRAIL) != 0;
+    config.hasGlow = (record.flags & CONFIG_GLOW) != 0;
+    config.destroyOnCollision = (record.flags & CONFIG_DESTROY_ON_COLLISION) != 0;
+    config.penetrateTargets = (record.flags & CONFIG_PENETRATES) != 0;
+    config.maxBounces = record.maxBounces;
+    config.maxPenetrations = record.maxPenetrations;
+    config.speed = record.speed;
+    config.maxDistance = record.maxDistance;
+    config.lifetime = record.lifetime;
+    config.size = record.size;
+    config.gravity = record.gravity;
+    config.bounceEnergy = record.bounceEnergy;
+    config.ricochetChance = record.ricochetChance;
+    config.damage = record.damage;
+    config.armorPenetration = record.armorPenetration;
+    config.explosionRadius = record.explosionRadius;
+    config.explosionForce = record.explosionForce;
+    config.color = record.color;
+    config.trailLength = record.trailLength;
+    config.glowIntensity = record.glowIntensity;
+    return config;
+}
+
+} // namespace
 
 // Projectile implementation
 Projectile::Projectile(const std::string& name, const ProjectileConfig& config)
@@ -29,6 +225,8 @@ Projectile::Projectile(const std::string& name, const ProjectileConfig& config)
       config(config),
       velocity(0.0f, 0.0f, 0.0f),
       startPosition(0.0f, 0.0f, 0.0f),
+      previousPosition(0.0f, 0.0f, 0.0f),
+      rewindTicks(-1.0),
       distanceTraveled(0.0f),
       currentLifetime(0.0f),
       bounceCount(0),
@@ -37,6 +235,12 @@ Projectile::Projectile(const std::string& name, const ProjectileConfig& config)
       collisionSystem(nullptr),
       particleSystem(nullptr),
       audioSystem(nullptr),
+      explosionSystem(nullptr),
+      impactEmitter(-1),
+      trailEmitter(-1),
+      explosionFireEmitter(-1),
+      explosionSmokeEmitter(-1),
+      plasmaEmitter(-1),
       owner(nullptr) {
     
     // Set projectile to be a world entity so it renders in 3D space
@@ -153,7 +357,7 @@ void Projectile::setupMesh() {
         indices.push_back((i + 2) * 2 + 1);
     }
     
-    mesh = std::make_unique<Mesh>();
+    mesh = std::make_shared<Mesh>();
     if (!mesh->createMeshWithTexCoords(vertices, indices)) {
         std::cout << "ERROR: Failed to create bullet mesh for projectile " << getName() << std::endl;
     }
@@ -186,6 +390,7 @@ void Projectile::update(float deltaTime) {
     checkLifetime();
     
     // Update physics
+    previousPosition = getPosition();
     updatePhysics(deltaTime);
 
     // Rotation is now handled in the custom getModelMatrix() method
@@ -194,6 +399,7 @@ void Projectile::update(float deltaTime) {
     // Update trail
     if (config.hasTrail) {
         updateTrail(deltaTime);
+        spawnTrailEffect();
     }
     
     // Check distance limit
@@ -232,6 +438,17 @@ void Projectile::render(const Renderer& renderer, const Camera& camera) {
     }
 }
 
+void Projectile::captureDraws(std::vector<MeshDrawState>& draws) const {
+    if (isDestroyed) return;
+    
+    size_t first = draws.size();
+    GameObject::captureDraws(draws);
+    for (size_t i = first; i < draws.size(); i++) {
+        // getModelMatrix orients along the velocity; keep that and move it with the position
+        draws[i].placement = DrawPlacement::Translate;
+    }
+}
+
 Mat4 Projectile::getModelMatrix() const {
     // Create a custom model matrix that maintains world space orientation
     // This ensures the bullet always points along its velocity vector regardless of camera movement
@@ -292,6 +509,7 @@ void Projectile::fire(const Vec3& position, const Vec3& direction, GameObject* o
     std::cout << "Fire direction: (" << direction.x << ", " << direction.y << ", " << direction.z << ")" << std::endl;
     
     startPosition = position;
+    previousPosition = position;
     setPosition(position);
     
     // std::cout << "After setPosition, projectile position: (" << getPosition().x << ", " << getPosition().y << ", " << getPosition().z << ")" << std::endl;
@@ -339,6 +557,35 @@ void Projectile::fire(const Vec3& position, const Vec3& direction, GameObject* o
     
 }
 
+ProjectileFlightState Projectile::getFlightState() const {
+    ProjectileFlightState state;
+    state.position = getPosition();
+    state.velocity = velocity;
+    state.startPosition = startPosition;
+    state.previousPosition = previousPosition;
+    state.distanceTraveled = distanceTraveled;
+    state.lifetime = currentLifetime;
+    state.bounceCount = bounceCount;
+    state.penetrationCount = penetrationCount;
+    state.rewindTicks = rewindTicks;
+    return state;
+}
+
+void Projectile::setFlightState(const ProjectileFlightState& state) {
+    setPosition(state.position);
+    velocity = state.velocity;
+    startPosition = state.startPosition;
+    previousPosition = state.previousPosition;
+    distanceTraveled = state.distanceTraveled;
+    currentLifetime = state.lifetime;
+    bounceCount = state.bounceCount;
+    penetrationCount = state.penetrationCount;
+    rewindTicks = state.rewindTicks;
+    isDestroyed = false;
+    setActive(true);
+    clearTrail();
+}
+
 void Projectile::destroy() {
     if (isDestroyed) return;
     
@@ -353,8 +600,10 @@ void Projectile::destroy() {
     // Call virtual destroy method
     onDestroy();
     
-    // Spawn destruction effects
-    spawnImpactEffect(getPosition(), Vec3(0.0f, 1.0f, 0.0f));
+    // Spawn destruction effects (impacts are spawned per hit in handleCollision)
+    if (config.explosive) {
+        performExplosion(getPosition());
+    }
 }
 
 void Projectile::bounce(const Vec3& normal, float energy) {
@@ -577,6 +826,10 @@ void Projectile::handleCollision(GameObject* target) {
     // Call virtual hit method
     onHit(target);
     
+    // Sparks fly back towards the shooter
+    spawnImpactEffect(getPosition(), velocity * -1.0f);
+    playSound(config.impactSound, config.explosive ? SoundPriority::High : SoundPriority::Low);
+    
     // Handle penetration
     if (config.penetrateTargets && penetrationCount < config.maxPenetrations) {
         penetrationCount++;
@@ -616,19 +869,37 @@ void Projectile::applyDamage(GameObject* target, float damage) {
     // based on the target's damage system
 }
 
+void Projectile::setParticleSystem(ParticleSystem* particles) {
+    particleSystem = particles;
+    impactEmitter = particles ? particles->findEmitter(IMPACT_EMITTER) : -1;
+    trailEmitter = particles ? particles->findEmitter(TRAIL_EMITTER) : -1;
+    explosionFireEmitter = particles ? particles->findEmitter(EXPLOSION_FIRE_EMITTER) : -1;
+    explosionSmokeEmitter = particles ? particles->findEmitter(EXPLOSION_SMOKE_EMITTER) : -1;
+    plasmaEmitter = particles ? particles->findEmitter(PLASMA_EMITTER) : -1;
+}
+
 void Projectile::spawnImpactEffect(const Vec3& position, const Vec3& normal) {
-    // Placeholder for impact effects
-    // This should spawn particles, play sounds, etc.
+    if (!particleSystem) return;
+    if (config.type == ProjectileType::Plasma) {
+        particleSystem->emit(plasmaEmitter, position, normal, PLASMA_IMPACT_PARTICLES);
+        return;
+    }
+    particleSystem->emit(impactEmitter, position, normal, IMPACT_PARTICLES);
 }
 
 void Projectile::spawnTrailEffect() {
-    // Placeholder for trail effects
-    // This should spawn particles along the trail
+    if (!particleSystem) return;
+    if (config.type == ProjectileType::Plasma) {
+        particleSystem->emit(plasmaEmitter, getPosition(), velocity * -1.0f, PLASMA_TRAIL_PARTICLES_PER_UPDATE);
+        return;
+    }
+    particleSystem->emit(trailEmitter, getPosition(), velocity * -1.0f, TRAIL_PARTICLES_PER_UPDATE);
 }
 
-void Projectile::playSound(const std::string& soundName) {
-    // Placeholder for sound system
-    // This should play the specified sound
+void Projectile::playSound(const std::string& soundName, SoundPriority priority) {
+    // Queued for the mixer thread; unknown names are ignored there
+    if (!audioSystem || soundName.empty()) return;
+    audioSystem->play(soundName, getPosition(), priority);
 }
 
 Vec3 Projectile::predictPosition(float timeAhead) const {
@@ -656,8 +927,20 @@ float Projectile::getTimeToTarget(const Vec3& targetPosition) const {
 void Projectile::performExplosion(const Vec3& position) {
     if (!config.explosive) return;
     
-    // Placeholder for explosion effects
-    // This should create explosion particles, apply force to nearby objects, etc.
+    if (particleSystem) {
+        Vec3 up(0.0f, 1.0f, 0.0f);
+        particleSystem->emit(explosionFireEmitter, position, up, EXPLOSION_FIRE_PARTICLES);
+        particleSystem->emit(explosionSmokeEmitter, position, up, EXPLOSION_SMOKE_PARTICLES);
+    }
+    
+    if (explosionSystem) {
+        ExplosionParams params;
+        params.center = position;
+        params.radius = config.explosionRadius;
+        params.damage = config.damage;
+        params.instigator = owner;
+        explosionSystem->explode(params);
+    }
 }
 
 // Virtual method implementations
@@ -837,6 +1120,19 @@ void ProjectileManager::initialize(CollisionSystem* collision, ParticleSystem* p
     collisionSystem = collision;
     particleSystem = particles;
     audioSystem = audio;
+    
+    if (particleSystem) {
+        registerProjectileEmitters(*particleSystem);
+    }
+}
+
+void ProjectileManager::emitTracer(ProjectileType type, const Vec3& position, const Vec3& velocity) {
+    if (!particleSystem) return;
+    if (type == ProjectileType::Plasma) {
+        particleSystem->emit(particleSystem->findEmitter(PLASMA_EMITTER), position, velocity * -1.0f, PLASMA_TRAIL_PARTICLES_PER_UPDATE);
+        return;
+    }
+    particleSystem->emit(particleSystem->findEmitter(TRAIL_EMITTER), position, velocity * -1.0f, TRAIL_PARTICLES_PER_UPDATE);
 }
 
 // MonsterProjectile - Specialized projectile for monster damage
@@ -914,6 +1210,14 @@ void ProjectileManager::render(const Renderer& renderer, const Camera& camera) {
     }
 }
 
+void ProjectileManager::captureDraws(std::vector<MeshDrawState>& draws) const {
+    for (const auto& projectile : activeProjectiles) {
+        if (projectile->isActive()) {
+            projectile->captureDraws(draws);
+        }
+    }
+}
+
 void ProjectileManager::cleanup() {
     activeProjectiles.clear();
 }
@@ -924,6 +1228,9 @@ Projectile* ProjectileManager::createProjectile(const ProjectileConfig& config,
     // Use MonsterProjectile for better monster damage handling
     auto projectile = std::make_unique<MonsterProjectile>(name.empty() ? "Projectile" : name, config);
     Projectile* ptr = projectile.get();
+    ptr->setParticleSystem(particleSystem);
+    ptr->setAudioSystem(audioSystem);
+    ptr->setExplosionSystem(&explosionSystem);
     
     // std::cout << "Projectile created, checking initial state:" << std::endl;
     // std::cout << "  Name: " << ptr->getName() << std::endl;
@@ -956,6 +1263,94 @@ void ProjectileManager::destroyProjectile(Projectile* projectile) {
     }
 }
 
+const uint32_t ProjectileManager::STATE_TAG = makeStateTag('P', 'R', 'O', 'J');
+const uint16_t ProjectileManager::STATE_VERSION = 1;
+
+void ProjectileManager::saveState(StateWriter& writer) const {
+    std::vector<uint32_t> ids;
+    std::vector<uint32_t> ownerIds;
+    std::vector<ProjectileConfigRecord> configs;
+    std::vector<ProjectileFlightState> flights;
+    ids.reserve(activeProjectiles.size());
+    ownerIds.reserve(activeProjectiles.size());
+    configs.reserve(activeProjectiles.size());
+    flights.reserve(activeProjectiles.size());
+    
+    // Destroyed projectiles are about to be erased by update(); leave them out
+    for (const auto& projectile : activeProjectiles) {
+        if (!projectile->isActive()) continue;
+        ids.push_back(projectile->getId());
+        ownerIds.push_back(projectile->getOwner() ? projectile->getOwner()->getId() : 0);
+        configs.push_back(makeConfigRecord(projectile->getConfig()));
+        flights.push_back(projectile->getFlightState());
+    }
+    
+    writer.beginSection(STATE_TAG, STATE_VERSION);
+    writer.writeArray(ids);
+    writer.writeArray(ownerIds);
+    writer.writeArray(configs);
+    writer.writeArray(flights);
+    writer.endSection();
+}
+
+bool ProjectileManager::restoreState(StateReader& reader, const std::function<GameObject*(uint32_t)>& findOwner) {
+    if (!reader.openSection(STATE_TAG, STATE_VERSION)) return false;
+    
+    std::vector<uint32_t> ids;
+    std::vector<uint32_t> ownerIds;
+    std::vector<ProjectileConfigRecord> configs;
+    std::vector<ProjectileFlightState> flights;
+    reader.readArray(ids);
+    reader.readArray(ownerIds);
+    reader.readArray(configs);
+    reader.readArray(flights);
+    if (!reader.isValid() || ownerIds.size() != ids.size() || configs.size() != ids.size() || flights.size() != ids.size()) {
+        reader.fail();
+        return false;
+    }
+    
+    // Projectiles that still exist keep their object; ids are never reused
+    std::vector<std::unique_ptr<Projectile>> previous;
+    previous.swap(activeProjectiles);
+    std::sort(previous.begin(), previous.end(),
+              [](const std::unique_ptr<Projectile>& a, const std::unique_ptr<Projectile>& b) { return a->getId() < b->getId(); });
+    
+    for (size_t i = 0; i < ids.size(); i++) {
+        auto existing = std::lower_bound(previous.begin(), previous.end(), ids[i],
+                                         [](const std::unique_ptr<Projectile>& p, uint32_t id) { return p && p->getId() < id; });
+        Projectile* projectile = nullptr;
+        if (existing != previous.end() && *existing && (*existing)->getId() == ids[i]) {
+            activeProjectiles.push_back(std::move(*existing));
+            projectile = activeProjectiles.back().get();
+        } else {
+            projectile = createProjectile(makeConfig(configs[i]), "Projectile");
+            if (!projectile) continue;
+        }
+        projectile->setFlightState(flights[i]);
+        // A reused projectile keeps its owner if the owner cannot be resolved
+        GameObject* owner = (ownerIds[i] != 0 && findOwner) ? findOwner(ownerIds[i]) : nullptr;
+        if (owner || ownerIds[i] == 0) {
+            projectile->setOwner(owner);
+            projectile->setOwnerTag(owner ? owner->getName() : std::string());
+        }
+    }
+    return true;
+}
+
+bool ProjectileManager::validateState(StateReader& reader) {
+    if (!reader.openSection(STATE_TAG, STATE_VERSION)) return false;
+    
+    std::vector<uint32_t> ids;
+    std::vector<uint32_t> ownerIds;
+    std::vector<ProjectileConfigRecord> configs;
+    std::vector<ProjectileFlightState> flights;
+    reader.readArray(ids);
+    reader.readArray(ownerIds);
+    reader.readArray(configs);
+    reader.readArray(flights);
+    return reader.isValid() && ownerIds.size() == ids.size() && configs.size() == ids.size() && flights.size() == ids.size();
+}
+
 void ProjectileManager::destroyAllProjectiles() {
     for (auto& projectile : activeProjectiles) {
         projectile->destroy();
@@ -1009,7 +1404,7 @@ void ProjectileManager::checkAllCollisions(const std::vector<GameObject*>& gameO
     }
     
     for (auto& projectile : activeProjectiles) {
-        if (!projectile->isActive()) continue;
+        if (!projectile->isActive() || projectile->isLagCompensated()) continue;
         
         for (GameObject* gameObject : gameObjects) {
             if (projectile->checkCollision(gameObject)) {
@@ -10,6 +10,7 @@
  * - Configurable physics properties (speed, gravity, bounce, etc.)
  * - Collision detection with different object types
  * - Damage system with different damage types
+ * - Explosive projectiles deal radius damage through ExplosionSystem
  * - Particle effects and trails
  * - Sound effects integration
  * - Network synchronization support
@@ -19,6 +20,11 @@
 #include "GameObject.h"
 #include "../Math/Math.h"
 #include "../Rendering/Material.h"
+#include "ParticleSystem.h"
+#include "StateBuffer.h"
+#include "../Audio/AudioSystem.h"
+#include "ExplosionSystem.h"
+#include <cstdint>
 #include <memory>
 #include <vector>
 #include <string>
@@ -29,8 +35,6 @@ namespace Engine {
 
 // Forward declarations
 class CollisionSystem;
-class ParticleSystem;
-class AudioSystem;
 class GameObject;
 
 /**
@@ -125,6 +129,22 @@ struct ProjectileConfig {
     std::function<void(void*, float)> onUpdateCallback = nullptr;
 };
 
+/**
+ * ProjectileFlightState - Everything that changes while a projectile flies
+ * (trivially copyable: SimulationState snapshots store these as one array)
+ */
+struct ProjectileFlightState {
+    Vec3 position;
+    Vec3 velocity;
+    Vec3 startPosition;
+    Vec3 previousPosition;
+    float distanceTraveled = 0.0f;
+    float lifetime = 0.0f;
+    int32_t bounceCount = 0;
+    int32_t penetrationCount = 0;
+    double rewindTicks = -1.0;
+};
+
 /**
  * Projectile - Main projectile class extending GameObject
  */
@@ -134,6 +154,8 @@ private:
     ProjectileConfig config;
     Vec3 velocity;
     Vec3 startPosition;
+    Vec3 previousPosition;      // Before this tick's movement (swept hit tests)
+    double rewindTicks;         // Lag compensation: ticks the shooter saw the world behind; < 0 = live collisions
     float distanceTraveled;
     float currentLifetime;
     int bounceCount;
@@ -153,6 +175,12 @@ private:
     // Effects systems
     ParticleSystem* particleSystem;
     AudioSystem* audioSystem;
+    ExplosionSystem* explosionSystem;
+    ParticleEmitterId impactEmitter;        // Emitters looked up once in setParticleSystem
+    ParticleEmitterId trailEmitter;
+    ParticleEmitterId explosionFireEmitter;
+    ParticleEmitterId explosionSmokeEmitter;
+    ParticleEmitterId plasmaEmitter;        // GPU-simulated where supported
     
     // Owner information
     GameObject* owner;
@@ -167,6 +195,7 @@ public:
     virtual bool initialize() override;
     virtual void update(float deltaTime) override;
     virtual void render(const Renderer& renderer, const Camera& camera) override;
+    virtual void captureDraws(std::vector<MeshDrawState>& draws) const override; // Interpolated by translation only
     
     // Override model matrix to provide world space orientation
     Mat4 getModelMatrix() const override;
@@ -186,6 +215,17 @@ public:
     float getDistanceTraveled() const { return distanceTraveled; }
     float getLifetime() const { return currentLifetime; }
     const Vec3& getVelocity() const { return velocity; }
+    const Vec3& getPreviousPosition() const { return previousPosition; }
+    
+    // Lag compensation (dedicated server): hits are tested against rewound
+    // monster history by the caller instead of by checkAllCollisions
+    void setRewindTicks(double ticks) { rewindTicks = ticks; }
+    double getRewindTicks() const { return rewindTicks; }
+    bool isLagCompensated() const { return rewindTicks >= 0.0; }
+    
+    // Snapshots (the trail restarts after a restore)
+    ProjectileFlightState getFlightState() const;
+    void setFlightState(const ProjectileFlightState& state);
     
     // Owner management
     void setOwner(GameObject* newOwner) { owner = newOwner; }
@@ -207,9 +247,12 @@ public:
     void applyDamage(GameObject* target, float damage);
     
     // Effects
+    void setParticleSystem(ParticleSystem* particles);
+    void setAudioSystem(AudioSystem* audio) { audioSystem = audio; }
+    void setExplosionSystem(ExplosionSystem* explosions) { explosionSystem = explosions; }
     void spawnImpactEffect(const Vec3& position, const Vec3& normal);
     void spawnTrailEffect();
-    void playSound(const std::string& soundName);
+    void playSound(const std::string& soundName, SoundPriority priority = SoundPriority::Normal);
     
     // Physics
     void updatePhysics(float deltaTime);
@@ -266,6 +309,7 @@ private:
     CollisionSystem* collisionSystem;
     ParticleSystem* particleSystem;
     AudioSystem* audioSystem;
+    ExplosionSystem explosionSystem; // Radius damage; targets are registered by the owner
     
 public:
     ProjectileManager();
@@ -274,6 +318,7 @@ public:
     void initialize(CollisionSystem* collision, ParticleSystem* particles, AudioSystem* audio);
     void update(float deltaTime);
     void render(const Renderer& renderer, const Camera& camera);
+    void captureDraws(std::vector<MeshDrawState>& draws) const;
     void cleanup();
     
     Projectile* createProjectile(const ProjectileConfig& config, const std::string& name = "");
@@ -281,11 +326,24 @@ public:
     void destroyProjectile(Projectile* projectile);
     void destroyAllProjectiles();
     
+    ExplosionSystem& getExplosionSystem() { return explosionSystem; }
+    
     const std::vector<std::unique_ptr<Projectile>>& getActiveProjectiles() const { return activeProjectiles; }
     size_t getActiveProjectileCount() const { return activeProjectiles.size(); }
     
-    // Collision detection for all projectiles
+    // Collision detection for all projectiles (lag-compensated ones are skipped)
     void checkAllCollisions(const std::vector<GameObject*>& gameObjects);
+    
+    // Trail particles for a projectile simulated elsewhere (network client)
+    void emitTracer(ProjectileType type, const Vec3& position, const Vec3& velocity);
+    
+    // Snapshots: projectiles still alive are updated in place, the others are
+    // rebuilt from their stored config; findOwner maps a GameObject id back
+    static const uint32_t STATE_TAG;
+    static const uint16_t STATE_VERSION;
+    void saveState(StateWriter& writer) const;
+    bool restoreState(StateReader& reader, const std::function<GameObject*(uint32_t)>& findOwner);
+    static bool validateState(StateReader& reader);
 };
 
 } // namespace Engine
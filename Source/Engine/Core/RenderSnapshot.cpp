@@ -0,0 +1,174 @@
+/**
+ * RenderSnapshot.cpp - Implementation of the Render Snapshot Hand-Off
+ */
+
+#include "RenderSnapshot.h"
+#include "GameObject.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Engine {
+
+// ===== RenderSnapshot =====
+
+void RenderSnapshot::clear() {
+    tick = 0;
+    simulationTime = 0.0;
+    tickMs = 0.0f;
+    camera = CameraRenderState();
+    hud = HudRenderState();
+    entities.clear(); // Keeps capacity - slots are reused every tick
+    sceneDraws.clear();
+    monsterDraws.clear();
+    projectileDraws.clear();
+    overlayDraws.clear();
+    viewModelDraws.clear();
+    particles.instances.clear(); // Emitter descriptions stay, see ParticleRenderState
+    particles.emitterOffsets.clear();
+    particles.clearEvents();
+}
+
+void RenderSnapshot::clearKeepingEvents() {
+    std::vector<ParticleBurst> bursts;
+    bursts.swap(particles.gpuBursts);
+    float elapsed = particles.gpuElapsed;
+    clear();
+    particles.gpuBursts.swap(bursts);
+    particles.gpuElapsed = elapsed;
+}
+
+void RenderSnapshot::finalize() {
+    std::sort(entities.begin(), entities.end(),
+              [](const EntityRenderState& a, const EntityRenderState& b) { return a.id < b.id; });
+}
+
+const EntityRenderState* RenderSnapshot::findEntity(uint32_t id) const {
+    auto it = std::lower_bound(entities.begin(), entities.end(), id,
+                               [](const EntityRenderState& entity, uint32_t value) { return entity.id < value; });
+    if (it != entities.end() && it->id == id) {
+        return &(*it);
+    }
+    return nullptr;
+}
+
+// ===== RenderSnapshotBuffer =====
+
+RenderSnapshotBuffer::RenderSnapshotBuffer()
+    : writeSlot(0), sharedSlot(1), currentSlot(2), previousSlot(3),
+      hasCurrent(false), hasPrevious(false), writeSlotUnread(false), droppedCount(0) {}
+
+RenderSnapshot& RenderSnapshotBuffer::beginWrite() {
+    RenderSnapshot& snapshot = slots[writeSlot];
+    if (writeSlotUnread) {
+        snapshot.clearKeepingEvents(); // Its bursts were never drawn; the new snapshot delivers them
+    } else {
+        snapshot.clear();
+    }
+    return snapshot;
+}
+
+void RenderSnapshotBuffer::publish() {
+    // Hand the written slot over and take back whatever was shared (read or dropped)
+    int previous = sharedSlot.exchange(writeSlot | FRESH_BIT, std::memory_order_acq_rel);
+    writeSlot = previous & SLOT_MASK;
+    writeSlotUnread = (previous & FRESH_BIT) != 0;
+    if (writeSlotUnread) {
+        droppedCount++;
+    }
+}
+
+bool RenderSnapshotBuffer::acquireLatest() {
+    if ((sharedSlot.load(std::memory_order_acquire) & FRESH_BIT) == 0) {
+        return false;
+    }
+
+    // Current becomes previous; the old previous slot is given back to the writer
+    int recycled = previousSlot;
+    previousSlot = currentSlot;
+    hasPrevious = hasCurrent;
+
+    int fresh = sharedSlot.exchange(recycled, std::memory_order_acq_rel);
+    currentSlot = fresh & SLOT_MASK;
+    hasCurrent = true;
+    return true;
+}
+
+void RenderSnapshotBuffer::reset() {
+    writeSlot = 0;
+    sharedSlot.store(1);
+    currentSlot = 2;
+    previousSlot = 3;
+    hasCurrent = false;
+    hasPrevious = false;
+    writeSlotUnread = false;
+    droppedCount = 0;
+    for (auto& slot : slots) {
+        slot.clear();
+    }
+}
+
+// ===== Interpolation =====
+
+Vec3 interpolatePosition(const Vec3& from, const Vec3& to, float t) {
+    return from + (to - from) * t;
+}
+
+namespace {
+
+float interpolateAngleDegrees(float from, float to, float t) {
+    float delta = std::fmod(to - from, 360.0f);
+    if (delta > 180.0f) delta -= 360.0f;
+    if (delta < -180.0f) delta += 360.0f;
+    return from + delta * t;
+}
+
+} // namespace
+
+Vec3 interpolateEulerDegrees(const Vec3& from, const Vec3& to, float t) {
+    return Vec3(interpolateAngleDegrees(from.x, to.x, t),
+                interpolateAngleDegrees(from.y, to.y, t),
+                interpolateAngleDegrees(from.z, to.z, t));
+}
+
+Mat4 placeDraw(const MeshDrawState& draw, const RenderSnapshot* previous, const RenderSnapshot& current, float alpha) {
+    if (draw.placement == DrawPlacement::Fixed || !previous) {
+        return draw.modelMatrix;
+    }
+    const EntityRenderState* from = previous->findEntity(draw.entityId);
+    const EntityRenderState* to = current.findEntity(draw.entityId);
+    if (!from || !to) {
+        return draw.modelMatrix;
+    }
+    
+    Vec3 position = interpolatePosition(from->position, to->position, alpha);
+    if (draw.placement == DrawPlacement::Translate) {
+        Mat4 model = draw.modelMatrix;
+        model.m[12] += position.x - to->position.x;
+        model.m[13] += position.y - to->position.y;
+        model.m[14] += position.z - to->position.z;
+        return model;
+    }
+    return GameObject::composeModelMatrix(position,
+                                          interpolateEulerDegrees(from->rotation, to->rotation, alpha),
+                                          interpolatePosition(from->scale, to->scale, alpha));
+}
+
+void placeDraws(const std::vector<MeshDrawState>& draws, const RenderSnapshot* previous, const RenderSnapshot& current,
+                float alpha, std::vector<MeshDrawState>& out) {
+    out.clear();
+    out.reserve(draws.size());
+    for (const MeshDrawState& draw : draws) {
+        out.push_back(draw);
+        // Material groups of one entity follow each other and share the rebuilt transform
+        if (out.size() > 1 && draw.placement == DrawPlacement::Transform) {
+            const MeshDrawState& before = out[out.size() - 2];
+            if (before.entityId == draw.entityId && before.placement == DrawPlacement::Transform) {
+                out.back().modelMatrix = before.modelMatrix;
+                continue;
+            }
+        }
+        out.back().modelMatrix = placeDraw(draw, previous, current, alpha);
+    }
+}
+
+} // namespace Engine
@@ -0,0 +1,204 @@
+/**
+ * RenderSnapshot.h - Immutable Per-Tick Render State and Its Hand-Off Buffer
+ *
+ * OVERVIEW:
+ * The simulation ends every tick by writing a RenderSnapshot: everything the
+ * frame draws (camera pose, the draw lists of the scene, monsters, projectiles,
+ * overlays and view model, monster health, particles, HUD values). Draws hold
+ * shared references to their meshes and index subsets, so the game objects can
+ * change or die while a frame is drawn from an older snapshot. In threaded mode
+ * the snapshot is published through RenderSnapshotBuffer and never modified
+ * afterwards; the render thread reads it without locks and interpolates
+ * between the two most recent ticks.
+ *
+ * FEATURES:
+ * - Entity states keyed by GameObject::getId(), sorted for binary search
+ * - Draw lists (mesh, material subset, model matrix, colour, renderer) with the
+ *   placement rule used to interpolate them
+ * - Triple buffer (writer slot, shared slot, reader slot) plus a reader-owned
+ *   history slot holding the previous tick for interpolation
+ * - Lock-free publish/acquire through a single atomic slot index; one-shot
+ *   events (GPU particle bursts) of a snapshot that was never read carry over
+ *   into the next one
+ * - Interpolation helpers for positions, Euler rotations (shortest arc) and draws
+ */
+
+#pragma once
+#include "../Math/Math.h"
+#include "ParticleSystem.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Engine {
+
+class Mesh;
+class Renderer;
+
+enum class RenderEntityKind {
+    Object,     // Scene object (terrain, cubes, water, UI owned by the scene)
+    Monster,    // Monster owned by the scene, tracked by MonsterSpawner
+    Projectile  // Projectile owned by ProjectileManager
+};
+
+/**
+ * Transform and gameplay state of one entity at the end of a tick
+ */
+struct EntityRenderState {
+    uint32_t id = 0;
+    RenderEntityKind kind = RenderEntityKind::Object;
+    Vec3 position;
+    Vec3 rotation; // Euler angles in degrees
+    Vec3 scale;
+    float healthPercent = 1.0f; // Monsters only
+    int state = 0;              // Monsters only: MonsterState as int
+    bool alive = true;
+    bool showHealthBar = false; // Monsters only
+    bool damageFlash = false;   // Monsters only: draws carry the flash colour, not the materials
+    uint32_t drawBegin = 0;     // Monsters only: range of the entity's draws in monsterDraws
+    uint32_t drawEnd = 0;
+};
+
+/**
+ * How a draw's model matrix follows interpolation
+ */
+enum class DrawPlacement {
+    Fixed,      // Drawn with the captured matrix (terrain, UI, view model)
+    Transform,  // Rebuilt from the entity's interpolated position/rotation/scale
+    Translate   // Captured matrix moved by the entity's interpolated position (custom orientation)
+};
+
+/**
+ * How a draw is submitted
+ */
+enum class DrawStyle {
+    Plain,          // renderer->renderMesh with the colour
+    HeightColored,  // BasicRenderer terrain colouring
+    Water           // WaterRenderer::renderWater at waterHeight
+};
+
+/**
+ * MeshDrawState - One mesh (or material subset of it) as drawn at the end of a tick
+ */
+struct MeshDrawState {
+    std::shared_ptr<const Mesh> mesh;
+    std::shared_ptr<const std::vector<unsigned int>> triangles; // Material subset, null = whole mesh
+    Mat4 modelMatrix;
+    Vec3 color;
+    const Renderer* renderer = nullptr; // Null = the renderer of the pass
+    uint32_t entityId = 0;              // GameObject::getId() of the owner
+    DrawPlacement placement = DrawPlacement::Fixed;
+    DrawStyle style = DrawStyle::Plain;
+    float waterHeight = 0.0f;           // DrawStyle::Water
+    bool entity = false;                // GameObject::getEntity() of the owner
+};
+
+/**
+ * Camera pose at the end of a tick, and the cursor position the tick's look input ended at
+ */
+struct CameraRenderState {
+    Vec3 position;
+    float yaw = 0.0f;   // Radians
+    float pitch = 0.0f; // Radians
+    double cursorX = 0.0;
+    double cursorY = 0.0;
+    bool hasCursor = false; // Late latching turns the camera by the cursor movement since cursorX/Y
+};
+
+/**
+ * HUD values at the end of a tick
+ */
+struct HudRenderState {
+    int currentAmmo = 0;
+    int maxAmmo = 0;
+    int reserveAmmo = 0;
+    int maxReserveAmmo = 0;
+    bool reloading = false;
+    float reloadProgress = 0.0f;
+    bool hasWeapon = false;
+    Vec3 barrelTip; // World position shots leave from
+    int activeMonsters = 0;
+    int activeProjectiles = 0;
+};
+
+/**
+ * RenderSnapshot - Everything the render thread reads from one simulation tick
+ */
+struct RenderSnapshot {
+    uint64_t tick = 0;            // Simulation tick that produced this snapshot
+    double simulationTime = 0.0;  // glfwGetTime() when the tick finished
+    float tickMs = 0.0f;          // CPU time spent in the tick
+    CameraRenderState camera;
+    HudRenderState hud;
+    std::vector<EntityRenderState> entities; // Sorted by id after finalize()
+
+    // Draw lists, in submission order
+    std::vector<MeshDrawState> sceneDraws;      // Scene objects (terrain, water, cubes, remote players)
+    std::vector<MeshDrawState> monsterDraws;    // Monster material groups, ranges per monster entity
+    std::vector<MeshDrawState> projectileDraws;
+    std::vector<MeshDrawState> overlayDraws;    // Screen-space overlays owned by the scene (crosshair)
+    std::vector<MeshDrawState> viewModelDraws;  // Weapon, already in view space
+    ParticleRenderState particles;
+
+    void clear();
+    void clearKeepingEvents(); // clear(), but particle bursts and GPU time not yet drawn stay
+    void finalize(); // Sorts entities by id; call once capture is complete
+    const EntityRenderState* findEntity(uint32_t id) const;
+};
+
+/**
+ * RenderSnapshotBuffer - Single-producer/single-consumer snapshot hand-off
+ *
+ * Writer: beginWrite() -> fill -> publish(). Reader: acquireLatest() -> getCurrent()/getPrevious().
+ * The writer never blocks; if it publishes twice before the reader acquires,
+ * the older snapshot is dropped.
+ */
+class RenderSnapshotBuffer {
+private:
+    static const int SLOT_COUNT = 4;
+    static const int SLOT_MASK = 0x3;
+    static const int FRESH_BIT = 0x4;
+
+    RenderSnapshot slots[SLOT_COUNT];
+    int writeSlot;                // Owned by the writer
+    std::atomic<int> sharedSlot;  // Slot index | FRESH_BIT when it holds an unread snapshot
+    int currentSlot;              // Owned by the reader
+    int previousSlot;             // Owned by the reader
+    bool hasCurrent;
+    bool hasPrevious;
+    bool writeSlotUnread;         // Writer: the slot came back from publish() without being read
+    uint64_t droppedCount;        // Writer: snapshots replaced before the reader acquired them
+
+public:
+    RenderSnapshotBuffer();
+
+    // Writer (simulation thread)
+    RenderSnapshot& beginWrite();
+    void publish();
+    uint64_t getDroppedCount() const { return droppedCount; }
+
+    // Reader (render thread)
+    bool acquireLatest(); // True if a new snapshot became current
+    bool hasSnapshot() const { return hasCurrent; }
+    bool hasInterpolationPair() const { return hasCurrent && hasPrevious; }
+    const RenderSnapshot& getCurrent() const { return slots[currentSlot]; }
+    const RenderSnapshot& getPrevious() const { return slots[previousSlot]; }
+
+    // Only while neither thread is using the buffer
+    void reset();
+};
+
+// Interpolation helpers
+Vec3 interpolatePosition(const Vec3& from, const Vec3& to, float t);
+Vec3 interpolateEulerDegrees(const Vec3& from, const Vec3& to, float t); // Per-axis shortest arc
+
+// Model matrix of a draw at interpolation factor alpha between the entity's state in
+// previous (null = none) and current; draws of entities missing from either keep their matrix
+Mat4 placeDraw(const MeshDrawState& draw, const RenderSnapshot* previous, const RenderSnapshot& current, float alpha);
+
+// Copies draws into out (cleared first) with their interpolated model matrices
+void placeDraws(const std::vector<MeshDrawState>& draws, const RenderSnapshot* previous, const RenderSnapshot& current,
+                float alpha, std::vector<MeshDrawState>& out);
+
+} // namespace Engine
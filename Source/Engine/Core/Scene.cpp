@@ -4,6 +4,7 @@
 
 #include "Scene.h"
 #include "../Rendering/Renderer.h"
+#include "RenderSnapshot.h"
 #include "../../GameObjects/Ground.h"
 #include "../../GameObjects/Monster.h"
 #include <iostream>
@@ -84,6 +85,11 @@ void Scene::render(const Camera& camera, const Renderer& renderer) {
                 continue; // Skip actual monsters - they're rendered by Game::render() with MonsterRenderer
             }
             
+            // Screen-space overlays (crosshair) are drawn by renderOverlays() after the scene pass
+            if (object->isScreenSpaceOverlay()) {
+                continue;
+            }
+            
             // For monsters and health bars, skip isValid() check to prevent crashes
             bool shouldRender = true;
             if (object->getName().find("Monster_") == 0) {
@@ -113,6 +119,48 @@ void Scene::render(const Camera& camera, const Renderer& renderer) {
     }
 }
 
+void Scene::renderOverlays(const Camera& camera, const Renderer& renderer) {
+    if (!isActive || !isInitialized) return;
+    
+    for (auto& object : gameObjects) {
+        if (object->getActive() && object->isScreenSpaceOverlay() && object->isValid()) {
+            object->render(renderer, camera);
+            renderedObjects++;
+        }
+    }
+}
+
+void Scene::captureDraws(std::vector<MeshDrawState>& draws, std::vector<MeshDrawState>& overlayDraws) const {
+    if (!isActive || !isInitialized) return;
+    
+    for (const auto& object : gameObjects) {
+        if (!object->getActive()) continue;
+        
+        if (object->isScreenSpaceOverlay()) {
+            if (object->isValid()) {
+                size_t first = overlayDraws.size();
+                object->captureDraws(overlayDraws);
+                for (size_t i = first; i < overlayDraws.size(); i++) {
+                    overlayDraws[i].placement = DrawPlacement::Fixed; // NDC, nothing to interpolate
+                }
+            }
+            continue;
+        }
+        
+        // Monsters are captured by the game into their own list (see render())
+        const std::string& name = object->getName();
+        if (name.find("Monster_") == 0) {
+            if (name.find("HealthBar") == std::string::npos) continue;
+        } else if (!object->isValid()) {
+            continue;
+        }
+        
+        if (!object->getEntity() || shouldRenderEntity(object.get())) {
+            object->captureDraws(draws);
+        }
+    }
+}
+
 void Scene::cleanup() {
     if (!isInitialized) return;
     
@@ -60,6 +60,8 @@ public:
     bool initialize();
     void update(float deltaTime);
     void render(const Camera& camera, const Renderer& renderer);
+    void renderOverlays(const Camera& camera, const Renderer& renderer); // Screen-space overlays only
+    void captureDraws(std::vector<MeshDrawState>& draws, std::vector<MeshDrawState>& overlayDraws) const; // Same filters as render()/renderOverlays()
     void cleanup();
     
     // Object management
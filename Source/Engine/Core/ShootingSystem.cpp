@@ -13,6 +13,7 @@
 #define M_PI 3.14159265358979323846
 #endif
 #include <algorithm>
+#include <limits>
 #include "../Math/Math.h" // Ensure Math.h is included
 
 using namespace Engine; // Use the Engine namespace for Vec3
@@ -48,7 +49,8 @@ ShootingSystem::ShootingSystem()
       currentWeapon(nullptr),
       isFiring(false),
       triggerPressed(false),
-      fireTimer(0.0f),
+      lastShotTime(0.0),
+      reloadTimer(TimerWheel::INVALID_TIMER),
       burstShotsFired(0),
       currentRecoil(0.0f, 0.0f, 0.0f),
       recoilRecovery(0.0f, 0.0f, 0.0f),
@@ -58,6 +60,9 @@ ShootingSystem::ShootingSystem()
       recoilRecoveryRate(2.0f),
 
       maxRecoil(0.5f),
+      randomSeed(0),
+      randomEntity(0),
+      shotCounter(0),
       currentSpread(0.0f),
       spreadRecovery(0.0f),
       spreadTimer(0.0f) {
@@ -69,12 +74,12 @@ void ShootingSystem::initialize(ProjectileManager* projectiles, Camera* camera,
     this->input = input;
 }
 
+ShootingSystem::~ShootingSystem() {
+    cleanup();
+}
+
 void ShootingSystem::update(float deltaTime) {
-    // Update fire timer
-    updateFireTimer(deltaTime);
-    
-    // Update reload timer
-    updateReloadTimer(deltaTime);
+    // Fire cooldown and reload completion are driven by the game TimerWheel
     
     // Update recoil
     updateRecoil(deltaTime);
@@ -94,7 +99,9 @@ void ShootingSystem::update(float deltaTime) {
 }
 
 void ShootingSystem::cleanup() {
-    // Cleanup implementation
+    // The pending reload callback points at this object
+    TimerWheel::getInstance().cancel(reloadTimer);
+    reloadTimer = TimerWheel::INVALID_TIMER;
 }
 
 void ShootingSystem::setWeapon(Weapon* weapon) {
@@ -102,6 +109,7 @@ void ShootingSystem::setWeapon(Weapon* weapon) {
 }
 
 void ShootingSystem::configureWeapon(const WeaponStats& stats) {
+    cancelReload();
     weaponStats = stats;
 }
 
@@ -112,8 +120,8 @@ void ShootingSystem::setProjectileManager(ProjectileManager* manager) {
 void ShootingSystem::startFiring() {
     isFiring = true;
     triggerPressed = true;
-    // Set fire timer to cooldown threshold so first shot can fire immediately
-    fireTimer = 1.0f / weaponStats.fireRate;
+    // Clear the cooldown so the first shot can fire immediately
+    lastShotTime = -std::numeric_limits<double>::max();
 }
 
 void ShootingSystem::stopFiring() {
@@ -121,15 +129,15 @@ void ShootingSystem::stopFiring() {
     triggerPressed = false;
 }
 
-void ShootingSystem::fireSingleShot() {
+void ShootingSystem::fireSingleShot(float leadTime) {
     if (!canFire()) return;
     
     // Compute and fire along the engineered start->end vector
     Vec3 firePos = getFirePosition();
-    Vec3 fireDir = getFireDirection();
+    Vec3 fireDir = calculateSpread(getFireDirection());
     
     if (projectileManager && currentWeapon) {
-        fireProjectile(firePos, fireDir);
+        fireProjectile(firePos, fireDir, leadTime);
     }
     
     // Consume ammo
@@ -180,7 +188,10 @@ void ShootingSystem::reload() {
     if (weaponStats.currentReserveAmmo == 0) return;
     
     weaponStats.reloadInProgress = true;
-    weaponStats.reloadTimer = 0.0f;
+    reloadTimer = TimerWheel::getInstance().reschedule(reloadTimer, weaponStats.reloadTime, [this]() {
+        reloadTimer = TimerWheel::INVALID_TIMER;
+        handleReloadComplete();
+    });
     
     if (weaponStats.onReloadStart) {
         weaponStats.onReloadStart(currentWeapon);
@@ -189,15 +200,21 @@ void ShootingSystem::reload() {
 
 void ShootingSystem::cancelReload() {
     weaponStats.reloadInProgress = false;
-    weaponStats.reloadTimer = 0.0f;
+    TimerWheel::getInstance().cancel(reloadTimer);
+    reloadTimer = TimerWheel::INVALID_TIMER;
+}
+
+float ShootingSystem::getReloadRemaining() const {
+    return weaponStats.reloadInProgress ? TimerWheel::getInstance().getRemaining(reloadTimer) : 0.0f;
 }
 
 void ShootingSystem::applyRecoil() {
     // Calculate recoil pattern (upward and slightly random)
     float recoilForce = weaponStats.recoil;
     
-    float randomX = (static_cast<float>(rand()) / RAND_MAX - 0.5f) * 0.3f; // Random horizontal recoil
-    float randomZ = (static_cast<float>(rand()) / RAND_MAX - 0.5f) * 0.1f; // Random forward/backward recoil
+    CounterRandom random(randomSeed, randomEntity, shotCounter++, RandomStream::Recoil);
+    float randomX = random.nextSigned() * 0.15f; // Random horizontal recoil
+    float randomZ = random.nextSigned() * 0.05f; // Random forward/backward recoil
     
     // Apply recoil to pattern
     recoilPattern.y += recoilForce * 0.8f;  // Upward recoil (80% of force)
@@ -255,8 +272,18 @@ void ShootingSystem::updateRecoil(float deltaTime) {
 }
 
 Vec3 ShootingSystem::calculateSpread(const Vec3& baseDirection) {
-    // Spread calculation implementation
-    return baseDirection; // Simplified for now
+    if (weaponStats.aimCone <= 0.0f) return baseDirection;
+    
+    // Uniform point in the weapon's aim cone, keyed like the recoil of the same shot
+    CounterRandom random(randomSeed, randomEntity, shotCounter, RandomStream::Spread);
+    const float pi = 3.14159265358979323846f;
+    float angle = random.nextFloat() * 2.0f * pi;
+    float radius = std::sqrt(random.nextFloat()) * std::tan(weaponStats.aimCone * pi / 180.0f);
+    
+    Vec3 up = std::abs(baseDirection.y) < 0.99f ? Vec3(0.0f, 1.0f, 0.0f) : Vec3(1.0f, 0.0f, 0.0f);
+    Vec3 right = normalize(cross(baseDirection, up));
+    up = cross(right, baseDirection);
+    return normalize(baseDirection + right * (std::cos(angle) * radius) + up * (std::sin(angle) * radius));
 }
 
 void ShootingSystem::updateSpread(float deltaTime) {
@@ -301,7 +328,7 @@ Projectile* ShootingSystem::spawnMonsterHunterProjectile(const Vec3& position, c
     return projectile;
 }
 
-void ShootingSystem::fireProjectile(const Vec3& position, const Vec3& direction) {
+void ShootingSystem::fireProjectile(const Vec3& position, const Vec3& direction, float leadTime) {
     // Debug output
     std::cout << "=== FIRING PROJECTILE ===" << std::endl;
     std::cout << "Fire position: (" << position.x << ", " << position.y << ", " << position.z << ")" << std::endl;
@@ -310,6 +337,10 @@ void ShootingSystem::fireProjectile(const Vec3& position, const Vec3& direction)
     Projectile* projectile = spawnProjectile(position, direction);
     if (projectile) {
         projectile->fire(position, direction, currentWeapon);
+        if (leadTime > 0.0f) {
+            // Catch up on the flight time the shot would have had if fired at the press
+            projectile->setPosition(position + projectile->getVelocity() * leadTime);
+        }
         std::cout << "Projectile fired successfully" << std::endl;
     } else {
         std::cout << "Failed to spawn projectile!" << std::endl;
@@ -378,25 +409,12 @@ Vec3 ShootingSystem::getFirePosition() const {
     return Vec3(0.0f, 0.0f, 0.0f);
 }
 
-void ShootingSystem::updateFireTimer(float deltaTime) {
-    fireTimer += deltaTime;
-}
-
-void ShootingSystem::updateReloadTimer(float deltaTime) {
-    if (!weaponStats.reloadInProgress) return;
-    
-    weaponStats.reloadTimer += deltaTime;
-    if (weaponStats.reloadTimer >= weaponStats.reloadTime) {
-        handleReloadComplete();
-    }
-}
-
 void ShootingSystem::resetFireTimer() {
-    fireTimer = 0.0f;
+    lastShotTime = TimerWheel::getInstance().getTime();
 }
 
 bool ShootingSystem::checkFireCooldown() const {
-    return fireTimer >= (1.0f / weaponStats.fireRate);
+    return TimerWheel::getInstance().getTime() - lastShotTime >= (1.0 / weaponStats.fireRate);
 }
 
 void ShootingSystem::handleAmmoEmpty() {
@@ -407,7 +425,6 @@ void ShootingSystem::handleAmmoEmpty() {
 
 void ShootingSystem::handleReloadComplete() {
     weaponStats.reloadInProgress = false;
-    weaponStats.reloadTimer = 0.0f;
     
     // Transfer ammo from reserve to current
     int ammoNeeded = weaponStats.maxAmmo - weaponStats.currentAmmo;
@@ -461,9 +478,9 @@ void WeaponShootingComponent::stopFiring() {
     }
 }
 
-void WeaponShootingComponent::fireSingleShot() {
+void WeaponShootingComponent::fireSingleShot(float leadTime) {
     if (isEnabled) {
-        shootingSystem.fireSingleShot();
+        shootingSystem.fireSingleShot(leadTime);
     }
 }
 
@@ -8,7 +8,8 @@
  * FEATURES:
  * - Weapon-specific projectile configurations
  * - Automatic projectile spawning and management
- * - Recoil and accuracy systems
+ * - Recoil and accuracy systems (recoil jitter drawn from Random.h, keyed
+ *   by the shooter and the shot number)
  * - Ammunition management
  * - Fire rate control
  * - Spread and accuracy calculations
@@ -17,6 +18,8 @@
 
 #pragma once
 #include "Projectile.h"
+#include "TimerWheel.h"
+#include "../Math/Random.h"
 #include <memory>
 #include <vector>
 #include <string>
@@ -60,7 +63,8 @@ struct WeaponStats {
     FireMode fireMode = FireMode::Single;
     float fireRate = 1.0f;           // Shots per second
     float burstCount = 3;            // Shots per burst
-    float spread = 0.0f;             // Base spread in degrees
+    float spread = 0.0f;             // Added to the current spread per shot (degrees)
+    float aimCone = 0.0f;            // Random aim deviation, half-angle in degrees (0 = shots go straight)
     float recoil = 0.0f;             // Recoil force
     float accuracy = 1.0f;           // Base accuracy (0.0-1.0)
     
@@ -79,7 +83,6 @@ struct WeaponStats {
     // Reload properties
     float reloadTime = 2.0f;
     bool reloadInProgress = false;
-    float reloadTimer = 0.0f;
     
     // Cooldown properties
     float lastFireTime = 0.0f;
@@ -109,7 +112,8 @@ private:
     // Shooting state
     bool isFiring;
     bool triggerPressed;
-    float fireTimer;
+    double lastShotTime;     // Game time of the last shot (TimerWheel clock)
+    TimerId reloadTimer;     // Pending reload completion
     int burstShotsFired;
     
     // Recoil system
@@ -121,6 +125,11 @@ private:
     float recoilRecoveryRate;
     float maxRecoil;
     
+    // Random key of the recoil jitter and spread: shot N of a shooter always kicks and strays the same way
+    uint64_t randomSeed;
+    uint32_t randomEntity;
+    uint32_t shotCounter;
+    
     // Recoil callbacks for visual feedback
     std::function<void(const Vec3&)> onRecoilApplied;
     
@@ -132,7 +141,7 @@ private:
 public:
     // Constructor/Destructor
     ShootingSystem();
-    ~ShootingSystem() = default;
+    ~ShootingSystem();
     
     // Core functionality
     void initialize(ProjectileManager* projectiles, Camera* camera, Input* input);
@@ -150,7 +159,7 @@ public:
     // Shooting control
     void startFiring();
     void stopFiring();
-    void fireSingleShot();
+    void fireSingleShot(float leadTime = 0.0f); // leadTime: seconds since the trigger was pulled; the shot starts that far along its path
     void fireBurst();
     void fireAuto(float deltaTime);
     
@@ -167,13 +176,14 @@ public:
     void updateRecoil(float deltaTime);
     Vec3 getRecoilOffset() const;
     void setRecoilCallback(std::function<void(const Vec3&)> callback);
+    void setRandomKey(uint64_t worldSeed, uint32_t entity) { randomSeed = worldSeed; randomEntity = entity; shotCounter = 0; }
     Vec3 calculateSpread(const Vec3& baseDirection);
     void updateSpread(float deltaTime);
     
     // Projectile spawning
     Projectile* spawnProjectile(const Vec3& position, const Vec3& direction);
     Projectile* spawnMonsterHunterProjectile(const Vec3& position, const Vec3& direction);
-    void fireProjectile(const Vec3& position, const Vec3& direction);
+    void fireProjectile(const Vec3& position, const Vec3& direction, float leadTime = 0.0f);
     void fireMonsterHunterProjectile(const Vec3& position, const Vec3& direction);
     
     // Utility
@@ -185,14 +195,13 @@ public:
     
     // State queries
     bool isReloading() const { return weaponStats.reloadInProgress; }
+    float getReloadRemaining() const; // Seconds until the reload completes, 0 when not reloading
     bool getIsFiring() const { return isFiring; }
     int getCurrentAmmo() const { return weaponStats.currentAmmo; }
     int getReserveAmmo() const { return weaponStats.currentReserveAmmo; }
     
 protected:
     // Internal helpers
-    void updateFireTimer(float deltaTime);
-    void updateReloadTimer(float deltaTime);
     void resetFireTimer();
     bool checkFireCooldown() const;
     void handleAmmoEmpty();
@@ -229,7 +238,7 @@ public:
     // Shooting interface
     void startFiring();
     void stopFiring();
-    void fireSingleShot();
+    void fireSingleShot(float leadTime = 0.0f);
     void fireMonsterHunterShot();
     
     // Ammunition interface
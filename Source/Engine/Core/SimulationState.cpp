@@ -0,0 +1,237 @@
+/**
+ * SimulationState.cpp - Implementation of Whole-Simulation Snapshots
+ */
+
+#include "SimulationState.h"
+#include "Scene.h"
+#include "Projectile.h"
+#include "../Math/Camera.h"
+#include "../../GameObjects/Monster.h"
+#include "../../GameObjects/Player.h"
+#include <fstream>
+#include <iostream>
+#include <unordered_map>
+
+namespace Engine {
+
+const uint32_t SimulationState::SCENE_TAG = makeStateTag('S', 'C', 'N', 'E');
+const uint32_t SimulationState::PLAYER_TAG = makeStateTag('P', 'L', 'Y', 'R');
+const uint32_t SimulationState::CAMERA_TAG = makeStateTag('C', 'A', 'M', 'R');
+const uint16_t SimulationState::SCENE_VERSION = 1;
+const uint16_t SimulationState::PLAYER_VERSION = 1;
+const uint16_t SimulationState::CAMERA_VERSION = 1;
+
+namespace {
+
+// Monsters are restored through MonsterSpawner, not as plain scene objects
+bool isSceneOwnedState(const GameObject* object) {
+    return object && !dynamic_cast<const Monster*>(object);
+}
+
+} // namespace
+
+void SimulationState::capture(const SimulationWorld& world) {
+    StateWriter writer(buffer);
+
+    if (world.scene) {
+        const auto& objects = world.scene->getGameObjects();
+        std::vector<uint32_t> ids;
+        std::vector<Vec3> positions, rotations, scales;
+        std::vector<uint8_t> active;
+        std::vector<uint32_t> playerIds;
+        std::vector<float> playerHealth, playerArmor;
+        ids.reserve(objects.size());
+        positions.reserve(objects.size());
+        rotations.reserve(objects.size());
+        scales.reserve(objects.size());
+        active.reserve(objects.size());
+
+        for (const auto& object : objects) {
+            if (!isSceneOwnedState(object.get())) continue;
+            ids.push_back(object->getId());
+            positions.push_back(object->getPosition());
+            rotations.push_back(object->getRotation());
+            scales.push_back(object->getScale());
+            active.push_back(object->getActive() ? 1 : 0);
+
+            if (const Player* player = dynamic_cast<const Player*>(object.get())) {
+                playerIds.push_back(player->getId());
+                playerHealth.push_back(player->getHealth());
+                playerArmor.push_back(player->getArmor());
+            }
+        }
+
+        writer.beginSection(SCENE_TAG, SCENE_VERSION);
+        writer.writeArray(ids);
+        writer.writeArray(positions);
+        writer.writeArray(rotations);
+        writer.writeArray(scales);
+        writer.writeArray(active);
+        writer.endSection();
+
+        writer.beginSection(PLAYER_TAG, PLAYER_VERSION);
+        writer.writeArray(playerIds);
+        writer.writeArray(playerHealth);
+        writer.writeArray(playerArmor);
+        writer.endSection();
+    }
+
+    if (world.camera) {
+        writer.beginSection(CAMERA_TAG, CAMERA_VERSION);
+        writer.write(world.camera->getPosition());
+        writer.write(world.camera->getRotation());
+        writer.endSection();
+    }
+
+    if (world.monsterSpawner) {
+        world.monsterSpawner->saveState(writer);
+    }
+
+    if (world.projectileManager) {
+        world.projectileManager->saveState(writer);
+    }
+}
+
+bool SimulationState::restore(const SimulationWorld& world) const {
+    if (buffer.empty()) return false;
+
+    // Parse and check every section this world needs before touching anything, so a
+    // snapshot that is foreign, from another schema version or corrupt leaves the game as it was
+    std::vector<uint32_t> ids;
+    std::vector<Vec3> positions, rotations, scales;
+    std::vector<uint8_t> active;
+    std::vector<uint32_t> playerIds;
+    std::vector<float> playerHealth, playerArmor;
+    Vec3 cameraPosition, cameraRotation;
+    bool valid = true;
+
+    if (world.scene) {
+        StateReader reader(buffer.data(), buffer.size());
+        reader.openSection(SCENE_TAG, SCENE_VERSION);
+        reader.readArray(ids);
+        reader.readArray(positions);
+        reader.readArray(rotations);
+        reader.readArray(scales);
+        reader.readArray(active);
+        reader.openSection(PLAYER_TAG, PLAYER_VERSION);
+        reader.readArray(playerIds);
+        reader.readArray(playerHealth);
+        reader.readArray(playerArmor);
+        valid = reader.isValid() && positions.size() == ids.size() && rotations.size() == ids.size() &&
+                scales.size() == ids.size() && active.size() == ids.size() &&
+                playerHealth.size() == playerIds.size() && playerArmor.size() == playerIds.size();
+    }
+    if (valid && world.camera) {
+        StateReader reader(buffer.data(), buffer.size());
+        reader.openSection(CAMERA_TAG, CAMERA_VERSION);
+        reader.read(cameraPosition);
+        reader.read(cameraRotation);
+        valid = reader.isValid();
+    }
+    if (valid && world.monsterSpawner) {
+        StateReader reader(buffer.data(), buffer.size());
+        valid = MonsterSpawner::validateState(reader);
+    }
+    if (valid && world.projectileManager) {
+        StateReader reader(buffer.data(), buffer.size());
+        valid = ProjectileManager::validateState(reader);
+    }
+    if (!valid) {
+        std::cerr << "SimulationState: snapshot is missing, incompatible or corrupt sections" << std::endl;
+        return false;
+    }
+
+    // Apply: the sections below were checked above and cannot fail
+    std::unordered_map<uint32_t, GameObject*> objectsById;
+    if (world.scene) {
+        const auto& objects = world.scene->getGameObjects();
+        objectsById.reserve(objects.size() + world.owners.size());
+        for (const auto& object : objects) {
+            if (object) objectsById[object->getId()] = object.get();
+        }
+
+        for (size_t i = 0; i < ids.size(); i++) {
+            auto it = objectsById.find(ids[i]);
+            if (it == objectsById.end() || !isSceneOwnedState(it->second)) continue;
+            GameObject* object = it->second;
+            object->setPosition(positions[i]);
+            object->setRotation(rotations[i]);
+            object->setScale(scales[i]);
+            object->setActive(active[i] != 0);
+        }
+
+        for (size_t i = 0; i < playerIds.size(); i++) {
+            auto it = objectsById.find(playerIds[i]);
+            Player* player = it != objectsById.end() ? dynamic_cast<Player*>(it->second) : nullptr;
+            if (!player) continue;
+            player->setArmor(playerArmor[i]);
+            player->setHealth(playerHealth[i]);
+        }
+    }
+
+    if (world.camera) {
+        world.camera->setPosition(cameraPosition);
+        world.camera->setRotation(cameraRotation);
+    }
+
+    StateReader reader(buffer.data(), buffer.size());
+    if (world.monsterSpawner && !world.monsterSpawner->restoreState(reader)) {
+        return false;
+    }
+
+    if (world.projectileManager) {
+        // Monster views may have been recreated by the spawner; look owners up afterwards
+        if (world.scene) {
+            objectsById.clear();
+            for (const auto& object : world.scene->getGameObjects()) {
+                if (object) objectsById[object->getId()] = object.get();
+            }
+        }
+        for (GameObject* owner : world.owners) {
+            if (owner) objectsById[owner->getId()] = owner;
+        }
+        auto findOwner = [&objectsById](uint32_t id) -> GameObject* {
+            auto it = objectsById.find(id);
+            return it != objectsById.end() ? it->second : nullptr;
+        };
+        if (!world.projectileManager->restoreState(reader, findOwner)) {
+            return false;
+        }
+    }
+
+    return reader.isValid();
+}
+
+bool SimulationState::saveToFile(const std::string& path) const {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        std::cerr << "SimulationState: cannot write " << path << std::endl;
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+    return static_cast<bool>(file);
+}
+
+bool SimulationState::loadFromFile(const std::string& path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        std::cerr << "SimulationState: cannot read " << path << std::endl;
+        return false;
+    }
+    std::streamsize fileSize = file.tellg();
+    file.seekg(0, std::ios::beg);
+    std::vector<uint8_t> loaded(static_cast<size_t>(fileSize > 0 ? fileSize : 0));
+    if (fileSize > 0 && !file.read(reinterpret_cast<char*>(loaded.data()), fileSize)) {
+        return false;
+    }
+
+    StateReader header(loaded.data(), loaded.size());
+    if (!header.isValid()) {
+        std::cerr << "SimulationState: " << path << " is not a snapshot from this build" << std::endl;
+        return false;
+    }
+    buffer.swap(loaded);
+    return true;
+}
+
+} // namespace Engine
@@ -0,0 +1,85 @@
+/**
+ * SimulationState.h - Whole-Simulation Snapshot and Restore
+ *
+ * OVERVIEW:
+ * Captures the gameplay state of a running Game into one contiguous
+ * StateBuffer and restores it in place. Each subsystem writes its own
+ * versioned section:
+ *
+ *   SCNE  scene object transforms and active flags (monsters excluded)
+ *   PLYR  player health and armor
+ *   CAMR  camera pose
+ *   MSPN  MonsterSpawner wave state, followed by
+ *   MSIM  the MonsterSimulation SoA arrays
+ *   PROJ  projectiles in flight
+ *
+ * Restore matches objects by GameObject::getId() and overwrites them rather
+ * than rebuilding the scene: monster state is a memcpy into the simulation's
+ * arrays and existing Monster views are re-bound, so only monsters or
+ * projectiles that no longer exist are recreated.
+ *
+ * USAGE:
+ *   SimulationState state;
+ *   state.capture(game.getSimulationWorld());
+ *   ...
+ *   state.restore(game.getSimulationWorld());
+ *
+ * Scene objects that were added after the capture are left alone; objects
+ * that were removed since are not brought back. Terrain is procedural and
+ * regenerates from its seed, so it carries no state here.
+ */
+
+#pragma once
+#include "StateBuffer.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Engine {
+
+class Scene;
+class Camera;
+class MonsterSpawner;
+class ProjectileManager;
+class GameObject;
+
+/**
+ * Subsystems a snapshot covers; any of them may be null
+ */
+struct SimulationWorld {
+    Scene* scene = nullptr;
+    Camera* camera = nullptr;
+    MonsterSpawner* monsterSpawner = nullptr;
+    ProjectileManager* projectileManager = nullptr;
+    std::vector<GameObject*> owners; // Projectile owners outside the scene (weapons)
+};
+
+/**
+ * SimulationState - One captured snapshot
+ */
+class SimulationState {
+public:
+    static const uint32_t SCENE_TAG;
+    static const uint32_t PLAYER_TAG;
+    static const uint32_t CAMERA_TAG;
+    static const uint16_t SCENE_VERSION;
+    static const uint16_t PLAYER_VERSION;
+    static const uint16_t CAMERA_VERSION;
+
+private:
+    std::vector<uint8_t> buffer; // Reused between captures
+
+public:
+    void capture(const SimulationWorld& world);
+    // False if the buffer is empty, foreign or from another schema version
+    bool restore(const SimulationWorld& world) const;
+
+    bool saveToFile(const std::string& path) const;
+    bool loadFromFile(const std::string& path);
+
+    bool isEmpty() const { return buffer.empty(); }
+    size_t getSize() const { return buffer.size(); }
+    const std::vector<uint8_t>& getBuffer() const { return buffer; }
+};
+
+} // namespace Engine
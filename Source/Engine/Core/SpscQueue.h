@@ -0,0 +1,78 @@
+/**
+ * SpscQueue.h - Bounded Lock-Free Single-Producer/Single-Consumer Queue
+ *
+ * OVERVIEW:
+ * Ring buffer with one writer thread and one reader thread. The writer
+ * owns the tail index and the reader owns the head index; each publishes
+ * its index with a release store and reads the other side's with an
+ * acquire load, so neither side ever blocks or takes a lock. Indices run
+ * freely and are masked into a power-of-two capacity.
+ *
+ * FEATURES:
+ * - push() fails instead of blocking when the queue is full
+ * - Head and tail on separate cache lines (no false sharing)
+ * - Elements are copied in and out; no allocation after construction
+ *
+ * THREADING:
+ * Exactly one thread may call push() and exactly one (other) thread may
+ * call pop(). size() is an estimate when called from a third thread.
+ */
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace Engine {
+
+template <typename T>
+class SpscQueue {
+private:
+    std::vector<T> slots;
+    size_t mask;
+    alignas(64) std::atomic<size_t> head;   // Next slot to read (consumer)
+    alignas(64) std::atomic<size_t> tail;   // Next slot to write (producer)
+
+public:
+    // Capacity is rounded up to a power of two
+    explicit SpscQueue(size_t capacity)
+        : mask(0), head(0), tail(0) {
+        size_t size = 1;
+        while (size < capacity) size <<= 1;
+        slots.resize(size);
+        mask = size - 1;
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    // Producer only
+    bool push(const T& value) {
+        size_t currentTail = tail.load(std::memory_order_relaxed);
+        if (currentTail - head.load(std::memory_order_acquire) > mask) {
+            return false; // Full
+        }
+        slots[currentTail & mask] = value;
+        tail.store(currentTail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer only
+    bool pop(T& value) {
+        size_t currentHead = head.load(std::memory_order_relaxed);
+        if (currentHead == tail.load(std::memory_order_acquire)) {
+            return false; // Empty
+        }
+        value = slots[currentHead & mask];
+        head.store(currentHead + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t size() const {
+        return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+    }
+    bool empty() const { return size() == 0; }
+    size_t capacity() const { return mask + 1; }
+};
+
+} // namespace Engine
@@ -0,0 +1,126 @@
+/**
+ * StateBuffer.cpp - Implementation of the Snapshot Buffer Primitives
+ */
+
+#include "StateBuffer.h"
+
+namespace Engine {
+
+namespace {
+
+// Header: magic, format version, byte order mark
+const size_t HEADER_SIZE = sizeof(uint32_t) + 2 * sizeof(uint16_t);
+// Section: tag, version, body size
+const size_t SECTION_HEADER_SIZE = sizeof(uint32_t) + sizeof(uint16_t) + sizeof(uint32_t);
+
+} // namespace
+
+const uint32_t StateWriter::MAGIC = makeStateTag('W', 'W', '3', 'S');
+const uint16_t StateWriter::FORMAT_VERSION = 1;
+
+// ===== StateWriter =====
+
+StateWriter::StateWriter(std::vector<uint8_t>& output)
+    : buffer(output), sectionStart(0) {
+    buffer.clear();
+    write(MAGIC);
+    write(FORMAT_VERSION);
+    write(BYTE_ORDER_MARK);
+}
+
+void StateWriter::beginSection(uint32_t tag, uint16_t version) {
+    if (sectionStart != 0) endSection();
+    write(tag);
+    write(version);
+    sectionStart = buffer.size();
+    write(static_cast<uint32_t>(0)); // Patched by endSection
+}
+
+void StateWriter::endSection() {
+    if (sectionStart == 0) return;
+    uint32_t bodySize = static_cast<uint32_t>(buffer.size() - sectionStart - sizeof(uint32_t));
+    std::memcpy(buffer.data() + sectionStart, &bodySize, sizeof(bodySize));
+    sectionStart = 0;
+}
+
+void StateWriter::writeBytes(const void* bytes, size_t count) {
+    if (count == 0) return;
+    size_t start = buffer.size();
+    buffer.resize(start + count);
+    std::memcpy(buffer.data() + start, bytes, count);
+}
+
+// ===== StateReader =====
+
+StateReader::StateReader(const uint8_t* buffer, size_t bufferSize)
+    : data(buffer), size(bufferSize), offset(0), sectionEnd(bufferSize), failed(false) {
+    uint32_t magic = 0;
+    uint16_t version = 0, byteOrder = 0;
+    read(magic);
+    read(version);
+    read(byteOrder);
+    if (magic != StateWriter::MAGIC || version != StateWriter::FORMAT_VERSION || byteOrder != StateWriter::BYTE_ORDER_MARK) {
+        failed = true;
+    }
+    sectionEnd = offset;
+}
+
+bool StateReader::require(size_t bytes) {
+    if (failed || bytes > sectionEnd - offset) {
+        failed = true;
+        return false;
+    }
+    return true;
+}
+
+bool StateReader::readBytes(void* bytes, size_t count) {
+    if (!require(count)) return false;
+    if (count > 0) {
+        std::memcpy(bytes, data + offset, count);
+        offset += count;
+    }
+    return true;
+}
+
+size_t StateReader::findSection(uint32_t tag, uint16_t& version, size_t& bodySize) const {
+    size_t position = HEADER_SIZE;
+    while (position + SECTION_HEADER_SIZE <= size) {
+        uint32_t sectionTag;
+        uint16_t sectionVersion;
+        uint32_t sectionSize;
+        std::memcpy(&sectionTag, data + position, sizeof(sectionTag));
+        std::memcpy(&sectionVersion, data + position + sizeof(uint32_t), sizeof(sectionVersion));
+        std::memcpy(&sectionSize, data + position + sizeof(uint32_t) + sizeof(uint16_t), sizeof(sectionSize));
+        size_t body = position + SECTION_HEADER_SIZE;
+        if (sectionSize > size - body) return 0; // Truncated
+        if (sectionTag == tag) {
+            version = sectionVersion;
+            bodySize = sectionSize;
+            return body;
+        }
+        position = body + sectionSize;
+    }
+    return 0;
+}
+
+bool StateReader::hasSection(uint32_t tag) const {
+    uint16_t version;
+    size_t bodySize;
+    return !failed && findSection(tag, version, bodySize) != 0;
+}
+
+bool StateReader::openSection(uint32_t tag, uint16_t version) {
+    if (failed) return false;
+    uint16_t storedVersion = 0;
+    size_t bodySize = 0;
+    size_t body = findSection(tag, storedVersion, bodySize);
+    if (body == 0 || storedVersion != version) {
+        failed = true;
+        return false;
+    }
+    offset = body;
+    sectionEnd = body + bodySize;
+    return true;
+}
+
+} // namespace Engine
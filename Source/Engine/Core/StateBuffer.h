@@ -0,0 +1,135 @@
+/**
+ * StateBuffer.h - Contiguous Binary Buffer for Simulation Snapshots
+ *
+ * OVERVIEW:
+ * Serialization primitives behind SimulationState. A buffer is a header
+ * (magic, format version, byte order mark) followed by sections. Each
+ * section carries a four-character tag, its own schema version and its
+ * byte size, so a reader skips sections it does not ask for and refuses a
+ * section whose schema it cannot read instead of misinterpreting it.
+ *
+ * Values are stored in host byte order: buffers are for restoring into the
+ * same build (benchmark resets, rollback, quick-save), not for the network.
+ * Arrays of trivially copyable elements are written and read with a single
+ * memcpy, which is what keeps restoring SoA pools cheap.
+ *
+ * FEATURES:
+ * - Bounds-checked reads; any failure sticks and isValid() turns false
+ * - Sections looked up by tag, in any order
+ * - GL-free (ww3_core)
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace Engine {
+
+// Four-character section tag, e.g. makeStateTag('M', 'S', 'I', 'M')
+constexpr uint32_t makeStateTag(char a, char b, char c, char d) {
+    return static_cast<uint32_t>(static_cast<uint8_t>(a)) |
+           (static_cast<uint32_t>(static_cast<uint8_t>(b)) << 8) |
+           (static_cast<uint32_t>(static_cast<uint8_t>(c)) << 16) |
+           (static_cast<uint32_t>(static_cast<uint8_t>(d)) << 24);
+}
+
+/**
+ * StateWriter - Appends a header and sections to a growing byte buffer
+ */
+class StateWriter {
+public:
+    static const uint32_t MAGIC;            // "WW3S"
+    static const uint16_t FORMAT_VERSION;   // Header and section framing
+    static const uint16_t BYTE_ORDER_MARK = 0x0102;
+
+private:
+    std::vector<uint8_t>& buffer;
+    size_t sectionStart;    // Offset of the open section's size field (0 = none)
+
+public:
+    // Clears the buffer (keeping its capacity) and writes the header
+    explicit StateWriter(std::vector<uint8_t>& output);
+
+    void beginSection(uint32_t tag, uint16_t version);
+    void endSection();
+
+    template <typename T>
+    void write(const T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "StateWriter::write needs a trivially copyable type");
+        writeBytes(&value, sizeof(T));
+    }
+
+    // Element count, then the elements in one copy
+    template <typename T>
+    void writeArray(const T* values, size_t count) {
+        static_assert(std::is_trivially_copyable<T>::value, "StateWriter::writeArray needs trivially copyable elements");
+        write(static_cast<uint32_t>(count));
+        writeBytes(values, count * sizeof(T));
+    }
+
+    template <typename T>
+    void writeArray(const std::vector<T>& values) {
+        writeArray(values.data(), values.size());
+    }
+
+    void writeBytes(const void* bytes, size_t count);
+
+    size_t getSize() const { return buffer.size(); }
+};
+
+/**
+ * StateReader - Reads sections written by StateWriter
+ */
+class StateReader {
+private:
+    const uint8_t* data;
+    size_t size;
+    size_t offset;
+    size_t sectionEnd;      // Reads stop here
+    bool failed;
+
+public:
+    // Checks the header; a foreign or truncated buffer leaves the reader invalid
+    StateReader(const uint8_t* buffer, size_t bufferSize);
+
+    // Moves to the section's body; false if it is missing or has another version
+    bool openSection(uint32_t tag, uint16_t version);
+    bool hasSection(uint32_t tag) const;
+
+    template <typename T>
+    bool read(T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "StateReader::read needs a trivially copyable type");
+        return readBytes(&value, sizeof(T));
+    }
+
+    template <typename T>
+    T read() {
+        T value{};
+        read(value);
+        return value;
+    }
+
+    // Resizes to the stored count and copies the elements in one go
+    template <typename T>
+    bool readArray(std::vector<T>& values) {
+        static_assert(std::is_trivially_copyable<T>::value, "StateReader::readArray needs trivially copyable elements");
+        uint32_t count = 0;
+        if (!read(count) || !require(static_cast<size_t>(count) * sizeof(T))) return false;
+        values.resize(count);
+        return readBytes(values.data(), static_cast<size_t>(count) * sizeof(T));
+    }
+
+    bool readBytes(void* bytes, size_t count);
+
+    bool isValid() const { return !failed; }
+    void fail() { failed = true; }
+
+private:
+    bool require(size_t bytes);
+    size_t findSection(uint32_t tag, uint16_t& version, size_t& bodySize) const; // Body offset, 0 if missing
+};
+
+} // namespace Engine
@@ -0,0 +1,233 @@
+/**
+ * TaskScheduler.cpp - Implementation of Resumable Gameplay Tasks
+ */
+
+#include "TaskScheduler.h"
+#include <algorithm>
+
+namespace Engine {
+
+namespace {
+
+const TaskId INVALID_TASK = 0;
+
+/**
+ * LambdaTask - Task whose body is a callable; state lives in its captures
+ */
+class LambdaTask : public Task {
+private:
+    std::function<TaskWait()> body;
+
+public:
+    explicit LambdaTask(std::function<TaskWait()> taskBody) : body(std::move(taskBody)) {}
+    TaskWait resume() override { return body(); }
+};
+
+} // namespace
+
+// ===== TaskEvent =====
+
+TaskEvent::TaskEvent() : scheduler(nullptr) {
+}
+
+TaskEvent::~TaskEvent() {
+    if (!scheduler) return;
+    for (TaskId id : waiters) {
+        scheduler->detachEvent(id);
+    }
+}
+
+void TaskEvent::signal() {
+    if (!scheduler || waiters.empty()) return;
+
+    // Waiters that re-wait on this event from their resume() need the next signal
+    std::vector<TaskId> woken;
+    woken.swap(waiters);
+    for (TaskId id : woken) {
+        scheduler->wake(id);
+    }
+}
+
+// ===== TaskScheduler =====
+
+TaskScheduler::TaskScheduler(TimerWheel& timerWheel)
+    : timers(&timerWheel), taskCount(0) {
+}
+
+TaskScheduler::~TaskScheduler() {
+    clear();
+}
+
+TaskScheduler& TaskScheduler::getInstance() {
+    static TaskScheduler instance(TimerWheel::getInstance());
+    return instance;
+}
+
+TaskId TaskScheduler::start(std::unique_ptr<Task> task) {
+    if (!task) return INVALID_TASK;
+
+    uint32_t index;
+    if (!freeSlots.empty()) {
+        index = freeSlots.back();
+        freeSlots.pop_back();
+    } else {
+        index = static_cast<uint32_t>(slots.size());
+        slots.push_back(TaskSlot());
+        slots[index].generation = 1;
+    }
+
+    TaskSlot& slot = slots[index];
+    slot.task = std::move(task);
+    slot.state = TaskState::Ready;
+    slot.cancelRequested = false;
+    slot.timer = TimerWheel::INVALID_TIMER;
+    slot.event = nullptr;
+    taskCount++;
+
+    TaskId id = (static_cast<TaskId>(slot.generation) << 32) | static_cast<TaskId>(index + 1);
+    ready.push_back(id);
+    return id;
+}
+
+TaskId TaskScheduler::start(std::function<TaskWait()> body) {
+    if (!body) return INVALID_TASK;
+    return start(std::unique_ptr<Task>(new LambdaTask(std::move(body))));
+}
+
+bool TaskScheduler::cancel(TaskId id) {
+    int32_t index = findSlot(id);
+    if (index < 0) return false;
+
+    if (slots[index].state == TaskState::Running) {
+        // Destroyed once its resume() returns
+        slots[index].cancelRequested = true;
+    } else {
+        release(static_cast<uint32_t>(index));
+    }
+    return true;
+}
+
+bool TaskScheduler::isRunning(TaskId id) const {
+    int32_t index = findSlot(id);
+    return index >= 0 && !slots[index].cancelRequested;
+}
+
+void TaskScheduler::update() {
+    // Tasks woken while this batch runs (including frame waits) resume next update
+    resuming.swap(ready);
+    for (TaskId id : resuming) {
+        run(id);
+    }
+    resuming.clear();
+}
+
+void TaskScheduler::clear() {
+    for (size_t i = 0; i < slots.size(); i++) {
+        if (slots[i].state != TaskState::Free) {
+            release(static_cast<uint32_t>(i));
+        }
+    }
+    ready.clear();
+}
+
+void TaskScheduler::wake(TaskId id) {
+    int32_t index = findSlot(id);
+    if (index < 0) return;
+
+    TaskSlot& slot = slots[index];
+    if (slot.state != TaskState::WaitingTimer && slot.state != TaskState::WaitingEvent) return;
+
+    slot.state = TaskState::Ready;
+    slot.timer = TimerWheel::INVALID_TIMER;
+    slot.event = nullptr;
+    ready.push_back(id);
+}
+
+void TaskScheduler::detachEvent(TaskId id) {
+    int32_t index = findSlot(id);
+    if (index >= 0 && slots[index].state == TaskState::WaitingEvent) {
+        slots[index].event = nullptr;
+    }
+}
+
+void TaskScheduler::run(TaskId id) {
+    int32_t index = findSlot(id);
+    if (index < 0 || slots[index].state != TaskState::Ready) return; // Cancelled since it was woken
+
+    slots[index].state = TaskState::Running;
+    Task* task = slots[index].task.get();
+    TaskWait wait = task->resume(); // May start/cancel tasks, so slots can reallocate
+
+    if (slots[index].cancelRequested || wait.kind == TaskWait::Kind::Done) {
+        release(static_cast<uint32_t>(index));
+        return;
+    }
+    park(id, wait);
+}
+
+void TaskScheduler::park(TaskId id, const TaskWait& wait) {
+    TaskSlot& slot = slots[static_cast<uint32_t>(id & 0xFFFFFFFFull) - 1];
+
+    switch (wait.kind) {
+        case TaskWait::Kind::Seconds:
+            slot.state = TaskState::WaitingTimer;
+            slot.timer = timers->schedule(wait.delay, [this, id]() { wake(id); });
+            break;
+        case TaskWait::Kind::Event:
+            if (wait.waitEvent) {
+                slot.state = TaskState::WaitingEvent;
+                slot.event = wait.waitEvent;
+                wait.waitEvent->scheduler = this;
+                wait.waitEvent->waiters.push_back(id);
+                break;
+            }
+            // No event to wait on: behave like a frame wait
+            slot.state = TaskState::Ready;
+            ready.push_back(id);
+            break;
+        default:
+            slot.state = TaskState::Ready;
+            ready.push_back(id);
+            break;
+    }
+}
+
+void TaskScheduler::release(uint32_t index) {
+    TaskSlot& slot = slots[index];
+    TaskId id = (static_cast<TaskId>(slot.generation) << 32) | static_cast<TaskId>(index + 1);
+
+    if (slot.state == TaskState::WaitingTimer) {
+        timers->cancel(slot.timer);
+    } else if (slot.state == TaskState::WaitingEvent && slot.event) {
+        std::vector<TaskId>& waiters = slot.event->waiters;
+        waiters.erase(std::remove(waiters.begin(), waiters.end(), id), waiters.end());
+        if (waiters.empty()) {
+            slot.event->scheduler = nullptr;
+        }
+    }
+
+    std::unique_ptr<Task> task = std::move(slot.task);
+    slot.state = TaskState::Free;
+    slot.cancelRequested = false;
+    slot.timer = TimerWheel::INVALID_TIMER;
+    slot.event = nullptr;
+    slot.generation++;
+    freeSlots.push_back(index);
+    taskCount--;
+
+    // Destroyed last: a task's destructor may cancel other tasks
+    task.reset();
+}
+
+int32_t TaskScheduler::findSlot(TaskId id) const {
+    if (id == INVALID_TASK) return -1;
+    uint64_t index = (id & 0xFFFFFFFFull) - 1;
+    uint32_t generation = static_cast<uint32_t>(id >> 32);
+    if (index >= slots.size()) return -1;
+
+    const TaskSlot& slot = slots[index];
+    if (slot.generation != generation || slot.state == TaskState::Free) return -1;
+    return static_cast<int32_t>(index);
+}
+
+} // namespace Engine
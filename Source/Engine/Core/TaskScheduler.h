@@ -0,0 +1,158 @@
+/**
+ * TaskScheduler.h - Resumable Gameplay Tasks (Wait for Frame / Time / Event)
+ *
+ * OVERVIEW:
+ * Multi-step gameplay sequences (wave flow, difficulty ramps, scripted
+ * behaviours) are written as tasks: resume() runs the task until its next
+ * wait and returns what to wait for - the next frame, a number of seconds
+ * or a TaskEvent. The scheduler parks the task until then. Time waits sit
+ * in the TimerWheel and event waits in the event's waiter list, so a
+ * suspended task costs nothing per frame, unlike a polled state check.
+ *
+ * The engine is C++17, so tasks are explicit resumable objects (the state a
+ * coroutine would keep in its frame lives in the task or its lambda captures)
+ * rather than C++20 coroutines; the scheduling model is the same.
+ *
+ * FEATURES:
+ * - TaskWait::nextFrame(), seconds(s), event(e), done()
+ * - Tasks from a Task subclass or from a lambda returning TaskWait
+ * - Generation-checked TaskIds, cancel() from anywhere (including the task itself)
+ * - Woken tasks resume in the next update(), in wake order
+ * - GL-free: part of ww3_core
+ *
+ * THREADING:
+ * Not thread-safe. The game instance is updated by Game::update right after
+ * the TimerWheel and must only be used from the simulation thread.
+ */
+
+#pragma once
+#include "TimerWheel.h"
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace Engine {
+
+class TaskEvent;
+class TaskScheduler;
+
+/**
+ * TaskId - Handle to a running task (0 = no task)
+ */
+typedef uint64_t TaskId;
+
+/**
+ * TaskWait - What a task waits for after resume() returns
+ */
+struct TaskWait {
+    enum class Kind {
+        NextFrame,  // Resume in the next update()
+        Seconds,    // Resume once the delay has passed on the TimerWheel
+        Event,      // Resume after the event is signalled
+        Done        // Task finished, destroy it
+    };
+
+    Kind kind;
+    float delay;
+    TaskEvent* waitEvent;
+
+    static TaskWait nextFrame() { return TaskWait{Kind::NextFrame, 0.0f, nullptr}; }
+    static TaskWait seconds(float delaySeconds) { return TaskWait{Kind::Seconds, delaySeconds, nullptr}; }
+    static TaskWait event(TaskEvent& signal) { return TaskWait{Kind::Event, 0.0f, &signal}; }
+    static TaskWait done() { return TaskWait{Kind::Done, 0.0f, nullptr}; }
+};
+
+/**
+ * Task - Resumable unit of gameplay logic
+ */
+class Task {
+public:
+    virtual ~Task() = default;
+
+    // Runs until the next wait point and returns what to wait for
+    virtual TaskWait resume() = 0;
+};
+
+/**
+ * TaskEvent - Wakes every task waiting on it when signalled
+ */
+class TaskEvent {
+private:
+    friend class TaskScheduler;
+    TaskScheduler* scheduler;       // Scheduler of the current waiters
+    std::vector<TaskId> waiters;
+
+public:
+    TaskEvent();
+    ~TaskEvent(); // Waiting tasks stay suspended until cancelled
+    TaskEvent(const TaskEvent&) = delete;
+    TaskEvent& operator=(const TaskEvent&) = delete;
+
+    void signal(); // Wakes all current waiters; tasks waiting later need the next signal
+    size_t getWaiterCount() const { return waiters.size(); }
+};
+
+/**
+ * TaskScheduler - Parks tasks on the frame, the TimerWheel or events
+ */
+class TaskScheduler {
+private:
+    enum class TaskState : uint8_t {
+        Free,
+        Ready,          // In the ready list
+        Running,
+        WaitingTimer,
+        WaitingEvent
+    };
+
+    struct TaskSlot {
+        std::unique_ptr<Task> task;
+        uint32_t generation;
+        TaskState state;
+        bool cancelRequested;   // Cancelled from inside its own resume()
+        TimerId timer;
+        TaskEvent* event;
+    };
+
+    TimerWheel* timers;
+    std::vector<TaskSlot> slots;
+    std::vector<uint32_t> freeSlots;
+    std::vector<TaskId> ready;      // Resumed by the next update()
+    std::vector<TaskId> resuming;   // Scratch for the batch being resumed
+    size_t taskCount;
+
+public:
+    explicit TaskScheduler(TimerWheel& timerWheel);
+    ~TaskScheduler();
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    // Game scheduler, driven by the game TimerWheel
+    static TaskScheduler& getInstance();
+
+    // Tasks are queued and first resumed by the next update()
+    TaskId start(std::unique_ptr<Task> task);
+    TaskId start(std::function<TaskWait()> body);
+    bool cancel(TaskId id);
+    bool isRunning(TaskId id) const;
+
+    // Resumes every task woken since the last update (frame waits, expired timers, events)
+    void update();
+    void clear(); // Destroys every task without resuming it
+
+    // Status
+    size_t getTaskCount() const { return taskCount; }
+    size_t getReadyCount() const { return ready.size(); }
+
+private:
+    friend class TaskEvent;
+    void wake(TaskId id);
+    void detachEvent(TaskId id);
+    void run(TaskId id);
+    void park(TaskId id, const TaskWait& wait);
+    void release(uint32_t index);
+    int32_t findSlot(TaskId id) const;
+};
+
+} // namespace Engine
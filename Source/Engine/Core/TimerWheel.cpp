@@ -0,0 +1,278 @@
+/**
+ * TimerWheel.cpp - Implementation of the Hierarchical Timing Wheel
+ */
+
+#include "TimerWheel.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Engine {
+
+namespace {
+
+const int16_t NODE_FREE = -1;
+const int16_t NODE_FIRING = -2;            // Detached from its slot, callback about to run
+const double TICK_EPSILON = 1e-9;          // Keeps 0.999999-tick rounding noise from shifting due ticks
+const uint64_t SLOT_MASK = TimerWheel::SLOTS_PER_LEVEL - 1;
+const uint64_t MAX_DELAY_TICKS = (1ull << (TimerWheel::LEVEL_BITS * TimerWheel::LEVEL_COUNT)) - 1;
+
+int lowestSetBit(uint64_t value) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, value);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctzll(value);
+#endif
+}
+
+} // namespace
+
+const int TimerWheel::LEVEL_BITS;
+const int TimerWheel::SLOTS_PER_LEVEL;
+const int TimerWheel::LEVEL_COUNT;
+const TimerId TimerWheel::INVALID_TIMER;
+
+TimerWheel::TimerWheel(double resolutionSeconds)
+    : tickSeconds(resolutionSeconds > 0.0 ? resolutionSeconds : 0.001),
+      currentTime(0.0), currentTick(0), pendingCount(0) {
+    for (int level = 0; level < LEVEL_COUNT; level++) {
+        std::fill(slotHeads[level], slotHeads[level] + SLOTS_PER_LEVEL, -1);
+        occupied[level] = 0;
+    }
+}
+
+TimerWheel& TimerWheel::getInstance() {
+    static TimerWheel instance;
+    return instance;
+}
+
+TimerId TimerWheel::schedule(float delaySeconds, std::function<void()> callback) {
+    if (!callback) return INVALID_TIMER;
+
+    int32_t index;
+    if (!freeNodes.empty()) {
+        index = freeNodes.back();
+        freeNodes.pop_back();
+    } else {
+        index = static_cast<int32_t>(nodes.size());
+        nodes.push_back(TimerNode());
+        nodes[index].generation = 1;
+    }
+
+    // Due on the first tick at or after now + delay, never in the already processed past
+    double dueTime = currentTime + std::max(0.0f, delaySeconds);
+    uint64_t dueTick = static_cast<uint64_t>(std::ceil(dueTime / tickSeconds - TICK_EPSILON));
+    dueTick = std::max(dueTick, currentTick);
+    dueTick = std::min(dueTick, currentTick + MAX_DELAY_TICKS);
+
+    TimerNode& node = nodes[index];
+    node.dueTick = dueTick;
+    node.callback = std::move(callback);
+    insert(index);
+    pendingCount++;
+
+    return (static_cast<TimerId>(node.generation) << 32) | static_cast<TimerId>(index + 1);
+}
+
+bool TimerWheel::cancel(TimerId id) {
+    int32_t index = findNode(id);
+    if (index < 0) return false;
+
+    TimerNode& node = nodes[index];
+    if (node.level >= 0) {
+        unlink(index); // Firing nodes are already detached from their slot
+    }
+    node.level = NODE_FREE;
+    node.callback = nullptr;
+    node.generation++;
+    freeNodes.push_back(index);
+    pendingCount--;
+    return true;
+}
+
+TimerId TimerWheel::reschedule(TimerId id, float delaySeconds, std::function<void()> callback) {
+    cancel(id);
+    return schedule(delaySeconds, std::move(callback));
+}
+
+bool TimerWheel::isPending(TimerId id) const {
+    return findNode(id) >= 0;
+}
+
+float TimerWheel::getRemaining(TimerId id) const {
+    int32_t index = findNode(id);
+    if (index < 0) return 0.0f;
+    double remaining = static_cast<double>(nodes[index].dueTick) * tickSeconds - currentTime;
+    return static_cast<float>(std::max(0.0, remaining));
+}
+
+void TimerWheel::advance(float deltaSeconds) {
+    if (deltaSeconds > 0.0f) {
+        currentTime += deltaSeconds;
+    }
+    uint64_t targetTick = static_cast<uint64_t>(std::floor(currentTime / tickSeconds + TICK_EPSILON));
+
+    while (currentTick <= targetTick) {
+        if (pendingCount == 0) {
+            currentTick = targetTick + 1;
+            break;
+        }
+
+        // Jump straight to the next tick that fires or cascades something
+        uint64_t tick = nextEventTick(targetTick);
+        if (tick > targetTick) {
+            currentTick = targetTick + 1;
+            break;
+        }
+        currentTick = tick;
+
+        // Refill lower levels from the top down when a block boundary is crossed
+        for (int level = LEVEL_COUNT - 1; level > 0; level--) {
+            if ((tick & ((1ull << (LEVEL_BITS * level)) - 1)) == 0) {
+                cascade(level);
+            }
+        }
+        fireSlot(static_cast<int>(tick & SLOT_MASK));
+    }
+}
+
+void TimerWheel::clear() {
+    for (size_t i = 0; i < nodes.size(); i++) {
+        if (nodes[i].level == NODE_FREE) continue;
+        nodes[i].level = NODE_FREE;
+        nodes[i].callback = nullptr;
+        nodes[i].generation++;
+        freeNodes.push_back(static_cast<int32_t>(i));
+    }
+    for (int level = 0; level < LEVEL_COUNT; level++) {
+        std::fill(slotHeads[level], slotHeads[level] + SLOTS_PER_LEVEL, -1);
+        occupied[level] = 0;
+    }
+    pendingCount = 0;
+}
+
+void TimerWheel::insert(int32_t index) {
+    TimerNode& node = nodes[index];
+
+    // Lowest level whose current block (relative to the next tick to process) contains the due tick
+    int level = 0;
+    while (level < LEVEL_COUNT - 1 &&
+           (node.dueTick >> (LEVEL_BITS * (level + 1))) != (currentTick >> (LEVEL_BITS * (level + 1)))) {
+        level++;
+    }
+    int slot = static_cast<int>((node.dueTick >> (LEVEL_BITS * level)) & SLOT_MASK);
+
+    node.level = static_cast<int16_t>(level);
+    node.slot = static_cast<int16_t>(slot);
+    node.previous = -1;
+    node.next = slotHeads[level][slot];
+    if (node.next >= 0) {
+        nodes[node.next].previous = index;
+    }
+    slotHeads[level][slot] = index;
+    occupied[level] |= (1ull << slot);
+}
+
+void TimerWheel::unlink(int32_t index) {
+    TimerNode& node = nodes[index];
+    if (node.previous >= 0) {
+        nodes[node.previous].next = node.next;
+    } else {
+        slotHeads[node.level][node.slot] = node.next;
+        if (node.next < 0) {
+            occupied[node.level] &= ~(1ull << node.slot);
+        }
+    }
+    if (node.next >= 0) {
+        nodes[node.next].previous = node.previous;
+    }
+    node.previous = -1;
+    node.next = -1;
+}
+
+void TimerWheel::cascade(int level) {
+    int slot = static_cast<int>((currentTick >> (LEVEL_BITS * level)) & SLOT_MASK);
+    int32_t index = slotHeads[level][slot];
+    if (index < 0) return;
+
+    slotHeads[level][slot] = -1;
+    occupied[level] &= ~(1ull << slot);
+
+    // Re-insert relative to the current tick; everything lands on a lower level
+    while (index >= 0) {
+        int32_t next = nodes[index].next;
+        insert(index);
+        index = next;
+    }
+}
+
+void TimerWheel::fireSlot(int slot) {
+    int32_t index = slotHeads[0][slot];
+    slotHeads[0][slot] = -1;
+    occupied[0] &= ~(1ull << slot);
+
+    // Detach the whole slot first so callbacks can cancel timers due on the same tick
+    firingNodes.clear();
+    while (index >= 0) {
+        TimerNode& node = nodes[index];
+        firingNodes.push_back(index);
+        node.level = NODE_FIRING;
+        node.previous = -1;
+        index = node.next;
+        node.next = -1;
+    }
+
+    // Callbacks see this tick as processed, so timers they schedule land in the future
+    currentTick++;
+
+    for (size_t i = 0; i < firingNodes.size(); i++) {
+        int32_t firingIndex = firingNodes[i];
+        TimerNode& node = nodes[firingIndex];
+        if (node.level != NODE_FIRING) continue; // Cancelled by an earlier callback
+
+        std::function<void()> callback = std::move(node.callback);
+        node.callback = nullptr;
+        node.level = NODE_FREE;
+        node.generation++;
+        freeNodes.push_back(firingIndex);
+        pendingCount--;
+
+        callback();
+    }
+}
+
+int32_t TimerWheel::findNode(TimerId id) const {
+    if (id == INVALID_TIMER) return -1;
+    uint64_t slotIndex = (id & 0xFFFFFFFFull) - 1;
+    uint32_t generation = static_cast<uint32_t>(id >> 32);
+    if (slotIndex >= nodes.size()) return -1;
+
+    const TimerNode& node = nodes[slotIndex];
+    if (node.generation != generation || node.level == NODE_FREE) return -1;
+    return static_cast<int32_t>(slotIndex);
+}
+
+uint64_t TimerWheel::nextEventTick(uint64_t limit) const {
+    bool higherLevelsOccupied = false;
+    for (int level = 1; level < LEVEL_COUNT; level++) {
+        higherLevelsOccupied = higherLevelsOccupied || occupied[level] != 0;
+    }
+
+    // An unprocessed block start may still have to cascade timers into this block
+    uint64_t blockStart = currentTick & ~SLOT_MASK;
+    if (higherLevelsOccupied && currentTick == blockStart) {
+        return currentTick;
+    }
+
+    // Level 0 slots at or after the current tick within this block
+    uint64_t ahead = occupied[0] & (~0ull << (currentTick & SLOT_MASK));
+    if (ahead) {
+        return blockStart + static_cast<uint64_t>(lowestSetBit(ahead));
+    }
+
+    // Otherwise the next block boundary, if a higher level has anything to cascade
+    return higherLevelsOccupied ? blockStart + SLOTS_PER_LEVEL : limit + 1;
+}
+
+} // namespace Engine
@@ -0,0 +1,103 @@
+/**
+ * TimerWheel.h - Hierarchical Timing Wheel for Gameplay Timers
+ *
+ * OVERVIEW:
+ * Replaces per-object countdown fields (reload, damage flash, deletion
+ * delay, ...) that were decremented every frame whether anything was about
+ * to happen or not. A timer is scheduled once with a delay and a callback;
+ * the wheel fires the callback on the first advance() at or after its due
+ * time. Objects with no pending timer cost nothing per frame.
+ *
+ * FEATURES:
+ * - 4 levels x 64 slots at 1 ms resolution (covers ~4.6 hours; longer
+ *   delays are clamped)
+ * - O(1) schedule and cancel: timers are nodes in intrusive per-slot lists
+ * - Lower levels are refilled from higher ones when their slot comes due
+ *   (cascading), so every timer is touched at most once per level
+ * - advance() skips runs of empty slots using per-level occupancy masks
+ * - Generation-checked TimerIds: cancelling a fired or stale timer is a no-op
+ * - Callbacks may schedule or cancel timers (including their own)
+ * - getTime() gives the accumulated game time for timestamp-style cooldowns
+ * - GL-free: part of ww3_core
+ *
+ * THREADING:
+ * Not thread-safe. The game instance is advanced by Game::update and must only
+ * be used from the thread running the simulation.
+ */
+
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace Engine {
+
+/**
+ * TimerId - Handle to a scheduled timer (0 = no timer)
+ */
+typedef uint64_t TimerId;
+
+/**
+ * TimerWheel - Hierarchical timing wheel driven by game time
+ */
+class TimerWheel {
+public:
+    static const int LEVEL_BITS = 6;
+    static const int SLOTS_PER_LEVEL = 1 << LEVEL_BITS;
+    static const int LEVEL_COUNT = 4;
+    static const TimerId INVALID_TIMER = 0;
+
+private:
+    struct TimerNode {
+        uint64_t dueTick;
+        std::function<void()> callback;
+        int32_t previous;   // Neighbours in the slot list (-1 = none)
+        int32_t next;
+        int16_t level;      // -1 while free or firing
+        int16_t slot;
+        uint32_t generation;
+    };
+
+    std::vector<TimerNode> nodes;
+    std::vector<int32_t> freeNodes;
+    int32_t slotHeads[LEVEL_COUNT][SLOTS_PER_LEVEL];
+    uint64_t occupied[LEVEL_COUNT];  // Bit per non-empty slot
+    std::vector<int32_t> firingNodes; // Scratch for the slot being fired
+
+    double tickSeconds;
+    double currentTime;    // Accumulated game time in seconds
+    uint64_t currentTick;  // Every tick < currentTick has been processed
+    size_t pendingCount;
+
+public:
+    explicit TimerWheel(double resolutionSeconds = 0.001);
+
+    // Game timer wheel, advanced once per simulation update
+    static TimerWheel& getInstance();
+
+    // Scheduling
+    TimerId schedule(float delaySeconds, std::function<void()> callback);
+    bool cancel(TimerId id); // False if the timer already fired or was cancelled
+    TimerId reschedule(TimerId id, float delaySeconds, std::function<void()> callback); // Cancel + schedule
+    bool isPending(TimerId id) const;
+    float getRemaining(TimerId id) const; // Seconds until due, 0 if not pending
+
+    // Time
+    void advance(float deltaSeconds); // Fires every timer that came due, in due order per tick
+    double getTime() const { return currentTime; }
+    void clear(); // Drops every pending timer without firing it
+
+    // Status
+    size_t getPendingCount() const { return pendingCount; }
+    double getResolution() const { return tickSeconds; }
+
+private:
+    void insert(int32_t index);
+    void unlink(int32_t index);
+    void cascade(int level);
+    void fireSlot(int slot);
+    int32_t findNode(TimerId id) const;
+    uint64_t nextEventTick(uint64_t limit) const;
+};
+
+} // namespace Engine
@@ -7,18 +7,15 @@
 
 #include "Input.h"
 #include <iostream>
-#include <cstring>
 
 namespace Engine {
 
 // Static instance for singleton pattern
 Input* Input::instance = nullptr;
 
-Input::Input() : lastX(300), lastY(300), firstMouse(true), mouseSensitivity(0.002f), camera(nullptr) {
-    // Initialize all keys to false
-    memset(keys, false, sizeof(keys));
-    // Initialize all mouse buttons to false
-    memset(mouseButtons, false, sizeof(mouseButtons));
+Input::Input() : events(EVENT_QUEUE_CAPACITY), droppedEvents(0),
+                 mouseSensitivity(0.002f), lateLatchEnabled(true), window(nullptr), camera(nullptr) {
+    bindDefaultActions();
 }
 
 Input& Input::getInstance() {
@@ -33,7 +30,8 @@ void Input::cleanup() {
     instance = nullptr;
 }
 
-void Input::initialize(GLFWwindow* window, Camera* cam) {
+void Input::initialize(GLFWwindow* inputWindow, Camera* cam) {
+    window = inputWindow;
     camera = cam;
     
     // Set GLFW callbacks
@@ -41,13 +39,47 @@ void Input::initialize(GLFWwindow* window, Camera* cam) {
     glfwSetMouseButtonCallback(window, mouseButtonCallback);
     glfwSetCursorPosCallback(window, mouseCallback);
     glfwSetScrollCallback(window, scrollCallback);
+    glfwSetWindowFocusCallback(window, focusCallback);
     
     // Capture mouse cursor for FPS controls
     glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
 }
 
+void Input::bindDefaultActions() {
+    actionMap.clearAll();
+    actionMap.bind(InputAction::MoveForward, InputBinding::key(GLFW_KEY_W));
+    actionMap.bind(InputAction::MoveBack, InputBinding::key(GLFW_KEY_S));
+    actionMap.bind(InputAction::StrafeLeft, InputBinding::key(GLFW_KEY_A));
+    actionMap.bind(InputAction::StrafeRight, InputBinding::key(GLFW_KEY_D));
+    actionMap.bind(InputAction::MoveUp, InputBinding::key(GLFW_KEY_SPACE));
+    actionMap.bind(InputAction::MoveDown, InputBinding::key(GLFW_KEY_LEFT_SHIFT));
+    actionMap.bind(InputAction::Fire, InputBinding::mouseButton(GLFW_MOUSE_BUTTON_LEFT));
+    actionMap.bind(InputAction::FireSingle, InputBinding::mouseButton(GLFW_MOUSE_BUTTON_RIGHT));
+    actionMap.bind(InputAction::HunterShot, InputBinding::mouseButton(GLFW_MOUSE_BUTTON_MIDDLE));
+    actionMap.bind(InputAction::HunterShot, InputBinding::key(GLFW_KEY_H));
+    actionMap.bind(InputAction::Reload, InputBinding::key(GLFW_KEY_R));
+    actionMap.bind(InputAction::Weapon1, InputBinding::key(GLFW_KEY_1));
+    actionMap.bind(InputAction::Weapon2, InputBinding::key(GLFW_KEY_2));
+    actionMap.bind(InputAction::Weapon3, InputBinding::key(GLFW_KEY_3));
+    actionMap.bind(InputAction::Weapon4, InputBinding::key(GLFW_KEY_4));
+    actionMap.bind(InputAction::Weapon5, InputBinding::key(GLFW_KEY_5));
+    actionMap.bind(InputAction::QuickSave, InputBinding::key(GLFW_KEY_F5));
+    actionMap.bind(InputAction::QuickLoad, InputBinding::key(GLFW_KEY_F8));
+    actionMap.bind(InputAction::ToggleDepthPrepass, InputBinding::key(GLFW_KEY_F3));
+}
+
+void Input::beginTick(double now) {
+    tracker.beginTick();
+    InputEvent event;
+    while (events.pop(event)) {
+        tracker.addEvent(event, actionMap);
+    }
+    tracker.endTick(now, actionMap);
+}
+
 void Input::processInput(float deltaTime) {
     if (!camera) return;
+    const InputSnapshot& snapshot = tracker.getSnapshot();
     
     // Reduced movement speed for more controlled camera movement
     float speed = 5.0f;
@@ -55,46 +87,54 @@ void Input::processInput(float deltaTime) {
     speed *= deltaTime;
     
     // WASD movement
-    if (keys[GLFW_KEY_W]) {
+    if (snapshot.isHeld(InputAction::MoveForward)) {
         camera->moveForward(speed);
     }
-    if (keys[GLFW_KEY_S]) {
+    if (snapshot.isHeld(InputAction::MoveBack)) {
         camera->moveBackward(speed);
     }
-    if (keys[GLFW_KEY_A]) {
+    if (snapshot.isHeld(InputAction::StrafeLeft)) {
         camera->strafeLeft(speed);
     }
-    if (keys[GLFW_KEY_D]) {
+    if (snapshot.isHeld(InputAction::StrafeRight)) {
         camera->strafeRight(speed);
     }
     
     // Vertical movement
-    if (keys[GLFW_KEY_SPACE]) {
+    if (snapshot.isHeld(InputAction::MoveUp)) {
         camera->moveUp(speed);
     }
-    if (keys[GLFW_KEY_LEFT_SHIFT]) {
+    if (snapshot.isHeld(InputAction::MoveDown)) {
         camera->moveDown(speed);
     }
 }
 
-bool Input::isKeyPressed(int key) const {
-    if (key >= 0 && key < 1024) {
-        return keys[key];
+void Input::processMouseLook() {
+    if (!camera) return;
+    const InputSnapshot& snapshot = tracker.getSnapshot();
+    
+    // Cursor movement of the tick; y goes down in window coordinates
+    double xoffset = snapshot.getCursorDeltaX();
+    double yoffset = -snapshot.getCursorDeltaY();
+    if (xoffset != 0.0 || yoffset != 0.0) {
+        camera->rotate(static_cast<float>(xoffset) * mouseSensitivity, static_cast<float>(yoffset) * mouseSensitivity);
     }
-    return false;
 }
 
-bool Input::isMouseButtonPressed(int button) const {
-    if (button >= 0 && button < 8) {
-        return mouseButtons[button];
+void Input::pushEvent(const InputEvent& event) {
+    // Full only when the simulation has stalled for seconds; later events are lost
+    if (!events.push(event) && droppedEvents++ == 0) {
+        std::cerr << "Input: event queue full, dropping input events" << std::endl;
     }
-    return false;
 }
 
-void Input::resetMousePosition(float x, float y) {
-    lastX = x;
-    lastY = y;
-    firstMouse = true;
+bool Input::sampleCursor(double& x, double& y) const {
+    if (!lateLatchEnabled || !window) return false;
+    
+    // Only read the position; pumping events here would run window callbacks mid-frame.
+    // The simulation still gets this movement from the cursor callback of the next poll.
+    glfwGetCursorPos(window, &x, &y);
+    return true;
 }
 
 // Static callback functions
@@ -102,12 +142,9 @@ void Input::resetMousePosition(float x, float y) {
 void Input::keyCallback(GLFWwindow* window, int key, int scancode, int action, int mode) {
     Input& input = getInstance();
     
-    if (key >= 0 && key < 1024) {
-        if (action == GLFW_PRESS) {
-            input.keys[key] = true;
-        } else if (action == GLFW_RELEASE) {
-            input.keys[key] = false;
-        }
+    // Key repeats carry no new state
+    if (action == GLFW_PRESS || action == GLFW_RELEASE) {
+        input.pushEvent(InputEvent::key(key, action == GLFW_PRESS, glfwGetTime()));
     }
     
     // Handle escape key to close window
@@ -126,35 +163,14 @@ void Input::keyCallback(GLFWwindow* window, int key, int scancode, int action, i
 void Input::mouseButtonCallback(GLFWwindow* window, int button, int action, int mods) {
     Input& input = getInstance();
     
-    if (button >= 0 && button < 8) {
-        if (action == GLFW_PRESS) {
-            input.mouseButtons[button] = true;
-        } else if (action == GLFW_RELEASE) {
-            input.mouseButtons[button] = false;
-        }
+    if (action == GLFW_PRESS || action == GLFW_RELEASE) {
+        input.pushEvent(InputEvent::mouseButton(button, action == GLFW_PRESS, glfwGetTime()));
     }
 }
 
 void Input::mouseCallback(GLFWwindow* window, double xpos, double ypos) {
-    Input& input = getInstance();
-    
-    if (input.firstMouse) {
-        input.lastX = static_cast<float>(xpos);
-        input.lastY = static_cast<float>(ypos);
-        input.firstMouse = false;
-    }
-
-    float xoffset = static_cast<float>(xpos - input.lastX);
-    float yoffset = static_cast<float>(input.lastY - ypos); // Reversed since y-coordinates go from bottom to top
-    input.lastX = static_cast<float>(xpos);
-    input.lastY = static_cast<float>(ypos);
-
-    xoffset *= input.mouseSensitivity;
-    yoffset *= input.mouseSensitivity;
-
-    if (input.camera) {
-        input.camera->rotate(xoffset, yoffset);
-    }
+    // The simulation turns the camera; the render thread late-latches on top of it
+    getInstance().pushEvent(InputEvent::cursor(xpos, ypos, glfwGetTime()));
 }
 
 void Input::scrollCallback(GLFWwindow* window, double xoffset, double yoffset) {
@@ -162,4 +178,11 @@ void Input::scrollCallback(GLFWwindow* window, double xoffset, double yoffset) {
     // Could be used for weapon switching or other FPS mechanics in the future
 }
 
+void Input::focusCallback(GLFWwindow* window, int focused) {
+    // Keys released while another window has focus are never reported; release everything now
+    if (!focused) {
+        getInstance().pushEvent(InputEvent::focusLost(glfwGetTime()));
+    }
+}
+
 } // namespace Engine
\ No newline at end of file
@@ -6,10 +6,16 @@
  * Provides clean interface for input polling and event handling.
  * 
  * FEATURES:
- * - Keyboard state management
- * - Mouse movement tracking
+ * - Event queue: callbacks push timestamped events into a lock-free queue,
+ *   the simulation drains it once per tick (beginTick) into an InputSnapshot,
+ *   so GLFW polling and the simulation can run on different threads
+ * - Action bindings ("fire", "reload", ...) with a default layout
+ * - Mouse movement tracking: cursor events go through the queue like keys,
+ *   the simulation turns its camera by the snapshot's cursor movement
  * - First-person camera controls
- * - Extensible input system
+ * - Late latching: the render thread samples the cursor right before the
+ *   camera-dependent passes and turns its own view by the movement since
+ *   the position the simulated tick ended at (no events are processed)
  */
 
 #pragma once
@@ -18,6 +24,9 @@
 #include <glfw3.h>
 #include <functional>
 #include "../Math/Camera.h"
+#include "../Core/SpscQueue.h"
+#include "InputActions.h"
+#include "InputSnapshot.h"
 
 namespace Engine {
 
@@ -34,14 +43,22 @@ class Input {
 private:
     static Input* instance;
     
-    // Input state
-    bool keys[1024];
-    bool mouseButtons[8]; // Support for up to 8 mouse buttons
-    float lastX, lastY;
-    bool firstMouse;
-    float mouseSensitivity;
+    static const size_t EVENT_QUEUE_CAPACITY = 4096; // Several seconds of a 1000 Hz mouse
     
-    // Camera reference for movement
+    // Producer side: GLFW callbacks on the thread that polls events
+    SpscQueue<InputEvent> events;
+    size_t droppedEvents;
+    
+    // Consumer side: the simulation tick
+    InputActionMap actionMap;
+    InputTracker tracker;
+    
+    // Mouse look
+    float mouseSensitivity;       // Radians per window pixel
+    bool lateLatchEnabled;
+    
+    // Window and camera references
+    GLFWwindow* window;
     Camera* camera;
     
     // Fullscreen toggle callback
@@ -58,8 +75,15 @@ public:
     // Initialization
     void initialize(GLFWwindow* window, Camera* cam);
     
-    // Input processing
-    void processInput(float deltaTime);
+    // Input processing (simulation thread): beginTick drains the queued events
+    // into the snapshot the rest of the tick reads
+    void beginTick(double now);
+    const InputSnapshot& getSnapshot() const { return tracker.getSnapshot(); }
+    bool getTickCursorPosition(double& x, double& y) const { return tracker.getCursorPosition(x, y); } // Late latch baseline
+    InputActionMap& getActionMap() { return actionMap; }
+    void bindDefaultActions();
+    void processInput(float deltaTime); // Camera movement keys
+    void processMouseLook();            // Turns the camera by the tick's cursor movement
     void setCamera(Camera* cam) { camera = cam; }
     
     // Callback setters
@@ -70,17 +94,20 @@ public:
     static void mouseButtonCallback(GLFWwindow* window, int button, int action, int mods);
     static void mouseCallback(GLFWwindow* window, double xpos, double ypos);
     static void scrollCallback(GLFWwindow* window, double xoffset, double yoffset);
+    static void focusCallback(GLFWwindow* window, int focused);
     
     // Settings
     void setMouseSensitivity(float sensitivity) { mouseSensitivity = sensitivity; }
     float getMouseSensitivity() const { return mouseSensitivity; }
     
-    // Key state queries
-    bool isKeyPressed(int key) const;
-    bool isMouseButtonPressed(int button) const;
+    // Late latching (render thread): the cursor position GLFW reports right now; false when
+    // disabled or there is no window. Only reads the position, never processes events.
+    bool sampleCursor(double& x, double& y) const;
+    void setLateLatchEnabled(bool enabled) { lateLatchEnabled = enabled; }
+    bool isLateLatchEnabled() const { return lateLatchEnabled; }
     
-    // Mouse state
-    void resetMousePosition(float x, float y);
+private:
+    void pushEvent(const InputEvent& event);
 };
 
 } // namespace Engine
\ No newline at end of file
@@ -0,0 +1,89 @@
+/**
+ * InputActions.cpp - Implementation of Named Game Actions and Their Bindings
+ */
+
+#include "InputActions.h"
+#include <algorithm>
+
+namespace Engine {
+
+namespace {
+
+const char* const ACTION_NAMES[INPUT_ACTION_COUNT] = {
+    "move_forward",
+    "move_back",
+    "strafe_left",
+    "strafe_right",
+    "move_up",
+    "move_down",
+    "fire",
+    "fire_single",
+    "hunter_shot",
+    "reload",
+    "weapon_1",
+    "weapon_2",
+    "weapon_3",
+    "weapon_4",
+    "weapon_5",
+    "quick_save",
+    "quick_load",
+    "toggle_depth_prepass"
+};
+
+} // namespace
+
+void InputActionMap::bind(InputAction action, const InputBinding& binding) {
+    if (!isBoundTo(action, binding)) {
+        bindings[static_cast<int>(action)].push_back(binding);
+    }
+}
+
+void InputActionMap::unbind(InputAction action, const InputBinding& binding) {
+    std::vector<InputBinding>& list = bindings[static_cast<int>(action)];
+    list.erase(std::remove(list.begin(), list.end(), binding), list.end());
+}
+
+void InputActionMap::clear(InputAction action) {
+    bindings[static_cast<int>(action)].clear();
+}
+
+void InputActionMap::clearAll() {
+    for (std::vector<InputBinding>& list : bindings) {
+        list.clear();
+    }
+}
+
+bool InputActionMap::bind(const std::string& actionName, const InputBinding& binding) {
+    InputAction action;
+    if (!findAction(actionName, action)) {
+        return false;
+    }
+    bind(action, binding);
+    return true;
+}
+
+const std::vector<InputBinding>& InputActionMap::getBindings(InputAction action) const {
+    return bindings[static_cast<int>(action)];
+}
+
+bool InputActionMap::isBoundTo(InputAction action, const InputBinding& binding) const {
+    const std::vector<InputBinding>& list = bindings[static_cast<int>(action)];
+    return std::find(list.begin(), list.end(), binding) != list.end();
+}
+
+const char* InputActionMap::getActionName(InputAction action) {
+    int index = static_cast<int>(action);
+    return index >= 0 && index < INPUT_ACTION_COUNT ? ACTION_NAMES[index] : "";
+}
+
+bool InputActionMap::findAction(const std::string& name, InputAction& action) {
+    for (int i = 0; i < INPUT_ACTION_COUNT; i++) {
+        if (name == ACTION_NAMES[i]) {
+            action = static_cast<InputAction>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace Engine
@@ -0,0 +1,97 @@
+/**
+ * InputActions.h - Named Game Actions and Their Bindings
+ *
+ * OVERVIEW:
+ * Gameplay code asks about actions ("fire", "reload") instead of physical
+ * keys, so controls can be rebound without touching the code that reacts
+ * to them. An action can have several bindings on the keyboard and the
+ * mouse; it is held while any of them is held.
+ *
+ * FEATURES:
+ * - Fixed action set (enum) with stable lower-case names for config files
+ * - Any number of bindings per action, keyboard and mouse mixed
+ * - GL-free: bindings store raw key/button codes (GLFW values); Input
+ *   installs the default layout
+ *
+ * USAGE:
+ *   InputActionMap& actions = Input::getInstance().getActionMap();
+ *   actions.clear(InputAction::Reload);
+ *   actions.bind("reload", InputBinding::key(GLFW_KEY_T));
+ */
+
+#pragma once
+#include <string>
+#include <vector>
+
+namespace Engine {
+
+/**
+ * InputAction - Everything the game reacts to
+ */
+enum class InputAction {
+    MoveForward = 0,
+    MoveBack,
+    StrafeLeft,
+    StrafeRight,
+    MoveUp,
+    MoveDown,
+    Fire,
+    FireSingle,
+    HunterShot,
+    Reload,
+    Weapon1,
+    Weapon2,
+    Weapon3,
+    Weapon4,
+    Weapon5,
+    QuickSave,
+    QuickLoad,
+    ToggleDepthPrepass,
+    Count
+};
+
+const int INPUT_ACTION_COUNT = static_cast<int>(InputAction::Count);
+
+enum class InputDevice {
+    Keyboard,
+    Mouse
+};
+
+/**
+ * InputBinding - One physical key or mouse button
+ */
+struct InputBinding {
+    InputDevice device;
+    int code;   // GLFW key or mouse button code
+
+    static InputBinding key(int code) { return { InputDevice::Keyboard, code }; }
+    static InputBinding mouseButton(int code) { return { InputDevice::Mouse, code }; }
+
+    bool operator==(const InputBinding& other) const { return device == other.device && code == other.code; }
+};
+
+/**
+ * InputActionMap - Bindings of every action
+ */
+class InputActionMap {
+private:
+    std::vector<InputBinding> bindings[INPUT_ACTION_COUNT];
+
+public:
+    // Adding a binding the action already has is a no-op
+    void bind(InputAction action, const InputBinding& binding);
+    void unbind(InputAction action, const InputBinding& binding);
+    void clear(InputAction action);
+    void clearAll();
+
+    // By name (see getActionName); false for an unknown action
+    bool bind(const std::string& actionName, const InputBinding& binding);
+
+    const std::vector<InputBinding>& getBindings(InputAction action) const;
+    bool isBoundTo(InputAction action, const InputBinding& binding) const;
+
+    static const char* getActionName(InputAction action);
+    static bool findAction(const std::string& name, InputAction& action);
+};
+
+} // namespace Engine
@@ -0,0 +1,117 @@
+/**
+ * InputSnapshot.cpp - Implementation of Per-Tick Input Snapshots
+ */
+
+#include "InputSnapshot.h"
+#include <algorithm>
+
+namespace Engine {
+
+// ===== InputSnapshot =====
+
+InputSnapshot::InputSnapshot()
+    : startTime(0.0), endTime(0.0), cursorDeltaX(0.0), cursorDeltaY(0.0), tick(0), eventCount(0) {
+    std::fill(pressTimes, pressTimes + INPUT_ACTION_COUNT, 0.0);
+}
+
+float InputSnapshot::getTickFraction(double time) const {
+    double duration = endTime - startTime;
+    if (duration <= 0.0) return 1.0f;
+    double fraction = (time - startTime) / duration;
+    return static_cast<float>(std::max(0.0, std::min(1.0, fraction)));
+}
+
+// ===== InputTracker =====
+
+InputTracker::InputTracker()
+    : lastCursorX(0.0), lastCursorY(0.0), hasCursorPosition(false), lastEndTime(0.0), tickCount(0) {
+}
+
+void InputTracker::beginTick() {
+    // Held state carries over; edges, timings and movement start empty
+    snapshot.keysPressed.reset();
+    snapshot.keysReleased.reset();
+    snapshot.buttonsPressed.reset();
+    snapshot.buttonsReleased.reset();
+    snapshot.actionsPressed.reset();
+    snapshot.actionsReleased.reset();
+    std::fill(snapshot.pressTimes, snapshot.pressTimes + INPUT_ACTION_COUNT, 0.0);
+    snapshot.cursorDeltaX = 0.0;
+    snapshot.cursorDeltaY = 0.0;
+    snapshot.eventCount = 0;
+    snapshot.startTime = lastEndTime;
+}
+
+void InputTracker::addEvent(const InputEvent& event, const InputActionMap& actions) {
+    snapshot.eventCount++;
+
+    InputBinding binding;
+    if (event.type == InputEvent::Type::CursorMove) {
+        if (hasCursorPosition) {
+            snapshot.cursorDeltaX += event.x - lastCursorX;
+            snapshot.cursorDeltaY += event.y - lastCursorY;
+        }
+        lastCursorX = event.x;
+        lastCursorY = event.y;
+        hasCursorPosition = true;
+        return;
+    } else if (event.type == InputEvent::Type::FocusLost) {
+        releaseAll(event.time, actions);
+        return;
+    } else if (event.type == InputEvent::Type::Key) {
+        if (event.code < 0 || event.code >= INPUT_MAX_KEYS) return;
+        snapshot.keysHeld[event.code] = event.pressed;
+        (event.pressed ? snapshot.keysPressed : snapshot.keysReleased).set(event.code);
+        binding = InputBinding::key(event.code);
+    } else {
+        if (event.code < 0 || event.code >= INPUT_MAX_MOUSE_BUTTONS) return;
+        snapshot.buttonsHeld[event.code] = event.pressed;
+        (event.pressed ? snapshot.buttonsPressed : snapshot.buttonsReleased).set(event.code);
+        binding = InputBinding::mouseButton(event.code);
+    }
+
+    // Edges of any binding are edges of the action: first press, last release
+    for (int i = 0; i < INPUT_ACTION_COUNT; i++) {
+        if (!actions.isBoundTo(static_cast<InputAction>(i), binding)) continue;
+        if (event.pressed) {
+            if (!snapshot.actionsPressed[i]) {
+                snapshot.actionsPressed.set(i);
+                snapshot.pressTimes[i] = event.time;
+            }
+        } else {
+            snapshot.actionsReleased.set(i);
+        }
+    }
+}
+
+void InputTracker::endTick(double now, const InputActionMap& actions) {
+    // Held is evaluated from the bindings at the end of the tick, so rebinding takes effect at once
+    for (int i = 0; i < INPUT_ACTION_COUNT; i++) {
+        bool held = false;
+        for (const InputBinding& binding : actions.getBindings(static_cast<InputAction>(i))) {
+            held = binding.device == InputDevice::Keyboard ? snapshot.isKeyHeld(binding.code)
+                                                           : snapshot.isMouseButtonHeld(binding.code);
+            if (held) break;
+        }
+        snapshot.actionsHeld[i] = held;
+    }
+
+    snapshot.endTime = now;
+    snapshot.tick = ++tickCount;
+    lastEndTime = now;
+}
+
+void InputTracker::releaseAll(double time, const InputActionMap& actions) {
+    // Feed a release of every held key and button through addEvent, so actions get their edges
+    for (int key = 0; key < INPUT_MAX_KEYS; key++) {
+        if (snapshot.keysHeld[key]) addEvent(InputEvent::key(key, false, time), actions);
+    }
+    for (int button = 0; button < INPUT_MAX_MOUSE_BUTTONS; button++) {
+        if (snapshot.buttonsHeld[button]) addEvent(InputEvent::mouseButton(button, false, time), actions);
+    }
+
+    // The cursor may be anywhere when focus returns; its first position is not movement
+    hasCursorPosition = false;
+}
+
+} // namespace Engine
@@ -0,0 +1,139 @@
+/**
+ * InputSnapshot.h - Timestamped Input Events and Per-Tick Input Snapshots
+ *
+ * OVERVIEW:
+ * Window callbacks only record what happened (an InputEvent with the time
+ * it was seen); they no longer write key state that the simulation reads.
+ * Once per simulation tick the queued events are folded into an
+ * InputSnapshot: which keys, buttons and actions are held at the end of
+ * the tick, which were pressed or released during it, and when. The
+ * snapshot is not changed again until the next tick, so every system in
+ * the tick sees the same input and edge detection needs no state of its own.
+ *
+ * FEATURES:
+ * - Pressed/released are edges seen during the tick, so a tap shorter than
+ *   a tick still registers as both pressed and released
+ * - Sub-tick timing: first press time of every action, with getTickFraction()
+ *   placing it inside the interval the snapshot covers (shots are led by the
+ *   time between the click and the end of the tick)
+ * - Accumulated cursor movement of the tick
+ * - Losing window focus releases everything held, so no key or button sticks
+ * - GL-free; InputTracker runs on the consuming (simulation) thread only
+ */
+
+#pragma once
+#include "InputActions.h"
+#include <bitset>
+#include <cstdint>
+
+namespace Engine {
+
+const int INPUT_MAX_KEYS = 1024;
+const int INPUT_MAX_MOUSE_BUTTONS = 8;
+
+/**
+ * InputEvent - One raw event as the window reported it
+ */
+struct InputEvent {
+    enum class Type : uint8_t {
+        Key,
+        MouseButton,
+        CursorMove,
+        FocusLost
+    };
+
+    Type type;
+    bool pressed;       // Key/MouseButton: press or release (repeats are not queued)
+    int code;           // Key/MouseButton: GLFW code
+    double x, y;        // CursorMove: cursor position
+    double time;        // Seconds (glfwGetTime) when the event was received
+
+    static InputEvent key(int code, bool pressed, double time) { return { Type::Key, pressed, code, 0.0, 0.0, time }; }
+    static InputEvent mouseButton(int code, bool pressed, double time) { return { Type::MouseButton, pressed, code, 0.0, 0.0, time }; }
+    static InputEvent cursor(double x, double y, double time) { return { Type::CursorMove, false, 0, x, y, time }; }
+    static InputEvent focusLost(double time) { return { Type::FocusLost, false, 0, 0.0, 0.0, time }; }
+};
+
+/**
+ * InputSnapshot - Input state of one simulation tick (read-only for consumers)
+ */
+class InputSnapshot {
+    friend class InputTracker;
+
+private:
+    std::bitset<INPUT_MAX_KEYS> keysHeld, keysPressed, keysReleased;
+    std::bitset<INPUT_MAX_MOUSE_BUTTONS> buttonsHeld, buttonsPressed, buttonsReleased;
+    std::bitset<INPUT_ACTION_COUNT> actionsHeld, actionsPressed, actionsReleased;
+    double pressTimes[INPUT_ACTION_COUNT];      // First press of the tick
+
+    double startTime, endTime;  // Events in (startTime, endTime] belong to this tick
+    double cursorDeltaX, cursorDeltaY;
+    uint32_t tick;
+    uint32_t eventCount;
+
+public:
+    InputSnapshot();
+
+    // Actions
+    bool isHeld(InputAction action) const { return actionsHeld[static_cast<int>(action)]; }
+    bool wasPressed(InputAction action) const { return actionsPressed[static_cast<int>(action)]; }
+    bool wasReleased(InputAction action) const { return actionsReleased[static_cast<int>(action)]; }
+    double getPressTime(InputAction action) const { return pressTimes[static_cast<int>(action)]; }
+
+    // Raw keys and mouse buttons (GLFW codes; out of range is never held)
+    bool isKeyHeld(int key) const { return key >= 0 && key < INPUT_MAX_KEYS && keysHeld[key]; }
+    bool wasKeyPressed(int key) const { return key >= 0 && key < INPUT_MAX_KEYS && keysPressed[key]; }
+    bool wasKeyReleased(int key) const { return key >= 0 && key < INPUT_MAX_KEYS && keysReleased[key]; }
+    bool isMouseButtonHeld(int button) const { return button >= 0 && button < INPUT_MAX_MOUSE_BUTTONS && buttonsHeld[button]; }
+    bool wasMouseButtonPressed(int button) const { return button >= 0 && button < INPUT_MAX_MOUSE_BUTTONS && buttonsPressed[button]; }
+    bool wasMouseButtonReleased(int button) const { return button >= 0 && button < INPUT_MAX_MOUSE_BUTTONS && buttonsReleased[button]; }
+
+    // Cursor movement during the tick (window pixels, y down)
+    double getCursorDeltaX() const { return cursorDeltaX; }
+    double getCursorDeltaY() const { return cursorDeltaY; }
+
+    // Interval covered and where in it a time falls (0 = start, 1 = end, clamped)
+    double getStartTime() const { return startTime; }
+    double getEndTime() const { return endTime; }
+    float getTickFraction(double time) const;
+
+    uint32_t getTick() const { return tick; }
+    uint32_t getEventCount() const { return eventCount; }
+};
+
+/**
+ * InputTracker - Folds events into consecutive snapshots
+ *
+ * Keeps the held state between ticks; beginTick/addEvent/endTick must be
+ * called from one thread.
+ */
+class InputTracker {
+private:
+    InputSnapshot snapshot;     // Published snapshot between endTick and the next beginTick
+    double lastCursorX, lastCursorY;
+    bool hasCursorPosition;
+    double lastEndTime;
+    uint32_t tickCount;
+
+public:
+    InputTracker();
+
+    void beginTick();
+    void addEvent(const InputEvent& event, const InputActionMap& actions);
+    void endTick(double now, const InputActionMap& actions);
+
+    const InputSnapshot& getSnapshot() const { return snapshot; }
+
+    // Cursor position the last tick ended at; false until one is known (or after focus loss)
+    bool getCursorPosition(double& x, double& y) const {
+        x = lastCursorX;
+        y = lastCursorY;
+        return hasCursorPosition;
+    }
+
+private:
+    // Release everything held (with release edges) and forget the cursor origin; FocusLost events
+    void releaseAll(double time, const InputActionMap& actions);
+};
+
+} // namespace Engine
@@ -13,7 +13,9 @@ namespace Engine {
 
 Camera::Camera() 
     : position(8, 10, 8), lastPosition(8, 10, 8), up(0, 1, 0), yaw(-90.0f * 3.14159f / 180.0f), pitch(0),
-      baseRotation(0.0f, 0.0f, 0.0f), recoilRotation(0.0f, 0.0f, 0.0f), recoilRecoveryRate(5.0f) {
+      baseRotation(0.0f, 0.0f, 0.0f), recoilRotation(0.0f, 0.0f, 0.0f), recoilRecoveryRate(5.0f),
+      fieldOfView(45.0f), aspectRatio(16.0f / 9.0f), nearPlane(0.1f), farPlane(1000.0f), reverseZ(false),
+      projectionDirty(true) {
     updateCameraVectors();
 }
 
@@ -42,15 +44,52 @@ Mat4 Camera::getViewMatrix() const {
     return Engine::lookAt(position, target, up);
 }
 
-Mat4 Camera::getProjectionMatrix() const {
-    // Create a perspective projection matrix
-    // Using typical FPS camera settings
-    float fovy = 45.0f * 3.14159f / 180.0f; // 45 degrees field of view
-    float aspect = 16.0f / 9.0f; // 16:9 aspect ratio
-    float near = 0.1f;
-    float far = 100.0f;
-    
-    return Engine::perspective(fovy, aspect, near, far);
+const Mat4& Camera::getProjectionMatrix() const {
+    // Every world draw asks for the projection; it only changes on resize or zoom
+    if (projectionDirty) {
+        float fovy = fieldOfView * 3.14159f / 180.0f;
+        projection = reverseZ ? Engine::perspectiveReverseZ(fovy, aspectRatio, nearPlane)
+                              : Engine::perspective(fovy, aspectRatio, nearPlane, farPlane);
+        projectionDirty = false;
+    }
+    return projection;
+}
+
+void Camera::setFieldOfView(float degrees) {
+    degrees = std::max(1.0f, std::min(179.0f, degrees));
+    if (degrees != fieldOfView) {
+        fieldOfView = degrees;
+        projectionDirty = true;
+    }
+}
+
+void Camera::setAspectRatio(float aspect) {
+    if (aspect > 0.0f && aspect != aspectRatio) {
+        aspectRatio = aspect;
+        projectionDirty = true;
+    }
+}
+
+void Camera::setAspectRatio(int width, int height) {
+    // Minimized windows report 0x0; keep the last valid aspect
+    if (width > 0 && height > 0) {
+        setAspectRatio(static_cast<float>(width) / static_cast<float>(height));
+    }
+}
+
+void Camera::setClipPlanes(float near, float far) {
+    if (near > 0.0f && far > near && (near != nearPlane || far != farPlane)) {
+        nearPlane = near;
+        farPlane = far;
+        projectionDirty = true;
+    }
+}
+
+void Camera::setReverseZ(bool enabled) {
+    if (enabled != reverseZ) {
+        reverseZ = enabled;
+        projectionDirty = true;
+    }
 }
 
 void Camera::moveForward(float distance) {
@@ -122,6 +161,12 @@ void Camera::rotate(float yawOffset, float pitchOffset) {
     updateCameraVectors();
 }
 
+void Camera::setOrientation(float yawRadians, float pitchRadians) {
+    yaw = yawRadians;
+    pitch = pitchRadians;
+    updateCameraVectors();
+}
+
 void Camera::setRotation(const Vec3& rot) {
     // Convert degrees to radians and set yaw and pitch
     // Note: rot.x = pitch, rot.y = yaw, rot.z = roll (unused for FPS camera)
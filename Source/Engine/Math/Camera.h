@@ -46,6 +46,15 @@ private:
     Vec3 baseRotation;   // Original rotation before recoil
     Vec3 recoilRotation; // Current recoil rotation offset
     float recoilRecoveryRate; // Rate at which camera recoil recovers
+    
+    // Projection (cached: rebuilt only after one of its parameters changes)
+    float fieldOfView;   // Vertical, degrees
+    float aspectRatio;   // Viewport width / height
+    float nearPlane;
+    float farPlane;      // Ignored with reverse-Z (infinite far plane)
+    bool reverseZ;       // [0, 1] clip depth, near -> 1 (needs ReverseZ clip control)
+    mutable Mat4 projection;
+    mutable bool projectionDirty;
 
 public:
     // Constructor
@@ -54,7 +63,7 @@ public:
     // Camera control
     void updateCameraVectors();
     Mat4 getViewMatrix() const;
-    Mat4 getProjectionMatrix() const;
+    const Mat4& getProjectionMatrix() const;
     
     // Movement
     void moveForward(float distance);
@@ -80,8 +89,21 @@ public:
     // Setters
     void setPosition(const Vec3& pos) { position = pos; }
     void setRotation(const Vec3& rot); // Set rotation in degrees (x=pitch, y=yaw, z=roll)
+    void setOrientation(float yawRadians, float pitchRadians); // As getYaw()/getPitch() report them
     void setTopDownView(); // Set camera to true top-down view (pitch=-90°, yaw=0°)
     
+    // Projection
+    void setFieldOfView(float degrees);
+    void setAspectRatio(float aspect);
+    void setAspectRatio(int width, int height);
+    void setClipPlanes(float near, float far);
+    void setReverseZ(bool enabled);
+    float getFieldOfView() const { return fieldOfView; }
+    float getAspectRatio() const { return aspectRatio; }
+    float getNearPlane() const { return nearPlane; }
+    float getFarPlane() const { return farPlane; }
+    bool isReverseZ() const { return reverseZ; }
+    
     // Recoil system
     void updateRecoil(float deltaTime);
     void applyRecoil(const Vec3& recoil);
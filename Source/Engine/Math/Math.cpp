@@ -189,6 +189,20 @@ Mat4 perspective(float fovy, float aspect, float near, float far) {
     return result;
 }
 
+Mat4 perspectiveReverseZ(float fovy, float aspect, float near) {
+    // Limit of the [0, 1] depth projection with near and far swapped as far -> infinity:
+    // z_ndc = near / -z_view, so w-divided depth is 1 at the near plane and 0 at infinity
+    Mat4 result(0.0f);
+    float tanHalfFovy = tan(fovy * 0.5f);
+    
+    result.m[0] = 1.0f / (aspect * tanHalfFovy);
+    result.m[5] = 1.0f / tanHalfFovy;
+    result.m[11] = -1.0f;
+    result.m[14] = near;
+    
+    return result;
+}
+
 Mat4 orthographic(float left, float right, float bottom, float top, float near, float far) {
     Mat4 result;
     
@@ -150,6 +150,7 @@ Mat3 inverse(const Mat3& matrix);
 
 // Transformation matrices
 Mat4 perspective(float fovy, float aspect, float near, float far);
+Mat4 perspectiveReverseZ(float fovy, float aspect, float near); // Infinite far plane, depth 1 at near -> 0 at infinity ([0, 1] clip depth)
 Mat4 orthographic(float left, float right, float bottom, float top, float near, float far);
 Mat4 lookAt(const Vec3& eye, const Vec3& center, const Vec3& up);
 Mat4 translate(const Mat4& matrix, const Vec3& v);
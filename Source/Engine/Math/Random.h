@@ -0,0 +1,93 @@
+/**
+ * Random.h - Stateless Counter-Based Random Numbers
+ *
+ * OVERVIEW:
+ * Every random value in the simulation is a pure function of a key:
+ * (world seed, entity, tick, stream, index). The key is hashed with two
+ * SplitMix64 finalizer rounds, so there is no generator state to share
+ * between threads, to save in snapshots or to advance in the right order.
+ * Two runs with the same world seed draw the same values whatever the
+ * update order or thread count, which is what replays, snapshots and
+ * parallel passes rely on.
+ *
+ * FEATURES:
+ * - randomBits/randomFloat: one value straight from a key
+ * - CounterRandom: a short-lived sequence over the index of one key, for
+ *   code that needs several values per decision (x and z of a target)
+ * - Streams keep unrelated decisions of one entity independent (a stun
+ *   roll never shifts the next patrol target)
+ * - Bit-identical on every platform and compiler (no <random>
+ *   distributions, whose algorithms are implementation-defined)
+ *
+ * USAGE:
+ *   CounterRandom random(worldSeed, monsterId, tick, RandomStream::Spawn);
+ *   float angle = random.nextFloat() * TWO_PI;
+ *   float distance = random.nextRange(2.0f, spawnRadius);
+ */
+
+#pragma once
+#include <cstdint>
+
+namespace Engine {
+
+/**
+ * RandomStream - Independent decision families of one entity
+ */
+enum class RandomStream : uint32_t {
+    Patrol = 1,
+    Stun,
+    Spawn,
+    SpawnType,
+    Recoil,
+    Spread,
+    Terrain
+};
+
+// SplitMix64 output function: a bijective 64-bit mixer
+inline uint64_t splitMix64(uint64_t value) {
+    value += 0x9E3779B97F4A7C15ull;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+    return value ^ (value >> 31);
+}
+
+inline uint64_t randomBits(uint64_t worldSeed, uint32_t entity, uint32_t tick, RandomStream stream, uint32_t index = 0) {
+    uint64_t key = splitMix64(worldSeed ^ ((static_cast<uint64_t>(entity) << 32) | tick));
+    return splitMix64(key ^ ((static_cast<uint64_t>(stream) << 32) | index));
+}
+
+// [0, 1) with 24 bits of precision
+inline float randomFloat(uint64_t worldSeed, uint32_t entity, uint32_t tick, RandomStream stream, uint32_t index = 0) {
+    return static_cast<float>(randomBits(worldSeed, entity, tick, stream, index) >> 40) * (1.0f / 16777216.0f);
+}
+
+/**
+ * CounterRandom - Consecutive indices of one key
+ *
+ * Holds only the key and the next index; it is meant to live for one
+ * decision, not to be stored.
+ */
+class CounterRandom {
+private:
+    uint64_t worldSeed;
+    uint32_t entity;
+    uint32_t tick;
+    RandomStream stream;
+    uint32_t index;
+
+public:
+    CounterRandom(uint64_t worldSeed, uint32_t entity, uint32_t tick, RandomStream stream)
+        : worldSeed(worldSeed), entity(entity), tick(tick), stream(stream), index(0) {}
+
+    uint64_t nextBits() { return randomBits(worldSeed, entity, tick, stream, index++); }
+    float nextFloat() { return static_cast<float>(nextBits() >> 40) * (1.0f / 16777216.0f); }
+    float nextRange(float min, float max) { return min + (max - min) * nextFloat(); }
+    float nextSigned() { return nextFloat() * 2.0f - 1.0f; } // [-1, 1)
+
+    // [0, bound), multiply-shift (bias below 2^-32 for small bounds)
+    uint32_t nextInt(uint32_t bound) {
+        return static_cast<uint32_t>(((nextBits() >> 32) * static_cast<uint64_t>(bound)) >> 32);
+    }
+};
+
+} // namespace Engine
@@ -0,0 +1,723 @@
+/**
+ * GameServer.cpp - Implementation of the Headless Authoritative Server
+ */
+
+#include "GameServer.h"
+#include "../Core/Scene.h"
+#include "../Core/Projectile.h"
+#include "../Core/TimerWheel.h"
+#include "../Core/TaskScheduler.h"
+#include "../../GameObjects/Player.h"
+#include "../../GameObjects/Monster.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <streambuf>
+#include <thread>
+
+namespace Engine {
+
+namespace {
+
+const Vec3 SPAWN_ORIGIN(8.0f, 10.0f, 8.0f);          // Game's initial camera position
+const float SPAWN_SPACING = 2.0f;
+const float SPAWN_YAW = -90.0f * 3.14159f / 180.0f;  // Game's initial camera yaw
+const float BOT_TURN_RATE = 0.6f;                     // Radians per second: bots walk in circles
+const double MAX_SCHEDULE_LAG = 0.25;                 // Stop catching up after falling this far behind
+
+// Swallows the gameplay debug output on a headless server
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return traits_type::not_eof(c); }
+};
+
+double toMs(double seconds) {
+    return seconds * 1000.0;
+}
+
+} // namespace
+
+// ===== ServerOptions =====
+
+bool ServerOptions::parseCommandLine(int argc, char** argv, ServerOptions& options) {
+    bool serverRequested = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+
+        if (arg == "--server") {
+            serverRequested = true;
+        } else if (arg == "--port" && hasValue) {
+            int port = std::atoi(argv[++i]);
+            if (port > 0 && port <= 65535) options.port = static_cast<uint16_t>(port);
+        } else if (arg == "--tick-rate" && hasValue) {
+            options.tickRate = std::max(1.0f, static_cast<float>(std::atof(argv[++i])));
+        } else if (arg == "--snapshot-rate" && hasValue) {
+            options.snapshotRate = std::max(1.0f, static_cast<float>(std::atof(argv[++i])));
+        } else if (arg == "--max-clients" && hasValue) {
+            options.maxClients = std::max(1, std::min(255, std::atoi(argv[++i])));
+        } else if (arg == "--max-monsters" && hasValue) {
+            options.maxMonsters = std::max(0, std::atoi(argv[++i]));
+        } else if (arg == "--snapshot-budget" && hasValue) {
+            int budget = std::atoi(argv[++i]);
+            options.snapshotBudget = static_cast<size_t>(std::max(64, std::min(static_cast<int>(NetProtocol::MAX_PACKET_SIZE), budget)));
+        } else if (arg == "--bots" && hasValue) {
+            options.bots = std::max(0, std::atoi(argv[++i]));
+        } else if (arg == "--server-duration" && hasValue) {
+            options.duration = std::max(0.0f, static_cast<float>(std::atof(argv[++i])));
+        } else if (arg == "--server-stats" && hasValue) {
+            options.statsInterval = std::max(0.5f, static_cast<float>(std::atof(argv[++i])));
+        } else if (arg == "--max-rewind" && hasValue) {
+            options.maxRewind = std::max(0.0f, std::min(2.0f, static_cast<float>(std::atof(argv[++i]))));
+        } else if (arg == "--world-seed" && hasValue) {
+            options.worldSeed = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--server-verbose") {
+            options.verbose = true;
+        }
+    }
+
+    options.snapshotRate = std::min(options.snapshotRate, options.tickRate);
+    return serverRequested;
+}
+
+// ===== GameServer =====
+
+const float GameServer::CLIENT_TIMEOUT = 5.0f;
+const float GameServer::MAX_INPUT_BUDGET = 0.5f;
+const float GameServer::FIRE_INTERVAL = 0.1f;
+const float GameServer::MUZZLE_DISTANCE = 0.5f;
+const size_t GameServer::MAX_QUEUED_INPUTS;
+
+void GameServer::MetricAccumulator::add(const MetricAccumulator& other) {
+    ticks += other.ticks;
+    tickSeconds += other.tickSeconds;
+    maxTickSeconds = std::max(maxTickSeconds, other.maxTickSeconds);
+    bytesIn += other.bytesIn;
+    bytesOut += other.bytesOut;
+    packetsIn += other.packetsIn;
+    packetsOut += other.packetsOut;
+    snapshotsSent += other.snapshotsSent;
+    snapshotBytes += other.snapshotBytes;
+    deltaSnapshots += other.deltaSnapshots;
+    entitiesSent += other.entitiesSent;
+    entitiesDeferred += other.entitiesDeferred;
+    rewoundHits += other.rewoundHits;
+    rewoundTicks += other.rewoundTicks;
+}
+
+GameServer::GameServer(const ServerOptions& options)
+    : options(options), tick(0), time(0.0),
+      ticksPerSnapshot(std::max(1, static_cast<int>(std::lround(options.tickRate / options.snapshotRate)))),
+      packetBuffer(NetProtocol::MAX_PACKET_SIZE),
+      hitboxHistory(static_cast<size_t>(std::ceil(options.maxRewind * options.tickRate)) + 2, static_cast<size_t>(std::max(1, options.maxMonsters))),
+      coutBuffer(std::cout.rdbuf()) {
+    if (!options.verbose) {
+        mutedOutput = std::make_unique<NullBuffer>();
+    }
+}
+
+GameServer::~GameServer() {
+    stopBots();
+
+    // Tell connected clients instead of letting them time out
+    NetWriter writer(packetBuffer.data(), packetBuffer.size());
+    writer.writeHeader(NetPacketType::Disconnect);
+    for (const ClientSlot& client : clients) {
+        if (client.connected) {
+            socket.send(client.address, writer.getData(), writer.getSize());
+        }
+    }
+
+    if (monsterSpawner) {
+        monsterSpawner->cleanup();
+    }
+    if (projectileManager) {
+        projectileManager->cleanup();
+    }
+    monsterSpawner.reset();
+    projectileManager.reset();
+    scene.reset();
+    std::cout.rdbuf(coutBuffer);
+}
+
+bool GameServer::initialize() {
+    if (!socket.open(options.port)) {
+        std::cerr << "GameServer: cannot listen on UDP port " << options.port << std::endl;
+        return false;
+    }
+
+    scene = std::make_unique<Scene>("ServerScene");
+
+    // One avatar per client slot, created up front so the spawner's target pointer stays valid
+    clients.resize(options.maxClients);
+    for (int i = 0; i < options.maxClients; i++) {
+        auto avatar = std::make_unique<Player>("NetPlayer_" + std::to_string(i));
+        avatar->setShowHealthBar(false); // Nothing is drawn on the server
+        avatar->setActive(false);
+        clients[i].avatar = avatar.get();
+        scene->addGameObject(std::move(avatar));
+    }
+    if (!scene->initialize()) {
+        std::cerr << "GameServer: scene initialization failed" << std::endl;
+        return false;
+    }
+
+    // No particles, collision or audio system: effects are the clients' business
+    projectileManager = std::make_unique<ProjectileManager>();
+    projectileManager->initialize(nullptr, nullptr, nullptr);
+
+    monsterSpawner = std::make_unique<MonsterSpawner>(scene.get(), nullptr);
+    monsterSpawner->setMaxMonsters(options.maxMonsters);
+    monsterSpawner->setWorldSeed(options.worldSeed);
+
+    // Blasts reach monsters and every avatar (inactive slots are skipped); no terrain here
+    ExplosionSystem& explosions = projectileManager->getExplosionSystem();
+    explosions.setMonsterSpawner(monsterSpawner.get());
+    for (const ClientSlot& client : clients) {
+        explosions.addPlayer(client.avatar);
+    }
+
+    std::cout << "GameServer: listening on UDP port " << socket.getLocalPort() << " (" << options.tickRate << " Hz tick, "
+              << options.snapshotRate << " Hz snapshots of up to " << options.snapshotBudget << " B, " << options.maxClients << " clients, "
+              << options.maxMonsters << " monsters)" << std::endl;
+    return true;
+}
+
+int GameServer::getClientCount() const {
+    int count = 0;
+    for (const ClientSlot& client : clients) {
+        if (client.connected) count++;
+    }
+    return count;
+}
+
+// ===== Main loop =====
+
+int GameServer::run() {
+    typedef std::chrono::steady_clock Clock;
+
+    // Reports go to the real stdout; the gameplay code's debug prints are muted
+    std::ostream report(coutBuffer);
+    if (mutedOutput) {
+        std::cout.rdbuf(mutedOutput.get());
+    }
+
+    startBots();
+
+    const Clock::duration tickDuration = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(1.0 / options.tickRate));
+    const Clock::time_point start = Clock::now();
+    Clock::time_point nextTick = start;
+    Clock::time_point intervalStart = start;
+
+    for (;;) {
+        Clock::time_point tickStart = Clock::now();
+        double elapsed = std::chrono::duration<double>(tickStart - start).count();
+        if (options.duration > 0.0f && elapsed >= options.duration) break;
+
+        step();
+
+        Clock::time_point tickEnd = Clock::now();
+        double tickSeconds = std::chrono::duration<double>(tickEnd - tickStart).count();
+        interval.ticks++;
+        interval.tickSeconds += tickSeconds;
+        interval.maxTickSeconds = std::max(interval.maxTickSeconds, tickSeconds);
+
+        double intervalSeconds = std::chrono::duration<double>(tickEnd - intervalStart).count();
+        if (intervalSeconds >= options.statsInterval) {
+            printMetrics(report, buildMetrics(interval, intervalSeconds));
+            printBotStats(report, intervalSeconds);
+            total.add(interval);
+            interval = MetricAccumulator();
+            intervalStart = tickEnd;
+        }
+
+        // Fixed schedule; after a long stall, restart it instead of bursting ticks
+        nextTick += tickDuration;
+        if (std::chrono::duration<double>(tickEnd - nextTick).count() > MAX_SCHEDULE_LAG) {
+            nextTick = tickEnd;
+        }
+        std::this_thread::sleep_until(nextTick);
+    }
+
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    total.add(interval);
+    report << "=== SERVER SUMMARY (" << std::fixed << std::setprecision(1) << seconds << " s, " << tick << " ticks) ===" << std::endl;
+    printMetrics(report, buildMetrics(total, seconds));
+    printBotStats(report, 0.0);
+
+    stopBots();
+    return 0;
+}
+
+void GameServer::step() {
+    const float deltaTime = 1.0f / options.tickRate;
+    tick++;
+    time += deltaTime;
+
+    updateBots(deltaTime);
+    receivePackets();
+    applyInputs(deltaTime);
+    updateMonsterTarget();
+
+    TimerWheel::getInstance().advance(deltaTime);
+    TaskScheduler::getInstance().update();
+
+    scene->update(deltaTime);
+
+    projectileManager->update(deltaTime);
+    projectileManager->checkAllCollisions(scene->getAllObjectsForCollision());
+    resolveRewoundHits();
+
+    monsterSpawner->update(deltaTime);
+    recordHitboxes();
+
+    dropTimedOutClients();
+    if (tick % ticksPerSnapshot == 0) {
+        sendSnapshots();
+    }
+}
+
+// ===== Networking =====
+
+void GameServer::send(const NetAddress& address, const uint8_t* data, size_t size) {
+    if (socket.send(address, data, size)) {
+        interval.bytesOut += size;
+        interval.packetsOut++;
+    }
+}
+
+int GameServer::findClient(const NetAddress& address) const {
+    for (size_t i = 0; i < clients.size(); i++) {
+        if (clients[i].connected && clients[i].address == address) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+void GameServer::receivePackets() {
+    NetAddress sender;
+    int received;
+    while ((received = socket.receive(sender, packetBuffer.data(), packetBuffer.size())) >= 0) {
+        interval.bytesIn += static_cast<uint64_t>(received);
+        interval.packetsIn++;
+
+        NetReader reader(packetBuffer.data(), static_cast<size_t>(received));
+        NetPacketType type;
+        if (!reader.readHeader(type)) continue;
+
+        int clientIndex = findClient(sender);
+        switch (type) {
+            case NetPacketType::ConnectRequest:
+                handleConnect(sender, reader);
+                break;
+            case NetPacketType::Input:
+                if (clientIndex >= 0) handleInput(clientIndex, reader);
+                break;
+            case NetPacketType::Disconnect:
+                if (clientIndex >= 0) handleDisconnect(clientIndex);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+void GameServer::handleConnect(const NetAddress& sender, NetReader& reader) {
+    uint16_t version = reader.readU16();
+    uint32_t nonce = reader.readU32();
+    if (!reader.isValid()) return;
+
+    NetWriter writer(packetBuffer.data(), packetBuffer.size());
+    if (version != NetProtocol::VERSION) {
+        writer.writeHeader(NetPacketType::ConnectReject);
+        writer.writeU32(nonce);
+        writer.writeU8(static_cast<uint8_t>(NetRejectReason::VersionMismatch));
+        send(sender, writer.getData(), writer.getSize());
+        return;
+    }
+
+    // A resent request of a client we already accepted gets the same answer
+    int clientIndex = findClient(sender);
+    if (clientIndex >= 0 && clients[clientIndex].nonce != nonce) {
+        handleDisconnect(clientIndex); // Same address, new session
+        clientIndex = -1;
+    }
+
+    if (clientIndex < 0) {
+        for (size_t i = 0; i < clients.size(); i++) {
+            if (!clients[i].connected) {
+                clientIndex = static_cast<int>(i);
+                break;
+            }
+        }
+        if (clientIndex < 0) {
+            writer.writeHeader(NetPacketType::ConnectReject);
+            writer.writeU32(nonce);
+            writer.writeU8(static_cast<uint8_t>(NetRejectReason::ServerFull));
+            send(sender, writer.getData(), writer.getSize());
+            return;
+        }
+
+        ClientSlot& client = clients[clientIndex];
+        client.connected = true;
+        client.address = sender;
+        client.nonce = nonce;
+        client.queuedInputs.clear();
+        client.lastInputSequence = 0;
+        client.ackedSnapshot = 0;
+        client.encoder.reset();
+        client.encoder.setByteBudget(options.snapshotBudget);
+        client.inputBudget = 0.0f;
+        client.connectedAt = time;
+        client.fireCooldown = 0.0f;
+        respawn(clientIndex);
+        std::cout << "GameServer: client " << clientIndex << " connected from " << sender.toString() << std::endl;
+    }
+
+    ClientSlot& client = clients[clientIndex];
+    client.lastHeard = time;
+
+    writer.writeHeader(NetPacketType::ConnectAccept);
+    writer.writeU32(nonce);
+    writer.writeU8(static_cast<uint8_t>(clientIndex));
+    writer.writeFloat(options.tickRate);
+    writer.writeFloat(options.snapshotRate);
+    NetMessages::writePlayerState(writer, client.state);
+    send(sender, writer.getData(), writer.getSize());
+}
+
+void GameServer::handleInput(int clientIndex, NetReader& reader) {
+    uint32_t ackedSnapshot = reader.readU32();
+    if (!NetMessages::readInputs(reader, receivedInputs)) return;
+
+    ClientSlot& client = clients[clientIndex];
+    client.lastHeard = time;
+    // Input packets may arrive out of order; a snapshot never sent is a forged ack
+    if (ackedSnapshot <= tick) {
+        client.ackedSnapshot = std::max(client.ackedSnapshot, ackedSnapshot);
+    }
+
+    // Packets repeat recent commands: queue only the ones not seen yet
+    uint32_t newest = client.queuedInputs.empty() ? client.lastInputSequence : client.queuedInputs.back().sequence;
+    for (const NetPlayerInput& input : receivedInputs) {
+        if (input.sequence > newest) {
+            client.queuedInputs.push_back(input);
+            newest = input.sequence;
+        }
+    }
+    while (client.queuedInputs.size() > MAX_QUEUED_INPUTS) {
+        client.queuedInputs.pop_front();
+    }
+}
+
+void GameServer::handleDisconnect(int clientIndex) {
+    ClientSlot& client = clients[clientIndex];
+    if (!client.connected) return;
+    client.connected = false;
+    client.queuedInputs.clear();
+    client.avatar->setActive(false);
+    std::cout << "GameServer: client " << clientIndex << " (" << client.address.toString() << ") disconnected" << std::endl;
+}
+
+void GameServer::dropTimedOutClients() {
+    for (size_t i = 0; i < clients.size(); i++) {
+        if (clients[i].connected && time - clients[i].lastHeard > CLIENT_TIMEOUT) {
+            std::cout << "GameServer: client " << i << " timed out" << std::endl;
+            handleDisconnect(static_cast<int>(i));
+        }
+    }
+}
+
+void GameServer::sendSnapshots() {
+    // World part, shared by every client
+    snapshot.clear();
+    snapshot.tick = tick;
+
+    for (size_t i = 0; i < clients.size(); i++) {
+        if (!clients[i].connected) continue;
+        NetPlayerState player = clients[i].state;
+        player.health = clients[i].avatar->getHealth();
+        snapshot.players.push_back(player);
+    }
+
+    const MonsterSimulation& simulation = monsterSpawner->getSimulation();
+    for (size_t i = 0; i < simulation.getLiveCount(); i++) {
+        NetMonsterState monster;
+        monster.id = simulation.getHandleAt(i);
+        monster.type = static_cast<uint8_t>(simulation.getType(monster.id));
+        monster.state = static_cast<uint8_t>(simulation.getState(monster.id));
+        monster.position = simulation.getPositionAt(i);
+        monster.yawDegrees = simulation.getYawDegreesAt(i);
+        monster.healthPercent = simulation.getHealth(monster.id) / simulation.getMaxHealth(monster.id);
+        snapshot.monsters.push_back(monster);
+    }
+    std::sort(snapshot.monsters.begin(), snapshot.monsters.end(),
+              [](const NetMonsterState& a, const NetMonsterState& b) { return a.id < b.id; });
+
+    for (const auto& projectile : projectileManager->getActiveProjectiles()) {
+        if (!projectile->isActive()) continue;
+        NetProjectileState state;
+        state.id = projectile->getId();
+        state.type = static_cast<uint8_t>(projectile->getConfig().type);
+        state.position = projectile->getPosition();
+        state.velocity = projectile->getVelocity();
+        snapshot.projectiles.push_back(state);
+    }
+    std::sort(snapshot.projectiles.begin(), snapshot.projectiles.end(),
+              [](const NetProjectileState& a, const NetProjectileState& b) { return a.id < b.id; });
+
+    QuantizedWorld::quantize(snapshot, quantizedWorld);
+
+    // Per client: a delta against what that client acknowledged, within its byte budget
+    for (size_t i = 0; i < clients.size(); i++) {
+        ClientSlot& client = clients[i];
+        if (!client.connected) continue;
+
+        SnapshotViewer viewer;
+        viewer.clientId = static_cast<uint8_t>(i);
+        viewer.position = client.state.position;
+        viewer.direction = getViewDirection(client.state.yaw, client.state.pitch);
+
+        SnapshotEncodeStats stats;
+        NetWriter writer(packetBuffer.data(), packetBuffer.size());
+        if (!client.encoder.encode(quantizedWorld, client.ackedSnapshot, client.lastInputSequence, viewer, writer, &stats)) {
+            continue;
+        }
+        send(client.address, writer.getData(), writer.getSize());
+        interval.snapshotBytes += writer.getSize();
+        interval.snapshotsSent++;
+        interval.deltaSnapshots += stats.delta ? 1 : 0;
+        interval.entitiesSent += stats.entitiesSent + stats.removalsSent;
+        interval.entitiesDeferred += stats.entitiesDeferred;
+    }
+}
+
+// ===== Simulation =====
+
+NetPlayerState GameServer::getSpawnState(int clientIndex) const {
+    NetPlayerState state;
+    state.clientId = static_cast<uint8_t>(clientIndex);
+    state.position = SPAWN_ORIGIN + Vec3(SPAWN_SPACING * (clientIndex % 8), 0.0f, SPAWN_SPACING * (clientIndex / 8));
+    state.yaw = SPAWN_YAW;
+    state.pitch = 0.0f;
+    return state;
+}
+
+void GameServer::respawn(int clientIndex) {
+    ClientSlot& client = clients[clientIndex];
+    NetPlayerState spawn = getSpawnState(clientIndex);
+
+    // Keep the view the client is already using; only the body moves
+    if (client.lastInputSequence > 0) {
+        spawn.yaw = client.state.yaw;
+        spawn.pitch = client.state.pitch;
+    }
+    client.state = spawn;
+    client.avatar->setActive(true);
+    client.avatar->setHealth(client.avatar->getMaxHealth());
+    client.avatar->setPosition(spawn.position);
+    client.state.health = client.avatar->getHealth();
+}
+
+void GameServer::applyInputs(float deltaTime) {
+    for (size_t i = 0; i < clients.size(); i++) {
+        ClientSlot& client = clients[i];
+        if (!client.connected) continue;
+
+        if (client.avatar->isDead()) {
+            respawn(static_cast<int>(i));
+        }
+
+        // A client gets as much command time as real time passed (plus a small bank for jitter)
+        client.inputBudget = std::min(client.inputBudget + deltaTime, MAX_INPUT_BUDGET);
+        while (!client.queuedInputs.empty() && client.queuedInputs.front().deltaTime <= client.inputBudget) {
+            const NetPlayerInput& input = client.queuedInputs.front();
+            client.inputBudget -= input.deltaTime;
+            applyInput(client, input);
+            client.lastInputSequence = input.sequence;
+            client.queuedInputs.pop_front();
+        }
+    }
+}
+
+void GameServer::applyInput(ClientSlot& client, const NetPlayerInput& input) {
+    applyPlayerInput(client.state, input);
+    client.avatar->setPosition(client.state.position);
+
+    client.fireCooldown = std::max(0.0f, client.fireCooldown - input.deltaTime);
+    if ((input.buttons & NetButtons::Fire) && client.fireCooldown <= 0.0f) {
+        fire(client, input.viewTick);
+        client.fireCooldown = FIRE_INTERVAL;
+    }
+}
+
+void GameServer::fire(ClientSlot& client, double viewTick) {
+    Projectile* projectile = projectileManager->createProjectile(ProjectileFactory::getDefaultConfig(ProjectileType::Bullet));
+    if (!projectile) return;
+
+    Vec3 direction = getViewDirection(client.state.yaw, client.state.pitch);
+    projectile->fire(client.state.position + direction * MUZZLE_DISTANCE, direction, client.avatar);
+
+    // Old clients and clients without two snapshots yet send 0: live hit tests
+    if (options.maxRewind > 0.0f && viewTick > 0.0) {
+        double maxTicks = options.maxRewind * options.tickRate;
+        projectile->setRewindTicks(std::max(0.0, std::min(maxTicks, tick - viewTick)));
+    }
+}
+
+void GameServer::recordHitboxes() {
+    if (options.maxRewind <= 0.0f) return;
+
+    hitboxHistory.beginFrame(tick);
+    for (Monster* monster : monsterSpawner->getActiveMonsters()) {
+        if (monster->isDead()) continue;
+        hitboxHistory.add(monster->getId(), monster->getCollisionCenter(), monster->getCollisionRadius());
+    }
+    hitboxHistory.endFrame();
+}
+
+void GameServer::resolveRewoundHits() {
+    for (const auto& projectile : projectileManager->getActiveProjectiles()) {
+        if (!projectile->isActive() || !projectile->isLagCompensated()) continue;
+
+        // This tick's movement against the monsters as the shooter saw them then
+        RewindHit hit;
+        double rewind = projectile->getRewindTicks();
+        if (!hitboxHistory.sweep(tick - rewind, projectile->getPreviousPosition(), projectile->getPosition(),
+                                 projectile->getConfig().size, hit)) {
+            continue;
+        }
+
+        // Damage goes to the monster as it is now; one that died since is a miss
+        for (Monster* monster : monsterSpawner->getActiveMonsters()) {
+            if (monster->getId() != hit.id) continue;
+            if (!monster->isDead()) {
+                projectile->setPosition(hit.point);
+                projectile->handleCollision(monster);
+                interval.rewoundHits++;
+                interval.rewoundTicks += rewind;
+            }
+            break;
+        }
+    }
+}
+
+void GameServer::updateMonsterTarget() {
+    // Monsters hunt one player: the longest-connected one
+    const ClientSlot* target = nullptr;
+    for (const ClientSlot& client : clients) {
+        if (client.connected && (!target || client.connectedAt < target->connectedAt)) {
+            target = &client;
+        }
+    }
+    monsterSpawner->setPlayerTarget(target ? target->avatar : nullptr);
+}
+
+// ===== Loopback bots =====
+
+void GameServer::startBots() {
+    for (int i = 0; i < options.bots; i++) {
+        Bot bot;
+        bot.client = std::make_unique<NetClient>();
+        bot.phase = 6.28318f * i / std::max(1, options.bots);
+        bot.snapshotsAtLastReport = 0;
+        if (bot.client->connect(NetAddress::loopback(socket.getLocalPort()))) {
+            bots.push_back(std::move(bot));
+        }
+    }
+}
+
+void GameServer::stopBots() {
+    for (Bot& bot : bots) {
+        bot.client->disconnect();
+    }
+    bots.clear();
+}
+
+void GameServer::updateBots(float deltaTime) {
+    for (Bot& bot : bots) {
+        bot.client->update();
+        if (!bot.client->isConnected()) continue;
+
+        // Walk forward while turning, shooting all the time
+        bot.phase += BOT_TURN_RATE * deltaTime;
+        NetPlayerInput input;
+        input.buttons = NetButtons::Forward | NetButtons::Fire;
+        input.yaw = bot.phase;
+        input.pitch = -0.1f;
+        input.deltaTime = deltaTime;
+        bot.client->sendInput(input);
+    }
+}
+
+// ===== Reporting =====
+
+ServerMetrics GameServer::buildMetrics(const MetricAccumulator& counters, double seconds) const {
+    ServerMetrics metrics;
+    if (seconds > 0.0) {
+        metrics.achievedTickRate = counters.ticks / seconds;
+        metrics.bytesInPerSecond = counters.bytesIn / seconds;
+        metrics.bytesOutPerSecond = counters.bytesOut / seconds;
+        metrics.packetsInPerSecond = counters.packetsIn / seconds;
+        metrics.packetsOutPerSecond = counters.packetsOut / seconds;
+    }
+    if (counters.ticks > 0) {
+        metrics.avgTickMs = toMs(counters.tickSeconds / counters.ticks);
+    }
+    metrics.maxTickMs = toMs(counters.maxTickSeconds);
+    if (counters.snapshotsSent > 0) {
+        metrics.avgSnapshotBytes = static_cast<double>(counters.snapshotBytes) / counters.snapshotsSent;
+        metrics.avgEntitiesSent = static_cast<double>(counters.entitiesSent) / counters.snapshotsSent;
+        metrics.avgEntitiesDeferred = static_cast<double>(counters.entitiesDeferred) / counters.snapshotsSent;
+        metrics.deltaSnapshotRatio = static_cast<double>(counters.deltaSnapshots) / counters.snapshotsSent;
+    }
+    metrics.rewoundHits = counters.rewoundHits;
+    if (counters.rewoundHits > 0) {
+        metrics.avgRewindMs = toMs(counters.rewoundTicks / counters.rewoundHits / options.tickRate);
+    }
+    metrics.clients = getClientCount();
+    metrics.monsters = monsterSpawner ? monsterSpawner->getAliveMonsterCount() : 0;
+    metrics.projectiles = projectileManager ? static_cast<int>(projectileManager->getActiveProjectileCount()) : 0;
+    return metrics;
+}
+
+void GameServer::printMetrics(std::ostream& out, const ServerMetrics& metrics) const {
+    out << std::fixed << std::setprecision(1)
+        << "[server] tick " << metrics.achievedTickRate << "/" << options.tickRate << " Hz"
+        << " | tick cost avg " << std::setprecision(3) << metrics.avgTickMs << " ms, max " << metrics.maxTickMs << " ms"
+        << std::setprecision(1)
+        << " | out " << metrics.bytesOutPerSecond / 1024.0 << " KiB/s (" << metrics.packetsOutPerSecond << " pkt/s)"
+        << " | in " << metrics.bytesInPerSecond / 1024.0 << " KiB/s (" << metrics.packetsInPerSecond << " pkt/s)"
+        << " | snapshot " << std::setprecision(0) << metrics.avgSnapshotBytes << " B, "
+        << metrics.avgEntitiesSent << " sent, " << metrics.avgEntitiesDeferred << " deferred, "
+        << metrics.deltaSnapshotRatio * 100.0 << "% delta"
+        << " | rewound hits " << metrics.rewoundHits << " (avg " << metrics.avgRewindMs << " ms)"
+        << " | clients " << metrics.clients << ", monsters " << metrics.monsters << ", projectiles " << metrics.projectiles
+        << std::endl;
+}
+
+void GameServer::printBotStats(std::ostream& out, double seconds) {
+    for (size_t i = 0; i < bots.size(); i++) {
+        const NetClientStats& stats = bots[i].client->getStats();
+        out << std::fixed << std::setprecision(1) << "[bot " << i << "] "
+            << (bots[i].client->isConnected() ? "connected" : "disconnected");
+        if (seconds > 0.0) {
+            out << " | " << (stats.snapshotsReceived - bots[i].snapshotsAtLastReport) / seconds << " snapshots/s";
+            bots[i].snapshotsAtLastReport = stats.snapshotsReceived;
+        } else {
+            out << " | " << stats.snapshotsReceived << " snapshots";
+        }
+        out << " | input ack " << std::setprecision(2) << stats.inputAckMs << " ms"
+            << " | corrections " << stats.predictionCorrections
+            << " | dropped snapshots " << stats.snapshotsDropped
+            << " | in " << stats.bytesReceived << " B, out " << stats.bytesSent << " B" << std::endl;
+    }
+}
+
+} // namespace Engine
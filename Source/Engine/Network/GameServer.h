@@ -0,0 +1,231 @@
+/**
+ * GameServer.h - Headless Authoritative Dedicated Server
+ *
+ * OVERVIEW:
+ * Runs the game simulation without a window or GL context: a Scene with one
+ * Player avatar per client, the MonsterSpawner (waves, monster AI) and the
+ * ProjectileManager, stepped at a fixed tick. Clients (NetClient) send input
+ * commands over UDP; the server applies them in sequence order, simulates,
+ * and every few ticks sends each client a snapshot of the world stamped with
+ * the last command of that client it applied. Snapshots are delta-encoded
+ * per client against the last one the client acknowledged (SnapshotEncoder)
+ * and fit one datagram of --snapshot-budget bytes; what does not fit is
+ * prioritized by distance and view direction and sent later.
+ *
+ * TICK:
+ * 1. Receive packets (connects, input commands, disconnects)
+ * 2. Apply each client's queued commands, limited to the time the client
+ *    may have played since the last tick (speed-hack guard)
+ * 3. Timers and tasks, scene, projectiles and collisions, monsters
+ * 4. Record the monsters' collision spheres into the hitbox history
+ * 5. Drop silent clients; on snapshot ticks, build and send snapshots
+ *
+ * LAG COMPENSATION:
+ * A client shoots at monsters it sees an interpolation delay in the past.
+ * Each command carries the server tick the client was showing; shots fired
+ * by it are swept against HitboxHistory at that tick (plus the ticks the
+ * shot has flown since) instead of against the live monsters, rewinding at
+ * most --max-rewind seconds.
+ *
+ * FEATURES:
+ * - Fixed tick rate with sleep-based pacing; overrun ticks are reported
+ * - Metrics for fleet sizing: achieved tick rate, tick cost (avg/max),
+ *   bytes and packets per second in each direction, snapshot size, entities
+ *   sent and deferred per snapshot, entity counts; printed periodically and
+ *   as a summary on exit
+ * - Loopback bots: in-process NetClients that connect over 127.0.0.1, walk
+ *   and shoot, and report their own round-trip and prediction statistics
+ * - Gameplay debug output is muted unless --server-verbose is given
+ */
+
+#pragma once
+#include "NetClient.h"
+#include "NetProtocol.h"
+#include "NetSocket.h"
+#include "SnapshotEncoder.h"
+#include "../Core/HitboxHistory.h"
+#include <cstdint>
+#include <deque>
+#include <iosfwd>
+#include <memory>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+namespace Engine {
+
+class Scene;
+class Player;
+class MonsterSpawner;
+class ProjectileManager;
+
+/**
+ * Dedicated server settings
+ */
+struct ServerOptions {
+    uint16_t port = NetProtocol::DEFAULT_PORT;
+    float tickRate = 60.0f;         // Simulation ticks per second
+    float snapshotRate = 20.0f;     // Snapshots per second (a divisor of the tick rate works best)
+    int maxClients = 16;
+    int maxMonsters = 64;
+    size_t snapshotBudget = NetProtocol::MAX_PACKET_SIZE;  // Bytes per snapshot datagram
+    int bots = 0;                   // Loopback clients started by the server itself
+    float duration = 0.0f;          // Seconds to run; 0 = until killed
+    float statsInterval = 5.0f;     // Seconds between metric reports
+    float maxRewind = 0.5f;         // Seconds a shot may be rewound (lag compensation); 0 = live hit tests
+    uint64_t worldSeed = 12345;     // Key of every gameplay random draw (Random.h)
+    bool verbose = false;           // Keep the gameplay debug output
+
+    // Parses --server* arguments; returns false if --server was not given
+    static bool parseCommandLine(int argc, char** argv, ServerOptions& options);
+};
+
+/**
+ * Server metrics over one reporting interval
+ */
+struct ServerMetrics {
+    double achievedTickRate = 0.0;
+    double avgTickMs = 0.0;
+    double maxTickMs = 0.0;
+    double bytesInPerSecond = 0.0;
+    double bytesOutPerSecond = 0.0;
+    double packetsInPerSecond = 0.0;
+    double packetsOutPerSecond = 0.0;
+    double avgSnapshotBytes = 0.0;  // Per client per snapshot
+    double avgEntitiesSent = 0.0;   // Entity records and removals per client per snapshot
+    double avgEntitiesDeferred = 0.0;   // Changes left out by the byte budget, per client per snapshot
+    double deltaSnapshotRatio = 0.0;    // Share of snapshots encoded against an acknowledged baseline
+    double avgRewindMs = 0.0;       // How far back lag-compensated hits were tested
+    uint64_t rewoundHits = 0;
+    int clients = 0;
+    int monsters = 0;
+    int projectiles = 0;
+};
+
+/**
+ * GameServer - Authoritative simulation and snapshot replication
+ */
+class GameServer {
+public:
+    static const float CLIENT_TIMEOUT;      // Seconds without a packet before a client is dropped
+    static const float MAX_INPUT_BUDGET;    // Command time a client may bank (seconds)
+    static const float FIRE_INTERVAL;       // Seconds between shots while Fire is held
+    static const float MUZZLE_DISTANCE;     // Shots start this far ahead of the eye
+    static const size_t MAX_QUEUED_INPUTS = 64;
+
+private:
+    struct ClientSlot {
+        bool connected = false;
+        NetAddress address;
+        uint32_t nonce = 0;
+        Player* avatar = nullptr;           // Owned by the scene
+        NetPlayerState state;
+        std::deque<NetPlayerInput> queuedInputs;
+        uint32_t lastInputSequence = 0;     // Highest command applied (acknowledged in snapshots)
+        uint32_t ackedSnapshot = 0;         // Newest snapshot the client decoded (delta baseline)
+        SnapshotEncoder encoder;
+        float inputBudget = 0.0f;
+        double lastHeard = 0.0;
+        double connectedAt = 0.0;
+        float fireCooldown = 0.0f;
+    };
+
+    struct Bot {
+        std::unique_ptr<NetClient> client;
+        float phase;
+        uint64_t snapshotsAtLastReport;
+    };
+
+    // Interval counters behind ServerMetrics
+    struct MetricAccumulator {
+        uint64_t ticks = 0;
+        double tickSeconds = 0.0;
+        double maxTickSeconds = 0.0;
+        uint64_t bytesIn = 0, bytesOut = 0;
+        uint64_t packetsIn = 0, packetsOut = 0;
+        uint64_t snapshotsSent = 0;
+        uint64_t snapshotBytes = 0;
+        uint64_t deltaSnapshots = 0;
+        uint64_t entitiesSent = 0;
+        uint64_t entitiesDeferred = 0;
+        uint64_t rewoundHits = 0;
+        double rewoundTicks = 0.0;
+
+        void add(const MetricAccumulator& other);
+    };
+
+    ServerOptions options;
+    UdpSocket socket;
+    std::unique_ptr<Scene> scene;
+    std::unique_ptr<ProjectileManager> projectileManager;
+    std::unique_ptr<MonsterSpawner> monsterSpawner;
+    std::vector<ClientSlot> clients;
+    std::vector<Bot> bots;
+
+    uint32_t tick;
+    double time;                    // Simulated seconds
+    int ticksPerSnapshot;
+    WorldSnapshot snapshot;
+    QuantizedWorld quantizedWorld;
+    std::vector<uint8_t> packetBuffer;
+    std::vector<NetPlayerInput> receivedInputs;
+    HitboxHistory hitboxHistory;
+
+    MetricAccumulator interval;
+    MetricAccumulator total;
+
+    // Gameplay debug output is swallowed until the server is destroyed
+    std::unique_ptr<std::streambuf> mutedOutput;
+    std::streambuf* coutBuffer;
+
+public:
+    explicit GameServer(const ServerOptions& options);
+    ~GameServer();
+    GameServer(const GameServer&) = delete;
+    GameServer& operator=(const GameServer&) = delete;
+
+    // Binds the port and builds the world; false if the port is taken
+    bool initialize();
+
+    // Runs the fixed-tick loop for options.duration (forever if 0); returns the process exit code
+    int run();
+
+    // One simulation tick (exposed for tools that drive the server themselves)
+    void step();
+
+    uint32_t getTick() const { return tick; }
+    int getClientCount() const;
+
+private:
+    // Networking
+    void receivePackets();
+    void handleConnect(const NetAddress& sender, NetReader& reader);
+    void handleInput(int clientIndex, NetReader& reader);
+    void handleDisconnect(int clientIndex);
+    int findClient(const NetAddress& address) const;
+    void send(const NetAddress& address, const uint8_t* data, size_t size);
+    void sendSnapshots();
+    void dropTimedOutClients();
+
+    // Simulation
+    void applyInputs(float deltaTime);
+    void applyInput(ClientSlot& client, const NetPlayerInput& input);
+    void fire(ClientSlot& client, double viewTick);
+    void recordHitboxes();
+    void resolveRewoundHits();
+    void updateMonsterTarget();
+    void respawn(int clientIndex);
+    NetPlayerState getSpawnState(int clientIndex) const;
+
+    // Loopback bots
+    void startBots();
+    void updateBots(float deltaTime);
+    void stopBots();
+
+    // Reporting
+    ServerMetrics buildMetrics(const MetricAccumulator& counters, double seconds) const;
+    void printMetrics(std::ostream& out, const ServerMetrics& metrics) const;
+    void printBotStats(std::ostream& out, double seconds);
+};
+
+} // namespace Engine
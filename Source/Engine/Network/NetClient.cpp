@@ -0,0 +1,348 @@
+/**
+ * NetClient.cpp - Implementation of Client Prediction and Interpolation
+ */
+
+#include "NetClient.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace Engine {
+
+namespace {
+
+const float TWO_PI = 6.28318530718f;
+const double CLOCK_SNAP_ERROR = 0.5;        // Re-sync the server clock estimate past this error
+const double CLOCK_SMOOTHING = 0.05;
+const float INPUT_ACK_SMOOTHING = 0.1f;
+
+float lerp(float a, float b, float t) {
+    return a + (b - a) * t;
+}
+
+Vec3 lerp(const Vec3& a, const Vec3& b, float t) {
+    return Vec3(lerp(a.x, b.x, t), lerp(a.y, b.y, t), lerp(a.z, b.z, t));
+}
+
+// Shortest arc between two angles with the given full turn
+float lerpAngle(float a, float b, float t, float fullTurn) {
+    float difference = std::fmod(b - a, fullTurn);
+    if (difference > fullTurn * 0.5f) difference -= fullTurn;
+    if (difference < -fullTurn * 0.5f) difference += fullTurn;
+    return a + difference * t;
+}
+
+} // namespace
+
+const float NetClient::CONNECT_RESEND_INTERVAL = 0.25f;
+const float NetClient::CONNECT_TIMEOUT = 5.0f;
+const float NetClient::SERVER_TIMEOUT = 5.0f;
+const float NetClient::CORRECTION_EPSILON = 0.03f;
+const size_t NetClient::MAX_SNAPSHOTS;
+const size_t NetClient::MAX_PENDING_INPUTS;
+
+NetClient::NetClient()
+    : state(State::Disconnected), nonce(0), clientId(0),
+      serverTickRate(60.0f), snapshotRate(20.0f),
+      epoch(std::chrono::steady_clock::now()),
+      connectStartedAt(0.0), lastConnectSentAt(0.0), lastReceivedAt(0.0),
+      nextSequence(1), deltaTimeRemainder(0.0f), serverTimeOffset(0.0), hasTimeOffset(false), interpolationDelay(0.1f),
+      packetBuffer(NetProtocol::MAX_PACKET_SIZE) {
+}
+
+NetClient::~NetClient() {
+    disconnect();
+}
+
+double NetClient::now() const {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - epoch).count();
+}
+
+float NetClient::quantizeDeltaTime(float deltaTime) {
+    return std::floor(std::max(0.0f, std::min(deltaTime, 0.255f)) * 1000.0f) * 0.001f;
+}
+
+bool NetClient::connect(const NetAddress& server) {
+    disconnect();
+    if (!socket.open(0)) {
+        return false;
+    }
+
+    serverAddress = server;
+    state = State::Connecting;
+    nonce = static_cast<uint32_t>(std::chrono::steady_clock::now().time_since_epoch().count()) ^ (socket.getLocalPort() * 2654435761u);
+    stats = NetClientStats();
+    decoder.reset();
+    snapshots.clear();
+    pendingInputs.clear();
+    nextSequence = 1;
+    deltaTimeRemainder = 0.0f;
+    hasTimeOffset = false;
+
+    connectStartedAt = now();
+    sendConnectRequest();
+    return true;
+}
+
+void NetClient::disconnect() {
+    if (state != State::Disconnected && socket.isOpen()) {
+        NetWriter writer(packetBuffer.data(), packetBuffer.size());
+        writer.writeHeader(NetPacketType::Disconnect);
+        send(writer.getData(), writer.getSize());
+    }
+    socket.close();
+    state = State::Disconnected;
+}
+
+void NetClient::send(const uint8_t* data, size_t size) {
+    if (socket.send(serverAddress, data, size)) {
+        stats.bytesSent += size;
+        stats.packetsSent++;
+    }
+}
+
+void NetClient::sendConnectRequest() {
+    NetWriter writer(packetBuffer.data(), packetBuffer.size());
+    writer.writeHeader(NetPacketType::ConnectRequest);
+    writer.writeU16(NetProtocol::VERSION);
+    writer.writeU32(nonce);
+    send(writer.getData(), writer.getSize());
+    lastConnectSentAt = now();
+}
+
+void NetClient::update() {
+    if (state == State::Disconnected) return;
+
+    NetAddress sender;
+    int received;
+    while ((received = socket.receive(sender, packetBuffer.data(), packetBuffer.size())) >= 0) {
+        if (sender != serverAddress) continue;
+        stats.bytesReceived += static_cast<uint64_t>(received);
+        stats.packetsReceived++;
+
+        NetReader reader(packetBuffer.data(), static_cast<size_t>(received));
+        NetPacketType type;
+        if (!reader.readHeader(type)) continue;
+
+        switch (type) {
+            case NetPacketType::ConnectAccept:
+                handleAccept(reader);
+                break;
+            case NetPacketType::ConnectReject:
+                if (state == State::Connecting && reader.readU32() == nonce && reader.isValid()) {
+                    std::cerr << "NetClient: server " << serverAddress.toString() << " rejected the connection" << std::endl;
+                    socket.close();
+                    state = State::Disconnected;
+                    return;
+                }
+                break;
+            case NetPacketType::Snapshot:
+                if (state == State::Connected) {
+                    lastReceivedAt = now();
+                    handleSnapshot(reader);
+                }
+                break;
+            case NetPacketType::Disconnect:
+                if (state == State::Connected) {
+                    std::cerr << "NetClient: server closed the connection" << std::endl;
+                    socket.close();
+                    state = State::Disconnected;
+                    return;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    double time = now();
+    if (state == State::Connecting) {
+        if (time - connectStartedAt > CONNECT_TIMEOUT) {
+            std::cerr << "NetClient: no answer from " << serverAddress.toString() << std::endl;
+            socket.close();
+            state = State::Disconnected;
+        } else if (time - lastConnectSentAt > CONNECT_RESEND_INTERVAL) {
+            sendConnectRequest();
+        }
+    } else if (state == State::Connected && time - lastReceivedAt > SERVER_TIMEOUT) {
+        std::cerr << "NetClient: server " << serverAddress.toString() << " timed out" << std::endl;
+        socket.close();
+        state = State::Disconnected;
+    }
+}
+
+void NetClient::handleAccept(NetReader& reader) {
+    uint32_t acceptedNonce = reader.readU32();
+    uint8_t id = reader.readU8();
+    float tickRate = reader.readFloat();
+    float rate = reader.readFloat();
+    NetPlayerState spawn = NetMessages::readPlayerState(reader);
+    if (!reader.isValid() || state != State::Connecting || acceptedNonce != nonce) return;
+
+    clientId = id;
+    serverTickRate = std::max(1.0f, tickRate);
+    snapshotRate = std::max(1.0f, rate);
+    interpolationDelay = 2.0f / snapshotRate; // Two snapshot intervals: one lost snapshot is bridged
+    predicted = spawn;
+    state = State::Connected;
+    lastReceivedAt = now();
+    std::cout << "NetClient: connected to " << serverAddress.toString() << " as client " << static_cast<int>(clientId)
+              << " (" << serverTickRate << " Hz tick, " << snapshotRate << " Hz snapshots)" << std::endl;
+}
+
+void NetClient::handleSnapshot(NetReader& reader) {
+    if (!decoder.decode(reader, incoming)) {
+        stats.snapshotsDropped++;
+        return;
+    }
+    stats.snapshotsReceived++;
+
+    double time = now();
+    double serverTime = incoming.tick / static_cast<double>(serverTickRate);
+    double offset = serverTime - time;
+    if (!hasTimeOffset || std::fabs(offset - serverTimeOffset) > CLOCK_SNAP_ERROR) {
+        serverTimeOffset = offset;
+        hasTimeOffset = true;
+    } else {
+        serverTimeOffset += (offset - serverTimeOffset) * CLOCK_SMOOTHING;
+    }
+
+    reconcile(incoming);
+
+    snapshots.push_back(TimedSnapshot{std::move(incoming), serverTime});
+    incoming.clear();
+    while (snapshots.size() > MAX_SNAPSHOTS) {
+        snapshots.pop_front();
+    }
+}
+
+void NetClient::reconcile(const WorldSnapshot& snapshot) {
+    const NetPlayerState* authoritative = snapshot.findPlayer(clientId);
+    if (!authoritative) return;
+
+    // Drop acknowledged commands (the newest one gives the latency sample)
+    double time = now();
+    while (!pendingInputs.empty() && pendingInputs.front().input.sequence <= snapshot.ackedInput) {
+        if (pendingInputs.front().input.sequence == snapshot.ackedInput) {
+            float sample = static_cast<float>((time - pendingInputs.front().sentAt) * 1000.0);
+            stats.inputAckMs = stats.inputAckMs == 0.0f ? sample : lerp(stats.inputAckMs, sample, INPUT_ACK_SMOOTHING);
+        }
+        pendingInputs.pop_front();
+    }
+
+    // Server state + the commands it has not seen yet
+    NetPlayerState corrected = *authoritative;
+    for (const PendingInput& pending : pendingInputs) {
+        applyPlayerInput(corrected, pending.input);
+    }
+
+    float error = (corrected.position - predicted.position).length();
+    if (error > CORRECTION_EPSILON) {
+        stats.predictionCorrections++;
+        stats.lastCorrection = error;
+    }
+
+    // View angles stay with the local mouse
+    corrected.yaw = predicted.yaw;
+    corrected.pitch = predicted.pitch;
+    predicted = corrected;
+}
+
+void NetClient::sendInput(const NetPlayerInput& command) {
+    if (state != State::Connected) return;
+
+    PendingInput pending;
+    pending.input = command;
+    pending.input.sequence = nextSequence++;
+    pending.input.viewTick = getViewTick();
+    // 16.67 ms frames must not become 17 ms commands: the server would fall behind
+    float deltaTime = std::min(command.deltaTime, NetProtocol::INPUT_MAX_DELTA) + deltaTimeRemainder;
+    pending.input.deltaTime = quantizeDeltaTime(deltaTime);
+    deltaTimeRemainder = deltaTime - pending.input.deltaTime;
+    pending.sentAt = now();
+    applyPlayerInput(predicted, pending.input);
+
+    pendingInputs.push_back(pending);
+    while (pendingInputs.size() > MAX_PENDING_INPUTS) {
+        pendingInputs.pop_front();
+    }
+
+    // The newest commands, oldest first
+    NetPlayerInput inputs[NetProtocol::MAX_INPUTS_PER_PACKET];
+    int count = static_cast<int>(std::min<size_t>(pendingInputs.size(), NetProtocol::MAX_INPUTS_PER_PACKET));
+    for (int i = 0; i < count; i++) {
+        inputs[i] = pendingInputs[pendingInputs.size() - count + i].input;
+    }
+
+    NetWriter writer(packetBuffer.data(), packetBuffer.size());
+    writer.writeHeader(NetPacketType::Input);
+    writer.writeU32(decoder.getLatestTick());
+    NetMessages::writeInputs(writer, inputs, count);
+    send(writer.getData(), writer.getSize());
+}
+
+double NetClient::getViewTick() const {
+    if (snapshots.size() < 2) return 0.0;
+    // What sampleWorld shows, in server ticks
+    double renderTick = (now() + serverTimeOffset - interpolationDelay) * serverTickRate;
+    return std::max<double>(snapshots.front().snapshot.tick, std::min<double>(snapshots.back().snapshot.tick, renderTick));
+}
+
+bool NetClient::sampleWorld(WorldSnapshot& out) const {
+    if (snapshots.size() < 2) return false;
+
+    double renderTime = now() + serverTimeOffset - interpolationDelay;
+
+    // Bracketing pair; clamp to the ends (no extrapolation)
+    size_t next = 1;
+    while (next + 1 < snapshots.size() && snapshots[next].serverTime < renderTime) {
+        next++;
+    }
+    const TimedSnapshot& from = snapshots[next - 1];
+    const TimedSnapshot& to = snapshots[next];
+    double span = to.serverTime - from.serverTime;
+    float t = span > 0.0 ? static_cast<float>((renderTime - from.serverTime) / span) : 1.0f;
+    t = std::max(0.0f, std::min(1.0f, t));
+
+    // Entities of the newer snapshot, blended with their older state where they existed
+    out.clear();
+    out.tick = to.snapshot.tick;
+    out.ackedInput = to.snapshot.ackedInput;
+
+    for (const NetPlayerState& player : to.snapshot.players) {
+        NetPlayerState blended = player;
+        if (const NetPlayerState* previous = from.snapshot.findPlayer(player.clientId)) {
+            blended.position = lerp(previous->position, player.position, t);
+            blended.yaw = lerpAngle(previous->yaw, player.yaw, t, TWO_PI);
+            blended.pitch = lerp(previous->pitch, player.pitch, t);
+        }
+        out.players.push_back(blended);
+    }
+
+    // Both lists are sorted by id: merge
+    const std::vector<NetMonsterState>& oldMonsters = from.snapshot.monsters;
+    size_t previous = 0;
+    for (const NetMonsterState& monster : to.snapshot.monsters) {
+        while (previous < oldMonsters.size() && oldMonsters[previous].id < monster.id) previous++;
+        NetMonsterState blended = monster;
+        if (previous < oldMonsters.size() && oldMonsters[previous].id == monster.id) {
+            blended.position = lerp(oldMonsters[previous].position, monster.position, t);
+            blended.yawDegrees = lerpAngle(oldMonsters[previous].yawDegrees, monster.yawDegrees, t, 360.0f);
+        }
+        out.monsters.push_back(blended);
+    }
+
+    const std::vector<NetProjectileState>& oldProjectiles = from.snapshot.projectiles;
+    previous = 0;
+    for (const NetProjectileState& projectile : to.snapshot.projectiles) {
+        while (previous < oldProjectiles.size() && oldProjectiles[previous].id < projectile.id) previous++;
+        NetProjectileState blended = projectile;
+        if (previous < oldProjectiles.size() && oldProjectiles[previous].id == projectile.id) {
+            blended.position = lerp(oldProjectiles[previous].position, projectile.position, t);
+        }
+        out.projectiles.push_back(blended);
+    }
+    return true;
+}
+
+} // namespace Engine
@@ -0,0 +1,158 @@
+/**
+ * NetClient.h - Client Side of Snapshot Replication
+ *
+ * OVERVIEW:
+ * Connects to a GameServer over UDP, sends one input command per client
+ * tick and turns the server's snapshots into two views of the world:
+ * - The local player, predicted: every command is applied locally with
+ *   the same rule the server runs (applyPlayerInput) as soon as it is sent;
+ *   when a snapshot acknowledges command N, the prediction restarts from
+ *   the server's state and replays the commands after N
+ * - Everything else, interpolated: decoded snapshots are kept with their
+ *   server time and sampled a fixed delay behind the estimated server
+ *   clock, so monsters, projectiles and other players move smoothly
+ *   between 20 Hz updates and survive a lost snapshot
+ *
+ * FEATURES:
+ * - Connect handshake with resends and a timeout; server timeout detection
+ * - Each Input packet repeats the last unacknowledged commands, so a lost
+ *   packet costs nothing as long as a later one arrives, and acknowledges
+ *   the newest decoded snapshot, the baseline of the server's next delta
+ * - Commands are stamped with the server tick on screen when they were
+ *   made, so the server can test shots against that moment (lag compensation)
+ * - Server clock estimate smoothed against arrival jitter
+ * - Statistics: bytes/packets in and out, snapshots, input acknowledgement
+ *   latency, prediction corrections
+ * - No dependency on Game or GL (ww3_core); used by the game client and by
+ *   the server's in-process loopback bots
+ */
+
+#pragma once
+#include "NetProtocol.h"
+#include "NetSocket.h"
+#include "SnapshotEncoder.h"
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+namespace Engine {
+
+/**
+ * Client-side replication statistics (totals since connect)
+ */
+struct NetClientStats {
+    uint64_t bytesSent = 0;
+    uint64_t bytesReceived = 0;
+    uint64_t packetsSent = 0;
+    uint64_t packetsReceived = 0;
+    uint64_t snapshotsReceived = 0;     // Decoded snapshots
+    uint64_t snapshotsDropped = 0;      // Stale, malformed or against a baseline no longer held
+    uint64_t predictionCorrections = 0; // Reconciliations that moved the local player
+    float inputAckMs = 0.0f;            // Smoothed send -> acknowledged time of input commands
+    float lastCorrection = 0.0f;        // Distance of the last correction
+};
+
+/**
+ * NetClient - Input upload, prediction and snapshot interpolation
+ */
+class NetClient {
+public:
+    enum class State {
+        Disconnected,
+        Connecting,
+        Connected
+    };
+
+    static const float CONNECT_RESEND_INTERVAL;
+    static const float CONNECT_TIMEOUT;
+    static const float SERVER_TIMEOUT;
+    static const float CORRECTION_EPSILON;  // Smaller differences are snapshot quantization (1/64 unit per axis)
+    static const size_t MAX_SNAPSHOTS = 32;
+    static const size_t MAX_PENDING_INPUTS = 256;
+
+private:
+    struct PendingInput {
+        NetPlayerInput input;
+        double sentAt;
+    };
+
+    struct TimedSnapshot {
+        WorldSnapshot snapshot;
+        double serverTime;
+    };
+
+    UdpSocket socket;
+    NetAddress serverAddress;
+    State state;
+    uint32_t nonce;
+    uint8_t clientId;
+    float serverTickRate;
+    float snapshotRate;
+    std::chrono::steady_clock::time_point epoch;
+    double connectStartedAt;
+    double lastConnectSentAt;
+    double lastReceivedAt;
+
+    // Prediction
+    NetPlayerState predicted;
+    std::deque<PendingInput> pendingInputs;
+    uint32_t nextSequence;
+    float deltaTimeRemainder;   // Carried quantization error, so command time sums to real time
+
+    // Interpolation
+    SnapshotDecoder decoder;
+    std::deque<TimedSnapshot> snapshots;
+    WorldSnapshot incoming;
+    double serverTimeOffset;    // Estimated server time - local time
+    bool hasTimeOffset;
+    float interpolationDelay;   // Seconds behind the estimated server time
+
+    NetClientStats stats;
+    std::vector<uint8_t> packetBuffer;
+
+public:
+    NetClient();
+    ~NetClient();
+    NetClient(const NetClient&) = delete;
+    NetClient& operator=(const NetClient&) = delete;
+
+    // Opens a socket and starts the handshake; completes during update()
+    bool connect(const NetAddress& server);
+    void disconnect();
+
+    // Drains the socket, resends the handshake, detects timeouts; call once per tick
+    void update();
+
+    // Stamps, predicts and sends one tick of input (Connected only)
+    void sendInput(const NetPlayerInput& command);
+
+    // Interpolated world at the current render time (false until two snapshots arrived)
+    bool sampleWorld(WorldSnapshot& out) const;
+
+    // Server tick sampleWorld is showing now, fractional (0 until two snapshots arrived)
+    double getViewTick() const;
+
+    State getState() const { return state; }
+    bool isConnected() const { return state == State::Connected; }
+    uint8_t getClientId() const { return clientId; }
+    const NetPlayerState& getPredictedPlayer() const { return predicted; }
+    const NetClientStats& getStats() const { return stats; }
+    float getServerTickRate() const { return serverTickRate; }
+    float getSnapshotRate() const { return snapshotRate; }
+    float getInterpolationDelay() const { return interpolationDelay; }
+    uint16_t getLocalPort() const { return socket.getLocalPort(); }
+
+    // Input delta as the server will see it (whole milliseconds, rounded down)
+    static float quantizeDeltaTime(float deltaTime);
+
+private:
+    double now() const;
+    void send(const uint8_t* data, size_t size);
+    void sendConnectRequest();
+    void handleAccept(NetReader& reader);
+    void handleSnapshot(NetReader& reader);
+    void reconcile(const WorldSnapshot& snapshot);
+};
+
+} // namespace Engine
@@ -0,0 +1,285 @@
+/**
+ * NetProtocol.cpp - Implementation of the Replication Wire Format
+ */
+
+#include "NetProtocol.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace Engine {
+
+const uint32_t NetProtocol::PROTOCOL_ID;
+const uint16_t NetProtocol::VERSION;
+const uint16_t NetProtocol::DEFAULT_PORT;
+const size_t NetProtocol::MAX_PACKET_SIZE;
+const int NetProtocol::MAX_INPUTS_PER_PACKET;
+const int NetProtocol::SNAPSHOT_HISTORY;
+const float NetProtocol::PLAYER_MOVE_SPEED = 5.0f;
+const float NetProtocol::PLAYER_MAX_PITCH = 89.0f * 3.14159f / 180.0f;
+const float NetProtocol::INPUT_MAX_DELTA = 0.25f;
+
+// ===== WorldSnapshot =====
+
+void WorldSnapshot::clear() {
+    tick = 0;
+    ackedInput = 0;
+    players.clear();
+    monsters.clear();
+    projectiles.clear();
+}
+
+const NetPlayerState* WorldSnapshot::findPlayer(uint8_t clientId) const {
+    for (const NetPlayerState& player : players) {
+        if (player.clientId == clientId) return &player;
+    }
+    return nullptr;
+}
+
+// ===== NetWriter =====
+
+NetWriter::NetWriter(uint8_t* buffer, size_t bufferCapacity)
+    : data(buffer), capacity(bufferCapacity), size(0), overflowed(false) {
+}
+
+void NetWriter::writeU8(uint8_t value) {
+    if (size + 1 > capacity) {
+        overflowed = true;
+        return;
+    }
+    data[size++] = value;
+}
+
+void NetWriter::writeU16(uint16_t value) {
+    writeU8(static_cast<uint8_t>(value));
+    writeU8(static_cast<uint8_t>(value >> 8));
+}
+
+void NetWriter::writeU32(uint32_t value) {
+    writeU16(static_cast<uint16_t>(value));
+    writeU16(static_cast<uint16_t>(value >> 16));
+}
+
+void NetWriter::writeFloat(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    writeU32(bits);
+}
+
+void NetWriter::writeVec3(const Vec3& value) {
+    writeFloat(value.x);
+    writeFloat(value.y);
+    writeFloat(value.z);
+}
+
+void NetWriter::writeBytes(const uint8_t* bytes, size_t count) {
+    if (size + count > capacity) {
+        overflowed = true;
+        return;
+    }
+    if (count > 0) std::memcpy(data + size, bytes, count);
+    size += count;
+}
+
+void NetWriter::writeHeader(NetPacketType type) {
+    writeU32(NetProtocol::PROTOCOL_ID);
+    writeU8(static_cast<uint8_t>(type));
+}
+
+// ===== NetReader =====
+
+NetReader::NetReader(const uint8_t* buffer, size_t bufferSize)
+    : data(buffer), size(bufferSize), offset(0), failed(false) {
+}
+
+bool NetReader::require(size_t bytes) {
+    if (failed || offset + bytes > size) {
+        failed = true;
+        return false;
+    }
+    return true;
+}
+
+uint8_t NetReader::readU8() {
+    if (!require(1)) return 0;
+    return data[offset++];
+}
+
+uint16_t NetReader::readU16() {
+    if (!require(2)) return 0;
+    uint16_t value = static_cast<uint16_t>(data[offset] | (data[offset + 1] << 8));
+    offset += 2;
+    return value;
+}
+
+uint32_t NetReader::readU32() {
+    uint32_t low = readU16();
+    uint32_t high = readU16();
+    return low | (high << 16);
+}
+
+float NetReader::readFloat() {
+    uint32_t bits = readU32();
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return std::isfinite(value) ? value : 0.0f; // Never let a bad packet put NaN into the world
+}
+
+Vec3 NetReader::readVec3() {
+    float x = readFloat();
+    float y = readFloat();
+    float z = readFloat();
+    return Vec3(x, y, z);
+}
+
+const uint8_t* NetReader::readBytes(size_t count) {
+    if (!require(count)) return nullptr;
+    const uint8_t* bytes = data + offset;
+    offset += count;
+    return bytes;
+}
+
+bool NetReader::readHeader(NetPacketType& type) {
+    if (readU32() != NetProtocol::PROTOCOL_ID) return false;
+    uint8_t value = readU8();
+    if (!isValid() || value < static_cast<uint8_t>(NetPacketType::ConnectRequest) ||
+        value > static_cast<uint8_t>(NetPacketType::Disconnect)) {
+        return false;
+    }
+    type = static_cast<NetPacketType>(value);
+    return true;
+}
+
+// ===== BitWriter =====
+
+BitWriter::BitWriter(uint8_t* buffer, size_t bufferCapacity)
+    : data(buffer), capacity(bufferCapacity), bitCount(0), overflowed(false) {
+}
+
+void BitWriter::writeBits(uint32_t value, int bits) {
+    if (bits <= 0) return;
+    if (bitCount + bits > capacity * 8) {
+        overflowed = true;
+        return;
+    }
+    // At most 32 bits at any bit offset span five bytes
+    size_t byte = bitCount >> 3;
+    int shift = static_cast<int>(bitCount & 7);
+    uint64_t chunk = static_cast<uint64_t>(value & (bits < 32 ? (1u << bits) - 1 : ~0u)) << shift;
+    int bytes = (shift + bits + 7) >> 3;
+    data[byte] = static_cast<uint8_t>((shift == 0 ? 0 : data[byte]) | chunk);
+    for (int i = 1; i < bytes; i++) {
+        data[byte + i] = static_cast<uint8_t>(chunk >> (8 * i));
+    }
+    bitCount += bits;
+}
+
+// ===== BitReader =====
+
+BitReader::BitReader(const uint8_t* buffer, size_t bufferSize)
+    : data(buffer), bitSize(bufferSize * 8), bitOffset(0), failed(false) {
+}
+
+uint32_t BitReader::readBits(int bits) {
+    if (bits <= 0) return 0;
+    if (failed || bitOffset + bits > bitSize) {
+        failed = true;
+        return 0;
+    }
+    size_t byte = bitOffset >> 3;
+    int shift = static_cast<int>(bitOffset & 7);
+    int bytes = (shift + bits + 7) >> 3;
+    uint64_t chunk = 0;
+    for (int i = 0; i < bytes; i++) {
+        chunk |= static_cast<uint64_t>(data[byte + i]) << (8 * i);
+    }
+    bitOffset += bits;
+    return static_cast<uint32_t>((chunk >> shift) & ((1ull << bits) - 1));
+}
+
+// ===== Messages =====
+
+namespace NetMessages {
+
+void writeInputs(NetWriter& writer, const NetPlayerInput* inputs, int count) {
+    count = std::min(count, NetProtocol::MAX_INPUTS_PER_PACKET);
+    writer.writeU8(static_cast<uint8_t>(count));
+    for (int i = 0; i < count; i++) {
+        writer.writeU32(inputs[i].sequence);
+        writer.writeU16(inputs[i].buttons);
+        writer.writeFloat(inputs[i].yaw);
+        writer.writeFloat(inputs[i].pitch);
+        writer.writeU8(static_cast<uint8_t>(std::lround(std::min(inputs[i].deltaTime, 0.255f) * 1000.0f)));
+        double viewTick = std::max(0.0, std::min(4294967295.0, inputs[i].viewTick));
+        uint32_t wholeTicks = static_cast<uint32_t>(viewTick);
+        writer.writeU32(wholeTicks);
+        writer.writeU8(static_cast<uint8_t>(std::min(255.0, (viewTick - wholeTicks) * 256.0)));
+    }
+}
+
+bool readInputs(NetReader& reader, std::vector<NetPlayerInput>& inputs) {
+    inputs.clear();
+    int count = reader.readU8();
+    if (count > NetProtocol::MAX_INPUTS_PER_PACKET) return false;
+    for (int i = 0; i < count; i++) {
+        NetPlayerInput input;
+        input.sequence = reader.readU32();
+        input.buttons = reader.readU16();
+        input.yaw = reader.readFloat();
+        input.pitch = reader.readFloat();
+        input.deltaTime = reader.readU8() * 0.001f;
+        input.viewTick = reader.readU32();
+        input.viewTick += reader.readU8() / 256.0;
+        inputs.push_back(input);
+    }
+    return reader.isValid();
+}
+
+void writePlayerState(NetWriter& writer, const NetPlayerState& player) {
+    writer.writeU8(player.clientId);
+    writer.writeVec3(player.position);
+    writer.writeFloat(player.yaw);
+    writer.writeFloat(player.pitch);
+    writer.writeFloat(player.health);
+}
+
+NetPlayerState readPlayerState(NetReader& reader) {
+    NetPlayerState player;
+    player.clientId = reader.readU8();
+    player.position = reader.readVec3();
+    player.yaw = reader.readFloat();
+    player.pitch = reader.readFloat();
+    player.health = reader.readFloat();
+    return player;
+}
+
+} // namespace NetMessages
+
+// ===== Shared rules =====
+
+Vec3 getViewDirection(float yaw, float pitch) {
+    return Vec3(std::cos(pitch) * std::cos(yaw), std::sin(pitch), std::cos(pitch) * std::sin(yaw)).normalize();
+}
+
+void applyPlayerInput(NetPlayerState& player, const NetPlayerInput& input) {
+    player.yaw = input.yaw;
+    player.pitch = std::max(-NetProtocol::PLAYER_MAX_PITCH, std::min(NetProtocol::PLAYER_MAX_PITCH, input.pitch));
+
+    float distance = NetProtocol::PLAYER_MOVE_SPEED *
+                     std::max(0.0f, std::min(NetProtocol::INPUT_MAX_DELTA, input.deltaTime));
+    if (distance <= 0.0f) return;
+
+    // Same vectors as Camera::updateCameraVectors / moveForward / strafe
+    Vec3 forward = getViewDirection(player.yaw, player.pitch);
+    Vec3 flatForward = Vec3(forward.x, 0.0f, forward.z).normalize();
+    Vec3 right = forward.cross(Vec3(0.0f, 1.0f, 0.0f)).normalize();
+
+    if (input.buttons & NetButtons::Forward) player.position = player.position + flatForward * distance;
+    if (input.buttons & NetButtons::Back) player.position = player.position - flatForward * distance;
+    if (input.buttons & NetButtons::Left) player.position = player.position - right * distance;
+    if (input.buttons & NetButtons::Right) player.position = player.position + right * distance;
+    if (input.buttons & NetButtons::Up) player.position.y += distance;
+    if (input.buttons & NetButtons::Down) player.position.y -= distance;
+}
+
+} // namespace Engine
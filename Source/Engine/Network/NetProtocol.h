@@ -0,0 +1,256 @@
+/**
+ * NetProtocol.h - Replication Wire Format and Shared Player Rules
+ *
+ * OVERVIEW:
+ * Everything the dedicated server (GameServer) and its clients (NetClient)
+ * must agree on: packet layout, the input command a client sends every
+ * tick, the world snapshot the server sends back, and the player movement
+ * rule both sides run (the server authoritatively, the client to predict
+ * its own player ahead of the next snapshot).
+ *
+ * PACKETS (little endian, all start with protocol id + type):
+ * - ConnectRequest  client -> server  version, nonce
+ * - ConnectAccept   server -> client  nonce, client id, tick/snapshot rate, spawn state
+ * - ConnectReject   server -> client  nonce, reason
+ * - Input           client -> server  newest snapshot tick decoded, then the
+ *                                     last few unacknowledged commands
+ *                                     (redundancy instead of resends)
+ * - Snapshot        server -> client  tick, baseline tick, acked command, then
+ *                                     a bit-packed delta against the baseline
+ *                                     (SnapshotEncoder); one datagram each
+ * - Disconnect      either direction
+ *
+ * FEATURES:
+ * - Bounds-checked NetWriter/NetReader (a short or malformed packet only
+ *   fails the read, it never reads past the datagram) and BitWriter/
+ *   BitReader for fields narrower than a byte
+ * - applyPlayerInput(): the camera movement of Input::processInput as a
+ *   pure function of state and command
+ * - GL-free: part of ww3_core
+ */
+
+#pragma once
+#include "../Math/Math.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Engine {
+
+enum class NetPacketType : uint8_t {
+    ConnectRequest = 1,
+    ConnectAccept,
+    ConnectReject,
+    Input,
+    Snapshot,
+    Disconnect
+};
+
+enum class NetRejectReason : uint8_t {
+    ServerFull = 1,
+    VersionMismatch
+};
+
+/**
+ * Protocol constants
+ */
+struct NetProtocol {
+    static const uint32_t PROTOCOL_ID = 0x57573301u;    // "WW3" + 1
+    static const uint16_t VERSION = 3;
+    static const uint16_t DEFAULT_PORT = 27015;
+    static const size_t MAX_PACKET_SIZE = 1200;         // Stays under common path MTUs
+    static const int MAX_INPUTS_PER_PACKET = 8;         // Redundant commands per Input packet
+    static const int SNAPSHOT_HISTORY = 32;            // Snapshots a delta may be based on
+    static const float PLAYER_MOVE_SPEED;               // Units per second (Input::processInput)
+    static const float PLAYER_MAX_PITCH;                // Radians (Camera::rotate)
+    static const float INPUT_MAX_DELTA;                 // Longest time one command may cover
+};
+
+/**
+ * Input command buttons
+ */
+struct NetButtons {
+    static const uint16_t Forward = 1 << 0;
+    static const uint16_t Back = 1 << 1;
+    static const uint16_t Left = 1 << 2;
+    static const uint16_t Right = 1 << 3;
+    static const uint16_t Up = 1 << 4;
+    static const uint16_t Down = 1 << 5;
+    static const uint16_t Fire = 1 << 6;
+};
+
+/**
+ * One client tick of input (absolute view angles, movement keys, fire)
+ */
+struct NetPlayerInput {
+    uint32_t sequence = 0;      // Increasing per client; snapshots acknowledge it
+    uint16_t buttons = 0;
+    float yaw = 0.0f;           // Radians, as Camera
+    float pitch = 0.0f;
+    float deltaTime = 0.0f;     // Sent in whole milliseconds
+    double viewTick = 0.0;      // Server tick the client was showing (lag compensation; 0 = unknown), 1/256 tick steps
+};
+
+/**
+ * Replicated player
+ */
+struct NetPlayerState {
+    uint8_t clientId = 0;
+    Vec3 position;
+    float yaw = 0.0f;
+    float pitch = 0.0f;
+    float health = 100.0f;
+};
+
+/**
+ * Replicated monster (id = the server's MonsterSimulation handle)
+ */
+struct NetMonsterState {
+    uint32_t id = 0;
+    uint8_t type = 0;           // MonsterType
+    uint8_t state = 0;          // MonsterState
+    Vec3 position;
+    float yawDegrees = 0.0f;
+    float healthPercent = 1.0f; // Sent as 0-255
+};
+
+/**
+ * Replicated projectile (id = the server's GameObject id)
+ */
+struct NetProjectileState {
+    uint32_t id = 0;
+    uint8_t type = 0;           // ProjectileType
+    Vec3 position;
+    Vec3 velocity;
+};
+
+/**
+ * WorldSnapshot - Server state at the end of one tick, as seen by one client
+ */
+struct WorldSnapshot {
+    uint32_t tick = 0;
+    uint32_t ackedInput = 0;    // Last input sequence of the receiving client applied in this tick
+    std::vector<NetPlayerState> players;
+    std::vector<NetMonsterState> monsters;          // Sorted by id
+    std::vector<NetProjectileState> projectiles;    // Sorted by id
+
+    void clear();
+    const NetPlayerState* findPlayer(uint8_t clientId) const;
+};
+
+/**
+ * NetWriter - Appends little-endian values to a fixed buffer
+ */
+class NetWriter {
+private:
+    uint8_t* data;
+    size_t capacity;
+    size_t size;
+    bool overflowed;
+
+public:
+    NetWriter(uint8_t* buffer, size_t bufferCapacity);
+
+    void writeU8(uint8_t value);
+    void writeU16(uint16_t value);
+    void writeU32(uint32_t value);
+    void writeFloat(float value);
+    void writeVec3(const Vec3& value);
+    void writeBytes(const uint8_t* bytes, size_t count);
+    void writeHeader(NetPacketType type);
+
+    size_t getSize() const { return size; }
+    size_t getRemaining() const { return capacity - size; }
+    bool hasOverflowed() const { return overflowed; }
+    const uint8_t* getData() const { return data; }
+};
+
+/**
+ * NetReader - Reads little-endian values; any read past the end fails the reader
+ */
+class NetReader {
+private:
+    const uint8_t* data;
+    size_t size;
+    size_t offset;
+    bool failed;
+
+public:
+    NetReader(const uint8_t* buffer, size_t bufferSize);
+
+    uint8_t readU8();
+    uint16_t readU16();
+    uint32_t readU32();
+    float readFloat();
+    Vec3 readVec3();
+    const uint8_t* readBytes(size_t count);   // Points into the packet; nullptr if short
+    bool readHeader(NetPacketType& type); // False for foreign or truncated packets
+
+    bool isValid() const { return !failed; }
+    size_t getRemaining() const { return failed ? 0 : size - offset; }
+
+private:
+    bool require(size_t bytes);
+};
+
+/**
+ * BitWriter - Packs values of 1-32 bits, least significant bit first
+ */
+class BitWriter {
+private:
+    uint8_t* data;
+    size_t capacity;
+    size_t bitCount;
+    bool overflowed;
+
+public:
+    BitWriter(uint8_t* buffer, size_t bufferCapacity);
+
+    void writeBits(uint32_t value, int bits);
+    void writeBool(bool value) { writeBits(value ? 1u : 0u, 1); }
+
+    size_t getBitCount() const { return bitCount; }
+    size_t getSize() const { return (bitCount + 7) / 8; }
+    bool hasOverflowed() const { return overflowed; }
+};
+
+/**
+ * BitReader - Reads what BitWriter packed; any read past the end fails the reader
+ */
+class BitReader {
+private:
+    const uint8_t* data;
+    size_t bitSize;
+    size_t bitOffset;
+    bool failed;
+
+public:
+    BitReader(const uint8_t* buffer, size_t bufferSize);
+
+    uint32_t readBits(int bits);
+    bool readBool() { return readBits(1) != 0; }
+
+    bool isValid() const { return !failed; }
+    size_t getRemainingBits() const { return failed ? 0 : bitSize - bitOffset; }
+};
+
+/**
+ * Message encoding shared by server and client
+ */
+namespace NetMessages {
+
+void writeInputs(NetWriter& writer, const NetPlayerInput* inputs, int count);
+bool readInputs(NetReader& reader, std::vector<NetPlayerInput>& inputs);
+
+void writePlayerState(NetWriter& writer, const NetPlayerState& player);
+NetPlayerState readPlayerState(NetReader& reader);
+
+} // namespace NetMessages
+
+// Server-side movement; the client runs the same function to predict its player
+void applyPlayerInput(NetPlayerState& player, const NetPlayerInput& input);
+
+// Camera forward vector for the given view angles
+Vec3 getViewDirection(float yaw, float pitch);
+
+} // namespace Engine
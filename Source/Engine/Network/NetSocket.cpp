@@ -0,0 +1,209 @@
+/**
+ * NetSocket.cpp - Implementation of Non-Blocking UDP Sockets
+ */
+
+#include "NetSocket.h"
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#ifdef _MSC_VER
+#pragma comment(lib, "ws2_32.lib")
+#endif
+#else
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace Engine {
+
+namespace {
+
+#ifdef _WIN32
+const uintptr_t INVALID_HANDLE = static_cast<uintptr_t>(INVALID_SOCKET);
+typedef int SocketLength;
+#else
+const int INVALID_HANDLE = -1;
+typedef socklen_t SocketLength;
+#endif
+
+std::mutex socketLibraryMutex;
+int socketLibraryUsers = 0;
+
+bool acquireSocketLibrary() {
+    std::lock_guard<std::mutex> lock(socketLibraryMutex);
+#ifdef _WIN32
+    if (socketLibraryUsers == 0) {
+        WSADATA data;
+        if (WSAStartup(MAKEWORD(2, 2), &data) != 0) {
+            return false;
+        }
+    }
+#endif
+    socketLibraryUsers++;
+    return true;
+}
+
+void releaseSocketLibrary() {
+    std::lock_guard<std::mutex> lock(socketLibraryMutex);
+    if (socketLibraryUsers == 0) return;
+    socketLibraryUsers--;
+#ifdef _WIN32
+    if (socketLibraryUsers == 0) {
+        WSACleanup();
+    }
+#endif
+}
+
+sockaddr_in toSockaddr(const NetAddress& address) {
+    sockaddr_in result;
+    std::memset(&result, 0, sizeof(result));
+    result.sin_family = AF_INET;
+    result.sin_addr.s_addr = htonl(address.ip);
+    result.sin_port = htons(address.port);
+    return result;
+}
+
+} // namespace
+
+// ===== NetAddress =====
+
+bool NetAddress::parse(const std::string& text, uint16_t defaultPort, NetAddress& out) {
+    std::string host = text;
+    uint16_t port = defaultPort;
+
+    size_t colon = text.rfind(':');
+    if (colon != std::string::npos) {
+        host = text.substr(0, colon);
+        int parsedPort = std::atoi(text.c_str() + colon + 1);
+        if (parsedPort <= 0 || parsedPort > 65535) return false;
+        port = static_cast<uint16_t>(parsedPort);
+    }
+    if (host.empty() || port == 0) return false;
+
+    in_addr numeric;
+    if (inet_pton(AF_INET, host.c_str(), &numeric) == 1) {
+        out = NetAddress(ntohl(numeric.s_addr), port);
+        return true;
+    }
+
+    // Host name: first IPv4 result
+    if (!acquireSocketLibrary()) return false;
+    addrinfo hints;
+    std::memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_DGRAM;
+    addrinfo* results = nullptr;
+    bool resolved = getaddrinfo(host.c_str(), nullptr, &hints, &results) == 0 && results;
+    if (resolved) {
+        const sockaddr_in* address = reinterpret_cast<const sockaddr_in*>(results->ai_addr);
+        out = NetAddress(ntohl(address->sin_addr.s_addr), port);
+    }
+    if (results) freeaddrinfo(results);
+    releaseSocketLibrary();
+    return resolved;
+}
+
+std::string NetAddress::toString() const {
+    return std::to_string((ip >> 24) & 0xFF) + "." + std::to_string((ip >> 16) & 0xFF) + "." +
+           std::to_string((ip >> 8) & 0xFF) + "." + std::to_string(ip & 0xFF) + ":" + std::to_string(port);
+}
+
+// ===== UdpSocket =====
+
+UdpSocket::UdpSocket() : handle(INVALID_HANDLE), localPort(0) {
+}
+
+UdpSocket::~UdpSocket() {
+    close();
+}
+
+bool UdpSocket::open(uint16_t port) {
+    close();
+    if (!acquireSocketLibrary()) {
+        std::cerr << "UdpSocket: socket library unavailable" << std::endl;
+        return false;
+    }
+
+    handle = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (handle == INVALID_HANDLE) {
+        std::cerr << "UdpSocket: socket() failed" << std::endl;
+        releaseSocketLibrary();
+        return false;
+    }
+
+    sockaddr_in address = toSockaddr(NetAddress(INADDR_ANY, port));
+    if (bind(handle, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+        std::cerr << "UdpSocket: cannot bind port " << port << std::endl;
+        close();
+        return false;
+    }
+
+#ifdef _WIN32
+    u_long nonBlocking = 1;
+    bool configured = ioctlsocket(handle, FIONBIO, &nonBlocking) == 0;
+#else
+    bool configured = fcntl(handle, F_SETFL, fcntl(handle, F_GETFL, 0) | O_NONBLOCK) == 0;
+#endif
+    if (!configured) {
+        std::cerr << "UdpSocket: cannot make socket non-blocking" << std::endl;
+        close();
+        return false;
+    }
+
+    sockaddr_in bound;
+    SocketLength length = sizeof(bound);
+    localPort = getsockname(handle, reinterpret_cast<sockaddr*>(&bound), &length) == 0 ? ntohs(bound.sin_port) : port;
+    return true;
+}
+
+void UdpSocket::close() {
+    if (handle == INVALID_HANDLE) return;
+#ifdef _WIN32
+    closesocket(handle);
+#else
+    ::close(handle);
+#endif
+    handle = INVALID_HANDLE;
+    localPort = 0;
+    releaseSocketLibrary();
+}
+
+bool UdpSocket::isOpen() const {
+    return handle != INVALID_HANDLE;
+}
+
+bool UdpSocket::send(const NetAddress& destination, const void* data, size_t size) {
+    if (handle == INVALID_HANDLE) return false;
+    sockaddr_in address = toSockaddr(destination);
+    int sent = static_cast<int>(sendto(handle, static_cast<const char*>(data), static_cast<int>(size), 0,
+                                       reinterpret_cast<const sockaddr*>(&address), sizeof(address)));
+    return sent == static_cast<int>(size);
+}
+
+int UdpSocket::receive(NetAddress& sender, void* buffer, size_t capacity) {
+    if (handle == INVALID_HANDLE) return -1;
+    sockaddr_in address;
+    SocketLength length = sizeof(address);
+    int received = static_cast<int>(recvfrom(handle, static_cast<char*>(buffer), static_cast<int>(capacity), 0,
+                                             reinterpret_cast<sockaddr*>(&address), &length));
+    if (received < 0) return -1; // Would block, or an ICMP error from an earlier send
+    sender = NetAddress(ntohl(address.sin_addr.s_addr), ntohs(address.sin_port));
+    return received;
+}
+
+} // namespace Engine
@@ -0,0 +1,76 @@
+/**
+ * NetSocket.h - Non-Blocking UDP Sockets
+ *
+ * OVERVIEW:
+ * Thin portable wrapper over BSD sockets / Winsock for the replication
+ * layer. Sockets are always non-blocking: receive() returns immediately
+ * when nothing is queued, so the server tick and the client update can
+ * drain them once per tick without a network thread.
+ *
+ * FEATURES:
+ * - IPv4 addresses with "host[:port]" parsing (dotted quad or resolvable name)
+ * - Bind to a fixed port (server) or an ephemeral one (client)
+ * - Winsock started on first use and shut down with the last socket
+ * - GL-free: part of ww3_core
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Engine {
+
+/**
+ * NetAddress - IPv4 address and port in host byte order
+ */
+struct NetAddress {
+    uint32_t ip = 0;
+    uint16_t port = 0;
+
+    NetAddress() = default;
+    NetAddress(uint32_t address, uint16_t portNumber) : ip(address), port(portNumber) {}
+
+    static NetAddress loopback(uint16_t port) { return NetAddress(0x7F000001u, port); }
+
+    // "127.0.0.1", "127.0.0.1:27015" or "hostname[:port]"; defaultPort when none is given
+    static bool parse(const std::string& text, uint16_t defaultPort, NetAddress& out);
+
+    std::string toString() const;
+    bool isValid() const { return ip != 0 && port != 0; }
+
+    bool operator==(const NetAddress& other) const { return ip == other.ip && port == other.port; }
+    bool operator!=(const NetAddress& other) const { return !(*this == other); }
+};
+
+/**
+ * UdpSocket - Non-blocking datagram socket
+ */
+class UdpSocket {
+private:
+#ifdef _WIN32
+    uintptr_t handle;   // SOCKET
+#else
+    int handle;
+#endif
+    uint16_t localPort;
+
+public:
+    UdpSocket();
+    ~UdpSocket();
+    UdpSocket(const UdpSocket&) = delete;
+    UdpSocket& operator=(const UdpSocket&) = delete;
+
+    // port 0 binds an ephemeral port (see getLocalPort())
+    bool open(uint16_t port = 0);
+    void close();
+    bool isOpen() const;
+    uint16_t getLocalPort() const { return localPort; }
+
+    bool send(const NetAddress& destination, const void* data, size_t size);
+
+    // Bytes received into buffer, or -1 when no datagram is queued (or on error)
+    int receive(NetAddress& sender, void* buffer, size_t capacity);
+};
+
+} // namespace Engine
@@ -0,0 +1,600 @@
+/**
+ * SnapshotEncoder.cpp - Implementation of Delta-Compressed Snapshot Encoding
+ */
+
+#include "SnapshotEncoder.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+namespace Engine {
+
+namespace {
+
+const float POSITION_SCALE = 64.0f;         // 1/64 unit
+const float VELOCITY_SCALE = 16.0f;         // 1/16 unit per second
+const float TWO_PI = 6.28318530718f;
+const float HALF_PI = 1.57079632679f;
+
+// Positions and velocities: 24-bit signed, delta-coded in one of four sizes
+const int WIDE_BITS = 24;
+const int32_t WIDE_MIN = -(1 << (WIDE_BITS - 1));
+const int32_t WIDE_MAX = (1 << (WIDE_BITS - 1)) - 1;
+const int DELTA_BITS[3] = {6, 10, 15};      // Zigzag delta; the fourth size is the absolute value
+
+const int UNSIGNED_BITS[4] = {4, 8, 16, 32};
+
+// Protocol header + tick, baseline tick, acknowledged input
+const size_t HEADER_BYTES = 5 + 4 + 4 + 4;
+
+const float REMOVAL_PRIORITY = FLT_MAX / 2.0f;
+
+/**
+ * Field layout per kind; a width of 0 marks a delta-coded wide field
+ */
+struct KindSchema {
+    int fieldCount;
+    int bits[QuantizedEntity::MAX_FIELDS];
+};
+
+const KindSchema SCHEMAS[QuantizedWorld::KIND_COUNT] = {
+    {6, {0, 0, 0, 12, 10, 7}},      // Player: position, yaw, pitch, health
+    {7, {0, 0, 0, 8, 8, 3, 2}},     // Monster: position, yaw, health, state, type
+    {7, {0, 0, 0, 0, 0, 0, 3}}      // Projectile: position, velocity, type
+};
+
+const std::vector<QuantizedEntity> NO_ENTITIES;
+
+// ===== Quantization =====
+
+int32_t quantizeWide(float value, float scale) {
+    float scaled = value * scale;
+    if (!(scaled == scaled)) return 0;
+    scaled = std::max(static_cast<float>(WIDE_MIN), std::min(static_cast<float>(WIDE_MAX), scaled));
+    return static_cast<int32_t>(std::lround(scaled));
+}
+
+int32_t quantizeTurns(float turns, int bits) {
+    if (!std::isfinite(turns)) return 0;
+    float fraction = turns - std::floor(turns);
+    return static_cast<int32_t>(std::lround(fraction * (1 << bits))) & ((1 << bits) - 1);
+}
+
+int32_t quantizeRange(float value, float minimum, float maximum, int bits) {
+    if (!(value == value)) value = minimum;
+    float t = (std::max(minimum, std::min(maximum, value)) - minimum) / (maximum - minimum);
+    return static_cast<int32_t>(std::lround(t * ((1 << bits) - 1)));
+}
+
+float dequantizeRange(int32_t value, float minimum, float maximum, int bits) {
+    return minimum + (maximum - minimum) * value / static_cast<float>((1 << bits) - 1);
+}
+
+int32_t clampBits(int value, int bits) {
+    return std::max(0, std::min((1 << bits) - 1, value));
+}
+
+// ===== Bit coding =====
+
+uint32_t zigzag(int32_t value) {
+    return (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+}
+
+int32_t unzigzag(uint32_t value) {
+    return static_cast<int32_t>(value >> 1) ^ -static_cast<int32_t>(value & 1);
+}
+
+int getDeltaClass(int32_t value, int32_t base) {
+    uint32_t delta = zigzag(value - base);
+    for (int i = 0; i < 3; i++) {
+        if (delta < (1u << DELTA_BITS[i])) return i;
+    }
+    return 3;
+}
+
+int getFieldBits(const KindSchema& schema, int field, int32_t value, int32_t base) {
+    if (schema.bits[field] > 0) return schema.bits[field];
+    int deltaClass = getDeltaClass(value, base);
+    return 2 + (deltaClass < 3 ? DELTA_BITS[deltaClass] : WIDE_BITS);
+}
+
+void writeField(BitWriter& writer, const KindSchema& schema, int field, int32_t value, int32_t base) {
+    if (schema.bits[field] > 0) {
+        writer.writeBits(static_cast<uint32_t>(value), schema.bits[field]);
+        return;
+    }
+    int deltaClass = getDeltaClass(value, base);
+    writer.writeBits(static_cast<uint32_t>(deltaClass), 2);
+    if (deltaClass < 3) {
+        writer.writeBits(zigzag(value - base), DELTA_BITS[deltaClass]);
+    } else {
+        writer.writeBits(static_cast<uint32_t>(value) & ((1u << WIDE_BITS) - 1), WIDE_BITS);
+    }
+}
+
+int32_t readField(BitReader& reader, const KindSchema& schema, int field, int32_t base) {
+    if (schema.bits[field] > 0) {
+        return static_cast<int32_t>(reader.readBits(schema.bits[field]));
+    }
+    int deltaClass = static_cast<int>(reader.readBits(2));
+    if (deltaClass < 3) {
+        // Wrapping add: a forged delta must not be undefined behaviour
+        uint32_t delta = static_cast<uint32_t>(unzigzag(reader.readBits(DELTA_BITS[deltaClass])));
+        int32_t value = static_cast<int32_t>(static_cast<uint32_t>(base) + delta);
+        return std::max(WIDE_MIN, std::min(WIDE_MAX, value));
+    }
+    uint32_t value = reader.readBits(WIDE_BITS);
+    if (value & (1u << (WIDE_BITS - 1))) value |= ~((1u << WIDE_BITS) - 1);
+    return static_cast<int32_t>(value);
+}
+
+int getUnsignedBits(uint32_t value) {
+    for (int i = 0; i < 3; i++) {
+        if (value < (1ull << UNSIGNED_BITS[i])) return 2 + UNSIGNED_BITS[i];
+    }
+    return 2 + UNSIGNED_BITS[3];
+}
+
+void writeUnsigned(BitWriter& writer, uint32_t value) {
+    int sizeClass = 0;
+    while (sizeClass < 3 && value >= (1ull << UNSIGNED_BITS[sizeClass])) sizeClass++;
+    writer.writeBits(static_cast<uint32_t>(sizeClass), 2);
+    writer.writeBits(value, UNSIGNED_BITS[sizeClass]);
+}
+
+uint32_t readUnsigned(BitReader& reader) {
+    int sizeClass = static_cast<int>(reader.readBits(2));
+    return reader.readBits(UNSIGNED_BITS[sizeClass]);
+}
+
+// Ids ascend within a list: a consecutive id is one bit, otherwise the gap follows
+void writeId(BitWriter& writer, uint32_t id, int64_t& previous) {
+    uint32_t gap = static_cast<uint32_t>(id - previous - 1);
+    writer.writeBool(gap == 0);
+    if (gap != 0) writeUnsigned(writer, gap - 1);
+    previous = id;
+}
+
+bool readId(BitReader& reader, int64_t& previous, uint32_t& id) {
+    int64_t gap = reader.readBool() ? 0 : static_cast<int64_t>(readUnsigned(reader)) + 1;
+    int64_t value = previous + 1 + gap;
+    if (value > UINT32_MAX) return false;
+    id = static_cast<uint32_t>(value);
+    previous = value;
+    return true;
+}
+
+// Upper bound for an id whatever precedes it in the list
+int getWorstIdBits(uint32_t id) {
+    return 1 + getUnsignedBits(id);
+}
+
+/**
+ * Baseline - removals + updates, in id order. The encoder records the client's
+ * world with it and the decoder rebuilds that world with it: both must agree bit for bit.
+ */
+void mergeDelta(const std::vector<QuantizedEntity>& baseline, const std::vector<uint32_t>* baselineSent,
+                const std::vector<uint32_t>& removed, const std::vector<QuantizedEntity>& updated, uint32_t tick,
+                std::vector<QuantizedEntity>& out, std::vector<uint32_t>* outSent) {
+    out.clear();
+    if (outSent) outSent->clear();
+
+    size_t b = 0, r = 0, u = 0;
+    while (b < baseline.size() || u < updated.size()) {
+        if (u < updated.size() && (b == baseline.size() || updated[u].id <= baseline[b].id)) {
+            if (b < baseline.size() && baseline[b].id == updated[u].id) b++;
+            out.push_back(updated[u++]);
+            if (outSent) outSent->push_back(tick);
+            continue;
+        }
+        uint32_t id = baseline[b].id;
+        while (r < removed.size() && removed[r] < id) r++;
+        if (r == removed.size() || removed[r] != id) {
+            out.push_back(baseline[b]);
+            if (outSent) outSent->push_back(baselineSent ? (*baselineSent)[b] : 0);
+        }
+        b++;
+    }
+}
+
+uint32_t getChangeMask(const KindSchema& schema, const QuantizedEntity& entity, const QuantizedEntity* baseline,
+                       uint32_t& bits) {
+    static const QuantizedEntity zero;
+    const QuantizedEntity& base = baseline ? *baseline : zero;
+    uint32_t mask = 0;
+    bits = schema.fieldCount;
+    for (int f = 0; f < schema.fieldCount; f++) {
+        if (entity.fields[f] == base.fields[f]) continue;
+        mask |= 1u << f;
+        bits += getFieldBits(schema, f, entity.fields[f], base.fields[f]);
+    }
+    return mask;
+}
+
+} // namespace
+
+const int QuantizedEntity::MAX_FIELDS;
+const int QuantizedWorld::KIND_COUNT;
+
+// ===== QuantizedWorld =====
+
+void QuantizedWorld::clear() {
+    tick = 0;
+    for (std::vector<QuantizedEntity>& list : entities) {
+        list.clear();
+    }
+}
+
+void QuantizedWorld::quantize(const WorldSnapshot& snapshot, QuantizedWorld& out) {
+    out.clear();
+    out.tick = snapshot.tick;
+
+    std::vector<QuantizedEntity>& players = out.get(ReplicatedKind::Player);
+    for (const NetPlayerState& player : snapshot.players) {
+        QuantizedEntity entity;
+        entity.id = player.clientId;
+        entity.fields[0] = quantizeWide(player.position.x, POSITION_SCALE);
+        entity.fields[1] = quantizeWide(player.position.y, POSITION_SCALE);
+        entity.fields[2] = quantizeWide(player.position.z, POSITION_SCALE);
+        entity.fields[3] = quantizeTurns(player.yaw / TWO_PI, SCHEMAS[0].bits[3]);
+        entity.fields[4] = quantizeRange(player.pitch, -HALF_PI, HALF_PI, SCHEMAS[0].bits[4]);
+        entity.fields[5] = clampBits(static_cast<int>(std::lround(std::max(0.0f, player.health))), SCHEMAS[0].bits[5]);
+        players.push_back(entity);
+    }
+    std::sort(players.begin(), players.end(),
+              [](const QuantizedEntity& a, const QuantizedEntity& b) { return a.id < b.id; });
+
+    std::vector<QuantizedEntity>& monsters = out.get(ReplicatedKind::Monster);
+    for (const NetMonsterState& monster : snapshot.monsters) {
+        QuantizedEntity entity;
+        entity.id = monster.id;
+        entity.fields[0] = quantizeWide(monster.position.x, POSITION_SCALE);
+        entity.fields[1] = quantizeWide(monster.position.y, POSITION_SCALE);
+        entity.fields[2] = quantizeWide(monster.position.z, POSITION_SCALE);
+        entity.fields[3] = quantizeTurns(monster.yawDegrees / 360.0f, SCHEMAS[1].bits[3]);
+        entity.fields[4] = quantizeRange(monster.healthPercent, 0.0f, 1.0f, SCHEMAS[1].bits[4]);
+        entity.fields[5] = clampBits(monster.state, SCHEMAS[1].bits[5]);
+        entity.fields[6] = clampBits(monster.type, SCHEMAS[1].bits[6]);
+        monsters.push_back(entity);
+    }
+
+    std::vector<QuantizedEntity>& projectiles = out.get(ReplicatedKind::Projectile);
+    for (const NetProjectileState& projectile : snapshot.projectiles) {
+        QuantizedEntity entity;
+        entity.id = projectile.id;
+        entity.fields[0] = quantizeWide(projectile.position.x, POSITION_SCALE);
+        entity.fields[1] = quantizeWide(projectile.position.y, POSITION_SCALE);
+        entity.fields[2] = quantizeWide(projectile.position.z, POSITION_SCALE);
+        entity.fields[3] = quantizeWide(projectile.velocity.x, VELOCITY_SCALE);
+        entity.fields[4] = quantizeWide(projectile.velocity.y, VELOCITY_SCALE);
+        entity.fields[5] = quantizeWide(projectile.velocity.z, VELOCITY_SCALE);
+        entity.fields[6] = clampBits(projectile.type, SCHEMAS[2].bits[6]);
+        projectiles.push_back(entity);
+    }
+}
+
+void QuantizedWorld::dequantize(const QuantizedWorld& world, WorldSnapshot& out) {
+    out.tick = world.tick;
+    out.players.clear();
+    out.monsters.clear();
+    out.projectiles.clear();
+
+    for (const QuantizedEntity& entity : world.get(ReplicatedKind::Player)) {
+        NetPlayerState player;
+        player.clientId = static_cast<uint8_t>(entity.id);
+        player.position = Vec3(entity.fields[0], entity.fields[1], entity.fields[2]) * (1.0f / POSITION_SCALE);
+        player.yaw = entity.fields[3] * TWO_PI / (1 << SCHEMAS[0].bits[3]);
+        player.pitch = dequantizeRange(entity.fields[4], -HALF_PI, HALF_PI, SCHEMAS[0].bits[4]);
+        player.health = static_cast<float>(entity.fields[5]);
+        out.players.push_back(player);
+    }
+
+    for (const QuantizedEntity& entity : world.get(ReplicatedKind::Monster)) {
+        NetMonsterState monster;
+        monster.id = entity.id;
+        monster.position = Vec3(entity.fields[0], entity.fields[1], entity.fields[2]) * (1.0f / POSITION_SCALE);
+        monster.yawDegrees = entity.fields[3] * 360.0f / (1 << SCHEMAS[1].bits[3]);
+        monster.healthPercent = dequantizeRange(entity.fields[4], 0.0f, 1.0f, SCHEMAS[1].bits[4]);
+        monster.state = static_cast<uint8_t>(entity.fields[5]);
+        monster.type = static_cast<uint8_t>(entity.fields[6]);
+        out.monsters.push_back(monster);
+    }
+
+    for (const QuantizedEntity& entity : world.get(ReplicatedKind::Projectile)) {
+        NetProjectileState projectile;
+        projectile.id = entity.id;
+        projectile.position = Vec3(entity.fields[0], entity.fields[1], entity.fields[2]) * (1.0f / POSITION_SCALE);
+        projectile.velocity = Vec3(entity.fields[3], entity.fields[4], entity.fields[5]) * (1.0f / VELOCITY_SCALE);
+        projectile.type = static_cast<uint8_t>(entity.fields[6]);
+        out.projectiles.push_back(projectile);
+    }
+}
+
+// ===== SnapshotEncoder =====
+
+const float SnapshotEncoder::RELEVANCE_DISTANCE = 20.0f;
+const float SnapshotEncoder::VIEW_CONE_COS = 0.5f;
+const float SnapshotEncoder::OUT_OF_VIEW_WEIGHT = 0.5f;
+const float SnapshotEncoder::PLAYER_WEIGHT = 4.0f;
+
+SnapshotEncoder::SnapshotEncoder(size_t byteBudget)
+    : byteBudget(byteBudget) {
+}
+
+void SnapshotEncoder::reset() {
+    for (ClientView& view : history) {
+        view.valid = false;
+    }
+}
+
+void SnapshotEncoder::setByteBudget(size_t bytes) {
+    byteBudget = bytes;
+}
+
+const SnapshotEncoder::ClientView* SnapshotEncoder::findBaseline(uint32_t ackedSnapshot, uint32_t tick) const {
+    if (ackedSnapshot == 0 || ackedSnapshot >= tick || tick - ackedSnapshot >= NetProtocol::SNAPSHOT_HISTORY) {
+        return nullptr;
+    }
+    const ClientView& view = history[ackedSnapshot % NetProtocol::SNAPSHOT_HISTORY];
+    return (view.valid && view.world.tick == ackedSnapshot) ? &view : nullptr;
+}
+
+float SnapshotEncoder::getRelevance(ReplicatedKind kind, const QuantizedEntity& entity,
+                                    const SnapshotViewer& viewer) const {
+    Vec3 position = Vec3(entity.fields[0], entity.fields[1], entity.fields[2]) * (1.0f / POSITION_SCALE);
+    Vec3 offset = position - viewer.position;
+    float distance = offset.length();
+
+    float relevance = 1.0f / (1.0f + distance / RELEVANCE_DISTANCE);
+    if (distance > 0.001f && offset.dot(viewer.direction) < VIEW_CONE_COS * distance) {
+        relevance *= OUT_OF_VIEW_WEIGHT;
+    }
+    if (kind == ReplicatedKind::Player) relevance *= PLAYER_WEIGHT;
+    return relevance;
+}
+
+bool SnapshotEncoder::encode(const QuantizedWorld& world, uint32_t ackedSnapshot, uint32_t ackedInput,
+                             const SnapshotViewer& viewer, NetWriter& out, SnapshotEncodeStats* stats) {
+    static const ClientView emptyView;
+    const ClientView* baseline = findBaseline(ackedSnapshot, world.tick);
+    const ClientView& base = baseline ? *baseline : emptyView;
+
+    // Everything that differs from the baseline, with its exact size but the worst-case id
+    candidates.clear();
+    size_t kindEnd[QuantizedWorld::KIND_COUNT];
+    int64_t countBits = 0;
+    for (int k = 0; k < QuantizedWorld::KIND_COUNT; k++) {
+        const KindSchema& schema = SCHEMAS[k];
+        const std::vector<QuantizedEntity>& current = world.entities[k];
+        const std::vector<QuantizedEntity>& previous = base.world.entities[k];
+        const std::vector<uint32_t>& sent = base.sentTicks[k];
+        uint32_t removalCount = 0, updateCount = 0;
+
+        size_t i = 0, j = 0;
+        while (i < current.size() || j < previous.size()) {
+            if (j < previous.size() && (i == current.size() || previous[j].id < current[i].id)) {
+                candidates.push_back(Candidate{REMOVAL_PRIORITY, previous[j].id, 0,
+                                               static_cast<uint32_t>(getWorstIdBits(previous[j].id)), true, false,
+                                               nullptr, nullptr});
+                removalCount++;
+                j++;
+                continue;
+            }
+
+            const QuantizedEntity& entity = current[i++];
+            const QuantizedEntity* before = nullptr;
+            uint32_t lastSent = 0;
+            if (j < previous.size() && previous[j].id == entity.id) {
+                before = &previous[j];
+                lastSent = sent[j];
+                j++;
+            }
+
+            uint32_t bits = 0;
+            uint32_t mask = getChangeMask(schema, entity, before, bits);
+            if (mask == 0) continue;
+
+            ReplicatedKind kind = static_cast<ReplicatedKind>(k);
+            float priority = (kind == ReplicatedKind::Player && entity.id == viewer.clientId)
+                                 ? FLT_MAX
+                                 : getRelevance(kind, entity, viewer) * static_cast<float>(world.tick - lastSent);
+            candidates.push_back(Candidate{priority, entity.id, mask,
+                                           bits + static_cast<uint32_t>(getWorstIdBits(entity.id)), false, false,
+                                           &entity, before});
+            updateCount++;
+        }
+        countBits += getUnsignedBits(removalCount) + getUnsignedBits(updateCount);
+        kindEnd[k] = candidates.size();
+    }
+
+    size_t capacity = std::min(byteBudget, out.getRemaining());
+    if (capacity < HEADER_BYTES) return false;
+    int64_t available = static_cast<int64_t>(capacity - HEADER_BYTES) * 8 - countBits;
+
+    int64_t totalBits = 0;
+    for (const Candidate& candidate : candidates) {
+        totalBits += candidate.bits;
+    }
+
+    int deferred = 0;
+    if (totalBits <= available) {
+        for (Candidate& candidate : candidates) {
+            candidate.selected = true;
+        }
+    } else {
+        // Most urgent first while it fits; smaller records may still fill the tail
+        order.resize(candidates.size());
+        for (size_t i = 0; i < order.size(); i++) {
+            order[i] = static_cast<uint32_t>(i);
+        }
+        std::sort(order.begin(), order.end(), [this](uint32_t a, uint32_t b) {
+            if (candidates[a].priority != candidates[b].priority) return candidates[a].priority > candidates[b].priority;
+            return a < b;
+        });
+        for (uint32_t index : order) {
+            Candidate& candidate = candidates[index];
+            candidate.selected = candidate.bits <= available;
+            if (candidate.selected) {
+                available -= candidate.bits;
+            } else {
+                deferred++;
+            }
+        }
+    }
+
+    out.writeHeader(NetPacketType::Snapshot);
+    out.writeU32(world.tick);
+    out.writeU32(baseline ? ackedSnapshot : 0);
+    out.writeU32(ackedInput);
+
+    // Wire order: by kind, removals before updates, ascending ids (the order candidates were found in)
+    bitBuffer.resize(capacity - HEADER_BYTES);
+    BitWriter bits(bitBuffer.data(), bitBuffer.size());
+    int entitiesSent = 0, removalsSent = 0;
+    size_t first = 0;
+    for (int k = 0; k < QuantizedWorld::KIND_COUNT; k++) {
+        const KindSchema& schema = SCHEMAS[k];
+        removals[k].clear();
+        updates[k].clear();
+
+        size_t last = kindEnd[k];
+        for (size_t c = first; c < last; c++) {
+            if (!candidates[c].selected) continue;
+            if (candidates[c].removal) {
+                removals[k].push_back(candidates[c].id);
+            } else {
+                updates[k].push_back(*candidates[c].entity);
+            }
+        }
+
+        writeUnsigned(bits, static_cast<uint32_t>(removals[k].size()));
+        int64_t previousId = -1;
+        for (uint32_t id : removals[k]) {
+            writeId(bits, id, previousId);
+        }
+
+        writeUnsigned(bits, static_cast<uint32_t>(updates[k].size()));
+        previousId = -1;
+        for (size_t c = first; c < last; c++) {
+            const Candidate& candidate = candidates[c];
+            if (!candidate.selected || candidate.removal) continue;
+            writeId(bits, candidate.id, previousId);
+            bits.writeBits(candidate.mask, schema.fieldCount);
+            for (int f = 0; f < schema.fieldCount; f++) {
+                if (candidate.mask & (1u << f)) {
+                    writeField(bits, schema, f, candidate.entity->fields[f], candidate.baseline ? candidate.baseline->fields[f] : 0);
+                }
+            }
+        }
+
+        removalsSent += static_cast<int>(removals[k].size());
+        entitiesSent += static_cast<int>(updates[k].size());
+        first = last;
+    }
+    if (bits.hasOverflowed()) return false;
+    out.writeBytes(bitBuffer.data(), bits.getSize());
+    if (out.hasOverflowed()) return false;
+
+    // What the client will hold once this snapshot arrives
+    ClientView& view = history[world.tick % NetProtocol::SNAPSHOT_HISTORY];
+    for (int k = 0; k < QuantizedWorld::KIND_COUNT; k++) {
+        mergeDelta(base.world.entities[k], &base.sentTicks[k], removals[k], updates[k], world.tick,
+                   view.world.entities[k], &view.sentTicks[k]);
+    }
+    view.world.tick = world.tick;
+    view.valid = true;
+
+    if (stats) {
+        stats->bytes = HEADER_BYTES + bits.getSize();
+        stats->entitiesSent = entitiesSent;
+        stats->removalsSent = removalsSent;
+        stats->entitiesDeferred = deferred;
+        stats->delta = baseline != nullptr;
+    }
+    return true;
+}
+
+// ===== SnapshotDecoder =====
+
+SnapshotDecoder::SnapshotDecoder() {
+    reset();
+}
+
+void SnapshotDecoder::reset() {
+    for (bool& slot : valid) {
+        slot = false;
+    }
+    latestTick = 0;
+}
+
+bool SnapshotDecoder::decode(NetReader& reader, WorldSnapshot& out) {
+    uint32_t tick = reader.readU32();
+    uint32_t baselineTick = reader.readU32();
+    uint32_t ackedInput = reader.readU32();
+    if (!reader.isValid() || tick == 0 || tick <= latestTick) return false;
+
+    const QuantizedWorld* baseline = nullptr;
+    if (baselineTick != 0) {
+        if (baselineTick >= tick || tick - baselineTick >= NetProtocol::SNAPSHOT_HISTORY) return false;
+        size_t slot = baselineTick % NetProtocol::SNAPSHOT_HISTORY;
+        if (!valid[slot] || history[slot].tick != baselineTick) return false;
+        baseline = &history[slot];
+    }
+
+    size_t size = reader.getRemaining();
+    const uint8_t* body = reader.readBytes(size);
+    BitReader bits(body, body ? size : 0);
+
+    for (int k = 0; k < QuantizedWorld::KIND_COUNT; k++) {
+        const KindSchema& schema = SCHEMAS[k];
+        const std::vector<QuantizedEntity>& previous = baseline ? baseline->entities[k] : NO_ENTITIES;
+        removals[k].clear();
+        updates[k].clear();
+
+        // Every id costs at least one bit: a larger count is a forged packet
+        uint32_t count = readUnsigned(bits);
+        if (count > bits.getRemainingBits()) return false;
+        int64_t previousId = -1;
+        for (uint32_t i = 0; i < count; i++) {
+            uint32_t id;
+            if (!readId(bits, previousId, id)) return false;
+            removals[k].push_back(id);
+        }
+
+        count = readUnsigned(bits);
+        if (count > bits.getRemainingBits()) return false;
+        previousId = -1;
+        size_t cursor = 0;  // Ids ascend: walk the baseline alongside
+        for (uint32_t i = 0; i < count; i++) {
+            uint32_t id;
+            if (!readId(bits, previousId, id)) return false;
+            while (cursor < previous.size() && previous[cursor].id < id) cursor++;
+            const QuantizedEntity* before = (cursor < previous.size() && previous[cursor].id == id) ? &previous[cursor] : nullptr;
+            QuantizedEntity entity = before ? *before : QuantizedEntity();
+            entity.id = id;
+            uint32_t mask = bits.readBits(schema.fieldCount);
+            for (int f = 0; f < schema.fieldCount; f++) {
+                if (mask & (1u << f)) entity.fields[f] = readField(bits, schema, f, entity.fields[f]);
+            }
+            updates[k].push_back(entity);
+        }
+        if (!bits.isValid()) return false;
+    }
+
+    // The baseline slot is at least one tick older, never this one
+    size_t slot = tick % NetProtocol::SNAPSHOT_HISTORY;
+    QuantizedWorld& world = history[slot];
+    for (int k = 0; k < QuantizedWorld::KIND_COUNT; k++) {
+        mergeDelta(baseline ? baseline->entities[k] : NO_ENTITIES, nullptr, removals[k], updates[k], tick,
+                   world.entities[k], nullptr);
+    }
+    world.tick = tick;
+    valid[slot] = true;
+    latestTick = tick;
+
+    QuantizedWorld::dequantize(world, out);
+    out.ackedInput = ackedInput;
+    return true;
+}
+
+} // namespace Engine
@@ -0,0 +1,180 @@
+/**
+ * SnapshotEncoder.h - Delta-Compressed, Quantized Snapshot Encoding
+ *
+ * OVERVIEW:
+ * Turns a WorldSnapshot into the body of a Snapshot packet and back. The
+ * server remembers, per client, the world that client holds after each
+ * snapshot it was sent; the client reports the newest snapshot it decoded in
+ * every Input packet, and the next snapshot is encoded as a delta against
+ * that one (against an empty world until the first acknowledgement):
+ * - Fields are quantized first: positions to 1/64 unit, velocities to
+ *   1/16 unit/s, angles and health to a few bits
+ * - Each entity record carries a change mask and only the changed fields;
+ *   positions and velocities as the smallest of four signed delta sizes
+ * - Ids are sorted and gap-coded, so runs of consecutive ids cost one bit
+ * - Entities gone since the baseline are listed by id
+ *
+ * BUDGET:
+ * A snapshot is one datagram of at most the client's byte budget. The
+ * client's own player always goes out; removals come next; the other changed
+ * entities are ranked by relevance (near the client and in front of its view
+ * ranks higher) times the ticks since the client's baseline last had them,
+ * and are sent in that order while their size still fits. Entities left out
+ * stay at their baseline state on the client and rank higher next time.
+ *
+ * FEATURES:
+ * - Server and client build the world after each snapshot with the same
+ *   merge, so a delta is always taken against bit-identical state
+ * - The server quantizes the world once per snapshot tick for all clients
+ * - GL-free (ww3_core); Benchmarks/NetworkBenchmarks.cpp measures the size
+ *   and the encode/decode cost
+ */
+
+#pragma once
+#include "NetProtocol.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Engine {
+
+/**
+ * Entity kinds in a snapshot, in wire order
+ */
+enum class ReplicatedKind : uint8_t {
+    Player = 0,
+    Monster,
+    Projectile
+};
+
+/**
+ * One entity as integers (field meaning depends on the kind)
+ */
+struct QuantizedEntity {
+    static const int MAX_FIELDS = 7;
+
+    uint32_t id = 0;
+    int32_t fields[MAX_FIELDS] = {};
+};
+
+/**
+ * QuantizedWorld - A snapshot after quantization, entities sorted by id per kind
+ */
+struct QuantizedWorld {
+    static const int KIND_COUNT = 3;
+
+    uint32_t tick = 0;
+    std::vector<QuantizedEntity> entities[KIND_COUNT];
+
+    void clear();
+    std::vector<QuantizedEntity>& get(ReplicatedKind kind) { return entities[static_cast<int>(kind)]; }
+    const std::vector<QuantizedEntity>& get(ReplicatedKind kind) const { return entities[static_cast<int>(kind)]; }
+
+    static void quantize(const WorldSnapshot& snapshot, QuantizedWorld& out);
+    static void dequantize(const QuantizedWorld& world, WorldSnapshot& out);  // Leaves out.ackedInput alone
+};
+
+/**
+ * Where the receiving client is looking from (relevance ranking)
+ */
+struct SnapshotViewer {
+    uint8_t clientId = 0;
+    Vec3 position;
+    Vec3 direction = Vec3(0.0f, 0.0f, -1.0f);
+};
+
+/**
+ * What one encode() put into its packet
+ */
+struct SnapshotEncodeStats {
+    size_t bytes = 0;
+    int entitiesSent = 0;       // Updated or new entity records
+    int removalsSent = 0;
+    int entitiesDeferred = 0;   // Changed entities and removals left for a later snapshot
+    bool delta = false;         // False: encoded against an empty world
+};
+
+/**
+ * SnapshotEncoder - Server side, one per connected client
+ */
+class SnapshotEncoder {
+public:
+    static const float RELEVANCE_DISTANCE;  // Relevance halves at this distance
+    static const float VIEW_CONE_COS;       // Cosine of the half-angle treated as in view
+    static const float OUT_OF_VIEW_WEIGHT;
+    static const float PLAYER_WEIGHT;       // Other players over monsters and projectiles
+
+private:
+    struct ClientView {
+        QuantizedWorld world;
+        std::vector<uint32_t> sentTicks[QuantizedWorld::KIND_COUNT];  // Tick each entity was last written
+        bool valid = false;
+    };
+
+    struct Candidate {
+        float priority;
+        uint32_t id;
+        uint32_t mask;          // Changed fields; 0 for a removal
+        uint32_t bits;          // Size with the worst-case id gap
+        bool removal;
+        bool selected;
+        const QuantizedEntity* entity;
+        const QuantizedEntity* baseline;    // nullptr: new to the client, diffed against zero
+    };
+
+    ClientView history[NetProtocol::SNAPSHOT_HISTORY];
+    size_t byteBudget;
+
+    // Scratch, kept to avoid per-snapshot allocations
+    std::vector<Candidate> candidates;     // Per kind in id order
+    std::vector<uint32_t> order;            // Candidate indices by priority
+    std::vector<uint32_t> removals[QuantizedWorld::KIND_COUNT];
+    std::vector<QuantizedEntity> updates[QuantizedWorld::KIND_COUNT];
+    std::vector<uint8_t> bitBuffer;
+
+public:
+    explicit SnapshotEncoder(size_t byteBudget = NetProtocol::MAX_PACKET_SIZE);
+
+    // Forgets every baseline (a new client in this slot)
+    void reset();
+
+    void setByteBudget(size_t bytes);
+    size_t getByteBudget() const { return byteBudget; }
+
+    // Writes a whole Snapshot packet for world (tick must increase between
+    // calls) into out. ackedSnapshot is the newest tick the client decoded
+    // (0 = none); false if out is too small for the packet header.
+    bool encode(const QuantizedWorld& world, uint32_t ackedSnapshot, uint32_t ackedInput,
+                const SnapshotViewer& viewer, NetWriter& out, SnapshotEncodeStats* stats = nullptr);
+
+private:
+    const ClientView* findBaseline(uint32_t ackedSnapshot, uint32_t tick) const;
+    float getRelevance(ReplicatedKind kind, const QuantizedEntity& entity, const SnapshotViewer& viewer) const;
+};
+
+/**
+ * SnapshotDecoder - Client side
+ */
+class SnapshotDecoder {
+private:
+    QuantizedWorld history[NetProtocol::SNAPSHOT_HISTORY];
+    bool valid[NetProtocol::SNAPSHOT_HISTORY];
+    uint32_t latestTick;
+
+    std::vector<uint32_t> removals[QuantizedWorld::KIND_COUNT];
+    std::vector<QuantizedEntity> updates[QuantizedWorld::KIND_COUNT];
+
+public:
+    SnapshotDecoder();
+
+    void reset();
+
+    // Reads a Snapshot packet after its header; false for a stale tick, a
+    // baseline no longer held or a malformed body
+    bool decode(NetReader& reader, WorldSnapshot& out);
+
+    // Newest decoded tick, acknowledged in Input packets (0 = none yet)
+    uint32_t getLatestTick() const { return latestTick; }
+};
+
+} // namespace Engine
@@ -3,12 +3,14 @@
  */
 
 #include "BasicRenderer.h"
+#include "ReverseZ.h"
 #include <iostream>
 
 namespace Engine {
 
 BasicRenderer::BasicRenderer()
-    : windowWidth(600), windowHeight(600), isInitialized(false) {}
+    : windowWidth(600), windowHeight(600), isInitialized(false),
+      depthPrepassEnabled(true), depthOnly(false) {}
 
 BasicRenderer::~BasicRenderer() {
     cleanup();
@@ -29,6 +31,11 @@ bool BasicRenderer::initialize(int width, int height) {
     if (!loadTerrainShader()) {
         return false;
     }
+    
+    // Optional: without it the opaque pass simply runs without a prepass
+    if (!loadDepthPrepassShader()) {
+        depthPrepassShader.reset();
+    }
 
     updateProjectionMatrix();
     setClearColor(0.5f, 0.7f, 1.0f, 1.0f);
@@ -53,6 +60,11 @@ bool BasicRenderer::loadTerrainShader() {
     return terrainShader->loadFromFiles("Resources/Shaders/terrain_vertex.glsl", "Resources/Shaders/terrain_fragment.glsl");
 }
 
+bool BasicRenderer::loadDepthPrepassShader() {
+    depthPrepassShader = std::make_unique<Shader>();
+    return depthPrepassShader->loadFromFiles("Resources/Shaders/depth_prepass_vertex.glsl", "Resources/Shaders/depth_map_fragment.glsl");
+}
+
 void BasicRenderer::updateProjectionMatrix() {
     const float aspect = static_cast<float>(windowWidth) / static_cast<float>(windowHeight);
     const float fov = 45.0f * 3.14159f / 180.0f;
@@ -64,6 +76,7 @@ void BasicRenderer::updateProjectionMatrix() {
 void BasicRenderer::cleanup() {
     objectShader.reset();
     terrainShader.reset();
+    depthPrepassShader.reset();
     isInitialized = false;
 }
 
@@ -101,6 +114,7 @@ void BasicRenderer::renderMesh(const Mesh& mesh,
                                const Vec3& color,
                                bool useHeightColoring) const {
     if (!isInitialized) return;
+    if (renderDepthOnly(mesh, modelMatrix, camera)) return;
     
     // Use terrain shader for height-based coloring, object shader for regular objects
     Shader* shader = useHeightColoring ? terrainShader.get() : objectShader.get();
@@ -129,6 +143,37 @@ void BasicRenderer::renderMesh(const Mesh& mesh,
     mesh.render();
 }
 
+void BasicRenderer::beginDepthPrepass() {
+    glEnable(GL_DEPTH_TEST);
+    glDepthFunc(ReverseZ::depthLess());
+    glDepthMask(GL_TRUE);
+    glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+    depthOnly = true;
+}
+
+void BasicRenderer::beginPrepassShading() {
+    depthOnly = false;
+    glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+    glDepthFunc(GL_EQUAL);   // Only the surface that won the prepass is shaded
+    glDepthMask(GL_FALSE);
+}
+
+void BasicRenderer::endPrepassShading() {
+    glDepthFunc(ReverseZ::depthLess());
+    glDepthMask(GL_TRUE);
+}
+
+bool BasicRenderer::renderDepthOnly(const Mesh& mesh, const Mat4& modelMatrix, const Camera& camera) const {
+    if (!depthOnly || !depthPrepassShader) return false;
+    
+    depthPrepassShader->use();
+    depthPrepassShader->setMat4("model", modelMatrix);
+    depthPrepassShader->setMat4("view", camera.getViewMatrix());
+    depthPrepassShader->setMat4("projection", camera.getProjectionMatrix());
+    mesh.render();
+    return true;
+}
+
 void BasicRenderer::renderCrosshair(const Camera& camera) const {}
 
 float BasicRenderer::getAspectRatio() const {
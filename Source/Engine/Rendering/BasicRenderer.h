@@ -1,5 +1,11 @@
 /**
  * BasicRenderer.h - Concrete OpenGL Renderer Implementation
+ * 
+ * Also owns the optional depth prepass of the opaque pass: the opaque
+ * objects are drawn once depth-only (colour writes off, an empty fragment
+ * shader for renderMesh draws), then again with GL_EQUAL and depth writes
+ * off, so the lighting in the fragment shaders runs once per visible pixel
+ * instead of once per overdrawn layer.
  */
 
 #pragma once
@@ -20,7 +26,13 @@ private:
     std::unique_ptr<Shader> objectShader;
     // Shader used for terrain (with normals support)
     std::unique_ptr<Shader> terrainShader;
+    // Depth-only shader for the prepass (null when it failed to load)
+    std::unique_ptr<Shader> depthPrepassShader;
     bool isInitialized;
+    
+    // Depth prepass state
+    bool depthPrepassEnabled;
+    bool depthOnly;             // Between beginDepthPrepass() and beginPrepassShading()
 
 public:
     BasicRenderer();
@@ -57,11 +69,25 @@ public:
     Shader* getShader() const { return objectShader.get(); }
     // Get terrain shader for terrain rendering
     Shader* getTerrainShader() const { return terrainShader.get(); }
+    
+    // Depth prepass: draw the opaque objects between beginDepthPrepass() and
+    // beginPrepassShading(), then the same objects again up to endPrepassShading().
+    // Objects drawing with their own shader must use the same program in both.
+    void setDepthPrepassEnabled(bool enabled) { depthPrepassEnabled = enabled; }
+    bool isDepthPrepassEnabled() const { return depthPrepassEnabled && depthPrepassShader != nullptr; }
+    void beginDepthPrepass();
+    void beginPrepassShading();
+    void endPrepassShading();
+
+protected:
+    // Inside the depth-only half of the prepass, draws the mesh depth-only and returns true
+    bool renderDepthOnly(const Mesh& mesh, const Mat4& modelMatrix, const Camera& camera) const;
 
 private:
     bool initializeOpenGL();
     bool loadObjectShader();
     bool loadTerrainShader();
+    bool loadDepthPrepassShader();
     void updateProjectionMatrix();
 };
 
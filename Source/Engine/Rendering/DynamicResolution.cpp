@@ -0,0 +1,293 @@
+/**
+ * DynamicResolution.cpp - Implementation of GPU-Time Driven Render Scale
+ */
+
+#include "DynamicResolution.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace Engine {
+
+namespace {
+
+const float SCALE_STEP = 0.05f;          // Scales are quantized so the target size changes in visible steps only
+const float AVERAGE_WEIGHT = 0.1f;       // EMA weight of the newest GPU timing (~10 frame window)
+const float HEADROOM_RATIO = 0.85f;      // Scale up only below this fraction of the budget
+const int FRAMES_BEFORE_SCALE_UP = 30;   // Headroom must persist this long before scaling up
+const int FRAMES_BETWEEN_CHANGES = 8;    // Let the average settle after every change
+
+float quantizeScale(float scale) {
+    return std::round(scale / SCALE_STEP) * SCALE_STEP;
+}
+
+} // namespace
+
+DynamicResolution* DynamicResolution::activeInstance = nullptr;
+
+DynamicResolution::DynamicResolution()
+    : framebuffer(0), colorTexture(0), depthRenderbuffer(0), fullscreenVAO(0),
+      targetWidth(0), targetHeight(0), windowWidth(0), windowHeight(0),
+      enabled(true), currentScale(1.0f), minScale(0.5f), maxScale(1.0f),
+      gpuBudgetMs(12.0f), averageGpuMs(0.0f), framesUnderBudget(0), framesSinceChange(0),
+      sharpness(0.5f), queryIndex(0), hasTimerQueries(false), sceneActive(false) {
+    std::fill(queries, queries + QUERY_COUNT, 0u);
+    std::fill(queryPending, queryPending + QUERY_COUNT, false);
+}
+
+DynamicResolution::~DynamicResolution() {
+    cleanup();
+}
+
+bool DynamicResolution::initialize(int width, int height) {
+    upscaleShader = std::make_unique<Shader>();
+    if (!upscaleShader->loadFromFiles("Resources/Shaders/upscale_vertex.glsl", "Resources/Shaders/upscale_fragment.glsl")) {
+        std::cerr << "DynamicResolution: failed to load upscale shader" << std::endl;
+        upscaleShader.reset();
+        return false;
+    }
+
+    glGenVertexArrays(1, &fullscreenVAO);
+
+    // Timer queries are core since GL 3.3; without them the scale simply stays put
+    hasTimerQueries = GLEW_VERSION_3_3 || GLEW_ARB_timer_query;
+    if (hasTimerQueries) {
+        glGenQueries(QUERY_COUNT, queries);
+    }
+
+    windowWidth = width;
+    windowHeight = height;
+    return createTarget(width, height);
+}
+
+void DynamicResolution::cleanup() {
+    if (activeInstance == this) {
+        activeInstance = nullptr;
+    }
+    destroyTarget();
+
+    if (fullscreenVAO) {
+        glDeleteVertexArrays(1, &fullscreenVAO);
+        fullscreenVAO = 0;
+    }
+    if (queries[0]) {
+        glDeleteQueries(QUERY_COUNT, queries);
+        std::fill(queries, queries + QUERY_COUNT, 0u);
+        std::fill(queryPending, queryPending + QUERY_COUNT, false);
+    }
+    upscaleShader.reset();
+}
+
+void DynamicResolution::resize(int width, int height) {
+    if (width <= 0 || height <= 0) return; // Minimized
+    windowWidth = width;
+    windowHeight = height;
+    if (width != targetWidth || height != targetHeight) {
+        createTarget(width, height);
+    }
+}
+
+bool DynamicResolution::createTarget(int width, int height) {
+    destroyTarget();
+
+    glGenTextures(1, &colorTexture);
+    glBindTexture(GL_TEXTURE_2D, colorTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glGenRenderbuffers(1, &depthRenderbuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, depthRenderbuffer);
+    // Float depth: with reverse-Z its exponent keeps distant terrain from z-fighting
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH32F_STENCIL8, width, height);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    glGenFramebuffers(1, &framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, colorTexture, 0);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, depthRenderbuffer);
+
+    bool complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    if (!complete) {
+        std::cerr << "DynamicResolution: scene framebuffer incomplete" << std::endl;
+        destroyTarget();
+        return false;
+    }
+
+    targetWidth = width;
+    targetHeight = height;
+    return true;
+}
+
+void DynamicResolution::destroyTarget() {
+    if (framebuffer) {
+        glDeleteFramebuffers(1, &framebuffer);
+        framebuffer = 0;
+    }
+    if (colorTexture) {
+        glDeleteTextures(1, &colorTexture);
+        colorTexture = 0;
+    }
+    if (depthRenderbuffer) {
+        glDeleteRenderbuffers(1, &depthRenderbuffer);
+        depthRenderbuffer = 0;
+    }
+    targetWidth = 0;
+    targetHeight = 0;
+}
+
+int DynamicResolution::getScaledWidth() const {
+    return std::max(1, static_cast<int>(windowWidth * getScale() + 0.5f));
+}
+
+int DynamicResolution::getScaledHeight() const {
+    return std::max(1, static_cast<int>(windowHeight * getScale() + 0.5f));
+}
+
+void DynamicResolution::beginScene() {
+    if (!enabled || !isValid() || !upscaleShader) return;
+
+    collectGpuTimings();
+    updateScale();
+
+    if (hasTimerQueries && !queryPending[queryIndex]) {
+        glBeginQuery(GL_TIME_ELAPSED, queries[queryIndex]);
+    }
+
+    sceneActive = true;
+    activeInstance = this;
+    bindSceneTarget();
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+}
+
+void DynamicResolution::endScene() {
+    if (!sceneActive) return;
+
+    if (hasTimerQueries && !queryPending[queryIndex]) {
+        glEndQuery(GL_TIME_ELAPSED);
+        queryPending[queryIndex] = true;
+        queryIndex = (queryIndex + 1) % QUERY_COUNT;
+    }
+
+    sceneActive = false;
+    activeInstance = nullptr;
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glViewport(0, 0, windowWidth, windowHeight);
+
+    // The fullscreen triangle covers every pixel, so depth is only cleared for the HUD passes
+    GLboolean depthTestWasEnabled = glIsEnabled(GL_DEPTH_TEST);
+    GLboolean blendWasEnabled = glIsEnabled(GL_BLEND);
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_BLEND);
+
+    float scale = getScale();
+    float uvScaleX = static_cast<float>(getScaledWidth()) / targetWidth;
+    float uvScaleY = static_cast<float>(getScaledHeight()) / targetHeight;
+
+    upscaleShader->use();
+    upscaleShader->setVec2("uvScale", Vec2(uvScaleX, uvScaleY));
+    upscaleShader->setVec2("texelSize", Vec2(1.0f / targetWidth, 1.0f / targetHeight));
+    upscaleShader->setFloat("sharpness", scale < 1.0f ? sharpness : 0.0f); // Nothing to recover at native scale
+    upscaleShader->setInt("sceneTexture", 0);
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, colorTexture);
+    glBindVertexArray(fullscreenVAO);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    glBindVertexArray(0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glClear(GL_DEPTH_BUFFER_BIT);
+    if (depthTestWasEnabled) glEnable(GL_DEPTH_TEST);
+    if (blendWasEnabled) glEnable(GL_BLEND);
+}
+
+bool DynamicResolution::bindSceneTarget() {
+    DynamicResolution* target = activeInstance;
+    if (!target || !target->sceneActive) {
+        return false;
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, target->framebuffer);
+    glViewport(0, 0, target->getScaledWidth(), target->getScaledHeight());
+    return true;
+}
+
+void DynamicResolution::collectGpuTimings() {
+    if (!hasTimerQueries) return;
+
+    // Oldest query first; stop at the first one the GPU has not finished so the CPU never stalls
+    for (int i = 0; i < QUERY_COUNT; i++) {
+        int index = (queryIndex + i) % QUERY_COUNT;
+        if (!queryPending[index]) continue;
+
+        GLint available = 0;
+        glGetQueryObjectiv(queries[index], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) break;
+
+        GLuint64 elapsedNs = 0;
+        glGetQueryObjectui64v(queries[index], GL_QUERY_RESULT, &elapsedNs);
+        queryPending[index] = false;
+
+        float elapsedMs = static_cast<float>(elapsedNs) / 1000000.0f;
+        averageGpuMs = (averageGpuMs <= 0.0f) ? elapsedMs
+                                              : averageGpuMs + (elapsedMs - averageGpuMs) * AVERAGE_WEIGHT;
+        framesSinceChange++;
+    }
+}
+
+void DynamicResolution::updateScale() {
+    if (averageGpuMs <= 0.0f || gpuBudgetMs <= 0.0f) return;
+    if (framesSinceChange < FRAMES_BETWEEN_CHANGES) return;
+
+    float newScale = currentScale;
+    if (averageGpuMs > gpuBudgetMs) {
+        // GPU time scales roughly with pixel count, i.e. with scale squared
+        newScale = currentScale * std::sqrt(gpuBudgetMs / averageGpuMs);
+        newScale = std::min(newScale, currentScale - SCALE_STEP);
+        framesUnderBudget = 0;
+    } else if (averageGpuMs < gpuBudgetMs * HEADROOM_RATIO) {
+        if (++framesUnderBudget >= FRAMES_BEFORE_SCALE_UP) {
+            newScale = currentScale + SCALE_STEP;
+            framesUnderBudget = 0;
+        }
+    } else {
+        framesUnderBudget = 0;
+    }
+
+    newScale = std::max(minScale, std::min(maxScale, quantizeScale(newScale)));
+    if (std::fabs(newScale - currentScale) > 0.001f) {
+        currentScale = newScale;
+        framesSinceChange = 0;
+    }
+}
+
+void DynamicResolution::setEnabled(bool enable) {
+    enabled = enable;
+    if (!enabled && sceneActive) {
+        endScene();
+    }
+}
+
+void DynamicResolution::setScaleRange(float minimum, float maximum) {
+    minScale = std::max(0.25f, std::min(1.0f, minimum));
+    maxScale = std::max(minScale, std::min(1.0f, maximum));
+    currentScale = std::max(minScale, std::min(maxScale, currentScale));
+}
+
+void DynamicResolution::setSharpness(float amount) {
+    sharpness = std::max(0.0f, std::min(1.0f, amount));
+}
+
+void DynamicResolution::setScale(float scale) {
+    currentScale = std::max(minScale, std::min(maxScale, quantizeScale(scale)));
+    framesUnderBudget = 0;
+    framesSinceChange = 0;
+}
+
+} // namespace Engine
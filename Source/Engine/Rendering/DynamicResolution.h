@@ -0,0 +1,108 @@
+/**
+ * DynamicResolution.h - GPU-Time Driven Render Scale for the 3D Scene
+ *
+ * OVERVIEW:
+ * The 3D scene (water passes, main scene, monsters, projectiles, health bars)
+ * is drawn into an offscreen target covering scale * window size. A GL
+ * TIME_ELAPSED query brackets the scene each frame; a rolling average of
+ * those timings steers the scale toward the GPU budget. endScene() upscales
+ * the target into the window with a sharpening filter, after which HUD
+ * elements (minimap, weapon, crosshair, AmmoUI) draw at native resolution.
+ *
+ * FEATURES:
+ * - Scale range 50-100% by default, quantized to 5% steps
+ * - Asymmetric controller: drops quickly when over budget, climbs back only
+ *   after a run of frames with clear headroom (no oscillation)
+ * - Target allocated once at window size; lower scales render into a
+ *   sub-rectangle, so scale changes never reallocate
+ * - Non-blocking GPU timing (query ring, results read when available)
+ * - Bilinear upscale plus contrast-clamped sharpening (no halos)
+ * - bindSceneTarget(): passes that temporarily render elsewhere (shadow
+ *   map, water reflection/refraction) return to the scene target through it
+ */
+
+#pragma once
+#include <GL/glew.h>
+#include <memory>
+#include "Shader.h"
+
+namespace Engine {
+
+/**
+ * DynamicResolution - Offscreen scene target whose size follows GPU time
+ */
+class DynamicResolution {
+public:
+    static const int QUERY_COUNT = 4; // Frames in flight for GPU timing
+
+private:
+    // Offscreen target (allocated at window size)
+    unsigned int framebuffer;
+    unsigned int colorTexture;
+    unsigned int depthRenderbuffer;
+    unsigned int fullscreenVAO; // Attribute-less VAO for the fullscreen triangle
+    std::unique_ptr<Shader> upscaleShader;
+    int targetWidth, targetHeight;
+    int windowWidth, windowHeight;
+
+    // Scale control
+    bool enabled;
+    float currentScale;
+    float minScale, maxScale;
+    float gpuBudgetMs;       // Scene GPU time to aim for
+    float averageGpuMs;      // Exponential moving average of scene GPU time
+    int framesUnderBudget;   // Consecutive frames with headroom, gates scaling up
+    int framesSinceChange;
+    float sharpness;         // 0 = plain bilinear, 1 = strongest sharpening
+
+    // GPU timing
+    unsigned int queries[QUERY_COUNT];
+    bool queryPending[QUERY_COUNT];
+    int queryIndex;
+    bool hasTimerQueries;
+    bool sceneActive;
+
+    // Active scene target, for passes that need to return to it
+    static DynamicResolution* activeInstance;
+
+public:
+    DynamicResolution();
+    ~DynamicResolution();
+
+    bool initialize(int width, int height);
+    void cleanup();
+    void resize(int width, int height);
+
+    // Frame usage: beginScene() -> 3D passes -> endScene() -> HUD passes
+    void beginScene();
+    void endScene(); // Upscales into the default framebuffer
+
+    // Rebinds the scene target and its scaled viewport; false when no scaled scene is in progress
+    static bool bindSceneTarget();
+
+    // Settings
+    void setEnabled(bool enable);
+    bool isEnabled() const { return enabled; }
+    void setScaleRange(float minimum, float maximum);
+    void setGpuBudgetMs(float budgetMs) { gpuBudgetMs = budgetMs; }
+    float getGpuBudgetMs() const { return gpuBudgetMs; }
+    void setSharpness(float amount);
+    float getSharpness() const { return sharpness; }
+    void setScale(float scale); // Manual override (the controller keeps adjusting from here)
+
+    // Status
+    float getScale() const { return enabled ? currentScale : 1.0f; }
+    float getAverageGpuMs() const { return averageGpuMs; }
+    int getScaledWidth() const;
+    int getScaledHeight() const;
+    bool isValid() const { return framebuffer != 0; }
+    bool isSceneActive() const { return sceneActive; } // Between beginScene() and endScene()
+
+private:
+    bool createTarget(int width, int height);
+    void destroyTarget();
+    void collectGpuTimings();
+    void updateScale();
+};
+
+} // namespace Engine
@@ -0,0 +1,184 @@
+/**
+ * GpuParticleEmitter.cpp - Implementation of Transform Feedback Particles
+ */
+
+#include "GpuParticleEmitter.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+namespace Engine {
+
+namespace {
+
+const size_t INITIAL_BURST_RECORDS = 256;
+
+} // namespace
+
+const int GpuParticleEmitter::MAX_BURST;
+
+GpuParticleEmitter::GpuParticleEmitter(const ParticleEmitterDesc& emitterDesc)
+    : desc(emitterDesc), capacity(std::max<size_t>(emitterDesc.capacity, 1)),
+      burstBuffer(0), burstVertexArray(0), burstBufferCapacity(0),
+      current(0), hasParticles(false) {
+    std::fill(buffers, buffers + 2, 0u);
+    std::fill(vertexArrays, vertexArrays + 2, 0u);
+    std::fill(feedbacks, feedbacks + 2, 0u);
+}
+
+GpuParticleEmitter::~GpuParticleEmitter() {
+    cleanup();
+}
+
+bool GpuParticleEmitter::isSupported() {
+    return GLEW_VERSION_4_0 || GLEW_ARB_transform_feedback2;
+}
+
+bool GpuParticleEmitter::initialize() {
+    glGenBuffers(2, buffers);
+    glGenVertexArrays(2, vertexArrays);
+    glGenTransformFeedbacks(2, feedbacks);
+
+    for (int i = 0; i < 2; i++) {
+        glBindBuffer(GL_ARRAY_BUFFER, buffers[i]);
+        glBufferData(GL_ARRAY_BUFFER, capacity * sizeof(GpuParticle), nullptr, GL_DYNAMIC_COPY);
+        setupAttributes(vertexArrays[i], buffers[i]);
+
+        glBindTransformFeedback(GL_TRANSFORM_FEEDBACK, feedbacks[i]);
+        glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, buffers[i]);
+    }
+    glBindTransformFeedback(GL_TRANSFORM_FEEDBACK, 0);
+
+    glGenBuffers(1, &burstBuffer);
+    glGenVertexArrays(1, &burstVertexArray);
+    burstBufferCapacity = INITIAL_BURST_RECORDS;
+    glBindBuffer(GL_ARRAY_BUFFER, burstBuffer);
+    glBufferData(GL_ARRAY_BUFFER, burstBufferCapacity * sizeof(GpuParticle), nullptr, GL_STREAM_DRAW);
+    setupAttributes(burstVertexArray, burstBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    current = 0;
+    hasParticles = false;
+    return true;
+}
+
+void GpuParticleEmitter::cleanup() {
+    if (feedbacks[0]) {
+        glDeleteTransformFeedbacks(2, feedbacks);
+        std::fill(feedbacks, feedbacks + 2, 0u);
+    }
+    if (vertexArrays[0]) {
+        glDeleteVertexArrays(2, vertexArrays);
+        std::fill(vertexArrays, vertexArrays + 2, 0u);
+    }
+    if (buffers[0]) {
+        glDeleteBuffers(2, buffers);
+        std::fill(buffers, buffers + 2, 0u);
+    }
+    if (burstVertexArray) {
+        glDeleteVertexArrays(1, &burstVertexArray);
+        burstVertexArray = 0;
+    }
+    if (burstBuffer) {
+        glDeleteBuffers(1, &burstBuffer);
+        burstBuffer = 0;
+    }
+    burstRecords.clear();
+    hasParticles = false;
+}
+
+void GpuParticleEmitter::setupAttributes(unsigned int vertexArray, unsigned int buffer) {
+    glBindVertexArray(vertexArray);
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    const GLsizei stride = sizeof(GpuParticle);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<void*>(offsetof(GpuParticle, position)));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<void*>(offsetof(GpuParticle, velocity)));
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2, 1, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<void*>(offsetof(GpuParticle, age)));
+    glEnableVertexAttribArray(3);
+    glVertexAttribPointer(3, 1, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<void*>(offsetof(GpuParticle, lifetime)));
+    glBindVertexArray(0);
+}
+
+void GpuParticleEmitter::queueBurst(const ParticleBurst& burst) {
+    uint32_t remaining = burst.count;
+    uint32_t chunk = 0;
+    while (remaining > 0) {
+        uint32_t particles = std::min<uint32_t>(remaining, MAX_BURST);
+        // 24-bit seeds are exact in a float attribute
+        uint32_t seed = (burst.seed + chunk * 0x9E3779B9u) & 0xFFFFFFu;
+
+        GpuParticle record;
+        record.position[0] = burst.position.x;
+        record.position[1] = burst.position.y;
+        record.position[2] = burst.position.z;
+        record.velocity[0] = burst.direction.x;
+        record.velocity[1] = burst.direction.y;
+        record.velocity[2] = burst.direction.z;
+        record.age = static_cast<float>(seed);
+        record.lifetime = -static_cast<float>(particles);
+        burstRecords.push_back(record);
+
+        remaining -= particles;
+        chunk++;
+    }
+}
+
+void GpuParticleEmitter::simulate(const Shader& updateShader, float deltaTime) {
+    if (!hasParticles && burstRecords.empty()) return;
+    if (deltaTime <= 0.0f && burstRecords.empty()) return;
+
+    // Upload this frame's burst records (orphaned each frame, grown when needed)
+    if (!burstRecords.empty()) {
+        glBindBuffer(GL_ARRAY_BUFFER, burstBuffer);
+        if (burstRecords.size() > burstBufferCapacity) {
+            burstBufferCapacity = std::max(burstRecords.size(), burstBufferCapacity * 2);
+        }
+        glBufferData(GL_ARRAY_BUFFER, burstBufferCapacity * sizeof(GpuParticle), nullptr, GL_STREAM_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, burstRecords.size() * sizeof(GpuParticle), burstRecords.data());
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    updateShader.use();
+    updateShader.setFloat("deltaTime", deltaTime);
+    updateShader.setFloat("damping", 1.0f / (1.0f + desc.drag * deltaTime));
+    updateShader.setFloat("gravityStep", desc.gravity * deltaTime);
+    updateShader.setFloat("lifetimeMin", desc.lifetimeMin);
+    updateShader.setFloat("lifetimeMax", desc.lifetimeMax);
+    updateShader.setFloat("speedMin", desc.speedMin);
+    updateShader.setFloat("speedMax", desc.speedMax);
+    updateShader.setFloat("minCosine", std::cos(std::min(desc.spread, 3.14159265f)));
+
+    // Live particles first, then the bursts, appended into the other buffer in one capture
+    const int next = 1 - current;
+    glEnable(GL_RASTERIZER_DISCARD);
+    glBindTransformFeedback(GL_TRANSFORM_FEEDBACK, feedbacks[next]);
+    glBeginTransformFeedback(GL_POINTS);
+    if (hasParticles) {
+        glBindVertexArray(vertexArrays[current]);
+        glDrawTransformFeedback(GL_POINTS, feedbacks[current]);
+    }
+    if (!burstRecords.empty()) {
+        glBindVertexArray(burstVertexArray);
+        glDrawArrays(GL_POINTS, 0, static_cast<GLsizei>(burstRecords.size()));
+    }
+    glEndTransformFeedback();
+    glBindTransformFeedback(GL_TRANSFORM_FEEDBACK, 0);
+    glBindVertexArray(0);
+    glDisable(GL_RASTERIZER_DISCARD);
+
+    current = next;
+    hasParticles = true;
+    burstRecords.clear();
+}
+
+void GpuParticleEmitter::draw() const {
+    if (!hasParticles) return;
+    glBindVertexArray(vertexArrays[current]);
+    glDrawTransformFeedback(GL_POINTS, feedbacks[current]);
+    glBindVertexArray(0);
+}
+
+} // namespace Engine
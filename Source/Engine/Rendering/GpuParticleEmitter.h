@@ -0,0 +1,86 @@
+/**
+ * GpuParticleEmitter.h - Transform Feedback Particle Simulation
+ *
+ * OVERVIEW:
+ * Simulates one GPU emitter (ParticleSimulation::Gpu) without the CPU ever
+ * touching its particles. Particles live in two vertex buffers used as
+ * ping-pong targets: each simulate() call draws the live buffer through the
+ * update program (vertex + geometry stage, rasterizer discarded) and
+ * captures the result into the other buffer with transform feedback.
+ * The geometry stage integrates live particles, drops expired ones and
+ * expands the frame's burst records into new particles, so emission,
+ * integration and death all happen on the GPU. Nothing is read back:
+ * both the next update and the draw use glDrawTransformFeedback, which
+ * takes the vertex count the GPU recorded (indirect draw without a count
+ * buffer).
+ *
+ * FEATURES:
+ * - Same ParticleEmitterDesc as the CPU pools (ramps, ranges, drag, gravity)
+ * - Bursts split into records of MAX_BURST particles, hashed seeds per record
+ * - Capacity overflow dropped by transform feedback itself
+ * - Requires GL 4.0 or ARB_transform_feedback2 (transform feedback objects
+ *   and glDrawTransformFeedback); callers fall back to CPU pools otherwise
+ */
+
+#pragma once
+#include <GL/glew.h>
+#include <vector>
+#include "Shader.h"
+#include "../Core/ParticleSystem.h"
+
+namespace Engine {
+
+/**
+ * GpuParticleEmitter - Ping-pong transform feedback buffers for one emitter
+ */
+class GpuParticleEmitter {
+public:
+    static const int MAX_BURST = 64; // Particles per burst record (max_vertices of the update shader)
+
+private:
+    struct GpuParticle {
+        float position[3];
+        float velocity[3];
+        float age;
+        float lifetime;     // Burst records: -count, with age = seed
+    };
+
+    ParticleEmitterDesc desc;
+    size_t capacity;
+    unsigned int buffers[2];
+    unsigned int vertexArrays[2];
+    unsigned int feedbacks[2];      // feedbacks[i] captures into buffers[i]
+    unsigned int burstBuffer;
+    unsigned int burstVertexArray;
+    size_t burstBufferCapacity;     // Records
+    int current;                    // Buffer holding the live particles
+    bool hasParticles;              // feedbacks[current] has recorded output
+    std::vector<GpuParticle> burstRecords;
+
+public:
+    explicit GpuParticleEmitter(const ParticleEmitterDesc& emitterDesc);
+    ~GpuParticleEmitter();
+    GpuParticleEmitter(const GpuParticleEmitter&) = delete;
+    GpuParticleEmitter& operator=(const GpuParticleEmitter&) = delete;
+
+    static bool isSupported();
+
+    bool initialize();
+    void cleanup();
+
+    // Emission recorded by ParticleSystem; expanded by the next simulate()
+    void queueBurst(const ParticleBurst& burst);
+
+    // Runs the update program over live particles and queued bursts (updateShader: particle_update_*)
+    void simulate(const Shader& updateShader, float deltaTime);
+
+    // Draws the live particles as points; the caller binds the render program and blend state
+    void draw() const;
+
+    const ParticleEmitterDesc& getDesc() const { return desc; }
+
+private:
+    static void setupAttributes(unsigned int vertexArray, unsigned int buffer);
+};
+
+} // namespace Engine
@@ -3,8 +3,9 @@
  */
 
 #include "LightingRenderer.h"
-#include "../Core/GameObject.h"
+#include "../Core/RenderSnapshot.h"
 #include "../Math/Camera.h"
+#include <algorithm>
 #include <iostream>
 
 namespace Engine {
@@ -108,6 +109,8 @@ void LightingRenderer::renderMesh(const Mesh& mesh, const Mat4& modelMatrix, con
 }
 
 void LightingRenderer::renderMeshWithMaterial(const Mesh& mesh, const Mat4& modelMatrix, const Camera& camera, const LightingMaterial& material) const {
+    if (renderDepthOnly(mesh, modelMatrix, camera)) return;
+    
     if (!lightingShader || !lightingShader->isValidShader()) {
         BasicRenderer::renderMesh(mesh, modelMatrix, camera, material.getDiffuse());
         return;
@@ -193,19 +196,32 @@ void LightingRenderer::updateMaterialUniforms(const Shader& shader, const Lighti
     shader.setFloat("material.shininess", material.getShininess());
 }
 
-void LightingRenderer::renderSceneWithShadows(const std::vector<GameObject*>& sceneObjects, const Camera& camera) {
+void LightingRenderer::renderSceneWithShadows(const std::vector<MeshDrawState>& draws, const Camera& camera) {
     if (!shadowMap || !shadowMap->isValid()) {
         return;
     }
     
     // First pass: Generate shadow maps
-    generateShadowMaps(sceneObjects, camera);
+    generateShadowMaps(draws, camera);
     
     // Second pass: Render scene with shadows
     if (!lightingShader || !lightingShader->isValidShader()) {
         return;
     }
     
+    // Front to back: the nearest surfaces fill the depth buffer first
+    sortOpaqueFrontToBack(draws, camera);
+    
+    // Depth prepass: lay down the final depth, then light only the fragments that match it
+    const bool prepass = isDepthPrepassEnabled();
+    if (prepass) {
+        beginDepthPrepass();
+        for (const auto& draw : opaqueDrawOrder) {
+            renderDepthOnly(*draw.second->mesh, draw.second->modelMatrix, camera);
+        }
+        beginPrepassShading();
+    }
+    
     // Use lighting shader for rendering with shadows
     lightingShader->use();
     
@@ -221,34 +237,51 @@ void LightingRenderer::renderSceneWithShadows(const std::vector<GameObject*>& sc
     lightingShader->setInt("numLightSpaceMatrices", static_cast<int>(lightSpaceMatrices.size()));
     
     // Render all scene objects with shadows
-    for (const auto& obj : sceneObjects) {
-        if (obj && obj->getMesh()) {
-            Mat4 modelMatrix = obj->getModelMatrix();
-            LightingMaterial material = defaultMaterial;
-            
-            // Set transformation matrices
-            lightingShader->setMat4("model", modelMatrix);
-            lightingShader->setMat4("view", camera.getViewMatrix());
-            lightingShader->setMat4("projection", camera.getProjectionMatrix());
-            
-            // Calculate and set normal matrix
-            Mat3 normalMatrix = calculateNormalMatrix(modelMatrix);
-            lightingShader->setMat3("normalMatrix", normalMatrix);
-            
-            // Set camera position
-            lightingShader->setVec3("viewPos", camera.getPosition());
-            
-            // Update light and material uniforms
-            updateLightUniforms(*lightingShader);
-            updateMaterialUniforms(*lightingShader, material);
-            
-            // Render the mesh
-            obj->getMesh()->render();
+    for (const auto& draw : opaqueDrawOrder) {
+        const Mat4& modelMatrix = draw.second->modelMatrix;
+        LightingMaterial material = defaultMaterial;
+        
+        // Set transformation matrices
+        lightingShader->setMat4("model", modelMatrix);
+        lightingShader->setMat4("view", camera.getViewMatrix());
+        lightingShader->setMat4("projection", camera.getProjectionMatrix());
+        
+        // Calculate and set normal matrix
+        Mat3 normalMatrix = calculateNormalMatrix(modelMatrix);
+        lightingShader->setMat3("normalMatrix", normalMatrix);
+        
+        // Set camera position
+        lightingShader->setVec3("viewPos", camera.getPosition());
+        
+        // Update light and material uniforms
+        updateLightUniforms(*lightingShader);
+        updateMaterialUniforms(*lightingShader, material);
+        
+        // Render the mesh
+        draw.second->mesh->render();
+    }
+    
+    if (prepass) {
+        endPrepassShading();
+    }
+}
+
+void LightingRenderer::sortOpaqueFrontToBack(const std::vector<MeshDrawState>& draws, const Camera& camera) {
+    opaqueDrawOrder.clear();
+    const Vec3 cameraPosition = camera.getPosition();
+    for (const MeshDrawState& draw : draws) {
+        // The water surface is translucent and must not occlude in the prepass
+        if (draw.mesh && !draw.triangles && draw.style != DrawStyle::Water) {
+            const Mat4& model = draw.modelMatrix;
+            Vec3 offset = Vec3(model.m[12], model.m[13], model.m[14]) - cameraPosition;
+            opaqueDrawOrder.emplace_back(offset.dot(offset), &draw);
         }
     }
+    std::sort(opaqueDrawOrder.begin(), opaqueDrawOrder.end(),
+              [](const std::pair<float, const MeshDrawState*>& a, const std::pair<float, const MeshDrawState*>& b) { return a.first < b.first; });
 }
 
-void LightingRenderer::generateShadowMaps(const std::vector<GameObject*>& sceneObjects, const Camera& camera) {
+void LightingRenderer::generateShadowMaps(const std::vector<MeshDrawState>& draws, const Camera& camera) {
     if (!shadowMap || !shadowMap->isValid()) return;
     
     // Calculate light space matrices for all directional lights
@@ -265,9 +298,9 @@ void LightingRenderer::generateShadowMaps(const std::vector<GameObject*>& sceneO
     }
     
     // Render all scene objects to depth map
-    for (const auto& obj : sceneObjects) {
-        if (obj && obj->getMesh()) {
-            Mat4 modelMatrix = obj->getModelMatrix();
+    for (const MeshDrawState& draw : draws) {
+        if (draw.mesh && !draw.triangles && draw.style != DrawStyle::Water) {
+            const Mat4& modelMatrix = draw.modelMatrix;
             
                                 // Set model matrix for depth map shader
                     if (shadowMap->getDepthMapShader()) {
@@ -275,7 +308,7 @@ void LightingRenderer::generateShadowMaps(const std::vector<GameObject*>& sceneO
                     }
             
             // Render mesh to depth map
-            obj->getMesh()->render();
+            draw.mesh->render();
         }
     }
     
@@ -10,6 +10,8 @@
  * - Material-based rendering
  * - Normal-based lighting calculations
  * - Integration with existing rendering pipeline
+ * - Shadowed scene pass sorted front to back, with the BasicRenderer depth
+ *   prepass so the light loops run once per visible pixel
  */
 
 #pragma once
@@ -18,11 +20,13 @@
 #include "LightingMaterial.h"
 #include "ShadowMap.h"
 #include <memory>
+#include <utility>
+#include <vector>
 
 namespace Engine {
 
 // Forward declarations
-class GameObject;
+struct MeshDrawState;
 class Camera;
 
 /**
@@ -41,12 +45,16 @@ private:
     std::unique_ptr<ShadowMap> shadowMap;
     LightingMaterial defaultMaterial;
     
+    // Opaque draws of the shadowed scene pass: squared camera distance, draw (reused per frame)
+    std::vector<std::pair<float, const MeshDrawState*>> opaqueDrawOrder;
+    
     // Normal matrix calculation
     Mat3 calculateNormalMatrix(const Mat4& modelMatrix) const;
     
     // Shadow mapping
-    void generateShadowMaps(const std::vector<GameObject*>& sceneObjects, const Camera& camera);
+    void generateShadowMaps(const std::vector<MeshDrawState>& draws, const Camera& camera);
     std::vector<Mat4> calculateLightSpaceMatrices() const;
+    void sortOpaqueFrontToBack(const std::vector<MeshDrawState>& draws, const Camera& camera);
 
 public:
     // Constructor/Destructor
@@ -59,6 +67,7 @@ public:
     
     // Light management
     LightManager* getLightManager() { return lightManager.get(); }
+    ShadowMap* getShadowMap() { return shadowMap.get(); } // Filter kernel and quality presets
     void setupDefaultLighting();
     void setupDayLighting();
     void setupNightLighting();
@@ -74,7 +83,7 @@ public:
     void renderMeshWithMaterial(const Mesh& mesh, const Mat4& modelMatrix, const Camera& camera, const LightingMaterial& material) const;
     
     // Shadow mapping
-    void renderSceneWithShadows(const std::vector<GameObject*>& sceneObjects, const Camera& camera);
+    void renderSceneWithShadows(const std::vector<MeshDrawState>& draws, const Camera& camera); // Whole-mesh draws, water skipped
     void setupShadowRendering(const Shader& shader) const;
     
     // Light uniform management
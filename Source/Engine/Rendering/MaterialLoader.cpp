@@ -5,7 +5,7 @@
 #include "MaterialLoader.h"
 #include <fstream>
 #include <sstream>
-#include <iostream                                                                                                                                                                                                                                 >
+#include <iostream>
 #include <algorithm>
 
 namespace Engine {
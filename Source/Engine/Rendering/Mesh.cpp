@@ -11,16 +11,25 @@
 
 namespace Engine {
 
-Mesh::Mesh() : VAO(0), VBO(0), EBO(0), isInitialized(false) {}
+thread_local bool Mesh::deferVertexArrays = false;
+std::mutex Mesh::pendingVertexArrayMutex;
+std::vector<unsigned int> Mesh::pendingVertexArrayDeletes;
+
+Mesh::Mesh() : VAO(0), VBO(0), EBO(0), layout(VertexLayout::Position), isInitialized(false) {}
 
 Mesh::~Mesh() {
     cleanup();
 }
 
+bool Mesh::isGPUAvailable() {
+    // GLEW leaves its function pointers null until glewInit() succeeds on a current context
+    return glGenVertexArrays != nullptr;
+}
+
 Mesh::Mesh(Mesh&& other) noexcept 
     : VAO(other.VAO), VBO(other.VBO), EBO(other.EBO), 
       vertices(std::move(other.vertices)), indices(std::move(other.indices)),
-      isInitialized(other.isInitialized) {
+      layout(other.layout), isInitialized(other.isInitialized) {
     // Reset the moved-from object
     other.VAO = other.VBO = other.EBO = 0;
     other.isInitialized = false;
@@ -37,6 +46,7 @@ Mesh& Mesh::operator=(Mesh&& other) noexcept {
         EBO = other.EBO;
         vertices = std::move(other.vertices);
         indices = std::move(other.indices);
+        layout = other.layout;
         isInitialized = other.isInitialized;
         
         // Reset the moved-from object
@@ -47,165 +57,144 @@ Mesh& Mesh::operator=(Mesh&& other) noexcept {
 }
 
 bool Mesh::createMesh(const std::vector<float>& vertexData, const std::vector<unsigned int>& indexData) {
-    // Clean up any existing mesh
-    cleanup();
-    
-    // Store data
-    vertices = vertexData;
-    indices = indexData;
-    
-    // Generate OpenGL objects
-    glGenVertexArrays(1, &VAO);
-    glGenBuffers(1, &VBO);
-    glGenBuffers(1, &EBO);
-    
-    glBindVertexArray(VAO);
-    
-    // Upload vertex data
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_STATIC_DRAW);
-    
-    // Upload index data
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
-    
-    // Configure vertex attributes (assuming position only: 3 floats per vertex)
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    
-    // Unbind
-    glBindVertexArray(0);
-    
-    isInitialized = true;
-    return true;
+    // Position only: 3 floats per vertex
+    return createWithLayout(vertexData, indexData, VertexLayout::Position);
 }
 
 bool Mesh::createMeshWithNormals(const std::vector<float>& vertexData, const std::vector<unsigned int>& indexData) {
-    
-    // Clean up any existing mesh
-    cleanup();
-    
-    // Store data
-    vertices = vertexData;
-    indices = indexData;
-    
-    // Generate OpenGL objects
-    glGenVertexArrays(1, &VAO);
-    glGenBuffers(1, &VBO);
-    glGenBuffers(1, &EBO);
-    
-    
-    glBindVertexArray(VAO);
-    
-    // Upload vertex data
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_STATIC_DRAW);
-    
-    // Upload index data
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
-    
-    // Configure vertex attributes for position + normal (6 floats per vertex)
-    // Position attribute (location = 0)
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    
-    // Normal attribute (location = 1)
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    
-    // Unbind
-    glBindVertexArray(0);
-    
-    isInitialized = true;
-    return true;
+    // Position + normal: 6 floats per vertex
+    return createWithLayout(vertexData, indexData, VertexLayout::PositionNormal);
 }
 
 bool Mesh::createMeshWithTexCoords(const std::vector<float>& vertexData, const std::vector<unsigned int>& indexData) {
+    // Position + texture coordinates: 5 floats per vertex
+    return createWithLayout(vertexData, indexData, VertexLayout::PositionTexCoord);
+}
+
+bool Mesh::createMeshWithNormalsAndTexCoords(const std::vector<float>& vertexData, const std::vector<unsigned int>& indexData) {
+    // Position + normal + texture coordinates: 8 floats per vertex
+    return createWithLayout(vertexData, indexData, VertexLayout::PositionNormalTexCoord);
+}
+
+bool Mesh::createWithLayout(const std::vector<float>& vertexData, const std::vector<unsigned int>& indexData, VertexLayout vertexLayout) {
     // Clean up any existing mesh
     cleanup();
     
     // Store data
     vertices = vertexData;
     indices = indexData;
+    layout = vertexLayout;
     
-    // Generate OpenGL objects
-    glGenVertexArrays(1, &VAO);
+    // Headless (no GL context, e.g. benchmarks and tools): keep CPU-side data only
+    if (!isGPUAvailable()) {
+        return true;
+    }
+    
+    // Buffers are shared between the render and loader contexts, so they are uploaded right away
     glGenBuffers(1, &VBO);
     glGenBuffers(1, &EBO);
     
-    glBindVertexArray(VAO);
-    
-    // Upload vertex data
     glBindBuffer(GL_ARRAY_BUFFER, VBO);
     glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
     
-    // Upload index data
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
     
-    // Configure vertex attributes for position + texture coordinates (5 floats per vertex)
-    // Position attribute (location = 0)
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    
-    // Texture coordinate attribute (location = 1)
-    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    
-    // Unbind
-    glBindVertexArray(0);
+    // Vertex arrays are per-context: on the simulation thread the VAO is built on first draw instead
+    if (!deferVertexArrays) {
+        createVertexArray();
+    }
     
     isInitialized = true;
     return true;
 }
 
-bool Mesh::createMeshWithNormalsAndTexCoords(const std::vector<float>& vertexData, const std::vector<unsigned int>& indexData) {
-    // Clean up any existing mesh
-    cleanup();
-    
-    // Store data
-    vertices = vertexData;
-    indices = indexData;
-    
-    // Generate OpenGL objects
+int Mesh::getFloatsPerVertex() const {
+    switch (layout) {
+        case VertexLayout::PositionNormal: return 6;
+        case VertexLayout::PositionTexCoord: return 5;
+        case VertexLayout::PositionNormalTexCoord: return 8;
+        case VertexLayout::Position:
+        default: return 3;
+    }
+}
+
+void Mesh::createVertexArray() const {
     glGenVertexArrays(1, &VAO);
-    glGenBuffers(1, &VBO);
-    glGenBuffers(1, &EBO);
-    
     glBindVertexArray(VAO);
-    
-    // Upload vertex data
     glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_STATIC_DRAW);
-    
-    // Upload index data
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
-    
-    // Configure vertex attributes for position + normal + texture coordinates (8 floats per vertex)
-    // Position attribute (location = 0)
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    
-    // Normal attribute (location = 1)
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
     
-    // Texture coordinate attribute (location = 2)
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(6 * sizeof(float)));
-    glEnableVertexAttribArray(2);
+    switch (layout) {
+        case VertexLayout::Position:
+            // Position attribute (location = 0)
+            glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+            glEnableVertexAttribArray(0);
+            break;
+            
+        case VertexLayout::PositionNormal:
+            // Position attribute (location = 0)
+            glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0);
+            glEnableVertexAttribArray(0);
+            // Normal attribute (location = 1)
+            glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float)));
+            glEnableVertexAttribArray(1);
+            break;
+            
+        case VertexLayout::PositionTexCoord:
+            // Position attribute (location = 0)
+            glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
+            glEnableVertexAttribArray(0);
+            // Texture coordinate attribute (location = 1)
+            glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
+            glEnableVertexAttribArray(1);
+            break;
+            
+        case VertexLayout::PositionNormalTexCoord:
+            // Position attribute (location = 0)
+            glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
+            glEnableVertexAttribArray(0);
+            // Normal attribute (location = 1)
+            glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(3 * sizeof(float)));
+            glEnableVertexAttribArray(1);
+            // Texture coordinate attribute (location = 2)
+            glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(6 * sizeof(float)));
+            glEnableVertexAttribArray(2);
+            break;
+    }
     
     // Unbind
     glBindVertexArray(0);
-    
-    isInitialized = true;
-    return true;
+}
+
+void Mesh::setDeferVertexArrays(bool defer) {
+    deferVertexArrays = defer;
+}
+
+void Mesh::releaseDeferredVertexArrays() {
+    std::vector<unsigned int> released;
+    {
+        std::lock_guard<std::mutex> lock(pendingVertexArrayMutex);
+        released.swap(pendingVertexArrayDeletes);
+    }
+    if (!released.empty()) {
+        glDeleteVertexArrays(static_cast<GLsizei>(released.size()), released.data());
+    }
 }
 
 void Mesh::cleanup() {
     if (isInitialized) {
-        glDeleteVertexArrays(1, &VAO);
+        if (VAO != 0) {
+            if (deferVertexArrays) {
+                // VAOs live in the render context - hand it to the render thread for deletion
+                std::lock_guard<std::mutex> lock(pendingVertexArrayMutex);
+                pendingVertexArrayDeletes.push_back(VAO);
+            } else {
+                glDeleteVertexArrays(1, &VAO);
+            }
+        }
         glDeleteBuffers(1, &VBO);
         glDeleteBuffers(1, &EBO);
         VAO = VBO = EBO = 0;
@@ -217,6 +206,9 @@ void Mesh::cleanup() {
 
 void Mesh::render() const {
     if (isInitialized) {
+        if (VAO == 0) {
+            createVertexArray();
+        }
         glBindVertexArray(VAO);
         glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indices.size()), GL_UNSIGNED_INT, 0);
         glBindVertexArray(0);
@@ -225,6 +217,9 @@ void Mesh::render() const {
 
 void Mesh::renderTriangles(const std::vector<unsigned int>& triangleIndices) const {
     if (isInitialized && !triangleIndices.empty()) {
+        if (VAO == 0) {
+            createVertexArray();
+        }
         glBindVertexArray(VAO);
         // Use glDrawRangeElements for better performance with subset rendering
         // Find min and max indices in the subset
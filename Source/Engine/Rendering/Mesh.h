@@ -10,10 +10,13 @@
  * - Vertex Buffer Object (VBO) and Element Buffer Object (EBO) handling
  * - Automatic resource cleanup
  * - Simple rendering interface
+ * - Headless fallback: CPU-side data only when no GL context exists
+ * - Deferred VAO creation for meshes built on the simulation thread
  */
 
 #pragma once
 #include <vector>
+#include <mutex>
 #include <GL/glew.h>
 #include "Math.h"
 
@@ -29,11 +32,27 @@ namespace Engine {
  * - Automatic resource management
  */
 class Mesh {
+public:
+    // Interleaved vertex formats supported by the create* functions
+    enum class VertexLayout {
+        Position,               // 3 floats
+        PositionNormal,         // 6 floats
+        PositionTexCoord,       // 5 floats
+        PositionNormalTexCoord  // 8 floats
+    };
+
 private:
-    unsigned int VAO, VBO, EBO;
+    mutable unsigned int VAO; // Built lazily on the render thread when created with deferred VAOs
+    unsigned int VBO, EBO;
     std::vector<float> vertices;
     std::vector<unsigned int> indices;
+    VertexLayout layout;
     bool isInitialized;
+    
+    // Simulation-thread support: VAOs are not shared between GL contexts
+    static thread_local bool deferVertexArrays;
+    static std::mutex pendingVertexArrayMutex;
+    static std::vector<unsigned int> pendingVertexArrayDeletes;
 
 public:
     // Constructor/Destructor
@@ -59,9 +78,16 @@ public:
     
     // Utility
     bool isValid() const { return isInitialized; }
+    static bool isGPUAvailable(); // False before GLEW is initialized (headless tools/benchmarks)
+    
+    // Threaded mode: meshes created on a thread with deferral enabled upload their buffers
+    // immediately but build the VAO on first draw; their VAOs are deleted by the render thread
+    static void setDeferVertexArrays(bool defer); // Per calling thread
+    static void releaseDeferredVertexArrays();    // Call on the render thread once per frame
     unsigned int getVertexCount() const { return static_cast<unsigned int>(vertices.size() / 3); } // Assuming 3 floats per vertex
     unsigned int getVertexCountWithNormals() const { return static_cast<unsigned int>(vertices.size() / 6); } // 6 floats per vertex (pos + normal)
     unsigned int getIndexCount() const { return static_cast<unsigned int>(indices.size()); }
+    int getFloatsPerVertex() const; // Stride of getVertices() for this mesh's layout
     
     // Data access
     const std::vector<float>& getVertices() const { return vertices; }
@@ -70,6 +96,10 @@ public:
     // Static helper methods for common shapes
     static Mesh createCube();
     static Mesh createGroundPlane(float size = 50.0f, float yPosition = -2.0f);
+    
+private:
+    bool createWithLayout(const std::vector<float>& vertexData, const std::vector<unsigned int>& indexData, VertexLayout vertexLayout);
+    void createVertexArray() const;
 };
 
 } // namespace Engine
\ No newline at end of file
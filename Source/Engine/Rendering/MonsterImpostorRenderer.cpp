@@ -0,0 +1,274 @@
+/**
+ * MonsterImpostorRenderer.cpp - Implementation of Baked Billboard Impostors
+ */
+
+#include "MonsterImpostorRenderer.h"
+#include "Mesh.h"
+#include "ReverseZ.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+
+namespace Engine {
+
+namespace {
+
+const float TWO_PI = 6.28318530718f;
+const float DEGREES_TO_RADIANS = 3.14159f / 180.0f; // Same constant as GameObject::getModelMatrix
+const float FRAME_PADDING = 1.05f;      // Keeps silhouettes off the frame border (no bleeding between views)
+const size_t INITIAL_CAPACITY = 256;
+
+} // namespace
+
+MonsterImpostorRenderer::MonsterImpostorRenderer()
+    : vertexArray(0), instanceBuffer(0), instanceCapacity(0),
+      atlasTexture(0), atlasColumns(1), atlasRows(1), bakedViewCount(0),
+      frameCenterHeight(0.0f), frameHalfExtent(1.0f),
+      cameraPosition(0.0f, 0.0f, 0.0f), meshCount(0) {
+}
+
+MonsterImpostorRenderer::~MonsterImpostorRenderer() {
+    cleanup();
+}
+
+bool MonsterImpostorRenderer::initialize() {
+    shader = std::make_unique<Shader>();
+    if (!shader->loadFromFiles("Resources/Shaders/impostor_vertex.glsl", "Resources/Shaders/impostor_fragment.glsl")) {
+        std::cerr << "MonsterImpostorRenderer: failed to load impostor shader" << std::endl;
+        shader.reset();
+        return false;
+    }
+
+    glGenVertexArrays(1, &vertexArray);
+    glGenBuffers(1, &instanceBuffer);
+
+    instanceCapacity = INITIAL_CAPACITY;
+    glBindVertexArray(vertexArray);
+    glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+    glBufferData(GL_ARRAY_BUFFER, instanceCapacity * sizeof(Instance), nullptr, GL_STREAM_DRAW);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, sizeof(Instance), reinterpret_cast<const void*>(offsetof(Instance, position)));
+    glVertexAttribDivisor(0, 1);
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(Instance), reinterpret_cast<const void*>(offsetof(Instance, scale)));
+    glVertexAttribDivisor(1, 1);
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    return true;
+}
+
+void MonsterImpostorRenderer::cleanup() {
+    destroyAtlas();
+    if (instanceBuffer) {
+        glDeleteBuffers(1, &instanceBuffer);
+        instanceBuffer = 0;
+    }
+    if (vertexArray) {
+        glDeleteVertexArrays(1, &vertexArray);
+        vertexArray = 0;
+    }
+    instanceCapacity = 0;
+    instances.clear();
+    shader.reset();
+}
+
+void MonsterImpostorRenderer::destroyAtlas() {
+    if (atlasTexture) {
+        glDeleteTextures(1, &atlasTexture);
+        atlasTexture = 0;
+    }
+    bakedViewCount = 0;
+}
+
+void MonsterImpostorRenderer::setSettings(const ImpostorSettings& newSettings) {
+    settings = newSettings;
+    settings.startDistance = std::max(0.0f, settings.startDistance);
+    settings.fadeDistance = std::max(0.0f, settings.fadeDistance);
+    settings.viewCount = std::max(1, std::min(64, settings.viewCount));
+    settings.frameSize = std::max(16, std::min(512, settings.frameSize));
+}
+
+// ===== Bake =====
+
+bool MonsterImpostorRenderer::bake(const Mesh& mesh, const std::vector<ImpostorMaterial>& materials, Shader& modelShader) {
+    const std::vector<float>& vertices = mesh.getVertices();
+    const int stride = mesh.getFloatsPerVertex();
+    if (!mesh.isValid() || vertices.size() < static_cast<size_t>(stride) || materials.empty()) return false;
+
+    // Square frame around the model's turning cylinder
+    float radius = 0.0f;
+    float minY = vertices[1], maxY = vertices[1];
+    for (size_t i = 0; i + 2 < vertices.size(); i += stride) {
+        radius = std::max(radius, std::sqrt(vertices[i] * vertices[i] + vertices[i + 2] * vertices[i + 2]));
+        minY = std::min(minY, vertices[i + 1]);
+        maxY = std::max(maxY, vertices[i + 1]);
+    }
+    float halfExtent = std::max(radius, (maxY - minY) * 0.5f) * FRAME_PADDING;
+    if (halfExtent <= 0.0f) return false;
+    float centerHeight = (minY + maxY) * 0.5f;
+
+    const int viewCount = settings.viewCount;
+    const int frameSize = settings.frameSize;
+    const int columns = static_cast<int>(std::ceil(std::sqrt(static_cast<float>(viewCount))));
+    const int rows = (viewCount + columns - 1) / columns;
+    const int atlasWidth = columns * frameSize;
+    const int atlasHeight = rows * frameSize;
+
+    // Whatever pass was bound (scene target, window) gets its state back afterwards
+    GLint previousFramebuffer = 0;
+    GLint previousViewport[4];
+    GLfloat previousClearColor[4];
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previousFramebuffer);
+    glGetIntegerv(GL_VIEWPORT, previousViewport);
+    glGetFloatv(GL_COLOR_CLEAR_VALUE, previousClearColor);
+    GLboolean depthTestEnabled = glIsEnabled(GL_DEPTH_TEST);
+    GLboolean blendEnabled = glIsEnabled(GL_BLEND);
+
+    destroyAtlas();
+    glGenTextures(1, &atlasTexture);
+    glBindTexture(GL_TEXTURE_2D, atlasTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, atlasWidth, atlasHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    unsigned int depthRenderbuffer = 0;
+    glGenRenderbuffers(1, &depthRenderbuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, depthRenderbuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, atlasWidth, atlasHeight);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    unsigned int framebuffer = 0;
+    glGenFramebuffers(1, &framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, atlasTexture, 0);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depthRenderbuffer);
+    bool complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+
+    if (complete) {
+        // Transparent background: the impostor shader cuts the silhouette out by alpha
+        glViewport(0, 0, atlasWidth, atlasHeight);
+        glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        glEnable(GL_DEPTH_TEST);
+        glDisable(GL_BLEND);
+
+        // Orthographic camera on +Z looking at the frame centre: screen right is +X
+        Mat4 view = lookAt(Vec3(0.0f, centerHeight, halfExtent * 2.0f), Vec3(0.0f, centerHeight, 0.0f), Vec3(0.0f, 1.0f, 0.0f));
+        Mat4 projection = orthographic(-halfExtent, halfExtent, -halfExtent, halfExtent, halfExtent * 0.5f, halfExtent * 3.5f);
+
+        modelShader.use();
+        modelShader.setMat4("view", view);
+        modelShader.setMat4("projection", projection);
+        modelShader.setInt("useHeightColoring", 0);
+        modelShader.setInt("useTexture", 0);
+
+        // View k shows the model turned by k/viewCount of a full turn
+        for (int k = 0; k < viewCount; k++) {
+            glViewport((k % columns) * frameSize, (k / columns) * frameSize, frameSize, frameSize);
+            modelShader.setMat4("model", rotateY(TWO_PI * static_cast<float>(k) / static_cast<float>(viewCount)));
+            for (const ImpostorMaterial& material : materials) {
+                if (!material.triangles) continue;
+                modelShader.setVec3("color", material.color);
+                mesh.renderTriangles(*material.triangles);
+            }
+        }
+
+        glBindTexture(GL_TEXTURE_2D, atlasTexture);
+        glGenerateMipmap(GL_TEXTURE_2D);
+    }
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(previousFramebuffer));
+    glDeleteFramebuffers(1, &framebuffer);
+    glDeleteRenderbuffers(1, &depthRenderbuffer);
+    glViewport(previousViewport[0], previousViewport[1], previousViewport[2], previousViewport[3]);
+    glClearColor(previousClearColor[0], previousClearColor[1], previousClearColor[2], previousClearColor[3]);
+    if (!depthTestEnabled) glDisable(GL_DEPTH_TEST);
+    if (blendEnabled) glEnable(GL_BLEND);
+
+    if (!complete) {
+        std::cerr << "MonsterImpostorRenderer: atlas framebuffer incomplete" << std::endl;
+        destroyAtlas();
+        return false;
+    }
+
+    atlasColumns = columns;
+    atlasRows = rows;
+    bakedViewCount = viewCount;
+    frameCenterHeight = centerHeight;
+    frameHalfExtent = halfExtent;
+    return true;
+}
+
+// ===== Per frame =====
+
+void MonsterImpostorRenderer::beginFrame(const Camera& camera) {
+    cameraPosition = camera.getPosition();
+    instances.clear();
+    meshCount = 0;
+}
+
+bool MonsterImpostorRenderer::add(const Vec3& position, float yawDegrees, float scale) {
+    if (!settings.enabled || !isBaked() || !shader) {
+        meshCount++;
+        return true;
+    }
+
+    float distance = (position - cameraPosition).length();
+    if (distance <= settings.startDistance) {
+        meshCount++;
+        return true;
+    }
+
+    float fade = settings.fadeDistance > 0.0f ? std::min(1.0f, (distance - settings.startDistance) / settings.fadeDistance) : 1.0f;
+    Instance instance = { { position.x, position.y, position.z }, yawDegrees * DEGREES_TO_RADIANS, scale, fade };
+    instances.push_back(instance);
+
+    // Inside the fade band both are drawn; the dithered impostor covers more of the mesh the further out it is
+    bool drawMesh = fade < 1.0f;
+    if (drawMesh) meshCount++;
+    return drawMesh;
+}
+
+void MonsterImpostorRenderer::render(const Camera& camera) {
+    if (instances.empty() || !shader || !isBaked()) return;
+
+    glBindVertexArray(vertexArray);
+    glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+    if (instances.size() > instanceCapacity) {
+        instanceCapacity = std::max(instances.size(), instanceCapacity * 2);
+    }
+    // Orphan, then fill: the driver hands out fresh storage while the GPU reads last frame's
+    glBufferData(GL_ARRAY_BUFFER, instanceCapacity * sizeof(Instance), nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, instances.size() * sizeof(Instance), instances.data());
+
+    shader->use();
+    shader->setMat4("view", camera.getViewMatrix());
+    shader->setMat4("projection", camera.getProjectionMatrix());
+    shader->setVec3("cameraPosition", camera.getPosition());
+    shader->setFloat("frameCenterHeight", frameCenterHeight);
+    shader->setFloat("frameHalfExtent", frameHalfExtent);
+    shader->setFloat("viewCount", static_cast<float>(bakedViewCount));
+    shader->setFloat("atlasColumns", static_cast<float>(atlasColumns));
+    shader->setFloat("atlasRows", static_cast<float>(atlasRows));
+    shader->setInt("atlas", 0);
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, atlasTexture);
+
+    // Opaque cut-outs: depth tested and written like the meshes they stand in for
+    glEnable(GL_DEPTH_TEST);
+    glDepthFunc(ReverseZ::depthLess());
+    glDepthMask(GL_TRUE);
+    glDisable(GL_BLEND);
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, static_cast<GLsizei>(instances.size()));
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+}
+
+} // namespace Engine
@@ -0,0 +1,123 @@
+/**
+ * MonsterImpostorRenderer.h - Baked Billboard Impostors for Distant Monsters
+ *
+ * OVERVIEW:
+ * Far-away monsters are a few pixels tall, yet the full OBJ mesh costs the
+ * same vertices and one draw per material group at any distance. The
+ * impostor renderer renders the monster model once, around a full turn of
+ * yaw angles, into a texture atlas. Beyond a configurable distance monsters
+ * are drawn as upright camera-facing quads that sample the baked view
+ * closest to the angle they are seen from; the whole far horde is one
+ * instanced draw of four vertices per monster.
+ *
+ * FEATURES:
+ * - Bake on the render thread from any monster view's mesh and material
+ *   colours (orthographic, the same shader the mesh is drawn with)
+ * - Cylindrical billboards: the quad turns only around the world up axis,
+ *   so monsters stay upright when seen from above
+ * - Adjacent baked views are blended by the fractional view angle, so
+ *   turning monsters do not pop between frames
+ * - Distance crossfade: over fadeDistance past startDistance the impostor
+ *   dithers in (screen-door, so it stays opaque and depth-written and needs
+ *   no sorting) while the mesh is still drawn; past that only the impostor
+ * - 24-byte instances streamed into an orphaned buffer each frame
+ *
+ * USAGE:
+ *   impostors.bake(*monster->getMesh(), materials, *monsterRenderer->getShader());
+ *   impostors.beginFrame(camera);
+ *   for each monster: if (impostors.add(position, yaw, scale)) monster->render(...);
+ *   impostors.render(camera);
+ */
+
+#pragma once
+#include <GL/glew.h>
+#include <memory>
+#include <vector>
+#include "Shader.h"
+#include "../Math/Camera.h"
+
+namespace Engine {
+
+class Mesh;
+
+/**
+ * ImpostorSettings - Distances and atlas layout
+ */
+struct ImpostorSettings {
+    bool enabled = true;
+    float startDistance = 40.0f;    // Impostors start fading in here (metres from the camera)
+    float fadeDistance = 6.0f;      // ...and replace the mesh this much further out
+    int viewCount = 16;             // Yaw angles baked around the model
+    int frameSize = 128;            // Pixels per baked view
+};
+
+/**
+ * ImpostorMaterial - One colour group of the baked model
+ */
+struct ImpostorMaterial {
+    const std::vector<unsigned int>* triangles; // Triangle list as passed to Mesh::renderTriangles
+    Vec3 color;
+};
+
+/**
+ * MonsterImpostorRenderer - Atlas bake plus one instanced draw per frame
+ */
+class MonsterImpostorRenderer {
+private:
+    struct Instance {
+        float position[3];  // Feet
+        float yaw;          // Radians, as the model matrix applies it
+        float scale;        // Uniform model scale
+        float fade;         // 0..1 dither coverage
+    };
+
+    ImpostorSettings settings;
+    std::unique_ptr<Shader> shader;
+    unsigned int vertexArray;
+    unsigned int instanceBuffer;
+    size_t instanceCapacity;        // Instances the buffer holds before it has to grow
+
+    // Baked atlas
+    unsigned int atlasTexture;
+    int atlasColumns, atlasRows;
+    int bakedViewCount;
+    float frameCenterHeight;        // Model-space height of the frame centre
+    float frameHalfExtent;          // Model-space half size of a square frame
+
+    // Per frame
+    Vec3 cameraPosition;
+    std::vector<Instance> instances;
+    size_t meshCount;               // Monsters still drawn with their mesh last frame
+
+public:
+    MonsterImpostorRenderer();
+    ~MonsterImpostorRenderer();
+
+    bool initialize();
+    void cleanup();
+
+    // Renders the model into the atlas (replacing an earlier bake). Restores the
+    // framebuffer, viewport and clear colour it found. modelShader is the mesh
+    // shader (model/view/projection/color uniforms).
+    bool bake(const Mesh& mesh, const std::vector<ImpostorMaterial>& materials, Shader& modelShader);
+    bool isBaked() const { return atlasTexture != 0; }
+
+    // Per frame: add() queues an impostor when the monster is far enough and
+    // returns whether the full mesh must still be drawn
+    void beginFrame(const Camera& camera);
+    bool add(const Vec3& position, float yawDegrees, float scale);
+    void render(const Camera& camera); // After the opaque world geometry
+
+    // Configuration
+    void setSettings(const ImpostorSettings& newSettings); // View count/frame size apply at the next bake
+    const ImpostorSettings& getSettings() const { return settings; }
+
+    // Last frame statistics
+    size_t getImpostorCount() const { return instances.size(); }
+    size_t getMeshCount() const { return meshCount; }
+
+private:
+    void destroyAtlas();
+};
+
+} // namespace Engine
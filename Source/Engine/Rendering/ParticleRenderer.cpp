@@ -0,0 +1,338 @@
+/**
+ * ParticleRenderer.cpp - Implementation of Instanced Particle Billboards
+ */
+
+#include "ParticleRenderer.h"
+#include "ReverseZ.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+
+namespace Engine {
+
+namespace {
+
+const int DEFAULT_SPRITE_SIZE = 64;
+const size_t STREAM_ALIGNMENT = 64;
+
+} // namespace
+
+const size_t ParticleRenderer::STREAM_BUFFER_BYTES;
+constexpr float ParticleRenderer::MAX_GPU_STEP;
+
+ParticleRenderer::ParticleRenderer()
+    : vertexArray(0), streamBuffer(0), streamOffset(0),
+      batchedEmitterCount(0),
+      gpuSupported(false), drawCalls(0), drawnParticles(0) {
+}
+
+ParticleRenderer::~ParticleRenderer() {
+    cleanup();
+}
+
+bool ParticleRenderer::initialize() {
+    shader = std::make_unique<Shader>();
+    if (!shader->loadFromFiles("Resources/Shaders/particle_vertex.glsl", "Resources/Shaders/particle_fragment.glsl")) {
+        std::cerr << "ParticleRenderer: failed to load particle shader" << std::endl;
+        shader.reset();
+        return false;
+    }
+
+    if (!createDefaultSprite()) {
+        std::cerr << "ParticleRenderer: failed to create default sprite" << std::endl;
+        cleanup();
+        return false;
+    }
+
+    glGenVertexArrays(1, &vertexArray);
+    glGenBuffers(1, &streamBuffer);
+
+    glBindVertexArray(vertexArray);
+    glBindBuffer(GL_ARRAY_BUFFER, streamBuffer);
+    glBufferData(GL_ARRAY_BUFFER, STREAM_BUFFER_BYTES, nullptr, GL_STREAM_DRAW);
+    glEnableVertexAttribArray(0);
+    glEnableVertexAttribArray(1);
+    glVertexAttribDivisor(0, 1);
+    glVertexAttribDivisor(1, 1);
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    streamOffset = 0;
+    
+    // GPU emitters are optional: without them ParticleSystem keeps every emitter on the CPU
+    gpuSupported = initializeGpuSimulation();
+    return true;
+}
+
+bool ParticleRenderer::initializeGpuSimulation() {
+    if (!GpuParticleEmitter::isSupported()) {
+        return false;
+    }
+
+    gpuUpdateShader = std::make_unique<Shader>();
+    gpuRenderShader = std::make_unique<Shader>();
+    const std::vector<std::string> varyings = {"outPosition", "outVelocity", "outAge", "outLifetime"};
+    if (!gpuUpdateShader->loadTransformFeedback("Resources/Shaders/particle_update_vertex.glsl",
+                                                "Resources/Shaders/particle_update_geometry.glsl", varyings) ||
+        !gpuRenderShader->loadFromFiles("Resources/Shaders/particle_gpu_vertex.glsl",
+                                        "Resources/Shaders/particle_gpu_geometry.glsl",
+                                        "Resources/Shaders/particle_fragment.glsl")) {
+        std::cerr << "ParticleRenderer: GPU particle shaders unavailable, GPU emitters run on the CPU" << std::endl;
+        gpuUpdateShader.reset();
+        gpuRenderShader.reset();
+        return false;
+    }
+    return true;
+}
+
+void ParticleRenderer::cleanup() {
+    if (streamBuffer) {
+        glDeleteBuffers(1, &streamBuffer);
+        streamBuffer = 0;
+    }
+    if (vertexArray) {
+        glDeleteVertexArrays(1, &vertexArray);
+        vertexArray = 0;
+    }
+    batches.clear();
+    batchedEmitterCount = 0;
+    gpuEmitters.clear();
+    gpuUpdateShader.reset();
+    gpuRenderShader.reset();
+    gpuSupported = false;
+    sprites.clear();
+    defaultSprite.reset();
+    shader.reset();
+}
+
+bool ParticleRenderer::createDefaultSprite() {
+    // White disc with a smooth falloff; emitter colours tint it
+    std::vector<unsigned char> pixels(DEFAULT_SPRITE_SIZE * DEFAULT_SPRITE_SIZE * 4);
+    const float center = (DEFAULT_SPRITE_SIZE - 1) * 0.5f;
+    for (int y = 0; y < DEFAULT_SPRITE_SIZE; y++) {
+        for (int x = 0; x < DEFAULT_SPRITE_SIZE; x++) {
+            float dx = (x - center) / center;
+            float dy = (y - center) / center;
+            float falloff = std::max(0.0f, 1.0f - std::sqrt(dx * dx + dy * dy));
+            unsigned char* pixel = &pixels[(y * DEFAULT_SPRITE_SIZE + x) * 4];
+            pixel[0] = pixel[1] = pixel[2] = 255;
+            pixel[3] = static_cast<unsigned char>(falloff * falloff * 255.0f);
+        }
+    }
+
+    defaultSprite = std::make_unique<Texture>();
+    if (!defaultSprite->loadFromMemory(pixels.data(), DEFAULT_SPRITE_SIZE, DEFAULT_SPRITE_SIZE, 4)) {
+        defaultSprite.reset();
+        return false;
+    }
+    defaultSprite->setWrapping(GL_CLAMP_TO_EDGE, GL_CLAMP_TO_EDGE);
+    return true;
+}
+
+const Texture* ParticleRenderer::getSprite(const std::string& path) {
+    if (path.empty()) return defaultSprite.get();
+
+    auto it = sprites.find(path);
+    if (it == sprites.end()) {
+        auto texture = std::make_unique<Texture>();
+        if (!texture->loadFromFile(path)) {
+            std::cerr << "ParticleRenderer: failed to load sprite " << path << ", using default" << std::endl;
+            texture.reset();
+        } else {
+            texture->setWrapping(GL_CLAMP_TO_EDGE, GL_CLAMP_TO_EDGE);
+        }
+        it = sprites.emplace(path, std::move(texture)).first;
+    }
+    return it->second ? it->second.get() : defaultSprite.get();
+}
+
+void ParticleRenderer::buildBatches(const ParticleRenderState& particles) {
+    batches.clear();
+    if (particles.emitters.size() < batchedEmitterCount) {
+        gpuEmitters.clear(); // Emitters only ever get added; fewer means another system
+    }
+    gpuEmitters.resize(particles.emitters.size());
+    
+    for (size_t i = 0; i < particles.emitters.size(); i++) {
+        ParticleEmitterId emitter = static_cast<ParticleEmitterId>(i);
+        const ParticleEmitterDesc& desc = particles.emitters[i];
+        const Texture* sprite = getSprite(desc.texture);
+        
+        if (desc.simulation == ParticleSimulation::Gpu) {
+            if (!gpuEmitters[i] && gpuSupported) {
+                gpuEmitters[i] = std::make_unique<GpuParticleEmitter>(desc);
+                if (!gpuEmitters[i]->initialize()) {
+                    gpuEmitters[i].reset();
+                }
+            }
+            continue;
+        }
+
+        auto batch = std::find_if(batches.begin(), batches.end(), [&](const DrawBatch& existing) {
+            return existing.sprite == sprite && existing.additive == desc.additive;
+        });
+        if (batch == batches.end()) {
+            batches.push_back(DrawBatch{sprite, desc.additive, {}});
+            batch = batches.end() - 1;
+        }
+        batch->emitters.push_back(emitter);
+    }
+
+    batchedEmitterCount = particles.emitters.size();
+}
+
+void ParticleRenderer::simulate(const ParticleRenderState& particles) {
+    if (!shader) return;
+    if (batchedEmitterCount != particles.emitters.size()) {
+        buildBatches(particles);
+    }
+    if (!gpuUpdateShader) return;
+
+    for (const ParticleBurst& burst : particles.gpuBursts) {
+        if (burst.emitter >= 0 && static_cast<size_t>(burst.emitter) < gpuEmitters.size() && gpuEmitters[burst.emitter]) {
+            gpuEmitters[burst.emitter]->queueBurst(burst);
+        }
+    }
+
+    float deltaTime = std::min(particles.gpuElapsed, MAX_GPU_STEP);
+    for (const auto& emitter : gpuEmitters) {
+        if (emitter) {
+            emitter->simulate(*gpuUpdateShader, deltaTime);
+        }
+    }
+}
+
+void ParticleRenderer::render(const ParticleRenderState& particles, const Camera& camera) {
+    drawCalls = 0;
+    drawnParticles = 0;
+    if (!shader) return;
+
+    if (batchedEmitterCount != particles.emitters.size()) {
+        buildBatches(particles);
+    }
+
+    glEnable(GL_DEPTH_TEST);
+    glDepthFunc(ReverseZ::depthLess());
+    glDepthMask(GL_FALSE);
+    glEnable(GL_BLEND);
+
+    // Alpha-blended particles first so additive sparks and fire brighten smoke rather than being covered
+    if (!particles.instances.empty()) {
+        shader->use();
+        shader->setMat4("view", camera.getViewMatrix());
+        shader->setMat4("projection", camera.getProjectionMatrix());
+        shader->setInt("sprite", 0);
+
+        glBindVertexArray(vertexArray);
+        glBindBuffer(GL_ARRAY_BUFFER, streamBuffer);
+        for (const DrawBatch& batch : batches) {
+            if (!batch.additive) drawBatch(particles, batch);
+        }
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindVertexArray(0);
+    }
+    drawGpuEmitters(camera, false);
+
+    if (!particles.instances.empty()) {
+        shader->use();
+        glBindVertexArray(vertexArray);
+        glBindBuffer(GL_ARRAY_BUFFER, streamBuffer);
+        for (const DrawBatch& batch : batches) {
+            if (batch.additive) drawBatch(particles, batch);
+        }
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindVertexArray(0);
+    }
+    drawGpuEmitters(camera, true);
+
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glDisable(GL_BLEND);
+    glDepthMask(GL_TRUE);
+}
+
+void ParticleRenderer::drawGpuEmitters(const Camera& camera, bool additive) {
+    if (!gpuRenderShader) return;
+
+    bool programBound = false;
+    for (const auto& emitter : gpuEmitters) {
+        if (!emitter || emitter->getDesc().additive != additive) continue;
+
+        const ParticleEmitterDesc& desc = emitter->getDesc();
+        if (!programBound) {
+            gpuRenderShader->use();
+            gpuRenderShader->setMat4("view", camera.getViewMatrix());
+            gpuRenderShader->setMat4("projection", camera.getProjectionMatrix());
+            gpuRenderShader->setInt("sprite", 0);
+            programBound = true;
+        }
+        gpuRenderShader->setVec3("colorStart", desc.colorStart);
+        gpuRenderShader->setVec3("colorEnd", desc.colorEnd);
+        gpuRenderShader->setFloat("alphaStart", desc.alphaStart);
+        gpuRenderShader->setFloat("alphaEnd", desc.alphaEnd);
+        gpuRenderShader->setFloat("sizeStart", desc.sizeStart);
+        gpuRenderShader->setFloat("sizeEnd", desc.sizeEnd);
+
+        glBlendFunc(GL_SRC_ALPHA, additive ? GL_ONE : GL_ONE_MINUS_SRC_ALPHA);
+        getSprite(desc.texture)->bind(0);
+        emitter->draw();
+        drawCalls++;
+    }
+}
+
+void ParticleRenderer::drawBatch(const ParticleRenderState& particles, const DrawBatch& batch) {
+    size_t instanceCount = 0;
+    for (ParticleEmitterId emitter : batch.emitters) {
+        instanceCount += particles.getInstanceCount(emitter);
+    }
+    if (instanceCount == 0) return;
+
+    const size_t maxInstances = STREAM_BUFFER_BYTES / sizeof(ParticleInstance);
+    size_t byteCount = std::min(instanceCount, maxInstances) * sizeof(ParticleInstance);
+
+    // Wrap around by orphaning: the driver hands out fresh storage while the GPU
+    // finishes with the old one, so the unsynchronized writes below never race it
+    if (streamOffset + byteCount > STREAM_BUFFER_BYTES) {
+        glBufferData(GL_ARRAY_BUFFER, STREAM_BUFFER_BYTES, nullptr, GL_STREAM_DRAW);
+        streamOffset = 0;
+    }
+
+    void* mapped = glMapBufferRange(GL_ARRAY_BUFFER, streamOffset, byteCount,
+                                    GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+    if (!mapped) return;
+
+    ParticleInstance* instances = static_cast<ParticleInstance*>(mapped);
+    size_t written = 0;
+    for (ParticleEmitterId emitter : batch.emitters) {
+        size_t count = particles.getInstanceCount(emitter);
+        if (count == 0) continue;
+        if (written + count > maxInstances) break; // Buffer full; the rest of this batch is skipped this frame
+        std::memcpy(instances + written, particles.instances.data() + particles.emitterOffsets[emitter],
+                    count * sizeof(ParticleInstance));
+        written += count;
+    }
+    glUnmapBuffer(GL_ARRAY_BUFFER);
+    if (written == 0) return;
+
+    // Instance attributes start at this batch's slice of the ring
+    const char* base = reinterpret_cast<const char*>(streamOffset);
+    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, sizeof(ParticleInstance),
+                          base + offsetof(ParticleInstance, position));
+    glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ParticleInstance),
+                          base + offsetof(ParticleInstance, color));
+
+    if (batch.additive) {
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE);
+    } else {
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    }
+    batch.sprite->bind(0);
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, static_cast<GLsizei>(written));
+
+    streamOffset += (byteCount + STREAM_ALIGNMENT - 1) / STREAM_ALIGNMENT * STREAM_ALIGNMENT;
+    drawCalls++;
+    drawnParticles += written;
+}
+
+} // namespace Engine
@@ -0,0 +1,57 @@
+/**
+ * ReverseZ.cpp - Implementation of the Reversed Depth Range
+ */
+
+#include "ReverseZ.h"
+
+namespace Engine {
+
+bool ReverseZ::supported = false;
+bool ReverseZ::enabled = true;
+bool ReverseZ::sceneActive = false;
+bool ReverseZ::applied = false;
+
+bool ReverseZ::initialize() {
+    supported = (GLEW_VERSION_4_5 || GLEW_ARB_clip_control) && glClipControl != nullptr;
+    return supported;
+}
+
+void ReverseZ::setEnabled(bool enable) {
+    enabled = enable;
+}
+
+void ReverseZ::beginScene() {
+    sceneActive = true;
+    if (isEnabled()) {
+        apply(true);
+    }
+}
+
+void ReverseZ::endScene() {
+    sceneActive = false;
+    if (applied) {
+        apply(false);
+    }
+}
+
+void ReverseZ::suspend() {
+    if (applied) {
+        apply(false);
+    }
+}
+
+void ReverseZ::resume() {
+    if (sceneActive && isEnabled() && !applied) {
+        apply(true);
+    }
+}
+
+void ReverseZ::apply(bool reversed) {
+    // Clear depth and depth test follow the convention: "far" is 0 when reversed
+    glClipControl(GL_LOWER_LEFT, reversed ? GL_ZERO_TO_ONE : GL_NEGATIVE_ONE_TO_ONE);
+    glClearDepth(reversed ? 0.0 : 1.0);
+    glDepthFunc(reversed ? GL_GREATER : GL_LESS);
+    applied = reversed;
+}
+
+} // namespace Engine
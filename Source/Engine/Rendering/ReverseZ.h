@@ -0,0 +1,72 @@
+/**
+ * ReverseZ.h - Reversed Depth Range for the 3D Scene
+ *
+ * OVERVIEW:
+ * A standard projection stores 1/z-shaped depth in [0, 1] with most of the
+ * precision spent right in front of the near plane, which is why distant
+ * terrain z-fights. With glClipControl(GL_LOWER_LEFT, GL_ZERO_TO_ONE) and a
+ * projection that maps the near plane to 1 and infinity to 0, the 1/z curve
+ * and the exponent of a floating-point depth buffer cancel out: precision is
+ * nearly uniform in log distance, and the far plane can go to infinity.
+ *
+ * FEATURES:
+ * - Scoped to the 3D scene: beginScene() switches clip control, clear depth
+ *   and the depth test to GREATER, endScene() restores the conventional
+ *   state for the HUD passes (their orthographic projections stay as-is)
+ * - suspend()/resume() for passes inside the scene that use their own
+ *   conventional projection (shadow map generation)
+ * - depthLess()/depthLessEqual(): the "nearer passes" comparison for code
+ *   that sets the depth function itself
+ * - Fallback when glClipControl is missing (GL < 4.5 without
+ *   ARB_clip_control): conventional depth, and Camera keeps a finite far plane
+ *
+ * USAGE:
+ *   ReverseZ::initialize();                  // After GLEW, once
+ *   camera.setReverseZ(ReverseZ::isEnabled());
+ *   ReverseZ::beginScene(); ...3D passes...; ReverseZ::endScene();
+ */
+
+#pragma once
+#include <GL/glew.h>
+
+namespace Engine {
+
+/**
+ * ReverseZ - Global depth convention of the scene passes
+ */
+class ReverseZ {
+private:
+    static bool supported;
+    static bool enabled;
+    static bool sceneActive;    // Between beginScene() and endScene()
+    static bool applied;        // Reversed state currently bound (false while suspended)
+
+public:
+    // Detects glClipControl; requires a current GL context
+    static bool initialize();
+
+    // Reverse-Z is used when supported and not disabled
+    static void setEnabled(bool enable);
+    static bool isEnabled() { return supported && enabled; }
+    static bool isSupported() { return supported; }
+
+    // Frame usage: beginScene() before the 3D targets are cleared, endScene() before the HUD
+    static void beginScene();
+    static void endScene();
+
+    // Conventional depth for a pass with its own projection inside the scene
+    static void suspend();
+    static void resume();
+
+    // True while the reversed convention is bound
+    static bool isActive() { return applied; }
+
+    // Depth functions for "closer than" / "closer or equal" under the bound convention
+    static GLenum depthLess() { return applied ? GL_GREATER : GL_LESS; }
+    static GLenum depthLessEqual() { return applied ? GL_GEQUAL : GL_LEQUAL; }
+
+private:
+    static void apply(bool reversed);
+};
+
+} // namespace Engine
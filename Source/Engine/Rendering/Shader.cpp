@@ -150,6 +150,87 @@ bool Shader::loadFromStrings(const char* vertexSource, const char* fragmentSourc
     return isValid;
 }
 
+bool Shader::loadFromFiles(const std::string& vertexPath, const std::string& geometryPath, const std::string& fragmentPath) {
+    cleanup();
+    
+    std::string sources[] = {loadShaderFromFile(vertexPath), loadShaderFromFile(geometryPath), loadShaderFromFile(fragmentPath)};
+    const unsigned int types[] = {GL_VERTEX_SHADER, GL_GEOMETRY_SHADER, GL_FRAGMENT_SHADER};
+    
+    std::vector<unsigned int> shaders;
+    for (int i = 0; i < 3; i++) {
+        unsigned int shader = sources[i].empty() ? 0 : compileShader(types[i], sources[i].c_str());
+        if (shader == 0) {
+            for (unsigned int compiled : shaders) glDeleteShader(compiled);
+            return false;
+        }
+        shaders.push_back(shader);
+    }
+    
+    return linkProgram(shaders, nullptr);
+}
+
+bool Shader::loadTransformFeedback(const std::string& vertexPath, const std::string& geometryPath,
+                                   const std::vector<std::string>& varyings) {
+    cleanup();
+    
+    std::string vertexSource = loadShaderFromFile(vertexPath);
+    std::string geometrySource = geometryPath.empty() ? std::string() : loadShaderFromFile(geometryPath);
+    if (vertexSource.empty() || (!geometryPath.empty() && geometrySource.empty())) {
+        return false;
+    }
+    
+    std::vector<unsigned int> shaders;
+    unsigned int vertexShader = compileShader(GL_VERTEX_SHADER, vertexSource.c_str());
+    if (vertexShader == 0) return false;
+    shaders.push_back(vertexShader);
+    
+    if (!geometrySource.empty()) {
+        unsigned int geometryShader = compileShader(GL_GEOMETRY_SHADER, geometrySource.c_str());
+        if (geometryShader == 0) {
+            glDeleteShader(vertexShader);
+            return false;
+        }
+        shaders.push_back(geometryShader);
+    }
+    
+    return linkProgram(shaders, &varyings);
+}
+
+bool Shader::linkProgram(const std::vector<unsigned int>& shaders, const std::vector<std::string>* feedbackVaryings) {
+    programID = glCreateProgram();
+    for (unsigned int shader : shaders) {
+        glAttachShader(programID, shader);
+    }
+    
+    // Captured outputs must be declared before linking
+    if (feedbackVaryings) {
+        std::vector<const char*> names;
+        for (const std::string& varying : *feedbackVaryings) {
+            names.push_back(varying.c_str());
+        }
+        glTransformFeedbackVaryings(programID, static_cast<GLsizei>(names.size()), names.data(), GL_INTERLEAVED_ATTRIBS);
+    }
+    glLinkProgram(programID);
+    
+    int success;
+    char infoLog[512];
+    glGetProgramiv(programID, GL_LINK_STATUS, &success);
+    if (!success) {
+        glGetProgramInfoLog(programID, 512, NULL, infoLog);
+        glDeleteProgram(programID);
+        programID = 0;
+        isValid = false;
+    } else {
+        isValid = true;
+    }
+    
+    for (unsigned int shader : shaders) {
+        glDeleteShader(shader);
+    }
+    
+    return isValid;
+}
+
 void Shader::use() const {
     if (isValid) {
         glUseProgram(programID);
@@ -183,6 +264,13 @@ void Shader::setMat3(const std::string& name, const Mat3& matrix) const {
     }
 }
 
+void Shader::setVec2(const std::string& name, const Vec2& vector) const {
+    int location = getUniformLocation(name);
+    if (location != -1) {
+        glUniform2f(location, vector.x, vector.y);
+    }
+}
+
 void Shader::setVec3(const std::string& name, const Vec3& vector) const {
     int location = getUniformLocation(name);
     if (location != -1) {
@@ -7,6 +7,7 @@
  * 
  * FEATURES:
  * - Automatic shader compilation with error checking
+ * - Optional geometry stage and transform feedback capture
  * - Uniform variable management
  * - Resource cleanup
  * - Easy shader program switching
@@ -14,6 +15,7 @@
 
 #pragma once
 #include <string>
+#include <vector>
 #include <GL/glew.h>
 #include "../Math/Math.h"
 
@@ -36,6 +38,7 @@ private:
     // Helper methods
     std::string loadShaderFromFile(const std::string& filePath);
     unsigned int compileShader(unsigned int type, const char* source);
+    bool linkProgram(const std::vector<unsigned int>& shaders, const std::vector<std::string>* feedbackVaryings);
 
 public:
     // Constructor/Destructor
@@ -50,12 +53,17 @@ public:
     // Shader management
     bool loadFromFiles(const std::string& vertexPath, const std::string& fragmentPath);
     bool loadFromStrings(const char* vertexSource, const char* fragmentSource);
+    bool loadFromFiles(const std::string& vertexPath, const std::string& geometryPath, const std::string& fragmentPath);
+    // Program without fragment stage whose outputs are captured interleaved by transform feedback
+    bool loadTransformFeedback(const std::string& vertexPath, const std::string& geometryPath,
+                               const std::vector<std::string>& varyings);
     void use() const;
     void cleanup();
     
     // Uniform setters
     void setMat4(const std::string& name, const Mat4& matrix) const;
     void setMat3(const std::string& name, const Mat3& matrix) const;
+    void setVec2(const std::string& name, const Vec2& vector) const;
     void setVec3(const std::string& name, const Vec3& vector) const;
     void setFloat(const std::string& name, float value) const;
     void setInt(const std::string& name, int value) const;
@@ -1,4 +1,6 @@
 #include "ShadowMap.h"
+#include "DynamicResolution.h"
+#include "ReverseZ.h"
 #include <iostream>
 
 namespace Engine {
@@ -6,6 +8,7 @@ namespace Engine {
 ShadowMap::ShadowMap(int resolution)
     : shadowMapFBO(0), shadowMapTexture(0), shadowMapWidth(resolution), shadowMapHeight(resolution),
       shadowBias(0.005f), shadowBiasMin(0.005f), shadowBiasMax(0.05f), shadowMapResolution(resolution),
+      shadowFilter(ShadowFilter::Grid2x2), shadowFilterRadius(1.0f),
       isInitialized(false), isDepthMapGenerated(false) {
 }
 
@@ -25,11 +28,15 @@ bool ShadowMap::initialize() {
     // Create depth texture
     glGenTextures(1, &shadowMapTexture);
     glBindTexture(GL_TEXTURE_2D, shadowMapTexture);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT, shadowMapWidth, shadowMapHeight, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
-    
-    // Set texture parameters for shadow mapping
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    allocateDepthTexture();
+    
+    // Set texture parameters for shadow mapping. Compare mode makes the texture unit
+    // do the depth test; with linear filtering it then blends the four neighbouring
+    // results (hardware PCF) for a sampler2DShadow lookup
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER);
     
@@ -89,6 +96,9 @@ void ShadowMap::cleanup() {
 void ShadowMap::beginDepthMapGeneration() {
     if (!isInitialized) return;
     
+    // The light's orthographic projection expects conventional depth
+    ReverseZ::suspend();
+    
     // Bind shadow map framebuffer
     glBindFramebuffer(GL_FRAMEBUFFER, shadowMapFBO);
     glViewport(0, 0, shadowMapWidth, shadowMapHeight);
@@ -105,8 +115,11 @@ void ShadowMap::beginDepthMapGeneration() {
 void ShadowMap::endDepthMapGeneration() {
     if (!isInitialized) return;
     
-    // Unbind framebuffer
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    // Unbind framebuffer (back to the scaled scene target when dynamic resolution is active)
+    if (!DynamicResolution::bindSceneTarget()) {
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    }
+    ReverseZ::resume();
     
     // Reset viewport (this should be set by the calling renderer)
     // glViewport(0, 0, windowWidth, windowHeight);
@@ -147,6 +160,10 @@ void ShadowMap::setupShadowRendering(Shader& shader) {
     
     // Set number of light space matrices
     shader.setInt("numLightSpaceMatrices", static_cast<int>(lightSpaceMatrices.size()));
+    
+    // Filter kernel
+    shader.setInt("shadowKernel", static_cast<int>(shadowFilter));
+    shader.setFloat("shadowFilterRadius", shadowFilterRadius);
 }
 
 void ShadowMap::bindShadowMap(unsigned int textureUnit) {
@@ -171,11 +188,42 @@ void ShadowMap::setShadowMapResolution(int resolution) {
         // Recreate shadow map texture with new resolution
         if (isInitialized) {
             glBindTexture(GL_TEXTURE_2D, shadowMapTexture);
-            glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT, shadowMapWidth, shadowMapHeight, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+            allocateDepthTexture();
         }
     }
 }
 
+void ShadowMap::setShadowFilter(ShadowFilter filter, float radiusTexels) {
+    shadowFilter = filter;
+    shadowFilterRadius = radiusTexels;
+}
+
+void ShadowMap::setShadowQuality(ShadowQuality quality) {
+    switch (quality) {
+        case ShadowQuality::Low:
+            setShadowFilter(ShadowFilter::Single);
+            setShadowMapResolution(1024);
+            break;
+        case ShadowQuality::Medium:
+            setShadowFilter(ShadowFilter::Grid2x2);
+            setShadowMapResolution(1024);
+            break;
+        case ShadowQuality::High:
+            setShadowFilter(ShadowFilter::Grid3x3);
+            setShadowMapResolution(2048);
+            break;
+        case ShadowQuality::Ultra:
+            setShadowFilter(ShadowFilter::PoissonDisk, 2.5f); // Wider, softer penumbra
+            setShadowMapResolution(2048);
+            break;
+    }
+}
+
+void ShadowMap::allocateDepthTexture() {
+    // Sized 24-bit depth format (compare mode only applies to depth textures)
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT24, shadowMapWidth, shadowMapHeight, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+}
+
 Mat4 ShadowMap::calculateLightSpaceMatrix(const Vec3& lightPos, const Vec3& lightDir, float nearPlane, float farPlane) {
     // Calculate light space matrix for directional light
     Vec3 lightPosition = lightPos;
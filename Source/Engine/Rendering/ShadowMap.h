@@ -8,12 +8,36 @@
 
 namespace Engine {
 
+/**
+ * Shadow filter kernels; every tap is a hardware-filtered (bilinear 2x2) comparison
+ */
+enum class ShadowFilter {
+    Single = 0,     // 1 tap
+    Grid2x2,        // 4 taps
+    Grid3x3,        // 9 taps
+    Grid4x4,        // 16 taps
+    PoissonDisk     // 16 taps on a Poisson disk
+};
+
+/**
+ * Shadow quality presets (filter, tap spacing and map resolution)
+ */
+enum class ShadowQuality {
+    Low,            // 1 tap, 1024
+    Medium,         // 2x2, 1024
+    High,           // 3x3, 2048
+    Ultra           // Poisson disk, 2048
+};
+
 /**
  * ShadowMap - Handles shadow mapping for realistic shadows
  * 
  * Features:
  * - Depth map generation from light perspective
- * - Shadow mapping with PCF filtering
+ * - Hardware PCF: the depth texture has GL_TEXTURE_COMPARE_MODE and linear
+ *   filtering, so a sampler2DShadow tap returns the bilinearly weighted
+ *   lit fraction of four texels instead of one binary comparison
+ * - Selectable kernels (1/4/9/16 taps or Poisson disk) and quality presets
  * - Support for multiple light sources
  * - Efficient shadow rendering
  */
@@ -37,6 +61,8 @@ private:
     float shadowBiasMin;
     float shadowBiasMax;
     int shadowMapResolution;
+    ShadowFilter shadowFilter;
+    float shadowFilterRadius;   // Texels between grid taps, or the Poisson disk radius
     
     // State
     bool isInitialized;
@@ -62,6 +88,10 @@ public:
     // Configuration
     void setShadowBias(float bias, float minBias = 0.005f, float maxBias = 0.05f);
     void setShadowMapResolution(int resolution);
+    void setShadowFilter(ShadowFilter filter, float radiusTexels = 1.0f);
+    void setShadowQuality(ShadowQuality quality);
+    ShadowFilter getShadowFilter() const { return shadowFilter; }
+    float getShadowFilterRadius() const { return shadowFilterRadius; }
     
     // Getters
     unsigned int getShadowMapTexture() const { return shadowMapTexture; }
@@ -73,6 +103,9 @@ public:
     // Utility
     Mat4 calculateLightSpaceMatrix(const Vec3& lightPos, const Vec3& lightDir, 
                                   float nearPlane = 0.1f, float farPlane = 100.0f);
+
+private:
+    void allocateDepthTexture();
 };
 
 } // namespace Engine
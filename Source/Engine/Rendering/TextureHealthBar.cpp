@@ -4,6 +4,7 @@
 
 #include "TextureHealthBar.h"
 #include "../Math/Camera.h"
+#include "ReverseZ.h"
 #include <iostream>
 #include <cmath>
 
@@ -27,10 +28,7 @@ TextureHealthBar::TextureHealthBar(float width, float height, float offset)
       pulseSpeed(3.0f),
       isPulsing(false),
       isInitialized(false),
-      isActive(true),
-      healthBarVAO(0),
-      healthBarVBO(0),
-      healthBarEBO(0) {
+      isActive(true) {
 }
 
 TextureHealthBar::~TextureHealthBar() {
@@ -40,6 +38,9 @@ TextureHealthBar::~TextureHealthBar() {
 bool TextureHealthBar::initialize() {
     if (isInitialized) return true;
     
+    // No GL context (dedicated server, tools): stay uninitialized, update/render are no-ops
+    if (!Mesh::isGPUAvailable()) return false;
+    
     std::cout << "Initializing TextureHealthBar..." << std::endl;
     
     // Setup geometry
@@ -74,7 +75,7 @@ void TextureHealthBar::setupGeometry() {
     // Define health bar quad with actual size (no matrix scaling needed)
     float halfWidth = barWidth * 0.5f;
     float halfHeight = barHeight * 0.5f;
-    float vertices[] = {
+    std::vector<float> vertices = {
         // positions (3D)   // texture coords
         -halfWidth, -halfHeight, 0.0f,   0.0f, 0.0f,  // bottom left
          halfWidth, -halfHeight, 0.0f,   1.0f, 0.0f,  // bottom right
@@ -82,39 +83,14 @@ void TextureHealthBar::setupGeometry() {
         -halfWidth,  halfHeight, 0.0f,   0.0f, 1.0f   // top left
     };
     
-    unsigned int indices[] = {
+    std::vector<unsigned int> indices = {
         0, 1, 2,  // first triangle
         2, 3, 0   // second triangle
     };
     
-    glGenVertexArrays(1, &healthBarVAO);
-    glGenBuffers(1, &healthBarVBO);
-    glGenBuffers(1, &healthBarEBO);
-    
-    std::cout << "=== VAO CREATION DEBUG ===" << std::endl;
-    std::cout << "VAO ID: " << healthBarVAO << std::endl;
-    std::cout << "VBO ID: " << healthBarVBO << std::endl;
-    std::cout << "EBO ID: " << healthBarEBO << std::endl;
-    std::cout << "=========================" << std::endl;
-    
-    glBindVertexArray(healthBarVAO);
-    
-    glBindBuffer(GL_ARRAY_BUFFER, healthBarVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-    
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, healthBarEBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
-    
-    // Position attribute (location = 0)
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    
-    // Texture coordinate attribute (location = 1)
-    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+    // Position at location 0, texture coordinates at location 1. Monsters initialize their bars on
+    // the simulation thread, whose context cannot own the VAO; Mesh defers it to the render thread.
+    healthBarMesh.createMeshWithTexCoords(vertices, indices);
 }
 
 void TextureHealthBar::setupShader() {
@@ -131,18 +107,7 @@ void TextureHealthBar::setupShader() {
 }
 
 void TextureHealthBar::cleanupGeometry() {
-    if (healthBarVAO) {
-        glDeleteVertexArrays(1, &healthBarVAO);
-        healthBarVAO = 0;
-    }
-    if (healthBarVBO) {
-        glDeleteBuffers(1, &healthBarVBO);
-        healthBarVBO = 0;
-    }
-    if (healthBarEBO) {
-        glDeleteBuffers(1, &healthBarEBO);
-        healthBarEBO = 0;
-    }
+    healthBarMesh.cleanup();
 }
 
 void TextureHealthBar::generateHealthBarTexture() {
@@ -361,7 +326,7 @@ void TextureHealthBar::render(const Vec3& monsterPosition, const Camera& camera)
     
     // Enable depth testing for proper occlusion with monster parts
     glEnable(GL_DEPTH_TEST);
-    glDepthFunc(GL_LEQUAL);  // Allow equal depth values, render closer objects first
+    glDepthFunc(ReverseZ::depthLessEqual());  // Allow equal depth values, render closer objects first
     
     // Disable culling for billboard effect
     glDisable(GL_CULL_FACE);
@@ -404,9 +369,7 @@ void TextureHealthBar::render(const Vec3& monsterPosition, const Camera& camera)
     // healthBarShader->setInt("healthBarTexture", 0);
     
     // Render the quad
-    glBindVertexArray(healthBarVAO);
-    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
-    glBindVertexArray(0);
+    healthBarMesh.render();
     
     // Check for OpenGL errors
     GLenum error = glGetError();
@@ -421,7 +384,6 @@ void TextureHealthBar::render(const Vec3& monsterPosition, const Camera& camera)
     renderDebugCount++;
     if (renderDebugCount % 300 == 0) { // Print every 5 seconds
         std::cout << "=== RENDERING DEBUG ===" << std::endl;
-        std::cout << "VAO: " << healthBarVAO << std::endl;
         std::cout << "Drawing 6 elements (2 triangles)" << std::endl;
         std::cout << "=======================" << std::endl;
     }
@@ -13,6 +13,7 @@
 #include "../Math/Math.h"
 #include "Shader.h"
 #include "Texture.h"
+#include "Mesh.h"
 #include <memory>
 #include <vector>
 
@@ -25,9 +26,7 @@ private:
     // Texture and rendering
     std::unique_ptr<Texture> healthBarTexture;
     std::unique_ptr<Shader> healthBarShader;
-    unsigned int healthBarVAO;
-    unsigned int healthBarVBO;
-    unsigned int healthBarEBO;
+    Mesh healthBarMesh; // Built on the simulation thread in threaded mode; the VAO follows on first draw
     
     // Health bar properties
     float barWidth;
@@ -3,8 +3,12 @@
  */
 
 #include "WaterRenderer.h"
+#include "DynamicResolution.h"
 #include "../Math/Camera.h"
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <string>
 #include <GL/glew.h>
 #define GLFW_INCLUDE_NONE
 #include <glfw3.h>
@@ -13,6 +17,8 @@
 
 namespace Engine {
 
+const int WaterRenderer::MAX_WAVES;
+
 WaterRenderer::WaterRenderer()
     : windowWidth(0), windowHeight(0), projectionMatrix(Mat4()),
       duDvTexture(0), normalMapTexture(0), reflectionTexture(0), 
@@ -20,6 +26,7 @@ WaterRenderer::WaterRenderer()
       refractionFBO(0), reflectionTextureID(0), refractionTextureID(0),
       refractionDepthTextureID(0), moveFactor(0.0f), waveSpeed(0.03f),
       distortionScale(0.01f), shineDamper(20.0f), reflectivity(0.6f),
+      wavesDirty(true), gridInnerSpacing(1.0f), gridGrowth(0.0f),
       isInitialized(false) {
 }
 
@@ -116,6 +123,11 @@ void WaterRenderer::renderMesh(const Mesh& mesh,
     renderWater(mesh, modelMatrix, camera, 0.0f);
 }
 
+void WaterRenderer::setWaves(const std::vector<GerstnerWave>& newWaves) {
+    waves.assign(newWaves.begin(), newWaves.begin() + std::min(newWaves.size(), static_cast<size_t>(MAX_WAVES)));
+    wavesDirty = true;
+}
+
 void WaterRenderer::renderCrosshair(const Camera& camera) const {
     // Water renderer doesn't handle crosshair
 }
@@ -136,15 +148,15 @@ void WaterRenderer::renderWater(const Mesh& mesh,
     
     waterShader->use();
     
-    // Create a completely static model matrix for water
-    // This bypasses any GameObject transformation issues
-    Mat4 staticModelMatrix = Mat4(); // Identity matrix - no transformation
-    
-    // Set matrices
-    waterShader->setMat4("model", staticModelMatrix);
+    // No model matrix: the grid is placed by gridOrigin and displaced in world space
     waterShader->setMat4("view", camera.getViewMatrix());
     waterShader->setMat4("projection", camera.getProjectionMatrix());
     
+    // Depth linearization for the shoreline fade must match the projection
+    waterShader->setFloat("cameraNear", camera.getNearPlane());
+    waterShader->setFloat("cameraFar", camera.getFarPlane());
+    waterShader->setInt("reverseDepth", camera.isReverseZ() ? 1 : 0);
+    
     // Set camera position
     waterShader->setVec3("cameraPosition", camera.getPosition());
     
@@ -156,6 +168,36 @@ void WaterRenderer::renderWater(const Mesh& mesh,
     waterShader->setFloat("reflectivity", reflectivity);
     waterShader->setFloat("waterHeight", waterHeight);
     
+    // The grid follows the camera in steps of its finest spacing, so the
+    // near vertices sample the waves at the same world positions every frame
+    Vec3 cameraPosition = camera.getPosition();
+    float snap = std::max(gridInnerSpacing, 0.01f);
+    waterShader->setVec2("gridOrigin", Vec2(std::floor(cameraPosition.x / snap) * snap, std::floor(cameraPosition.z / snap) * snap));
+    waterShader->setFloat("gridInnerSpacing", gridInnerSpacing);
+    waterShader->setFloat("gridGrowth", gridGrowth);
+    
+    // Wave set: uniforms keep their values in the program, so only changes are uploaded
+    if (wavesDirty) {
+        waterShader->setInt("waveCount", static_cast<int>(waves.size()));
+        for (size_t i = 0; i < waves.size(); i++) {
+            const GerstnerWave& wave = waves[i];
+            const std::string prefix = "waves[" + std::to_string(i) + "].";
+            float length = std::sqrt(wave.direction.x * wave.direction.x + wave.direction.y * wave.direction.y);
+            Vec2 direction = length > 0.0f ? Vec2(wave.direction.x / length, wave.direction.y / length) : Vec2(1.0f, 0.0f);
+            float wavelength = std::max(wave.wavelength, 0.01f);
+            float k = 2.0f * 3.14159265f / wavelength;
+            waterShader->setVec2(prefix + "direction", direction);
+            waterShader->setFloat(prefix + "amplitude", wave.amplitude);
+            waterShader->setFloat(prefix + "wavenumber", k);
+            waterShader->setFloat(prefix + "angularSpeed", std::sqrt(9.81f * k)); // Deep water: w^2 = g k
+            // Crest sharpness shared out so the summed horizontal motion never folds the surface
+            float steepness = std::max(0.0f, std::min(1.0f, wave.steepness));
+            float sharpness = wave.amplitude > 0.0f ? steepness / (k * wave.amplitude * static_cast<float>(waves.size())) : 0.0f;
+            waterShader->setFloat(prefix + "sharpness", sharpness);
+        }
+        wavesDirty = false;
+    }
+    
     // Bind water textures
     glActiveTexture(GL_TEXTURE0);
     glBindTexture(GL_TEXTURE_2D, duDvTexture);
@@ -284,7 +326,7 @@ bool WaterRenderer::setupFramebuffers() {
     
     glGenTextures(1, &refractionDepthTextureID);
     glBindTexture(GL_TEXTURE_2D, refractionDepthTextureID);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT32, windowWidth, windowHeight, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT32F, windowWidth, windowHeight, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
     glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, refractionDepthTextureID, 0);
@@ -317,6 +359,8 @@ void WaterRenderer::bindRefractionFramebuffer() const {
 }
 
 void WaterRenderer::unbindFramebuffer() const {
+    // Return to the scaled scene target when dynamic resolution is rendering the scene
+    if (DynamicResolution::bindSceneTarget()) return;
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
     glViewport(0, 0, windowWidth, windowHeight);
 }
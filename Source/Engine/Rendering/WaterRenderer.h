@@ -3,6 +3,10 @@
  * 
  * Handles water rendering with reflection, refraction, and wave animation.
  * Uses multiple render passes and texture sampling for realistic water effects.
+ * 
+ * The surface is displaced in water_vertex.glsl by a sum of Gerstner waves
+ * evaluated at each vertex's world position; the CPU only uploads the wave
+ * set (when it changes), the time and where the camera-following grid sits.
  */
 
 #pragma once
@@ -10,11 +14,27 @@
 #include "Shader.h"
 #include "Mesh.h"
 #include <memory>
+#include <vector>
 #include <GL/glew.h>
 
 namespace Engine {
 
+/**
+ * GerstnerWave - One travelling wave of the water surface
+ * 
+ * Phase speed follows deep-water dispersion (longer waves travel faster).
+ */
+struct GerstnerWave {
+    Vec2 direction = Vec2(1.0f, 0.0f); // Travel direction on the XZ plane (normalized on upload)
+    float amplitude = 0.5f;            // Metres
+    float wavelength = 20.0f;          // Metres crest to crest
+    float steepness = 0.5f;            // 0 = sine wave, 1 = sharpest crests the set allows without loops
+};
+
 class WaterRenderer : public Renderer {
+public:
+    static const int MAX_WAVES = 8; // Must match water_vertex.glsl
+
 private:
     int windowWidth;
     int windowHeight;
@@ -44,6 +64,12 @@ private:
     float shineDamper;
     float reflectivity;
     
+    // Surface waves and the camera-following grid they displace
+    std::vector<GerstnerWave> waves;
+    mutable bool wavesDirty;        // Uploaded on the next renderWater
+    float gridInnerSpacing;         // Ring spacing at the grid centre (metres)
+    float gridGrowth;               // Ring i sits at innerSpacing / growth * (e^(growth * i) - 1)
+    
     bool isInitialized;
 
 public:
@@ -93,6 +119,9 @@ public:
     void setDistortionScale(float scale) { distortionScale = scale; }
     void setShineDamper(float damper) { shineDamper = damper; }
     void setReflectivity(float reflect) { reflectivity = reflect; }
+    void setWaves(const std::vector<GerstnerWave>& newWaves); // At most MAX_WAVES are used
+    const std::vector<GerstnerWave>& getWaves() const { return waves; }
+    void setSurfaceGrid(float innerSpacing, float growth) { gridInnerSpacing = innerSpacing; gridGrowth = growth; }
 
 private:
     bool initializeOpenGL();
@@ -117,8 +117,8 @@ void WeaponRenderer::renderWeaponMesh(const Mesh& mesh,
     Mat4 identityView = Mat4();
     weaponShader->setMat4("view", identityView);
     
-    // For weapon overlay rendering, use orthographic projection for 2D screen space
-    weaponShader->setMat4("projection", Engine::perspective(45.0f, static_cast<float>(windowWidth) / static_cast<float>(windowHeight), 0.1f, 100.0f));
+    // Viewmodel projection, rebuilt only when the viewport changes
+    weaponShader->setMat4("projection", projectionMatrix);
     
     // Set weapon color - use a realistic weapon color if texture is disabled
     Vec3 weaponColor = color;
@@ -182,7 +182,7 @@ void WeaponRenderer::renderWeaponTriangles(const Mesh& mesh,
     
     // Set uniforms
     weaponShader->setMat4("model", modelMatrix);
-    weaponShader->setMat4("projection", Engine::perspective(45.0f, static_cast<float>(windowWidth) / static_cast<float>(windowHeight), 0.1f, 100.0f));
+    weaponShader->setMat4("projection", projectionMatrix);
     weaponShader->setMat4("view", Mat4()); // Identity matrix for view
     
     // Set weapon color
@@ -242,7 +242,8 @@ bool WeaponRenderer::loadWeaponShader() {
 }
 
 void WeaponRenderer::updateProjectionMatrix() {
-    // Use perspective projection for weapon rendering
+    // Use perspective projection for weapon rendering (minimized windows keep the last one)
+    if (windowWidth <= 0 || windowHeight <= 0) return;
     float aspectRatio = getAspectRatio();
     projectionMatrix = Engine::perspective(45.0f, aspectRatio, 0.1f, 100.0f);
 }
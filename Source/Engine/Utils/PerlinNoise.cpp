@@ -3,38 +3,37 @@
  */
 
 #include "PerlinNoise.h"
+#include "../Math/Random.h"
 #include <algorithm>
 #include <cmath>
 
 namespace Engine {
 
-PerlinNoise::PerlinNoise(unsigned int seed) : rng(seed) {
-    // Initialize permutation table
+PerlinNoise::PerlinNoise(unsigned int seed) {
+    buildPermutation(seed);
+}
+
+void PerlinNoise::setSeed(unsigned int seed) {
+    buildPermutation(seed);
+}
+
+void PerlinNoise::buildPermutation(unsigned int seed) {
     p.resize(256);
     for (int i = 0; i < 256; ++i) {
         p[i] = i;
     }
     
-    // Shuffle the permutation table
-    std::shuffle(p.begin(), p.end(), rng);
+    // std::shuffle's algorithm is implementation-defined; this one is not
+    CounterRandom random(seed, 0, 0, RandomStream::Terrain);
+    for (int i = 255; i > 0; --i) {
+        int j = static_cast<int>(random.nextInt(static_cast<uint32_t>(i + 1)));
+        std::swap(p[i], p[j]);
+    }
     
     // Duplicate the permutation table to avoid overflow
     p.insert(p.end(), p.begin(), p.end());
 }
 
-void PerlinNoise::setSeed(unsigned int seed) {
-    rng.seed(seed);
-    
-    // Regenerate permutation table
-    for (int i = 0; i < 256; ++i) {
-        p[i] = i;
-    }
-    std::shuffle(p.begin(), p.begin() + 256, rng);
-    
-    // Duplicate the permutation table
-    p.insert(p.begin() + 256, p.begin(), p.begin() + 256);
-}
-
 double PerlinNoise::fade(double t) const {
     // Fade function as defined by Ken Perlin
     return t * t * t * (t * (t * 6 - 15) + 10);
@@ -7,14 +7,15 @@
 
 #pragma once
 #include <vector>
-#include <random>
 
 namespace Engine {
 
 class PerlinNoise {
 private:
-    std::vector<int> p; // Permutation table
-    std::mt19937 rng;
+    std::vector<int> p; // Permutation table (256 entries, stored twice)
+    
+    // Fisher-Yates shuffle keyed by the seed (same table on every platform)
+    void buildPermutation(unsigned int seed);
     
     // Fade function for smooth interpolation
     double fade(double t) const;
@@ -10,7 +10,7 @@
 namespace Engine {
 
 SimpleChunkTerrainGenerator::SimpleChunkTerrainGenerator(const SimpleChunkTerrainParams& terrainParams)
-    : params(terrainParams), rng(params.seed), perlinNoise(params.seed) {
+    : params(terrainParams), perlinNoise(params.seed) {
 }
 
 float SimpleChunkTerrainGenerator::getHeightAt(float worldX, float worldZ) const {
@@ -167,7 +167,6 @@ float SimpleChunkTerrainGenerator::getHeightAtWorldPos(float worldX, float world
 
 void SimpleChunkTerrainGenerator::setParams(const SimpleChunkTerrainParams& newParams) {
     params = newParams;
-    rng.seed(params.seed);
     perlinNoise.setSeed(params.seed);
     // Clear chunks to force regeneration with new parameters
     clearAllChunks();
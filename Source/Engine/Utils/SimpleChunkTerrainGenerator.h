@@ -10,7 +10,6 @@
 #include <vector>
 #include <unordered_map>
 #include <string>
-#include <random>
 #include "PerlinNoise.h"
 #include "../Math/Math.h"
 
@@ -40,7 +39,6 @@ struct TerrainChunkData {
 class SimpleChunkTerrainGenerator {
 private:
     SimpleChunkTerrainParams params;
-    std::mt19937 rng;
     std::unordered_map<std::string, TerrainChunkData> chunks;
     PerlinNoise perlinNoise;
     
@@ -142,7 +142,7 @@ void AmmoUI::setupMesh() {
         0, 2, 3   // Second triangle
     };
     
-    mesh = std::make_unique<Mesh>();
+    mesh = std::make_shared<Mesh>();
     mesh->createMeshWithTexCoords(vertexData, indices);
 }
 
@@ -167,20 +167,22 @@ void AmmoUI::updateAmmunitionData() {
         
         // Calculate reload progress if reloading
         if (isReloading) {
-            reloadProgress = 1.0f - (stats.reloadTimer / stats.reloadTime);
+            reloadProgress = shootingComponent->getShootingSystem()->getReloadRemaining() / stats.reloadTime;
             reloadProgress = std::max(0.0f, std::min(1.0f, reloadProgress));
         } else {
             reloadProgress = 0.0f;
         }
-    } else {
-        // Default values if no weapon is connected
-        currentAmmo = 0;
-        maxAmmo = 30;
-        reserveAmmo = 0;
-        maxReserveAmmo = 90;
-        isReloading = false;
-        reloadProgress = 0.0f;
     }
+    // Without a weapon the values stay as set (constructor defaults or setAmmunition)
+}
+
+void AmmoUI::setAmmunition(int current, int max, int reserve, int maxReserve, bool reloading, float progress) {
+    currentAmmo = current;
+    maxAmmo = max;
+    reserveAmmo = reserve;
+    maxReserveAmmo = maxReserve;
+    isReloading = reloading;
+    reloadProgress = progress;
 }
 
 void AmmoUI::updateTextStrings() {
@@ -104,6 +104,10 @@ public:
     void setShootingComponent(WeaponShootingComponent* component);
     WeaponShootingComponent* getShootingComponent() const { return shootingComponent; }
     
+    // Ammunition values from outside the weapon system (render snapshot HUD); used while
+    // no weapon or shooting component is attached
+    void setAmmunition(int current, int max, int reserve, int maxReserve, bool reloading, float progress);
+    
     // Ammunition data access
     int getCurrentAmmo() const { return currentAmmo; }
     int getMaxAmmo() const { return maxAmmo; }
@@ -63,7 +63,7 @@ void Arrow::create2DArrowMesh() {
     };
     
     // Create mesh
-    mesh = std::make_unique<Mesh>();
+    mesh = std::make_shared<Mesh>();
     if (!mesh->createMesh(vertices, indices)) {
     } else {
     }
@@ -88,7 +88,7 @@ void Chunk::setupMesh() {
     };
     
     // Create mesh
-    mesh = std::make_unique<Mesh>();
+    mesh = std::make_shared<Mesh>();
     if (!mesh->createMesh(vertices, indices)) {
     } else {
     }
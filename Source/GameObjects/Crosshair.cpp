@@ -48,7 +48,7 @@ void Crosshair::setupMesh() {
     indices.insert(indices.end(), {0,1,2, 0,2,3});
     indices.insert(indices.end(), {4,5,6, 4,6,7});
 
-    mesh = std::make_unique<Mesh>();
+    mesh = std::make_shared<Mesh>();
     mesh->createMesh(vertices, indices);
 }
 
@@ -16,6 +16,7 @@ public:
     void update(float deltaTime) override;
     void render(const Renderer& renderer, const Camera& camera) override;
     RendererType getPreferredRendererType() const override { return RendererType::Crosshair; }
+    bool isScreenSpaceOverlay() const override { return true; }
     
     // Recoil methods
     void applyRecoil(const Vec3& recoil);
@@ -72,7 +72,7 @@ void Cube::setupMesh() {
     };
     
     // Create mesh
-    mesh = std::make_unique<Mesh>();
+    mesh = std::make_shared<Mesh>();
     if (!mesh->createMesh(vertices, indices)) {
     } else {
     }
@@ -100,6 +100,18 @@ void Ground::render(const Renderer& renderer, const Camera& camera) {
     // Ground rendering complete
 }
 
+void Ground::captureDraws(std::vector<MeshDrawState>& draws) const {
+    if (!getActive() || !isValid()) {
+        return;
+    }
+    
+    for (const auto& chunk : chunks) {
+        if (chunk->getActive()) {
+            chunk->captureDraws(draws);
+        }
+    }
+}
+
 void Ground::updateChunksForPlayer(const Vec3& playerPosition) {
     // Use sliding window system for dynamic terrain that follows the player
     updateSlidingChunkWindow(playerPosition);
@@ -100,6 +100,10 @@ protected:
     virtual void setupMesh() override;
     virtual void render(const Renderer& renderer, const Camera& camera) override;
     
+public:
+    // Captures the active chunks; chunk streaming stays with the simulation
+    virtual void captureDraws(std::vector<MeshDrawState>& draws) const override;
+    
 private:
     // Helper methods
     void generateInitialChunks();
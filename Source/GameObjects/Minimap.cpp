@@ -3,9 +3,7 @@
  */
 
 #include "Minimap.h"
-#include "Ground.h"
-#include "SimpleChunkTerrainGround.h"
-#include "../Engine/Core/Scene.h"
+#include "../Engine/Core/RenderSnapshot.h"
 #include "../Engine/Rendering/Renderer.h"
 #include "../Engine/Rendering/Mesh.h"
 #include "../Engine/Rendering/Shader.h"
@@ -33,19 +31,14 @@ Minimap::Minimap(const std::string& name, float size)
       framebuffer(0),
       textureColorBuffer(0),
       renderbuffer(0),
-      scene(nullptr),
+      lastUpdateFrame(0),
       playerPosition(0.0f, 0.0f, 0.0f),
       playerYaw(0.0f),
-      groundReference(nullptr),
-      terrainReference(nullptr),
+      isFramebufferInitialized(false),
+      isTextureValid(false),
       playerArrow(nullptr),
       playerArrowPtr(nullptr),
-      configurableScopeSize(24.0f),  // Default scope size
-      sceneObjectsDirty(true),
-      lastUpdateFrame(0),
-      lastPlayerPosition(0.0f, 0.0f, 0.0f),
-      isFramebufferInitialized(false),
-      isTextureValid(false) {
+      configurableScopeSize(24.0f) {  // Default scope size
     
     // Set minimap to render in 2D screen space
     setPosition(Vec3(-0.8f, 0.8f, 0.0f)); // Top-left corner in NDC
@@ -56,43 +49,7 @@ Minimap::Minimap(const std::string& name, float size)
 }
 
 void Minimap::setPlayerPosition(const Vec3& position) {
-    // Calculate player movement since last frame
-    Vec3 movement = position - lastPlayerPosition;
-    
-    // Check if player has moved significantly (to avoid unnecessary updates)
-    float moveThreshold = 0.1f; // Small threshold to avoid micro-movements
-    float distance = movement.length();
-    
-    if (distance > moveThreshold) {
-        // CORRECT MINIMAP MOVEMENT: World moves opposite to player movement
-        // When player moves forward (W), world moves opposite to create illusion arrow moves forward
-        // Only X and Z coordinates matter for minimap (Y height is ignored in orthographic view)
-        
-        // Create movement vector for minimap (ignore Y component)
-        Vec3 minimapMovement = Vec3(movement.x, 0.0f, movement.z);
-        
-        // World moves opposite to player movement
-        // This makes the arrow appear to move forward in its pointing direction
-        // BUT: The coordinate system for world movement might be different from arrow rotation
-        // Let's try a different approach - use player position directly
-        // worldOffset = worldOffset - minimapMovement; // Comment out the offset approach
-        
-        sceneObjectsDirty = true;
-        lastPlayerPosition = position;
-        
-        // Debug movement calculation
-        static int moveDebugCount = 0;
-        moveDebugCount++;
-        // if (moveDebugCount % 30 == 0) { // More frequent debug output
-        //     // std::cout << "=== MINIMAP MOVEMENT DEBUG ===" << std::endl;
-        //     // std::cout << "Player movement: (" << movement.x << ", " << movement.y << ", " << movement.z << ")" << std::endl;
-        //     // std::cout << "Minimap movement (X,Z only): (" << movement.x << ", 0, " << movement.z << ")" << std::endl;
-        //     // std::cout << "World offset BEFORE: (" << worldOffset.x << ", " << worldOffset.y << ", " << worldOffset.z << ")" << std::endl;
-        //     // std::cout << "Arrow direction: (" << playerForwardDirection.x << ", " << playerForwardDirection.y << ", " << playerForwardDirection.z << ")" << std::endl;
-        //     // std::cout << "Expected: W moves world opposite to player movement" << std::endl;
-        // }
-    }
-    
+    // Only X and Z matter for the minimap (Y height is ignored in orthographic view)
     playerPosition = position;
 }
 
@@ -154,9 +111,7 @@ void Minimap::update(float deltaTime) {
     GameObject::update(deltaTime);
     
     // Update orthographic camera to follow player
-    if (scene) {
-        updateOrthographicCamera(playerPosition);
-    }
+    updateOrthographicCamera(playerPosition);
 }
 
 void Minimap::render(const Renderer& renderer, const Camera& camera) {
@@ -164,8 +119,17 @@ void Minimap::render(const Renderer& renderer, const Camera& camera) {
         return;
     }
     
+    // The scene is drawn into the texture by render(sceneDraws)
+    renderMinimapTexture();
+}
+
+void Minimap::render(const std::vector<MeshDrawState>& sceneDraws) {
+    if (!isValid()) {
+        return;
+    }
+    
     // First, render the scene to our texture using orthographic projection
-    renderSceneToTexture();
+    renderSceneToTexture(sceneDraws);
     
     // Then render the minimap texture to screen
     renderMinimapTexture();
@@ -251,141 +215,15 @@ void Minimap::setupMesh() {
         2, 3, 0   // Second triangle
     };
     
-    mesh = std::make_unique<Mesh>();
+    mesh = std::make_shared<Mesh>();
     if (!mesh->createMeshWithTexCoords(vertices, indices)) {
     }
     
     // Debug output removed
 }
 
-bool Minimap::updateSceneObjects() {
-    if (!scene) {
-        return false;
-    }
-    
-    // Clear previous frame's objects
-    sceneObjects.clear();
-    
-    // Get all game objects from the scene
-    const auto& gameObjects = scene->getGameObjects();
-    
-    // Phase 1: Use Ground's global visibility system (Approach 2)
-    if (groundReference) {
-        // Get visible entities from Ground's visibility system
-        const auto& visibleEntities = groundReference->getVisibleEntities();
-        
-        // Add visible entities to minimap scene (with coordinate validation)
-        for (const auto* entity : visibleEntities) {
-            if (entity && entity->getMesh() && entity->getMesh()->isValid()) {
-                // Phase 2: Double-check coordinate safety (can be removed after testing)
-                if (isEntityInMinimapScope(entity)) {
-                    sceneObjects.push_back(entity);
-                } else {
-                }
-            }
-        }
-        
-    }
-    
-    static int frameCount = 0;
-    frameCount++;
-
-    // Only print every 100 frames to avoid spam
-    if (frameCount % 1000 == 0) {
-    }
-    
-    for (const auto& gameObject : gameObjects) {
-        // Skip crosshair (it's a 2D UI element)
-        if (gameObject->getName() == "Crosshair") {
-            continue;
-        }
-        
-        // Special handling for Ground objects (both chunk-based and simple terrain)
-        if (gameObject->getName() == "Ground" || gameObject->getName() == "SimpleTerrain") {
-            // Handle Ground objects with chunks (old system)
-            const Ground* ground = dynamic_cast<const Ground*>(gameObject.get());
-            if (ground) {
-                const auto& chunks = ground->getChunks();
-                for (const auto& chunk : chunks) {
-                    if (chunk && chunk->getActive()) {
-                        const Mesh* chunkMesh = chunk->getMesh();
-                        if (chunkMesh && chunkMesh->isValid()) {
-                            // Add chunk to scene objects for rendering
-                            sceneObjects.push_back(chunk.get());
-                            
-                            if (frameCount % 1000 == 0) {
-                                Vec3 position = chunk->getPosition();
-                            }
-                        }
-                    }
-                }
-            }
-            
-            // Handle SimpleChunkTerrainGround (new chunk-based system)
-            const SimpleChunkTerrainGround* simpleChunkTerrain = dynamic_cast<const SimpleChunkTerrainGround*>(gameObject.get());
-            if (simpleChunkTerrain && simpleChunkTerrain->getActive()) {
-                // Store reference to terrain for separate rendering
-                terrainReference = const_cast<SimpleChunkTerrainGround*>(simpleChunkTerrain);
-                
-                if (frameCount % 1000 == 0) {
-                    Vec3 position = simpleChunkTerrain->getPosition();
-                }
-            }
-            continue;
-        }
-        
-        // Get the mesh from the game object
-        const Mesh* objectMesh = gameObject->getMesh();
-        if (!objectMesh || !objectMesh->isValid()) {
-            if (frameCount % 1000 == 0) {
-            }
-            continue;
-        }
-        
-        // For entities, check if they should be rendered based on chunk visibility
-        if (gameObject->getEntity()) {
-            // Simplified entity visibility: render all entities within minimap bounds
-            Vec3 entityPos = gameObject->getPosition();
-            bool withinMinimapBounds = (
-                entityPos.x >= orthoLeft && entityPos.x <= orthoRight &&
-                entityPos.z >= orthoBottom && entityPos.z <= orthoTop
-            );
-            
-            if (withinMinimapBounds) {
-                if (frameCount % 1000 == 0) {
-                }
-            } else {
-                if (frameCount % 1000 == 0) {
-                }
-                continue;
-            }
-        }
-        
-        // Add to scene objects for GPU rendering
-        sceneObjects.push_back(gameObject.get());
-        
-        // Only print every 100 frames to avoid spam
-        if (frameCount % 1000 == 0) {
-            Vec3 position = gameObject->getPosition();
-            Vec3 rotation = gameObject->getRotation();
-            Vec3 scale = gameObject->getScale();
-        }
-    }
-    
-    if (frameCount % 1000 == 0) {
-    }
-    
-    return true;
-}
-
-void Minimap::renderSceneToTexture() {
-    // Only update scene objects when necessary (player moved, objects changed, etc.)
-    if (sceneObjectsDirty) {
-        updateSceneObjects();
-        sceneObjectsDirty = false;
-    }
-    
-    if (sceneObjects.empty() || !isFramebufferInitialized) return;
+void Minimap::renderSceneToTexture(const std::vector<MeshDrawState>& sceneDraws) {
+    if (sceneDraws.empty() || !isFramebufferInitialized) return;
     
     // Store current OpenGL state
     GLint currentFramebuffer;
@@ -413,27 +251,6 @@ void Minimap::renderSceneToTexture() {
         // Disable height-based coloring for minimap (use object colors instead)
         orthographicShader->setInt("useHeightColoring", 0);
         
-        // Debug transformation matrices
-        static int matrixDebugCount = 0;
-        matrixDebugCount++;
-        if (matrixDebugCount % 5 == 0) { // Very frequent debug
-            // Debug output removed
-            
-            // Debug a specific entity transformation
-            for (const GameObject* obj : sceneObjects) {
-                if (obj && obj->getName() == "RedCube") {
-                    Vec3 worldPos = obj->getPosition();
-                    
-                    // Test coordinate transformation
-                    // RedCube is at (5, 0, 3) in world coordinates
-                    // With current scope, it should be visible
-                    float normalizedX = (worldPos.x - orthoLeft) / (orthoRight - orthoLeft);
-                    float normalizedY = (worldPos.z - orthoBottom) / (orthoTop - orthoBottom);
-                    break;
-                }
-            }
-        }
-        
         // Debug: Print camera state during rendering
         static int debugFrameCount = 0;
         debugFrameCount++;
@@ -451,36 +268,24 @@ void Minimap::renderSceneToTexture() {
         // - Much more efficient than CPU-based mesh aggregation
         // ============================================================================
         
-        // Render each scene object individually
-        for (const GameObject* gameObject : sceneObjects) {
-            const Mesh* objectMesh = gameObject->getMesh();
-            if (objectMesh && objectMesh->isValid()) {
-                // Set the object's complete transformation matrix (includes rotation, position, scale)
-                Mat4 modelMatrix = gameObject->getModelMatrix();
-                orthographicShader->setMat4("model", modelMatrix);
-                
-                // Set the object's individual color (no height-based coloring in minimap)
-                orthographicShader->setVec3("color", gameObject->getColor());
-                
-                // Render the object's mesh
-                objectMesh->render();
-            }
-        }
-        
-        // Render terrain chunks separately
-        if (terrainReference && terrainReference->getActive()) {
-            for (const auto& chunkPair : terrainReference->getChunkMeshes()) {
-                const Mesh* chunkMesh = chunkPair.second.get();
-                if (chunkMesh && chunkMesh->isValid()) {
-                    // Use terrain's model matrix and color
-                    Mat4 modelMatrix = terrainReference->getModelMatrix();
-                    orthographicShader->setMat4("model", modelMatrix);
-                    orthographicShader->setVec3("color", terrainReference->getColor());
-                    
-                    // Render the chunk mesh
-                    chunkMesh->render();
-                }
+        // Render each draw individually (terrain chunks included)
+        for (const MeshDrawState& draw : sceneDraws) {
+            if (!draw.mesh || !draw.mesh->isValid()) continue;
+            
+            // Entities outside the captured area are skipped
+            const Mat4& modelMatrix = draw.modelMatrix;
+            if (draw.entity && !isInMinimapScope(Vec3(modelMatrix.m[12], modelMatrix.m[13], modelMatrix.m[14]))) {
+                continue;
             }
+            
+            // Set the draw's complete transformation matrix (includes rotation, position, scale)
+            orthographicShader->setMat4("model", modelMatrix);
+            
+            // Set the draw's individual color (no height-based coloring in minimap)
+            orthographicShader->setVec3("color", draw.color);
+            
+            // Render the mesh
+            draw.mesh->render();
         }
         
         // Note: Center indicator will be rendered as 2D overlay after minimap texture display
@@ -674,15 +479,6 @@ void Minimap::updateOrthographicCamera(const Vec3& playerPosition) {
         // std::cout << "Player position: (" << playerPosition.x << ", " << playerPosition.y << ", " << playerPosition.z << ")" << std::endl;
         // std::cout << "Arrow rotation angle: " << (playerYaw + 90.0f + 180.0f) << " degrees" << std::endl;
         
-        // Debug entity positions
-        // std::cout << "=== ENTITY POSITIONS DEBUG ===" << std::endl;
-        for (const GameObject* obj : sceneObjects) {
-            if (obj && obj->getEntity()) {
-                Vec3 pos = obj->getPosition();
-                // std::cout << "Entity " << obj->getName() << ": world(" << pos.x << ", " << pos.y << ", " << pos.z << ")";
-                // std::cout << " in scope: " << (pos.x >= orthoLeft && pos.x <= orthoRight && pos.z >= orthoBottom && pos.z <= orthoTop ? "YES" : "NO") << std::endl;
-            }
-        }
     }
     
     // Camera rotation is already set to top-down in initialize()
@@ -865,25 +661,10 @@ void Minimap::renderCenterIndicator() {
 // COORDINATE VALIDATION SAFETY SYSTEM
 // ============================================================================
 
-bool Minimap::isEntityInMinimapScope(const GameObject* entity) const {
-    if (!entity) return false;
-    
-    Vec3 entityPos = entity->getPosition();
-    
-    // Check if entity position is within minimap's orthographic scope
-    bool withinScope = (
-        entityPos.x >= orthoLeft && entityPos.x <= orthoRight &&
-        entityPos.z >= orthoBottom && entityPos.z <= orthoTop
-    );
-    
-    if (!withinScope) {
-        // std::cout << "WARNING: Entity " << entity->getName() << " at (" 
-        //           << entityPos.x << ", " << entityPos.z << ") is outside minimap scope [" 
-        //           << orthoLeft << " to " << orthoRight << ", " 
-        //           << orthoBottom << " to " << orthoTop << "]" << std::endl;
-    }
-    
-    return withinScope;
+bool Minimap::isInMinimapScope(const Vec3& position) const {
+    // Check if the position is within minimap's orthographic scope
+    return position.x >= orthoLeft && position.x <= orthoRight &&
+           position.z >= orthoBottom && position.z <= orthoTop;
 }
 
 void Minimap::renderPlayerPositionIndicator() {
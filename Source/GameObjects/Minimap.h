@@ -8,7 +8,7 @@
  * FEATURES:
  * - 2D texture rendering in screen space
  * - Orthographic camera for top-down view
- * - Scene mesh aggregation
+ * - Draws the scene from the render snapshot's draw lists (no scene access)
  * - Render-to-texture functionality
  */
 
@@ -17,22 +17,21 @@
 #include "../Engine/Rendering/Mesh.h"
 #include "../Engine/Rendering/Shader.h"
 #include "../Engine/Math/Camera.h"
-#include "SimpleChunkTerrainGround.h"
 #include <memory>
 #include <vector>
 
 namespace Engine {
 
-class Scene;
 class Renderer;
 class Arrow;
+struct MeshDrawState;
 
 /**
  * Minimap - 2D Minimap GameObject
  * 
  * Renders a bird's-eye view of the scene as a 2D texture overlay.
- * Aggregates all scene objects (except crosshair) into a single mesh
- * and renders them from an orthographic camera perspective.
+ * Draws the scene draws of a render snapshot (entities outside the
+ * orthographic scope are skipped) from an orthographic camera perspective.
  */
 class Minimap : public GameObject {
 private:
@@ -62,16 +61,8 @@ private:
     // Camera for orthographic view
     Camera orthographicCamera;
     
-    // GPU-based rendering: Store scene objects for individual rendering
-    std::vector<const GameObject*> sceneObjects;
-    
-    // Caching and state management
-    bool sceneObjectsDirty;
+    // State management
     int lastUpdateFrame;    
-    Vec3 lastPlayerPosition;
-    
-    // Scene reference for gathering objects
-    Scene* scene;
     
     // Player tracking
     Vec3 playerPosition;
@@ -81,12 +72,6 @@ private:
     // World offset for minimap movement
     Vec3 worldOffset; // Accumulated world offset for minimap movement
     
-    // Entity system
-    class Ground* groundReference;
-    
-    // Terrain system
-    class SimpleChunkTerrainGround* terrainReference;
-    
     // State
     bool isFramebufferInitialized;
     bool isTextureValid;
@@ -99,17 +84,16 @@ public:
     // Lifecycle methods
     virtual bool initialize() override;
     virtual void update(float deltaTime) override;
-    virtual void render(const Renderer& renderer, const Camera& camera) override;
+    virtual void render(const Renderer& renderer, const Camera& camera) override; // Shows the last minimap texture
     virtual void cleanup() override;
     
+    // Draws sceneDraws (render snapshot scene list) into the minimap texture, then shows it
+    void render(const std::vector<MeshDrawState>& sceneDraws);
+    
     // Setup
-    void setScene(Scene* sceneRef) { scene = sceneRef; }
     void setMinimapSize(float size) { minimapSize = size; }
     void setPlayerPosition(const Vec3& position);
     
-    // Entity system
-    void setGroundReference(class Ground* ground) { groundReference = ground; }
-    
     // Player direction arrow (separate object - non-owning pointer + owning pointer)
     Arrow* playerArrow;
     std::unique_ptr<Arrow> playerArrowPtr;  // Owns the arrow object
@@ -121,8 +105,8 @@ public:
     void setScopeSize(float size) { configurableScopeSize = size; }
     float getScopeSize() const { return configurableScopeSize; }
     
-    // Force update when needed
-    void forceUpdate() { sceneObjectsDirty = true; }
+    // The texture is redrawn every frame; kept for callers that signal terrain changes
+    void forceUpdate() {}
     
     // Minimap dimension configuration
     void setMinimapDimensions(int width, int height);
@@ -141,8 +125,7 @@ private:
     // Helper methods
     bool initializeFramebuffer();
     bool initializeShaders();
-    bool updateSceneObjects();  // GPU-based: Update list of objects to render
-    void renderSceneToTexture();
+    void renderSceneToTexture(const std::vector<MeshDrawState>& sceneDraws);
     void renderMinimapTexture();
     void renderArrowOverlay();  // Render arrow as 2D overlay on minimap
     void renderCenterIndicator(); // Render simple center indicator
@@ -153,8 +136,8 @@ private:
     void cleanupFramebuffer();
     bool isValid() const { return isInitialized && isFramebufferInitialized; }
     
-    // Safety check for coordinate validation
-    bool isEntityInMinimapScope(const GameObject* entity) const;
+    // Safety check for coordinate validation (world X/Z against the orthographic scope)
+    bool isInMinimapScope(const Vec3& position) const;
 };
 
 } // namespace Engine
@@ -11,12 +11,11 @@
 #include "../Engine/Rendering/Renderer.h"
 #include "../Engine/Rendering/MonsterRenderer.h"
 #include "../Engine/Rendering/RendererFactory.h"
+#include "../Engine/Core/RenderSnapshot.h"
 #include <iostream>
 #include <algorithm>
 #include <cmath>
 #include <map>
-#include <ctime>
-#include <random>
 #include <GL/gl.h>
 
 #ifndef M_PI
@@ -28,155 +27,71 @@ namespace Engine {
 Monster::Monster(const std::string& name, MonsterType monsterType)
     : GameObject(name),
       type(monsterType),
-      state(MonsterState::Idle),
-      health(100.0f),
-      maxHealth(100.0f),
-      moveSpeed(2.0f),      // Slower default speed for better gameplay
-      attackRange(2.0f),
-      attackDamage(25.0f),
-      detectionRange(5.0f),   // Reduced default detection range
-      dangerRange(8.0f),      // Reduced default danger range
-      targetPosition(0.0f, 0.0f, 0.0f),
-      moveTimer(0.0f),
-      stateTimer(0.0f),
-      patrolRadius(15.0f),  // Reasonable patrol radius for visible movement
-      chargeSpeed(4.0f),    // Slower speed when charging
-      baseSpeed(2.0f),      // Slower normal patrol speed
-      isCharging(false),    // Start in non-charging mode
-      lastAttackTime(0.0f),
-      attackCooldown(2.0f),
-      alertTimer(0.0f),
-      stunTimer(0.0f),
-      retreatTimer(0.0f),
-      lastPlayerSeenTime(0.0f),
-      lastKnownPlayerPos(0.0f, 0.0f, 0.0f),
-      hasLineOfSight(false),
-      aggressionLevel(0.5f),  // Start with moderate aggression
-      fearLevel(0.0f),        // Start with no fear
-      currentPathDirection(0.0f, 0.0f, 0.0f),
-      pathUpdateTimer(0.0f),
-      pathUpdateInterval(0.5f), // Update pathfinding every 0.5 seconds
-      isStuck(false),
-      stuckTimer(0.0f),
-      lastPosition(0.0f, 0.0f, 0.0f),
-      inGroup(false),
-      groupAlertRadius(10.0f),  // Alert monsters within 10 units
-      groupCoordinationTimer(0.0f),
-      hasAlertedGroup(false),
-      groupTarget(0.0f, 0.0f, 0.0f),
-      damageFlashTimer(0.0f),
+      simulation(nullptr),
+      simulationHandle(MonsterSimulation::INVALID_HANDLE),
+      viewState(MonsterState::Dead),
+      viewHealth(0.0f),
+      damageFlashTimer(TimerWheel::INVALID_TIMER),
       originalColor(0.5f, 0.14f, 0.58f),  // Xenomorph purple color
       damageColor(1.0f, 0.0f, 0.0f),      // Red for damage
       isFlashing(false),
-      stateChangeFlashTimer(0.0f),
-      isStateFlashing(false),
       alertColor(1.0f, 1.0f, 0.0f),       // Yellow for alert
       chaseColor(1.0f, 0.5f, 0.0f),       // Orange for chasing
       attackColor(1.0f, 0.0f, 0.0f),      // Red for attacking
-      pulseTimer(0.0f),
-      isPulsing(false),
-      pulseSpeed(2.0f),
-      experienceReward(10),
-      scoreReward(100),
       hasDroppedLoot(false),
       deathAnimationTimer(0.0f),
       deathAnimationDuration(2.0f), // 2 seconds death animation
       isDeathAnimating(false),
+      deathHandled(false),
       deathScale(1.0f, 1.0f, 1.0f),
       originalScale(1.0f, 1.0f, 1.0f),
       markedForDeletion(false),
-      deletionTimer(0.0f),
+      deletionTimer(TimerWheel::INVALID_TIMER),
       playerTarget(nullptr),
-      textureHealthBar(nullptr),  // NEW: Using texture-based system
-      showHealthBar(true) { // Higher above monster
+      showHealthBar(true) {
     
     // Set entity flag to true for monsters
     setEntity(true);
     
-    // Configure monster based on type
-    configureMonster(monsterType);
+    // Per-type base color (gameplay tuning lives in MonsterSimulation's archetype table)
+    switch (type) {
+        case MonsterType::Runner: originalColor = Vec3(0.2f, 0.8f, 0.2f); break; // Green
+        case MonsterType::Tank:   originalColor = Vec3(0.8f, 0.2f, 0.2f); break; // Red
+        default: break;
+    }
 }
 
 bool Monster::initialize() {
     if (isInitialized) return true;
     
-    // std::cout << "=== INITIALIZING MONSTER: " << getName() << " ===" << std::endl;
-    
     // Setup monster mesh
-    // std::cout << "Setting up monster mesh..." << std::endl;
     setupMonsterMesh();
     
     // Setup monster material
-    // std::cout << "Setting up monster material..." << std::endl;
     setupMonsterMaterial();
     
-    // Set initial target position
-    targetPosition = getPosition();
-    
-    // Create health bar - NEW: Using texture-based system
-    if (showHealthBar) {
-        textureHealthBar = std::make_unique<TextureHealthBar>(2.5f, 0.5f, 2.5f); // Position 2.5 units above monster
-        textureHealthBar->setHealth(health, maxHealth);
-        textureHealthBar->initialize();
-    }
-    
     isInitialized = true;
-    // std::cout << "Monster initialized successfully: " << getName() << std::endl;
-    // std::cout << "=== END INITIALIZATION ===" << std::endl;
     return true;
 }
 
 void Monster::update(float deltaTime) {
     if (!isActive || !isInitialized) return;
     
-    // CRASH PREVENTION: Skip all updates for dead monsters
-    // Don't touch them at all to prevent memory corruption
+    // Dead monsters are left alone; AI and movement run in MonsterSimulation
     if (isDead()) return;
     
-    // Debug output every few seconds to track position changes
-    static float updateDebugTimer = 0.0f;
-    static Vec3 lastLoggedPosition = Vec3(0.0f, 0.0f, 0.0f);
-    updateDebugTimer += deltaTime;
-    
-    Vec3 currentPos = getPosition();
-    float positionChange = sqrt(
-        (currentPos.x - lastLoggedPosition.x) * (currentPos.x - lastLoggedPosition.x) +
-        (currentPos.y - lastLoggedPosition.y) * (currentPos.y - lastLoggedPosition.y) +
-        (currentPos.z - lastLoggedPosition.z) * (currentPos.z - lastLoggedPosition.z)
-    );
-    
-    if (updateDebugTimer > 3.0f || positionChange > 0.1f) {
-        std::cout << "=== MONSTER POSITION DEBUG ===" << std::endl;
-        std::cout << "Monster: " << getName() << std::endl;
-        std::cout << "State: " << getStateName(state) << std::endl;
-        std::cout << "Position: (" << currentPos.x << ", " << currentPos.y << ", " << currentPos.z << ")" << std::endl;
-        std::cout << "Position change: " << positionChange << std::endl;
-        std::cout << "Target: (" << targetPosition.x << ", " << targetPosition.y << ", " << targetPosition.z << ")" << std::endl;
-        std::cout << "Active: " << (getActive() ? "YES" : "NO") << std::endl;
-        std::cout << "===============================" << std::endl;
-        updateDebugTimer = 0.0f;
-        lastLoggedPosition = currentPos;
-    }
-    
-    // Update AI behavior
-    // updateAI(deltaTime);  // DISABLED: Focus on health bar positioning
-    
-    // Update movement
-    // updateMovement(deltaTime);  // DISABLED: Focus on health bar positioning
-    
     // Update visual effects
     updateVisualEffects(deltaTime);
     
-    // Update health bar - NEW: Using texture-based system
-    updateHealthBar();
-    
     // Call base class update
     GameObject::update(deltaTime);
 }
 
 void Monster::markForDeletion() {
     markedForDeletion = true;
-    deletionTimer = 0.0f;
+    
+    // shouldBeDeleted() turns true once this timer has fired
+    deletionTimer = TimerWheel::getInstance().reschedule(deletionTimer, DELETION_DELAY, []() {});
     // std::cout << "Monster " << getName() << " marked for deletion" << std::endl;
 }
 
@@ -186,18 +101,19 @@ void Monster::render(const Renderer& renderer, const Camera& camera) {
     if (!isActive || !isInitialized) return;
     
     // Skip rendering if monster is dead
-    if (isDead()) return;
+    if (!getActive() || !isViewAlive()) return;
     
     // Try to use MonsterRenderer for multi-material rendering
     const MonsterRenderer* monsterRenderer = dynamic_cast<const MonsterRenderer*>(&renderer);
-    if (monsterRenderer && !materialGroups.empty()) {
+    const std::vector<MaterialGroup>& groups = getMaterialGroups();
+    if (monsterRenderer && !groups.empty()) {
         // Use monster renderer for multi-material rendering
         Mat4 monsterMatrix = getModelMatrix();
         
-        // std::cout << "Rendering monster " << getName() << " with " << materialGroups.size() << " material groups" << std::endl;
+        // std::cout << "Rendering monster " << getName() << " with " << groups.size() << " material groups" << std::endl;
         
         // Render each material group with its own color
-        for (const auto& materialGroup : materialGroups) {
+        for (const auto& materialGroup : groups) {
             Vec3 renderColor = materialGroup.color;
             
             // Apply damage flash effect
@@ -214,9 +130,9 @@ void Monster::render(const Renderer& renderer, const Camera& camera) {
         // Fallback to basic renderer - ALWAYS set a color
         Vec3 finalColor;
         
-        if (!materialGroups.empty()) {
+        if (!groups.empty()) {
             // Use the first material group's color as the dominant color
-            finalColor = materialGroups[0].color;
+            finalColor = groups[0].color;
             // std::cout << "Monster " << getName() << " using first material color: " << finalColor.x << ", " << finalColor.y << ", " << finalColor.z << std::endl;
         } else {
             // Fallback to original color system
@@ -240,87 +156,127 @@ void Monster::render(const Renderer& renderer, const Camera& camera) {
     // Health bar is now rendered separately in Game::render after monster rendering
 }
 
+void Monster::captureDraws(std::vector<MeshDrawState>& draws) const {
+    if (!isActive || !isInitialized || !mesh) return;
+    if (!isViewAlive()) return;
+    
+    const Renderer* monsterRenderer = RendererFactory::getInstance().getRenderer(RendererType::Monster);
+    if (!monsterRenderer) return;
+    
+    MeshDrawState draw;
+    draw.mesh = mesh;
+    draw.modelMatrix = getModelMatrix();
+    draw.renderer = monsterRenderer;
+    draw.entityId = getId();
+    draw.placement = DrawPlacement::Transform;
+    draw.entity = isEntity;
+    
+    if (materialGroups && !materialGroups->empty()) {
+        // Material subsets alias the shared group list, so they outlive a model reload
+        for (const MaterialGroup& group : *materialGroups) {
+            draw.triangles = std::shared_ptr<const std::vector<unsigned int>>(materialGroups, &group.indices);
+            draw.color = isFlashing ? damageColor : group.color;
+            draws.push_back(draw);
+        }
+    } else {
+        // Whole mesh, same colour as the fallback path of render()
+        draw.color = isFlashing ? damageColor : getCurrentColor();
+        draws.push_back(draw);
+    }
+}
+
+const std::vector<MaterialGroup>& Monster::getMaterialGroups() const {
+    static const std::vector<MaterialGroup> noGroups;
+    return materialGroups ? *materialGroups : noGroups;
+}
+
+Monster::~Monster() {
+    // Pending timer callbacks point at this monster
+    TimerWheel& timers = TimerWheel::getInstance();
+    timers.cancel(damageFlashTimer);
+    timers.cancel(deletionTimer);
+}
+
 void Monster::cleanup() {
     if (!isInitialized) return;
     
-    // std::cout << "Cleaning up Monster: " << getName() << std::endl;
+    TimerWheel::getInstance().cancel(damageFlashTimer);
+    damageFlashTimer = TimerWheel::INVALID_TIMER;
+    isFlashing = false;
     
     playerTarget = nullptr;
+    simulation = nullptr;
+    simulationHandle = MonsterSimulation::INVALID_HANDLE;
+    syncStatus();
     
     GameObject::cleanup();
 }
 
-void Monster::spawn(const Vec3& position) {
+void Monster::bindSimulation(MonsterSimulation* owner, uint32_t handle) {
+    simulation = owner;
+    simulationHandle = handle;
+    syncStatus();
+}
+
+void Monster::syncFromSimulation(const Vec3& position, float yawDegrees) {
     setPosition(position);
-    setHealth(maxHealth);
-    setState(MonsterState::Idle);  // FIXED: Set to Idle to prevent movement
-    resetTimers();
-    setActive(true);
+    Vec3 rotation = getRotation();
+    rotation.y = yawDegrees;
+    setRotation(rotation);
+    syncStatus();
+}
+
+void Monster::syncStatus() {
+    viewState = getState();
+    viewHealth = getHealth();
+}
+
+void Monster::resetFromSimulation() {
+    TimerWheel& timers = TimerWheel::getInstance();
+    timers.cancel(damageFlashTimer);
+    timers.cancel(deletionTimer);
+    isFlashing = false;
+    markedForDeletion = false;
+    isDeathAnimating = false;
+    deathAnimationTimer = 0.0f;
+    setScale(originalScale);
     
-    // IMPORTANT: Set initial patrol target to a different position to trigger movement
-    targetPosition = getRandomPatrolPosition();
+    // A slot restored as dead has already died (no second death animation or loot drop)
+    bool alive = isBound() && simulation->getState(simulationHandle) != MonsterState::Dead;
+    deathHandled = !alive;
+    hasDroppedLoot = !alive;
+    setActive(alive);
+    syncStatus();
     
-    // Set initial rotation to face the first patrol target
-    Vec3 direction = targetPosition - position;
-    if (direction.x != 0.0f || direction.z != 0.0f) {
-        setRotationFromDirection(direction);
+    if (isBound()) {
+        syncFromSimulation(simulation->getPosition(simulationHandle), simulation->getYawDegrees(simulationHandle));
     }
-    
-    // std::cout << "=== MONSTER SPAWN ===" << std::endl;
-    // std::cout << "Monster " << getName() << " spawned at: (" << position.x << ", " << position.y << ", " << position.z << ")" << std::endl;
-    // std::cout << "Initial patrol target: (" << targetPosition.x << ", " << targetPosition.y << ", " << targetPosition.z << ")" << std::endl;
-    // std::cout << "Initial rotation: (" << getRotation().x << ", " << getRotation().y << ", " << getRotation().z << ") degrees" << std::endl;
-    // std::cout << "Monster type: " << static_cast<int>(type) << std::endl;
-    // std::cout << "Initial state: Patrolling" << std::endl;
-    // std::cout << "Health: " << health << "/" << maxHealth << std::endl;
-    // std::cout << "Move speed: " << moveSpeed << std::endl;
-    // std::cout << "Active: " << (getActive() ? "YES" : "NO") << std::endl;
-    // std::cout << "Entity flag: " << (getEntity() ? "YES" : "NO") << std::endl;
-    // std::cout << "=================" << std::endl;
 }
 
-void Monster::takeDamage(float damage, GameObject* attacker) {
-    // CRASH PREVENTION: Multiple safety checks
-    if (isDead()) {
-        // std::cout << "Monster " << getName() << " is already dead, ignoring damage" << std::endl;
-        return;
-    }
-    
-    if (!getActive()) {
-        // std::cout << "Monster " << getName() << " is inactive, ignoring damage" << std::endl;
-        return;
-    }
+void Monster::spawn(const Vec3& position) {
+    setPosition(position);
+    setActive(true);
+    isFlashing = false;
+    isDeathAnimating = false;
+    deathHandled = false;
+    hasDroppedLoot = false;
     
-    if (health <= 0.0f) {
-        // std::cout << "Monster " << getName() << " has no health, ignoring damage" << std::endl;
-        return;
+    if (isBound()) {
+        // Full health, Idle, first patrol target picked by the simulation
+        simulation->respawn(simulationHandle, position);
+        syncFromSimulation(position, simulation->getYawDegrees(simulationHandle));
     }
+}
+
+void Monster::takeDamage(float damage, GameObject* attacker) {
+    if (isDead() || !isBound()) return;
     
-    health = std::max(0.0f, health - damage);
+    // Health, aggression, group alert and stun rolls are handled by the simulation
+    bool killed = simulation->applyDamage(simulationHandle, damage);
     flashDamage();
     
-    // Increase aggression when taking damage
-    setAggressionLevel(aggressionLevel + 0.2f);
-    
-    // Alert nearby monsters when taking damage
-    if (!hasAlertedGroup) {
-        alertNearbyMonsters();
-        hasAlertedGroup = true;
-    }
-    
-    // Chance to become stunned based on damage amount
-    if (damage > 15.0f && (rand() % 100) < 30) { // 30% chance to stun on heavy damage
-        becomeStunned(1.0f + (damage / 50.0f)); // Stun duration based on damage
-    }
-    
-    // Health bar is now rendered inline - no separate object to update
-    
-    // std::cout << "Monster " << getName() << " took " << damage << " damage. Health: " << health << "/" << maxHealth << std::endl;
-    
-    // If health reaches 0, die
-    if (health <= 0.0f) {
-        // std::cout << "Monster " << getName() << " health reached 0, calling die()..." << std::endl;
-        die();
+    if (killed) {
+        handleDeath();
     }
     
     // Call damage callback
@@ -328,31 +284,21 @@ void Monster::takeDamage(float damage, GameObject* attacker) {
 }
 
 void Monster::die() {
-    if (isDead()) return;
-    
-    // std::cout << "=== MONSTER DEATH PROCESS STARTING ===" << std::endl;
-    // std::cout << "Monster: " << getName() << std::endl;
-    
-    // CRASH PREVENTION: Set state first to prevent further updates
-    setState(MonsterState::Dead);
-    // std::cout << "State set to Dead" << std::endl;
+    if (isBound()) {
+        simulation->kill(simulationHandle);
+    }
+    handleDeath();
+}
+
+void Monster::handleDeath() {
+    if (deathHandled) return;
+    deathHandled = true;
     
     // Start death animation
     startDeathAnimation();
-    // std::cout << "Death animation started" << std::endl;
     
     // CRASH PREVENTION: Mark monster as inactive immediately
     setActive(false);
-    // std::cout << "Monster marked as inactive" << std::endl;
-    
-    // CRASH PREVENTION: Set health to 0 to prevent further damage
-    health = 0.0f;
-    // std::cout << "Health set to 0" << std::endl;
-    
-    // Health bar is now rendered inline - no separate object to clean up
-    // std::cout << "Monster " << getName() << " died! No health bar cleanup needed (inline rendering)" << std::endl;
-    
-    // std::cout << "Monster " << getName() << " died! (Scene will ignore it)" << std::endl;
     
     // Drop loot if not already dropped
     if (!hasDroppedLoot) {
@@ -360,422 +306,41 @@ void Monster::die() {
         hasDroppedLoot = true;
     }
     
-    // Call death callback with error handling
-    // std::cout << "Calling onDeath callback..." << std::endl;
-    try {
     onDeath();
-        // std::cout << "onDeath callback completed" << std::endl;
-    } catch (const std::exception&) {
-        // std::cout << "Error in onDeath callback: " << e.what() << std::endl;
-    }
-    
-    // std::cout << "=== MONSTER DEATH PROCESS COMPLETED ===" << std::endl;
-}
-
-void Monster::updateAI(float deltaTime) {
-    if (isDead()) return;
-    
-    // Update all timers
-    updateTimers(deltaTime);
-    
-    // Update behavior modifiers (aggression, fear)
-    updateBehaviorModifiers(deltaTime);
-    
-    // Update line of sight to player
-    updateLineOfSight();
-    
-    // Update pathfinding
-    updatePathfinding(deltaTime);
-    
-    // Update group behavior
-    updateGroupBehavior(deltaTime);
-    
-    // Update state based on conditions
-    updateState(deltaTime);
-}
-
-void Monster::updateMovement(float deltaTime) {
-    if (isDead()) return;
-    
-    // Debug movement state
-    static float movementDebugTimer = 0.0f;
-    movementDebugTimer += deltaTime;
-    if (movementDebugTimer > 2.0f) {
-        // std::cout << "=== MOVEMENT UPDATE ===" << std::endl;
-        // std::cout << "Monster: " << getName() << std::endl;
-        // std::cout << "State: " << getStateName(state) << std::endl;
-        // std::cout << "Delta time: " << deltaTime << std::endl;
-        movementDebugTimer = 0.0f;
-    }
-    
-    switch (state) {
-        case MonsterState::Idle:
-            // Do nothing, just stand still
-            if (movementDebugTimer < 0.1f) { // Only print once per debug cycle
-                // std::cout << "Monster " << getName() << " is IDLE - not moving" << std::endl;
-            }
-            break;
-            
-        case MonsterState::Patrolling:
-            patrol(deltaTime);
-            break;
-            
-        case MonsterState::Alert:
-            // Look around and prepare for action
-            if (movementDebugTimer < 0.1f) {
-                // std::cout << "Monster " << getName() << " is ALERT - scanning area" << std::endl;
-            }
-            break;
-            
-        case MonsterState::Chasing:
-            moveTowardsTarget(deltaTime);
-            break;
-            
-        case MonsterState::Attacking:
-            // Stop moving when attacking and perform attack
-            attack();
-            break;
-            
-        case MonsterState::Stunned:
-            // No movement when stunned
-            if (movementDebugTimer < 0.1f) {
-                // std::cout << "Monster " << getName() << " is STUNNED - cannot move" << std::endl;
-            }
-            break;
-            
-        case MonsterState::Retreating:
-            retreat(deltaTime);
-            break;
-            
-        case MonsterState::Dead:
-            // No movement when dead
-            break;
-    }
-    
-    // Note: Position is set directly by the movement methods (patrol, moveTowardsTarget)
-    // No need to call setPosition here as it would overwrite the movement
-}
-
-void Monster::updateState(float deltaTime) {
-    if (isDead()) return;
-    
-    MonsterState oldState = state;
-    MonsterState newState = determineNextState();
-    
-    // Debug AI state evaluation every few seconds
-    static float aiDebugTimer = 0.0f;
-    aiDebugTimer += deltaTime;
-    if (aiDebugTimer > 2.0f) {
-        // std::cout << "=== AI STATE EVALUATION ===" << std::endl;
-        // std::cout << "Monster: " << getName() << std::endl;
-        // std::cout << "Current state: " << getStateName(state) << std::endl;
-        // std::cout << "Evaluated next state: " << getStateName(newState) << std::endl;
-        if (playerTarget) {
-            float distance = getDistanceToPlayer();
-            // std::cout << "Distance to player: " << distance << " units" << std::endl;
-            // std::cout << "Can see player: " << (canSeePlayer() ? "YES" : "NO") << std::endl;
-            // std::cout << "In danger zone: " << (isPlayerInDangerZone() ? "YES" : "NO") << std::endl;
-            // std::cout << "In attack range: " << (isInAttackRange() ? "YES" : "NO") << std::endl;
-            // std::cout << "Detection range: " << detectionRange << ", Danger: " << dangerRange << ", Attack: " << attackRange << std::endl;
-        } else {
-            // std::cout << "No player target set!" << std::endl;
-        }
-        // std::cout << "=========================" << std::endl;
-        aiDebugTimer = 0.0f;
-    }
-    
-    if (newState != oldState) {
-        setState(newState);
-    }
-}
-
-void Monster::findNewTarget() {
-    if (!playerTarget) return;
-    
-    // Update target to player's current position
-    Vec3 oldTarget = targetPosition;
-    targetPosition = playerTarget->getPosition();
-    
-    // std::cout << "Monster " << getName() << " found new target: (" 
-    //           << targetPosition.x << ", " << targetPosition.y << ", " << targetPosition.z << ")" << std::endl;
-    // std::cout << "  Previous target: (" << oldTarget.x << ", " << oldTarget.y << ", " << oldTarget.z << ")" << std::endl;
-}
-
-void Monster::moveTowardsTarget(float deltaTime) {
-    if (!playerTarget) return;
-    
-    // Update target position to player's current position (for chasing)
-    targetPosition = playerTarget->getPosition();
-    
-    Vec3 currentPos = getPosition();
-    Vec3 targetPos = targetPosition;
-    
-    // Use pathfinding to get direction
-    Vec3 direction = findPathToTarget(targetPos);
-    float distance = sqrt(direction.x * direction.x + direction.y * direction.y + direction.z * direction.z);
-    
-    // Debug output for chasing (less frequent to avoid spam)
-    static float chaseDebugTimer = 0.0f;
-    chaseDebugTimer += deltaTime;
-    if (chaseDebugTimer > 2.0f) { // Print every 2 seconds
-        // std::cout << "=== CHASING DEBUG ===" << std::endl;
-        // std::cout << "Monster " << getName() << " chasing player" << std::endl;
-        // std::cout << "  Current position: (" << currentPos.x << ", " << currentPos.y << ", " << currentPos.z << ")" << std::endl;
-        // std::cout << "  Target position: (" << targetPos.x << ", " << targetPos.y << ", " << targetPos.z << ")" << std::endl;
-        // std::cout << "  Path direction: (" << direction.x << ", " << direction.y << ", " << direction.z << ")" << std::endl;
-        // std::cout << "  Distance: " << distance << " units" << std::endl;
-        // std::cout << "  Move speed: " << moveSpeed << std::endl;
-        // std::cout << "  Is stuck: " << (isStuck ? "YES" : "NO") << std::endl;
-        // std::cout << "===================" << std::endl;
-        chaseDebugTimer = 0.0f;
-    }
-    
-    if (distance > 0.1f) {
-        // Normalize direction
-        direction.x /= distance;
-        direction.y /= distance;
-        direction.z /= distance;
-        
-        // Set rotation to face movement direction
-        setRotationFromDirection(direction);
-        
-        // Move towards target with smooth interpolation
-        float moveDistance = moveSpeed * deltaTime;
-        if (distance < moveDistance) {
-            setPosition(targetPos);
-            // std::cout << "Monster " << getName() << " reached target: (" << targetPos.x << ", " << targetPos.y << ", " << targetPos.z << ")" << std::endl;
-        } else {
-            Vec3 newPos = currentPos + direction * moveDistance;
-            setPosition(newPos);
-            
-            // Debug: Print chasing movement every frame to see if it's smooth
-            static int chaseMovementDebugCounter = 0;
-            chaseMovementDebugCounter++;
-            if (chaseMovementDebugCounter % 60 == 0) { // Print every 60 frames (1 second at 60fps)
-                std::cout << "Monster " << getName() << " smooth chasing: (" 
-                         << newPos.x << ", " << newPos.y << ", " << newPos.z 
-                         << ") deltaTime: " << deltaTime << " moveDistance: " << moveDistance << std::endl;
-            }
-            
-            // Update stuck detection
-            updateStuckDetection(currentPos, newPos, deltaTime);
-        }
-    }
-}
-
-void Monster::patrol(float deltaTime) {
-    moveTimer += deltaTime;
-    
-    // Change patrol direction every few seconds OR if we've reached our current target
-    Vec3 currentPos = getPosition();
-    Vec3 toTarget = targetPosition - currentPos;
-    float distanceToTarget = sqrt(toTarget.x * toTarget.x + toTarget.y * toTarget.y + toTarget.z * toTarget.z);
-    
-    // Debug: Print current patrol status every few seconds
-    static float patrolDebugTimer = 0.0f;
-    patrolDebugTimer += deltaTime;
-    if (patrolDebugTimer > 3.0f) {
-        // std::cout << "=== PATROL STATUS ===" << std::endl;
-        // std::cout << "Monster " << getName() << " patrolling" << std::endl;
-        // std::cout << "  Current position: (" << currentPos.x << ", " << currentPos.y << ", " << currentPos.z << ")" << std::endl;
-        // std::cout << "  Target position: (" << targetPosition.x << ", " << targetPosition.y << ", " << targetPosition.z << ")" << std::endl;
-        // std::cout << "  Distance to target: " << distanceToTarget << " units" << std::endl;
-        // std::cout << "  Move timer: " << moveTimer << "s" << std::endl;
-        // std::cout << "  Move speed: " << moveSpeed << std::endl;
-        patrolDebugTimer = 0.0f;
-    }
-    
-    if (moveTimer > 1.0f || distanceToTarget < 2.0f) {  // Much more frequent target changes for visible movement
-        Vec3 oldTarget = targetPosition;
-        targetPosition = getRandomPatrolPosition();
-        moveTimer = 0.0f;
-        
-        // Immediately rotate to face the new patrol target
-        Vec3 newDirection = targetPosition - currentPos;
-        if (newDirection.x != 0.0f || newDirection.z != 0.0f) {
-            setRotationFromDirection(newDirection);
-        }
-        
-        // Debug output for patrol target changes
-        // std::cout << "Monster " << getName() << " changing patrol target from (" 
-        //           << oldTarget.x << ", " << oldTarget.y << ", " << oldTarget.z 
-        //           << ") to (" << targetPosition.x << ", " << targetPosition.y << ", " << targetPosition.z << ")" << std::endl;
-        // std::cout << "  Distance to old target was: " << distanceToTarget << " units" << std::endl;
-        // std::cout << "  New rotation: (" << getRotation().x << ", " << getRotation().y << ", " << getRotation().z << ") degrees" << std::endl;
-    }
-    
-    // Move towards current patrol target
-    Vec3 direction = targetPosition - currentPos;
-    float distance = sqrt(direction.x * direction.x + direction.y * direction.y + direction.z * direction.z);
-    
-    if (distance > 0.1f) {
-        // Normalize direction
-        direction.x /= distance;
-        direction.y /= distance;
-        direction.z /= distance;
-        
-        // Set rotation to face movement direction  
-        setRotationFromDirection(direction);
-        
-        // Move towards target with smooth interpolation
-        float moveDistance = moveSpeed * deltaTime;
-        if (distance < moveDistance) {
-            setPosition(targetPosition);
-            // std::cout << "Monster " << getName() << " reached patrol target: (" << targetPosition.x << ", " << targetPosition.y << ", " << targetPosition.z << ")" << std::endl;
-        } else {
-            Vec3 newPos = currentPos + direction * moveDistance;
-            setPosition(newPos);
-            
-            // Debug: Print movement every frame to see if it's smooth
-            static int movementDebugCounter = 0;
-            movementDebugCounter++;
-            if (movementDebugCounter % 60 == 0) { // Print every 60 frames (1 second at 60fps)
-                std::cout << "Monster " << getName() << " smooth movement: (" 
-                         << newPos.x << ", " << newPos.y << ", " << newPos.z 
-                         << ") deltaTime: " << deltaTime << " moveDistance: " << moveDistance << std::endl;
-            }
-        }
-    }
 }
 
-void Monster::attack() {
-    if (!playerTarget) return;
-    
-    // Use stateTimer as a simple time counter for attack cooldown
-    if (stateTimer >= attackCooldown) {
-        // Implement actual attack logic
-        // std::cout << "=== MONSTER ATTACK ===" << std::endl;
-        // std::cout << "Monster " << getName() << " attacks player for " << attackDamage << " damage!" << std::endl;
-        
-        // Deal damage to player
-        try {
-            // Try to cast playerTarget to Player and call takeDamage
-            Player* player = dynamic_cast<Player*>(playerTarget);
-            if (player) {
-                player->takeDamage(attackDamage, this);
-                // std::cout << "Successfully dealt " << attackDamage << " damage to player!" << std::endl;
-            } else {
-                // If not a Player, try to call takeDamage if it exists
-                // This is a fallback for other GameObject types that might have takeDamage
-                // std::cout << "Player target is not a Player object, cannot deal damage" << std::endl;
-            }
-        } catch (const std::exception&) {
-            // std::cout << "Error dealing damage to player: " << e.what() << std::endl;
-        }
-        
-        // std::cout << "Attack cooldown: " << attackCooldown << " seconds" << std::endl;
-        // std::cout << "=====================" << std::endl;
-        
-        // Reset attack timer
-        lastAttackTime = stateTimer;
-        stateTimer = 0.0f; // Reset state timer for next attack
-    }
+void Monster::setState(MonsterState newState) {
+    if (!isBound()) return;
+    simulation->setState(simulationHandle, newState);
 }
 
-void Monster::setState(MonsterState newState) {
-    if (state == newState) return;
-    
-    MonsterState oldState = state;
-    state = newState;
-    
-    // Debug output for state changes
-    std::string oldStateName = getStateName(oldState);
-    std::string newStateName = getStateName(newState);
-    // std::cout << "=== MONSTER STATE CHANGE ===" << std::endl;
-    // std::cout << "Monster: " << getName() << std::endl;
-    // std::cout << "State: " << oldStateName << " -> " << newStateName << std::endl;
-    // std::cout << "Position: (" << getPosition().x << ", " << getPosition().y << ", " << getPosition().z << ")" << std::endl;
-    if (playerTarget) {
-        float distance = getDistanceToPlayer();
-        // std::cout << "Distance to player: " << distance << " units" << std::endl;
-        // std::cout << "Detection range: " << detectionRange << ", Danger range: " << dangerRange << ", Attack range: " << attackRange << std::endl;
-        // std::cout << "In danger zone: " << (isPlayerInDangerZone() ? "YES" : "NO") << std::endl;
-    }
-    // std::cout << "===========================" << std::endl;
-    
-    // Handle state-specific behavior
-    if (newState == MonsterState::Chasing) {
-        // Find new target when entering chasing state
-        findNewTarget();
-        
-        // Immediately rotate to face the player when starting to chase
-        if (playerTarget) {
-            Vec3 direction = playerTarget->getPosition() - getPosition();
-            if (direction.x != 0.0f || direction.z != 0.0f) {
-                setRotationFromDirection(direction);
-                // std::cout << "Monster " << getName() << " rotated to face player when starting chase" << std::endl;
-            }
-        }
-        
-        // Check if player is in danger zone for charging behavior
-        if (isPlayerInDangerZone()) {
-            if (!isCharging) {
-                isCharging = true;
-                moveSpeed = chargeSpeed;  // Boost speed for charging
-                // std::cout << "Monster " << getName() << " CHARGING! Speed boosted to " << chargeSpeed << std::endl;
-            }
-        } else {
-            if (isCharging) {
-                isCharging = false;
-                moveSpeed = baseSpeed;  // Return to normal speed
-                // std::cout << "Monster " << getName() << " stopped charging. Speed returned to " << baseSpeed << std::endl;
-            }
-        }
-    } else {
-        // Not chasing - use normal speed
-        if (isCharging) {
-            isCharging = false;
-            moveSpeed = baseSpeed;  // Return to normal speed
-            // std::cout << "Monster " << getName() << " stopped charging. Speed returned to " << baseSpeed << std::endl;
-        }
+void Monster::handleStateChange(MonsterState oldState, MonsterState newState) {
+    syncStatus(); // Dead slots leave the live range and get no transform sync
+    if (newState == MonsterState::Dead) {
+        handleDeath();
     }
-    
-    // Reset timers on state change
-    resetTimers();
-    
-    // Trigger visual effects for state change
-    // flashStateChange(); // DISABLED: Causing unwanted flashing
-    
-    // Set pulsing based on state - DISABLED to prevent flashing
-    // switch (newState) {
-    //     case MonsterState::Alert:
-    //         setPulsing(true, 3.0f); // Fast pulsing when alert
-    //         break;
-    //     case MonsterState::Chasing:
-    //         setPulsing(true, 4.0f); // Very fast pulsing when chasing
-    //         break;
-    //     case MonsterState::Attacking:
-    //         setPulsing(true, 6.0f); // Extremely fast pulsing when attacking
-    //         break;
-    //     default:
-    //         setPulsing(false); // No pulsing for other states
-    //         break;
-    // }
-    setPulsing(false); // Disable all pulsing to prevent flashing
-    
-    // Call state change callback
     onStateChange(oldState, newState);
 }
 
 void Monster::setHealth(float newHealth) {
-    // Manual clamp instead of std::max/min
-    health = (newHealth < 0.0f) ? 0.0f : ((newHealth > maxHealth) ? maxHealth : newHealth);
-    
-    if (health <= 0.0f && !isDead()) {
-        die();
+    if (!isBound()) return;
+    simulation->setHealth(simulationHandle, newHealth);
+    syncStatus();
+    if (!isAlive()) {
+        handleDeath();
     }
 }
 
 void Monster::flashDamage() {
     isFlashing = true;
-    damageFlashTimer = 0.5f; // Flash for 0.5 seconds (increased from 0.3)
-    // std::cout << "Monster " << getName() << " flashing damage for " << damageFlashTimer << " seconds" << std::endl;
+    // Flash for 0.5 seconds (increased from 0.3); a new hit restarts the flash
+    damageFlashTimer = TimerWheel::getInstance().reschedule(damageFlashTimer, 0.5f, [this]() {
+        isFlashing = false;
+        damageFlashTimer = TimerWheel::INVALID_TIMER;
+    });
 }
 
 void Monster::updateVisualEffects(float deltaTime) {
-    updateDamageFlash(deltaTime);
-    updateStateVisualEffects(deltaTime);
-    updatePulsingEffect(deltaTime);
     updateDeathAnimation(deltaTime);
 }
 
@@ -783,75 +348,24 @@ Vec3 Monster::getCurrentColor() const {
     if (isFlashing) {
         return damageColor;
     }
-    
-    if (isStateFlashing) {
-        return getStateColor();
-    }
-    
-    // Apply pulsing effect to base color
-    Vec3 baseColor = getStateColor();
-    if (isPulsing) {
-        float pulseIntensity = (sin(pulseTimer * pulseSpeed) + 1.0f) * 0.5f; // 0.0 to 1.0
-        baseColor = baseColor * (0.7f + 0.3f * pulseIntensity); // Pulse between 70% and 100% intensity
-    }
-    
-    return baseColor;
+    return getStateColor();
 }
 
-void Monster::configureMonster(MonsterType monsterType) {
-    type = monsterType;
-    
-    switch (type) {
-        case MonsterType::Xenomorph:
-            maxHealth = 100.0f;
-            baseSpeed = 2.0f;      // Slower for better gameplay
-            moveSpeed = baseSpeed;
-            chargeSpeed = 4.0f;    // Slower charging
-            attackRange = 2.0f;
-            attackDamage = 25.0f;
-            detectionRange = 5.0f;  // Reduced detection range
-            dangerRange = 8.0f;     // Reduced danger zone
-            originalColor = Vec3(0.5f, 0.14f, 0.58f); // Purple
-            aggressionLevel = 0.6f; // Moderate aggression
-            fearLevel = 0.2f;       // Low fear
-            experienceReward = 10;  // Standard XP reward
-            scoreReward = 100;      // Standard score reward
-            break;
-            
-        case MonsterType::Runner:
-            maxHealth = 50.0f;
-            baseSpeed = 3.0f;      // Slower runners
-            moveSpeed = baseSpeed;
-            chargeSpeed = 6.0f;    // Slower charging
-            attackRange = 1.5f;
-            attackDamage = 15.0f;
-            detectionRange = 15.0f;
-            dangerRange = 22.0f;  // Runners have large danger zones
-            originalColor = Vec3(0.2f, 0.8f, 0.2f); // Green
-            aggressionLevel = 0.8f; // High aggression
-            fearLevel = 0.1f;       // Very low fear
-            experienceReward = 15;  // Higher XP for fast, hard-to-hit enemies
-            scoreReward = 150;      // Higher score for difficulty
-            break;
-            
-        case MonsterType::Tank:
-            maxHealth = 200.0f;
-            baseSpeed = 1.5f;      // Slower tanks
-            moveSpeed = baseSpeed;
-            chargeSpeed = 3.0f;    // Slower charging
-            attackRange = 3.0f;
-            attackDamage = 40.0f;
-            detectionRange = 8.0f;
-            dangerRange = 12.0f;  // Tanks have smaller but still significant danger zones
-            originalColor = Vec3(0.8f, 0.2f, 0.2f); // Red
-            aggressionLevel = 0.4f; // Lower aggression but persistent
-            fearLevel = 0.3f;       // Higher fear due to slow movement
-            experienceReward = 25;  // Highest XP for toughest enemies
-            scoreReward = 250;      // Highest score for tanks
-            break;
+Vec3 Monster::getStateColor() const {
+    switch (viewState) {
+        case MonsterState::Alert:
+            return alertColor;
+        case MonsterState::Chasing:
+            return chaseColor;
+        case MonsterState::Attacking:
+            return attackColor;
+        case MonsterState::Stunned:
+            return Vec3(0.5f, 0.5f, 0.5f); // Gray when stunned
+        case MonsterState::Retreating:
+            return Vec3(0.8f, 0.2f, 0.8f); // Purple when retreating
+        default:
+            return originalColor;
     }
-    
-    health = maxHealth;
 }
 
 // Override to use Monster renderer
@@ -862,69 +376,18 @@ RendererType Monster::getPreferredRendererType() const {
 float Monster::getDistanceToPlayer() const {
     if (!playerTarget) return 999999.0f;
     
-    Vec3 monsterPos = getPosition();
-    Vec3 playerPos = playerTarget->getPosition();
-    
-    Vec3 diff = playerPos - monsterPos;
+    Vec3 diff = playerTarget->getPosition() - getPosition();
     return sqrt(diff.x * diff.x + diff.y * diff.y + diff.z * diff.z);
 }
 
-bool Monster::canSeePlayer() const {
-    if (!playerTarget) return false;
-    
-    float distance = getDistanceToPlayer();
-    return distance <= detectionRange;
-}
-
 bool Monster::isInAttackRange() const {
     if (!playerTarget) return false;
-    
-    float distance = getDistanceToPlayer();
-    return distance <= attackRange;
+    return getDistanceToPlayer() <= MonsterSimulation::getArchetype(type).attackRange;
 }
 
 bool Monster::isPlayerInDangerZone() const {
     if (!playerTarget) return false;
-    
-    float distance = getDistanceToPlayer();
-    return distance <= dangerRange;
-}
-
-Vec3 Monster::getRandomPatrolPosition() const {
-    Vec3 currentPos = getPosition();
-    
-    // Use monster ID to create unique random seed for each monster
-    // This ensures each monster gets different "random" positions
-    unsigned int monsterSeed = static_cast<unsigned int>(std::hash<std::string>{}(getName())) + static_cast<unsigned int>(time(nullptr));
-    srand(monsterSeed);
-    
-    // Generate random offset within patrol radius with MINIMUM distance for visible movement
-    float angle = (float)(rand() % 360) * 3.14159f / 180.0f;
-    float distance = 5.0f + (float)(rand() % (int)(patrolRadius - 5.0f)); // Minimum 5 units for visible movement
-    
-    Vec3 offset;
-    offset.x = cos(angle) * distance;
-    offset.z = sin(angle) * distance;
-    offset.y = 0.0f; // Keep on same height
-    
-    Vec3 newTarget = currentPos + offset;
-    
-    // Debug output for patrol target generation
-    // std::cout << "=== PATROL TARGET GENERATION ===" << std::endl;
-    // std::cout << "Monster: " << getName() << std::endl;
-    // std::cout << "Current position: (" << currentPos.x << ", " << currentPos.y << ", " << currentPos.z << ")" << std::endl;
-    // std::cout << "Generated target: (" << newTarget.x << ", " << newTarget.y << ", " << newTarget.z << ")" << std::endl;
-    // std::cout << "Offset: (" << offset.x << ", " << offset.y << ", " << offset.z << ")" << std::endl;
-    // std::cout << "Angle: " << (angle * 180.0f / 3.14159f) << "°, Distance: " << distance << " units" << std::endl;
-    // std::cout << "Distance to target: " << sqrt(offset.x * offset.x + offset.z * offset.z) << " units" << std::endl;
-    // std::cout << "===============================" << std::endl;
-    
-    return newTarget;
-}
-
-void Monster::resetTimers() {
-    moveTimer = 0.0f;
-    stateTimer = 0.0f;
+    return getDistanceToPlayer() <= MonsterSimulation::getArchetype(type).dangerRange;
 }
 
 std::string Monster::getStateName(MonsterState state) const {
@@ -942,9 +405,19 @@ std::string Monster::getStateName(MonsterState state) const {
 }
 
 void Monster::setTargetPosition(const Vec3& position) {
-    targetPosition = position;
-    // std::cout << "Monster " << getName() << " target position set to: (" 
-    //           << position.x << ", " << position.y << ", " << position.z << ")" << std::endl;
+    if (isBound()) {
+        simulation->setPatrolTarget(simulationHandle, position);
+    }
+}
+
+Vec3 Monster::getTargetPosition() const {
+    return isBound() ? simulation->getPatrolTarget(simulationHandle) : getPosition();
+}
+
+float Monster::getMoveSpeed() const {
+    if (!isAlive()) return 0.0f;
+    const MonsterArchetype& archetype = MonsterSimulation::getArchetype(type);
+    return simulation->isCharging(simulationHandle) ? archetype.chargeSpeed : archetype.baseSpeed;
 }
 
 void Monster::setRotationFromDirection(const Vec3& direction) {
@@ -953,47 +426,16 @@ void Monster::setRotationFromDirection(const Vec3& direction) {
         return; // No movement, no rotation change
     }
     
-    // Calculate yaw angle (rotation around Y-axis)
     // atan2(x, z) gives us the angle from the positive Z-axis towards the positive X-axis
-    float yaw = atan2(direction.x, direction.z);
-    
-    // Convert to degrees for GameObject rotation system (which expects degrees)
-    float yawDegrees = yaw * 180.0f / 3.14159265359f; // Use explicit PI value
+    float yawDegrees = atan2(direction.x, direction.z) * 180.0f / 3.14159265359f;
     
-    // Get current rotation and update only the Y component (yaw)
     Vec3 currentRotation = getRotation();
-    Vec3 oldRotation = currentRotation;
-    currentRotation.y = yawDegrees; // Set Y rotation to face movement direction
+    currentRotation.y = yawDegrees;
     setRotation(currentRotation);
-    
-    // Debug output (less frequent to avoid spam)
-    static float rotationDebugTimer = 0.0f;
-    rotationDebugTimer += 0.016f; // Approximate frame time
-    
-    if (rotationDebugTimer > 2.0f) { // Debug every 2 seconds
-        // std::cout << "=== MONSTER ROTATION ===" << std::endl;
-        // std::cout << "Monster: " << getName() << std::endl;
-        // std::cout << "Movement direction: (" << direction.x << ", " << direction.y << ", " << direction.z << ")" << std::endl;
-        // std::cout << "Old rotation: (" << oldRotation.x << ", " << oldRotation.y << ", " << oldRotation.z << ") degrees" << std::endl;
-        // std::cout << "New rotation: (" << currentRotation.x << ", " << currentRotation.y << ", " << currentRotation.z << ") degrees" << std::endl;
-        // std::cout << "Yaw angle: " << yawDegrees << " degrees" << std::endl;
-        // std::cout << "=======================" << std::endl;
-        rotationDebugTimer = 0.0f;
-    }
 }
 
 float Monster::getCollisionRadius() const {
-    // Return collision radius based on monster type
-    switch (type) {
-        case MonsterType::Xenomorph:
-            return 1.5f; // Larger radius for easier hitting
-        case MonsterType::Runner:
-            return 1.2f; // Smaller, faster target
-        case MonsterType::Tank:
-            return 2.0f; // Large, slow target
-        default:
-            return 1.5f;
-    }
+    return MonsterSimulation::getArchetype(type).collisionRadius;
 }
 
 Vec3 Monster::getCollisionCenter() const {
@@ -1086,7 +528,7 @@ void Monster::setupMonsterMesh() {
             4, 5, 1,  1, 0, 4
         };
         
-        mesh = std::make_unique<Mesh>();
+        mesh = std::make_shared<Mesh>();
         if (!mesh->createMesh(vertices, indices)) {
             // std::cerr << "Failed to create fallback cube mesh for '" << getName() << "'" << std::endl;
         } else {
@@ -1096,7 +538,7 @@ void Monster::setupMonsterMesh() {
     }
     
     // Create mesh from loaded data
-    mesh = std::make_unique<Mesh>();
+    mesh = std::make_shared<Mesh>();
     
     // Extract position and texture coordinates from OBJ data for basic renderer
     // OBJ format: [pos.x, pos.y, pos.z, normal.x, normal.y, normal.z, texCoord.u, texCoord.v]
@@ -1147,12 +589,12 @@ void Monster::setupMonsterMaterial() {
     
     if (monsterMaterials.getMaterialCount() > 0) {
         // std::cout << "  Loaded " << monsterMaterials.getMaterialCount() << " materials from MTL file" << std::endl;
-        // std::cout << "  Created " << materialGroups.size() << " material groups" << std::endl;
+        // std::cout << "  Created " << getMaterialGroups().size() << " material groups" << std::endl;
         
         // Debug: List material group colors
-        for (size_t i = 0; i < materialGroups.size(); i++) {
-            // std::cout << "    Group " << i << " color: " << materialGroups[i].color.x << ", " 
-            //               << materialGroups[i].color.y << ", " << materialGroups[i].color.z << std::endl;
+        for (size_t i = 0; i < getMaterialGroups().size(); i++) {
+            // std::cout << "    Group " << i << " color: " << getMaterialGroups()[i].color.x << ", " 
+            //               << getMaterialGroups()[i].color.y << ", " << getMaterialGroups()[i].color.z << std::endl;
         }
     } else {
         // std::cout << "  No materials loaded - using fallback color" << std::endl;
@@ -1170,8 +612,8 @@ void Monster::createMaterialGroups(const OBJMeshData& objData) {
     // Parse the OBJ data and create material groups based on material assignments
     // std::cout << "Creating material groups from OBJ data..." << std::endl;
     
-    // Clear existing material groups
-    materialGroups.clear();
+    // Built into a new list; snapshots may still hold the old one
+    auto groups = std::make_shared<std::vector<MaterialGroup>>();
     
     // Create material groups based on loaded materials
     if (monsterMaterials.getMaterialCount() > 0 && !objData.faceMaterials.empty()) {
@@ -1211,7 +653,7 @@ void Monster::createMaterialGroups(const OBJMeshData& objData) {
                 group.materialName = materialName;
                 group.indices = materialIndexMap[materialName];
                 group.color = mat->diffuse;
-                materialGroups.push_back(group);
+                groups->push_back(group);
                 
                 // std::cout << "  Material group '" << materialName << "': " 
                 //           << group.indices.size() << " indices, color(" 
@@ -1220,173 +662,125 @@ void Monster::createMaterialGroups(const OBJMeshData& objData) {
         }
     }
     
-    // std::cout << "Created " << materialGroups.size() << " material groups for monster" << std::endl;
-}
-
-void Monster::updateDamageFlash(float deltaTime) {
-    if (isFlashing) {
-        damageFlashTimer -= deltaTime;
-        if (damageFlashTimer <= 0.0f) {
-            isFlashing = false;
-            // std::cout << "Monster " << getName() << " damage flash ended" << std::endl;
-        }
-    }
-}
-
-bool Monster::shouldChangeState() const {
-    if (isDead()) return false;
-    
-    // Check if player is in range
-    if (canSeePlayer()) {
-        if (isInAttackRange()) {
-            return state != MonsterState::Attacking;
-        } else {
-            return state != MonsterState::Chasing;
-        }
-    }
-    
-    // If no player in sight, patrol
-    return state != MonsterState::Patrolling;
+    materialGroups = groups;
+    // std::cout << "Created " << materialGroups->size() << " material groups for monster" << std::endl;
 }
 
-MonsterState Monster::determineNextState() {
-    if (isDead()) return MonsterState::Dead;
+// Loot system method implementations
+void Monster::dropLoot() {
+    if (hasDroppedLoot) return;
     
-    // If stunned, stay stunned until timer expires
-    if (isStunned()) {
-        return MonsterState::Stunned;
-    }
+    // std::cout << "=== MONSTER LOOT DROP ===" << std::endl;
+    // std::cout << "Monster: " << getName() << std::endl;
+    // std::cout << "Experience reward: " << experienceReward << " XP" << std::endl;
+    // std::cout << "Score reward: " << scoreReward << " points" << std::endl;
     
-    // Check if monster should retreat (low health + high fear)
-    if (shouldRetreat()) {
-        return MonsterState::Retreating;
-    }
-    
-    // Check if player is in attack range
-    if (isInAttackRange() && hasLineOfSight) {
-            return MonsterState::Attacking;
-    }
-    
-    // Check if player is in danger zone (aggressive behavior)
-    if (isPlayerInDangerZone() && hasLineOfSight) {
-            return MonsterState::Chasing;
-    }
-    
-    // Check if player is visible (normal detection)
-    if (hasLineOfSight) {
-        // If we just spotted the player, go to alert first
-        if (state == MonsterState::Patrolling || state == MonsterState::Idle) {
-            return MonsterState::Alert;
-        }
-            return MonsterState::Chasing;
-        }
-    
-    // If we lost sight of player but have a last known position
-    if (state == MonsterState::Chasing && !hasLineOfSight && 
-        getDistanceToLastKnownPlayerPos() > 2.0f) {
-        return MonsterState::Alert; // Search for player
-    }
+    // In a real game, you would:
+    // 1. Create loot objects at the monster's position
+    // 2. Add experience to the player
+    // 3. Add score to the game score
+    // 4. Possibly drop items, weapons, or other rewards
     
-    // If we've been alert for too long without seeing player, go back to patrolling
-    if (state == MonsterState::Alert && alertTimer > 5.0f) {
-    return MonsterState::Patrolling;
+    // For now, just log the rewards
+    // std::cout << "Loot dropped at position: (" << getPosition().x << ", " << getPosition().y << ", " << getPosition().z << ")" << std::endl;
+    // std::cout << "=========================" << std::endl;
 }
 
-    // Default to patrolling
-    return MonsterState::Patrolling;
+int Monster::getExperienceReward() const {
+    return MonsterSimulation::getArchetype(type).experienceReward;
 }
 
-// Health bar methods - NEW: Using texture-based system
-void Monster::updateHealthBar() {
-    if (textureHealthBar && showHealthBar) {
-        textureHealthBar->setHealth(health, maxHealth);
-        textureHealthBar->update(0.016f); // Approximate frame time
-    }
+int Monster::getScoreReward() const {
+    return MonsterSimulation::getArchetype(type).scoreReward;
 }
 
-void Monster::renderHealthBar(const Camera& camera) {
-    // IMMEDIATE DEBUG: Check why health bars aren't rendering
-    static int immediateDebugCount = 0;
-    immediateDebugCount++;
-    if (immediateDebugCount % 30 == 0) { // Every 0.5 seconds at 60fps
-        std::cout << "*** MONSTER RENDER HEALTH BAR CALLED ***" << std::endl;
-        std::cout << "Monster: " << getName() << std::endl;
-        std::cout << "textureHealthBar exists: " << (textureHealthBar ? "YES" : "NO") << std::endl;
-        std::cout << "showHealthBar: " << (showHealthBar ? "YES" : "NO") << std::endl;
-        std::cout << "health: " << health << "/" << maxHealth << std::endl;
-        std::cout << "isAlive(): " << (isAlive() ? "YES" : "NO") << std::endl;
-        std::cout << "******************************************" << std::endl;
-    }
+// Death animation method implementations
+void Monster::startDeathAnimation() {
+    if (isDeathAnimating) return;
     
-    // Only render health bars for alive monsters
-    if (textureHealthBar && showHealthBar && isAlive()) {
-        // Debug: Compare raw position vs model matrix position
-        Vec3 rawPosition = getPosition();
-        Mat4 monsterMatrix = getModelMatrix();
-        Vec3 matrixPosition = Vec3(monsterMatrix.m[12], monsterMatrix.m[13], monsterMatrix.m[14]);
-        
-        static int debugCount = 0;
-        debugCount++;
-        if (debugCount % 60 == 0) { // Every 1 second
-            std::cout << "=== MONSTER POSITION INVESTIGATION ===" << std::endl;
-            std::cout << "Monster name: " << getName() << std::endl;
-            std::cout << "Raw monster position: (" << rawPosition.x << ", " << rawPosition.y << ", " << rawPosition.z << ")" << std::endl;
-            std::cout << "Matrix position: (" << matrixPosition.x << ", " << matrixPosition.y << ", " << matrixPosition.z << ")" << std::endl;
-            std::cout << "Position difference: (" << (matrixPosition.x - rawPosition.x) << ", " << (matrixPosition.y - rawPosition.y) << ", " << (matrixPosition.z - rawPosition.z) << ")" << std::endl;
-            
-            // Check if monster is actually being rendered
-            std::cout << "Monster active: " << (isActive ? "YES" : "NO") << std::endl;
-            std::cout << "Monster health: " << health << "/" << maxHealth << std::endl;
-            std::cout << "Monster state: " << static_cast<int>(state) << std::endl;
-            
-            // Print the actual model matrix to see what's happening
-            std::cout << "Model matrix:" << std::endl;
-            for (int i = 0; i < 4; i++) {
-                std::cout << "[" << monsterMatrix.m[i*4] << ", " << monsterMatrix.m[i*4+1] << ", " << monsterMatrix.m[i*4+2] << ", " << monsterMatrix.m[i*4+3] << "]" << std::endl;
-            }
-            std::cout << "======================================" << std::endl;
-        }
-        
-        // Use model matrix position (now that transformation order is fixed)
-        
-        // Additional debug: Show what position we're passing to health bar
-        if (debugCount % 600 == 0) {
-            std::cout << "=== PASSING TO HEALTH BAR ===" << std::endl;
-            std::cout << "Monster matrix position passed to health bar: (" << matrixPosition.x << ", " << matrixPosition.y << ", " << matrixPosition.z << ")" << std::endl;
-            std::cout << "Expected health bar world position: (" << matrixPosition.x << ", " << (matrixPosition.y + 2.5f) << ", " << (matrixPosition.z + 0.1f) << ")" << std::endl;
-            std::cout << "=============================" << std::endl;
-        }
+    isDeathAnimating = true;
+    deathAnimationTimer = 0.0f;
+    
+    // Store original scale
+    originalScale = getScale();
+    
+    // std::cout << "=== DEATH ANIMATION STARTED ===" << std::endl;
+    // std::cout << "Monster: " << getName() << std::endl;
+    // std::cout << "Animation duration: " << deathAnimationDuration << " seconds" << std::endl;
+    // std::cout << "Original scale: (" << originalScale.x << ", " << originalScale.y << ", " << originalScale.z << ")" << std::endl;
+    // std::cout << "==============================" << std::endl;
+}
+
+void Monster::updateDeathAnimation(float deltaTime) {
+    if (!isDeathAnimating) return;
+    
+    deathAnimationTimer += deltaTime;
+    
+    // Calculate animation progress (0.0 to 1.0)
+    float progress = deathAnimationTimer / deathAnimationDuration;
+    
+    if (progress >= 1.0f) {
+        // Animation finished
+        isDeathAnimating = false;
+        deathAnimationTimer = deathAnimationDuration;
+        progress = 1.0f;
         
-        textureHealthBar->render(matrixPosition, camera);
+        // std::cout << "=== DEATH ANIMATION COMPLETED ===" << std::endl;
+        // std::cout << "Monster: " << getName() << std::endl;
+        // std::cout << "================================" << std::endl;
+    }
+    
+    // Create shrinking effect (monster shrinks and fades)
+    float scaleMultiplier = 1.0f - (progress * 0.8f); // Shrink to 20% of original size
+    deathScale = originalScale * scaleMultiplier;
+    
+    // Apply the death scale
+    setScale(deathScale);
+    
+    // Create fading effect by modifying color alpha (if supported)
+    // For now, we'll just make the monster darker
+    Vec3 fadeColor = getCurrentColor() * (1.0f - progress * 0.5f);
+    setColor(fadeColor);
+    
+    // Debug output every few frames
+    static float debugTimer = 0.0f;
+    debugTimer += deltaTime;
+    if (debugTimer > 0.5f) {
+        // std::cout << "Death animation progress: " << (progress * 100.0f) << "%" << std::endl;
+        // std::cout << "Current scale: (" << deathScale.x << ", " << deathScale.y << ", " << deathScale.z << ")" << std::endl;
+        debugTimer = 0.0f;
     }
 }
 
 // MonsterSpawner implementation
+const uint32_t MonsterSpawner::STATE_TAG = makeStateTag('M', 'S', 'P', 'N');
+const uint16_t MonsterSpawner::STATE_VERSION = 1;
+
 MonsterSpawner::MonsterSpawner(Scene* scene, GameObject* player)
-    : gameScene(scene),
-      playerTarget(player),
+    : activeMonsters(),
+      nextMonsterSeed(1),
+      monsterTypes({MonsterType::Xenomorph}),
       maxMonsters(3),  // TESTING: Spawn 3 monsters to test health bar positioning
       spawnInterval(0.1f),  // TESTING: Spawn extremely fast for multiple monster testing
-      lastSpawnTime(0.0f),
       spawnRadius(8.0f),  // Spread monsters out for better health bar visibility testing
       spawnCenter(10.0f, 0.0f, 10.0f),  // Spawn CLOSE to player starting position
-      monsterTypes({MonsterType::Xenomorph}),
-      activeMonsters(),
       currentWave(0),
       monstersInCurrentWave(0),
       monstersSpawnedInWave(0),
-      waveStartTime(0.0f),
+      waveStartTime(0.0),
       waveDuration(60.0f),  // 60 seconds per wave
       waveInProgress(false),
       timeBetweenWaves(10.0f),  // 10 seconds between waves
-      lastWaveEndTime(0.0f),
       difficultyLevel(1.0f),
       difficultyIncreaseRate(0.1f),
-      lastDifficultyIncrease(0.0f),
-      difficultyIncreaseInterval(30.0f) {  // Increase difficulty every 30 seconds
-    
-    // Seed random number generator for spawn positions
-    srand(static_cast<unsigned int>(time(nullptr)));
+      difficultyIncreaseInterval(30.0f),  // Increase difficulty every 30 seconds
+      waveStep(WaveStep::StartWave),
+      waveTask(0),
+      difficultyTask(0),
+      waveResumeTime(-1.0),
+      difficultyResumeTime(-1.0),
+      playerTarget(player),
+      gameScene(scene) {
     
     // std::cout << "MonsterSpawner initialized with spawn center: (" << spawnCenter.x << ", " << spawnCenter.y << ", " << spawnCenter.z << ")" << std::endl;
     // std::cout << "Spawn radius: " << spawnRadius << " units" << std::endl;
@@ -1395,65 +789,299 @@ MonsterSpawner::MonsterSpawner(Scene* scene, GameObject* player)
 
 
 
+MonsterSpawner::~MonsterSpawner() {
+    stopTasks();
+}
+
 void MonsterSpawner::update(float deltaTime) {
-    if (!gameScene || !playerTarget) return;
+    if (beginUpdate()) {
+        stepSimulation(deltaTime);
+        endUpdate();
+    }
+}
+
+bool MonsterSpawner::beginUpdate() {
+    if (!gameScene || !playerTarget) return false;
     
-    // Update difficulty
-    updateDifficulty(deltaTime);
+    // Wave flow and difficulty run as tasks; they only wake when something is due
+    startTasks();
     
-    // Update spawn timer
-    lastSpawnTime += deltaTime;
+    // AI and movement for every monster run in stepSimulation in batched passes;
+    // the Scene update cycle only drives the views' visual effects
+    simulation.setPlayerPosition(playerTarget->getPosition());
+    return true;
+}
+
+void MonsterSpawner::startTasks() {
+    TaskScheduler& scheduler = TaskScheduler::getInstance();
     
-    // Check if we should start a new wave
-    if (!waveInProgress && shouldStartNewWave()) {
-        startNewWave();
+    if (!scheduler.isRunning(waveTask)) {
+        waveStep = WaveStep::StartWave;
+        waveTask = scheduler.start([this]() { return resumeWaveSequence(); });
     }
     
-    // Check if current wave should end
-    if (waveInProgress && (lastSpawnTime >= waveDuration || monstersSpawnedInWave >= monstersInCurrentWave)) {
-        endCurrentWave();
+    if (!scheduler.isRunning(difficultyTask)) {
+        startDifficultyTask(0.0f);
+    }
+}
+
+void MonsterSpawner::startDifficultyTask(float firstDelay) {
+    bool firstResume = true;
+    difficultyTask = TaskScheduler::getInstance().start([this, firstResume, firstDelay]() mutable {
+        float delay = difficultyIncreaseInterval;
+        if (firstResume) {
+            firstResume = false;
+            if (firstDelay > 0.0f) delay = firstDelay;
+        } else {
+            increaseDifficulty(difficultyIncreaseRate);
+        }
+        difficultyResumeTime = TimerWheel::getInstance().getTime() + delay;
+        return TaskWait::seconds(delay);
+    });
+}
+
+void MonsterSpawner::restartTasks(float waveDelay, float difficultyDelay) {
+    stopTasks();
+    TaskScheduler& scheduler = TaskScheduler::getInstance();
+    
+    // The wave task picks up at the restored waveStep once the remaining sleep has passed
+    bool firstResume = true;
+    waveTask = scheduler.start([this, firstResume, waveDelay]() mutable {
+        if (firstResume) {
+            firstResume = false;
+            if (waveDelay > 0.0f) {
+                waveResumeTime = TimerWheel::getInstance().getTime() + waveDelay;
+                return TaskWait::seconds(waveDelay);
+            }
+        }
+        return resumeWaveSequence();
+    });
+    startDifficultyTask(difficultyDelay);
+}
+
+void MonsterSpawner::stopTasks() {
+    TaskScheduler& scheduler = TaskScheduler::getInstance();
+    scheduler.cancel(waveTask);
+    scheduler.cancel(difficultyTask);
+    waveTask = 0;
+    difficultyTask = 0;
+}
+
+TaskWait MonsterSpawner::resumeWaveSequence() {
+    // One resume runs until the next wait: start wave -> spawn one monster per interval -> end wave -> pause
+    for (;;) {
+        switch (waveStep) {
+            case WaveStep::StartWave:
+                startNewWave();
+                waveStep = WaveStep::SpawnMonsters;
+                break;
+                
+            case WaveStep::SpawnMonsters: {
+                double waveTime = TimerWheel::getInstance().getTime() - waveStartTime;
+                if (monstersSpawnedInWave >= monstersInCurrentWave || waveTime >= waveDuration) {
+                    waveStep = WaveStep::EndWave;
+                    break;
+                }
+                if (getAliveMonsterCount() >= maxMonsters) {
+                    // Population cap: sleep until a monster dies
+                    waveResumeTime = -1.0;
+                    return TaskWait::event(monsterDied);
+                }
+                std::cout << "=== SPAWNING NEW MONSTER (Wave " << currentWave << ") ===" << std::endl;
+                spawnRandomMonster();
+                monstersSpawnedInWave++;
+                waveResumeTime = TimerWheel::getInstance().getTime() + spawnInterval;
+                return TaskWait::seconds(spawnInterval);
+            }
+                
+            case WaveStep::EndWave:
+                endCurrentWave();
+                waveStep = WaveStep::StartWave;
+                waveResumeTime = TimerWheel::getInstance().getTime() + timeBetweenWaves;
+                return TaskWait::seconds(timeBetweenWaves);
+        }
+    }
+}
+
+void MonsterSpawner::updateSimulation(float deltaTime) {
+    if (playerTarget) {
+        simulation.setPlayerPosition(playerTarget->getPosition());
+    } else {
+        simulation.clearPlayer();
     }
     
-    // Check if we should spawn a new monster (only during waves)
-    if (waveInProgress && shouldSpawnMonster()) {
-        std::cout << "=== SPAWNING NEW MONSTER (Wave " << currentWave << ") ===" << std::endl;
-        spawnRandomMonster();
-        lastSpawnTime = 0.0f;
-        monstersSpawnedInWave++;
+    simulation.update(deltaTime);
+    endUpdate();
+}
+
+void MonsterSpawner::endUpdate() {
+    // Attacks landed this tick
+    Player* player = dynamic_cast<Player*>(playerTarget);
+    if (player) {
+        for (const MonsterAttackEvent& attackEvent : simulation.getAttackEvents()) {
+            player->takeDamage(attackEvent.damage);
+        }
     }
     
-    // CRASH PREVENTION: Check for dead monsters but don't remove them
-    static float debugTimer = 0.0f;
-    debugTimer += deltaTime;
-    if (debugTimer > 3.0f) { // Print every 3 seconds instead of every frame
-        // std::cout << "=== MONSTER SPAWNER UPDATE ===" << std::endl;
-        // std::cout << "Active monsters in tracking: " << activeMonsters.size() << std::endl;
-        for (const auto& monster : activeMonsters) {
-            if (monster) {
-                try {
-                    // CRASH PREVENTION: Check if monster is still valid before accessing
-                    if (monster->getActive() && !monster->isDead()) {
-                        // std::cout << "Monster: " << monster->getName() << " - Dead: NO" << std::endl;
-                    } else {
-                        // std::cout << "Monster: " << monster->getName() << " - Dead: YES (or inactive)" << std::endl;
-                    }
-                } catch (const std::exception&) {
-                    // std::cout << "Error accessing monster: " << e.what() << std::endl;
-                }
-            }
+    dispatchSimulationEvents();
+}
+
+void MonsterSpawner::dispatchSimulationEvents() {
+    // Let the views react to transitions (death handling, onStateChange hooks)
+    bool anyDied = false;
+    for (const MonsterStateChange& change : simulation.getStateChanges()) {
+        anyDied = anyDied || change.newState == MonsterState::Dead;
+        if (change.handle < monstersByHandle.size() && monstersByHandle[change.handle]) {
+            monstersByHandle[change.handle]->handleStateChange(change.oldState, change.newState);
         }
-        // std::cout << "=============================" << std::endl;
-        debugTimer = 0.0f;
+    }
+    if (anyDied) {
+        monsterDied.signal();
+    }
+    simulation.clearEvents();
+    
+    // Copy the simulated transforms into the live views
+    for (size_t i = 0; i < simulation.getLiveCount(); i++) {
+        uint32_t handle = simulation.getHandleAt(i);
+        Monster* monster = handle < monstersByHandle.size() ? monstersByHandle[handle] : nullptr;
+        if (monster) {
+            monster->syncFromSimulation(simulation.getPositionAt(i), simulation.getYawDegreesAt(i));
+        }
+    }
+}
+
+void MonsterSpawner::applyReplicatedMonsters(const std::vector<NetMonsterState>& monsters) {
+    if (!gameScene) return;
+    
+    // Ids that were not replicated this time have died (or left relevance) on the server
+    std::unordered_map<uint32_t, uint32_t> previousHandles;
+    previousHandles.swap(replicatedHandles);
+    
+    for (const NetMonsterState& state : monsters) {
+        MonsterType type = static_cast<MonsterType>(state.type);
+        uint32_t handle;
+        
+        auto known = previousHandles.find(state.id);
+        if (known != previousHandles.end() && simulation.isValid(known->second)) {
+            handle = known->second;
+            previousHandles.erase(known);
+        } else {
+            Monster* monster = createMonster(state.position, type);
+            if (!monster) continue;
+            handle = monster->getSimulationHandle();
+        }
+        replicatedHandles[state.id] = handle;
+        
+        // The server's values replace the local simulation's
+        Monster* monster = handle < monstersByHandle.size() ? monstersByHandle[handle] : nullptr;
+        float health = state.healthPercent * simulation.getMaxHealth(handle);
+        if (monster && health < simulation.getHealth(handle)) {
+            monster->flashDamage();
+        }
+        simulation.setPosition(handle, state.position);
+        simulation.setYawDegrees(handle, state.yawDegrees);
+        simulation.setHealth(handle, health);
+        simulation.setState(handle, static_cast<MonsterState>(state.state));
+    }
+    
+    for (const auto& gone : previousHandles) {
+        simulation.kill(gone.second);
+    }
+    
+    dispatchSimulationEvents();
+}
+
+void MonsterSpawner::saveState(StateWriter& writer) const {
+    double now = TimerWheel::getInstance().getTime();
+    
+    writer.beginSection(STATE_TAG, STATE_VERSION);
+    writer.write(nextMonsterSeed);
+    writer.write(static_cast<int32_t>(currentWave));
+    writer.write(static_cast<int32_t>(monstersInCurrentWave));
+    writer.write(static_cast<int32_t>(monstersSpawnedInWave));
+    writer.write(static_cast<uint8_t>(waveInProgress));
+    writer.write(static_cast<uint8_t>(waveStep));
+    writer.write(now - waveStartTime);  // TimerWheel times are stored relative to the capture
+    writer.write(spawnInterval);
+    writer.write(difficultyLevel);
+    writer.write(static_cast<float>(waveResumeTime >= 0.0 ? std::max(0.0, waveResumeTime - now) : 0.0));
+    writer.write(static_cast<float>(difficultyResumeTime >= 0.0 ? std::max(0.0, difficultyResumeTime - now) : 0.0));
+    writer.endSection();
+    
+    simulation.saveState(writer);
+}
+
+bool MonsterSpawner::restoreState(StateReader& reader) {
+    if (!reader.openSection(STATE_TAG, STATE_VERSION)) return false;
+    
+    double now = TimerWheel::getInstance().getTime();
+    nextMonsterSeed = reader.read<uint32_t>();
+    currentWave = reader.read<int32_t>();
+    monstersInCurrentWave = reader.read<int32_t>();
+    monstersSpawnedInWave = reader.read<int32_t>();
+    waveInProgress = reader.read<uint8_t>() != 0;
+    uint8_t step = reader.read<uint8_t>();
+    waveStep = step <= static_cast<uint8_t>(WaveStep::EndWave) ? static_cast<WaveStep>(step) : WaveStep::StartWave;
+    waveStartTime = now - reader.read<double>();
+    spawnInterval = reader.read<float>();
+    difficultyLevel = reader.read<float>();
+    float waveDelay = reader.read<float>();
+    float difficultyDelay = reader.read<float>();
+    
+    bool restored = reader.isValid() && simulation.restoreState(reader);
+    replicatedHandles.clear();
+    
+    // Keep the views whose slot came back with the same type; drop the others
+    for (size_t handle = 0; handle < monstersByHandle.size(); handle++) {
+        Monster* view = monstersByHandle[handle];
+        if (!view) continue;
+        uint32_t slot = static_cast<uint32_t>(handle);
+        if (simulation.isValid(slot) && simulation.getType(slot) == view->getType()) continue;
+        if (gameScene) gameScene->removeGameObject(view);
+        monstersByHandle[handle] = nullptr;
+    }
+    
+    // Bring every restored slot's view in line; build views only for slots that lost theirs
+    activeMonsters.clear();
+    for (size_t i = 0; i < simulation.size(); i++) {
+        uint32_t handle = simulation.getHandleAt(i);
+        Monster* view = handle < monstersByHandle.size() ? monstersByHandle[handle] : nullptr;
+        if (!view && gameScene) {
+            view = createView(handle, simulation.getType(handle));
+        }
+        if (!view) continue;
+        view->setPlayerTarget(playerTarget);
+        view->resetFromSimulation();
+        activeMonsters.push_back(view);
     }
     
-    // NOTE: Monster updates are now handled by the Scene update cycle
-    // This allows for proper full monster behavior including movement and AI
+    // Same condition update() starts the tasks under
+    if (gameScene && playerTarget) {
+        restartTasks(waveDelay, difficultyDelay);
+    }
+    return restored;
+}
+
+bool MonsterSpawner::validateState(StateReader& reader) {
+    if (!reader.openSection(STATE_TAG, STATE_VERSION)) return false;
     
-    // Monster updates are now handled by the Scene update cycle
-    // This enables full monster behavior including movement and AI
+    // Same layout restoreState reads: seed, wave counters, flags, timings
+    reader.read<uint32_t>();
+    reader.read<int32_t>();
+    reader.read<int32_t>();
+    reader.read<int32_t>();
+    reader.read<uint8_t>();
+    reader.read<uint8_t>();
+    reader.read<double>();
+    reader.read<float>();
+    reader.read<float>();
+    reader.read<float>();
+    reader.read<float>();
+    return reader.isValid() && MonsterSimulation::validateState(reader);
 }
 
 void MonsterSpawner::cleanup() {
+    stopTasks();
     clearAllMonsters();
     gameScene = nullptr;
     playerTarget = nullptr;
@@ -1462,15 +1090,7 @@ void MonsterSpawner::cleanup() {
 void MonsterSpawner::spawnMonster(MonsterType type) {
     if (!gameScene) return;
     
-    // Count only alive monsters
-    int aliveMonsters = 0;
-    for (const auto& monster : activeMonsters) {
-        if (monster && monster->getActive() && !monster->isDead()) {
-            aliveMonsters++;
-        }
-    }
-    
-    if (aliveMonsters >= maxMonsters) return;
+    if (getAliveMonsterCount() >= maxMonsters) return;
     
     Vec3 spawnPos = getRandomSpawnPosition();
     spawnMonsterAt(spawnPos, type);
@@ -1479,55 +1099,75 @@ void MonsterSpawner::spawnMonster(MonsterType type) {
 void MonsterSpawner::spawnMonsterAt(const Vec3& position, MonsterType type) {
     if (!gameScene) return;
     
-    // Count only alive monsters
-    int aliveMonsters = 0;
-    for (const auto& monster : activeMonsters) {
-        if (monster && monster->getActive() && !monster->isDead()) {
-            aliveMonsters++;
-        }
+    if (getAliveMonsterCount() >= maxMonsters) return;
+    
+    createMonster(position, type);
+}
+
+Monster* MonsterSpawner::createMonster(const Vec3& position, MonsterType type) {
+    if (!gameScene) return nullptr;
+    
+    // Gameplay state lives in the simulation; the monster object is a view onto it
+    uint32_t handle = simulation.add(type, position, nextMonsterSeed++ * 2654435761u);
+    Monster* monsterPtr = createView(handle, type);
+    if (!monsterPtr) {
+        simulation.remove(handle);
+        return nullptr;
     }
     
-    if (aliveMonsters >= maxMonsters) return;
+    monsterPtr->spawn(position);
     
-    std::string monsterName = "Monster_" + std::to_string(activeMonsters.size());
-    auto monster = std::make_unique<Monster>(monsterName, type);
+    // Health bar is now rendered inline - no separate object needed
+    
+    // Store reference in our active monsters list
+    activeMonsters.push_back(monsterPtr);
+    
+    std::cout << "=== MONSTER SPAWNED ===" << std::endl;
+    std::cout << "Spawned " << monsterPtr->getName() << " at " << position.x << ", " << position.y << ", " << position.z << std::endl;
+    std::cout << "Monster entity flag: " << (monsterPtr->getEntity() ? "true" : "false") << std::endl;
+    std::cout << "Monster active: " << (monsterPtr->getActive() ? "true" : "false") << std::endl;
+    std::cout << "Monster renderer type: " << static_cast<int>(monsterPtr->getPreferredRendererType()) << std::endl;
+    std::cout << "Monster position: (" << monsterPtr->getPosition().x << ", " << monsterPtr->getPosition().y << ", " << monsterPtr->getPosition().z << ")" << std::endl;
+    std::cout << "Monster state: " << monsterPtr->getStateName(monsterPtr->getState()) << std::endl;
+    std::cout << "Player target: " << (monsterPtr->getPlayerTarget() ? "SET" : "NULL") << std::endl;
+    // std::cout << "Total active monsters: " << activeMonsters.size() << std::endl;
+    return monsterPtr;
+}
+
+Monster* MonsterSpawner::createView(uint32_t handle, MonsterType type) {
+    // One view per slot, so the handle keeps names unique across spawns and restores
+    std::string name = "Monster_" + std::to_string(handle);
+    auto monster = std::make_unique<Monster>(name, type);
     
     // Set player target
     monster->setPlayerTarget(playerTarget);
+    monster->bindSimulation(&simulation, handle);
     
-    // Initialize and spawn
-    if (monster->initialize()) {
-        monster->spawn(position);
-        
-        // Add monster to the scene so it's included in visibility system
-        Monster* monsterPtr = monster.get();
-        gameScene->addGameObject(std::move(monster));
-        
-        // Health bar is now rendered inline - no separate object needed
-        
-        // Store reference in our active monsters list
-        activeMonsters.push_back(monsterPtr);
-        
-        std::cout << "=== MONSTER SPAWNED ===" << std::endl;
-        std::cout << "Spawned " << monsterName << " at " << position.x << ", " << position.y << ", " << position.z << std::endl;
-        std::cout << "Monster entity flag: " << (monsterPtr->getEntity() ? "true" : "false") << std::endl;
-        std::cout << "Monster active: " << (monsterPtr->getActive() ? "true" : "false") << std::endl;
-        std::cout << "Monster renderer type: " << static_cast<int>(monsterPtr->getPreferredRendererType()) << std::endl;
-        std::cout << "Monster position: (" << monsterPtr->getPosition().x << ", " << monsterPtr->getPosition().y << ", " << monsterPtr->getPosition().z << ")" << std::endl;
-        std::cout << "Monster state: " << monsterPtr->getStateName(monsterPtr->getState()) << std::endl;
-        std::cout << "Player target: " << (monsterPtr->getPlayerTarget() ? "SET" : "NULL") << std::endl;
-        // std::cout << "Total active monsters: " << activeMonsters.size() << std::endl;
+    if (!monster->initialize()) return nullptr;
+    
+    // Add monster to the scene so it's included in visibility system. The scene drops (destroys)
+    // an object whose name is taken, e.g. by a view it has not deleted yet; don't keep that pointer
+    Monster* monsterPtr = monster.get();
+    gameScene->addGameObject(std::move(monster));
+    if (gameScene->getGameObject(name) != monsterPtr) {
+        std::cerr << "MonsterSpawner: scene already has an object named " << name << std::endl;
+        return nullptr;
     }
-}
-
-void MonsterSpawner::spawnRandomMonster() {
-    MonsterType type = getRandomMonsterType();
-    spawnMonster(type);
+    
+    if (handle >= monstersByHandle.size()) {
+        monstersByHandle.resize(handle + 1, nullptr);
+    }
+    monstersByHandle[handle] = monsterPtr;
+    return monsterPtr;
 }
 
 void MonsterSpawner::clearAllMonsters() {
     // Clear our reference list - scene will handle cleanup
+    // (the views may already be destroyed; their retired handles make any survivors read as dead)
     activeMonsters.clear();
+    monstersByHandle.clear();
+    replicatedHandles.clear();
+    simulation.clear();
 }
 
 void MonsterSpawner::removeMonster(Monster* monster) {
@@ -1553,6 +1193,19 @@ void MonsterSpawner::addMonsterType(MonsterType type) {
     monsterTypes.push_back(type);
 }
 
+void MonsterSpawner::setPlayerTarget(GameObject* player) {
+    if (player == playerTarget) return;
+    playerTarget = player;
+    
+    // Only live monsters: views of dead ones may already be gone
+    for (size_t i = 0; i < simulation.getLiveCount(); i++) {
+        uint32_t handle = simulation.getHandleAt(i);
+        if (handle < monstersByHandle.size() && monstersByHandle[handle]) {
+            monstersByHandle[handle]->setPlayerTarget(player);
+        }
+    }
+}
+
 void MonsterSpawner::removeDeadMonsters() {
     // CRASH PREVENTION: COMPLETELY DISABLE DEAD MONSTER CLEANUP
     // This method was causing crashes when trying to access dead monsters
@@ -1573,40 +1226,23 @@ void MonsterSpawner::removeDeadMonsters() {
 }
 
 Vec3 MonsterSpawner::getRandomSpawnPosition() const {
+    // Keyed by the seed the next monster will get, so a spawn's position and
+    // type depend only on the world seed and how many monsters came before
+    CounterRandom random(simulation.getWorldSeed(), nextMonsterSeed, 0, RandomStream::Spawn);
+    
     if (spawnPoints.empty()) {
-        // Use current time and spawn count to create unique spawn positions
-        static int spawnCount = 0;
-        spawnCount++;
-        
-        // Create unique seed for each spawn with better randomization
-        unsigned int spawnSeed = static_cast<unsigned int>(time(nullptr)) + spawnCount * 1000 + (spawnCount * 7);
-        srand(spawnSeed);
-        
-        // Generate random position around spawn center - CLOSE to player
-        float angle = (float)(rand() % 360) * 3.14159f / 180.0f;
-        float distance = 2.0f + (float)(rand() % (int)(spawnRadius - 2.0f)); // Minimum 2 units from center
+        // Random position around spawn center - CLOSE to player, minimum 2 units from center
+        float angle = random.nextFloat() * 2.0f * static_cast<float>(M_PI);
+        float distance = random.nextRange(2.0f, std::max(2.0f, spawnRadius));
         
         Vec3 pos = spawnCenter;
         pos.x += cos(angle) * distance;
         pos.z += sin(angle) * distance;
-        
-        // Debug output for spawn position
-        // std::cout << "=== SPAWN POSITION GENERATION ===" << std::endl;
-        // std::cout << "Spawn #" << spawnCount << " generated at: (" << pos.x << ", " << pos.y << ", " << pos.z << ")" << std::endl;
-        // std::cout << "  From center: (" << spawnCenter.x << ", " << spawnCenter.y << ", " << spawnCenter.z << ")" << std::endl;
-        // std::cout << "  Angle: " << (angle * 180.0f / 3.14159f) << "°, Distance: " << distance << " units" << std::endl;
-        // std::cout << "  Spawn radius: " << spawnRadius << " units" << std::endl;
-        // std::cout << "  Distance from origin: " << sqrt(pos.x * pos.x + pos.z * pos.z) << " units" << std::endl;
-        // std::cout << "================================" << std::endl;
-        
         return pos;
     }
     
     // Pick random spawn point
-    int index = rand() % spawnPoints.size();
-    Vec3 pos = spawnPoints[index];
-    // std::cout << "Using predefined spawn point " << index << ": (" << pos.x << ", " << pos.y << ", " << pos.z << ")" << std::endl;
-    return pos;
+    return spawnPoints[random.nextInt(static_cast<uint32_t>(spawnPoints.size()))];
 }
 
 MonsterType MonsterSpawner::getRandomMonsterType() const {
@@ -1614,27 +1250,15 @@ MonsterType MonsterSpawner::getRandomMonsterType() const {
         return MonsterType::Xenomorph;
     }
     
-    int index = rand() % monsterTypes.size();
-    return monsterTypes[index];
-}
-
-bool MonsterSpawner::shouldSpawnMonster() const {
-    // Count only alive monsters
-    int aliveMonsters = 0;
-    for (const auto& monster : activeMonsters) {
-        if (monster && monster->getActive() && !monster->isDead()) {
-            aliveMonsters++;
-        }
-    }
-    
-    return aliveMonsters < maxMonsters && lastSpawnTime >= spawnInterval;
+    CounterRandom random(simulation.getWorldSeed(), nextMonsterSeed, 0, RandomStream::SpawnType);
+    return monsterTypes[random.nextInt(static_cast<uint32_t>(monsterTypes.size()))];
 }
 
 // Wave system method implementations
 void MonsterSpawner::startNewWave() {
     currentWave++;
     waveInProgress = true;
-    waveStartTime = 0.0f;
+    waveStartTime = TimerWheel::getInstance().getTime();
     monstersSpawnedInWave = 0;
     
     // TESTING: Spawn 3 monsters per wave for health bar positioning test
@@ -1652,7 +1276,6 @@ void MonsterSpawner::startNewWave() {
 
 void MonsterSpawner::endCurrentWave() {
     waveInProgress = false;
-    lastWaveEndTime = 0.0f;
     
     // std::cout << "=== WAVE " << currentWave << " ENDED ===" << std::endl;
     // std::cout << "Monsters spawned: " << monstersSpawnedInWave << "/" << monstersInCurrentWave << std::endl;
@@ -1663,21 +1286,12 @@ void MonsterSpawner::endCurrentWave() {
 float MonsterSpawner::getWaveProgress() const {
     if (!waveInProgress) return 0.0f;
     
-    float timeProgress = lastSpawnTime / waveDuration;
+    float timeProgress = static_cast<float>(TimerWheel::getInstance().getTime() - waveStartTime) / waveDuration;
     float monsterProgress = static_cast<float>(monstersSpawnedInWave) / monstersInCurrentWave;
     
     return std::min(1.0f, std::max(timeProgress, monsterProgress));
 }
 
-void MonsterSpawner::updateDifficulty(float deltaTime) {
-    lastDifficultyIncrease += deltaTime;
-    
-    if (lastDifficultyIncrease >= difficultyIncreaseInterval) {
-        increaseDifficulty();
-        lastDifficultyIncrease = 0.0f;
-    }
-}
-
 void MonsterSpawner::increaseDifficulty(float amount) {
     difficultyLevel += amount;
     difficultyLevel = std::min(5.0f, difficultyLevel); // Cap at 5.0
@@ -1691,16 +1305,6 @@ void MonsterSpawner::increaseDifficulty(float amount) {
     // std::cout << "===========================" << std::endl;
 }
 
-bool MonsterSpawner::shouldStartNewWave() const {
-    if (waveInProgress) return false;
-    
-    // Start first wave immediately
-    if (currentWave == 0) return true;
-    
-    // Check if enough time has passed since last wave
-    return lastWaveEndTime >= timeBetweenWaves;
-}
-
 bool MonsterSpawner::isWaveInProgress() const {
     return waveInProgress;
 }
@@ -1749,553 +1353,4 @@ void MonsterSpawner::setSpawnCenter(const Vec3& center) {
     spawnCenter = center;
 }
 
-// Enhanced AI method implementations
-void Monster::updateTimers(float deltaTime) {
-    stateTimer += deltaTime;
-    
-    if (alertTimer > 0.0f) {
-        alertTimer += deltaTime;
-    }
-    
-    if (stunTimer > 0.0f) {
-        stunTimer -= deltaTime;
-        if (stunTimer <= 0.0f) {
-            stunTimer = 0.0f;
-            // std::cout << "Monster " << getName() << " recovered from stun" << std::endl;
-        }
-    }
-    
-    if (retreatTimer > 0.0f) {
-        retreatTimer += deltaTime;
-    }
-}
-
-void Monster::updateBehaviorModifiers(float deltaTime) {
-    // Update aggression based on damage taken and player proximity
-    float distanceToPlayer = getDistanceToPlayer();
-    float threatLevel = calculateThreatLevel();
-    
-    // Increase aggression when taking damage or when player is close
-    if (threatLevel > 0.5f) {
-        aggressionLevel = std::min(1.0f, aggressionLevel + deltaTime * 0.5f);
-    } else {
-        // Gradually decrease aggression when not threatened
-        aggressionLevel = std::max(0.1f, aggressionLevel - deltaTime * 0.1f);
-    }
-    
-    // Update fear based on health and player strength
-    float healthPercentage = getHealthPercentage();
-    if (healthPercentage < 0.3f) {
-        fearLevel = std::min(1.0f, fearLevel + deltaTime * 0.3f);
-    } else {
-        fearLevel = std::max(0.0f, fearLevel - deltaTime * 0.1f);
-    }
-}
-
-void Monster::updateLineOfSight() {
-    if (!playerTarget) {
-        hasLineOfSight = false;
-        return;
-    }
-    
-    hasLineOfSight = checkLineOfSightToPlayer();
-    
-    if (hasLineOfSight) {
-        lastPlayerSeenTime = stateTimer;
-        updateLastKnownPlayerPosition();
-    }
-}
-
-void Monster::updateAggression(float deltaTime) {
-    // This method is called from updateBehaviorModifiers
-    // Aggression is updated there to avoid duplicate code
-}
-
-void Monster::updateFear(float deltaTime) {
-    // This method is called from updateBehaviorModifiers
-    // Fear is updated there to avoid duplicate code
-}
-
-void Monster::retreat(float deltaTime) {
-    if (!playerTarget) return;
-    
-    retreatTimer += deltaTime;
-    
-    // Move away from player
-    Vec3 currentPos = getPosition();
-    Vec3 playerPos = playerTarget->getPosition();
-    Vec3 direction = currentPos - playerPos; // Direction away from player
-    
-    float distance = sqrt(direction.x * direction.x + direction.y * direction.y + direction.z * direction.z);
-    
-    if (distance > 0.1f) {
-        // Normalize direction
-        direction.x /= distance;
-        direction.y /= distance;
-        direction.z /= distance;
-        
-        // Set rotation to face retreat direction
-        setRotationFromDirection(direction);
-        
-        // Move away from player at reduced speed
-        float retreatSpeed = moveSpeed * 0.7f; // Slower when retreating
-        float moveDistance = retreatSpeed * deltaTime;
-        
-        Vec3 newPos = currentPos + direction * moveDistance;
-        setPosition(newPos);
-        
-        // std::cout << "Monster " << getName() << " retreating from player" << std::endl;
-    }
-    
-    // Stop retreating after some time or if health improves
-    if (retreatTimer > 3.0f || getHealthPercentage() > 0.5f) {
-        setState(MonsterState::Patrolling);
-        retreatTimer = 0.0f;
-    }
-}
-
-void Monster::becomeAlert() {
-    if (state != MonsterState::Alert) {
-        setState(MonsterState::Alert);
-        alertTimer = 0.0f;
-        // std::cout << "Monster " << getName() << " became alert!" << std::endl;
-    }
-}
-
-void Monster::becomeStunned(float duration) {
-    stunTimer = duration;
-    setState(MonsterState::Stunned);
-    // std::cout << "Monster " << getName() << " stunned for " << duration << " seconds" << std::endl;
-}
-
-bool Monster::hasPlayerInSight() const {
-    return hasLineOfSight;
-}
-
-float Monster::getDistanceToLastKnownPlayerPos() const {
-    Vec3 currentPos = getPosition();
-    Vec3 diff = lastKnownPlayerPos - currentPos;
-    return sqrt(diff.x * diff.x + diff.y * diff.y + diff.z * diff.z);
-}
-
-bool Monster::checkLineOfSightToPlayer() const {
-    if (!playerTarget) return false;
-    
-    // Simple line of sight check - can be enhanced with raycasting
-    float distance = getDistanceToPlayer();
-    return distance <= detectionRange;
-}
-
-void Monster::updateLastKnownPlayerPosition() {
-    if (playerTarget) {
-        lastKnownPlayerPos = playerTarget->getPosition();
-    }
-}
-
-float Monster::calculateThreatLevel() const {
-    if (!playerTarget) return 0.0f;
-    
-    float distance = getDistanceToPlayer();
-    float healthPercentage = getHealthPercentage();
-    
-    // Threat increases as player gets closer and monster health decreases
-    float distanceThreat = 1.0f - (distance / detectionRange);
-    float healthThreat = 1.0f - healthPercentage;
-    
-    return (distanceThreat + healthThreat) * 0.5f;
-}
-
-// Pathfinding method implementations
-void Monster::updatePathfinding(float deltaTime) {
-    pathUpdateTimer += deltaTime;
-    
-    // Update stuck detection
-    Vec3 currentPos = getPosition();
-    if (lastPosition.x != 0.0f || lastPosition.y != 0.0f || lastPosition.z != 0.0f) {
-        float distanceMoved = sqrt(
-            (currentPos.x - lastPosition.x) * (currentPos.x - lastPosition.x) +
-            (currentPos.y - lastPosition.y) * (currentPos.y - lastPosition.y) +
-            (currentPos.z - lastPosition.z) * (currentPos.z - lastPosition.z)
-        );
-        
-        if (distanceMoved < 0.1f) { // Not moving much
-            stuckTimer += deltaTime;
-            if (stuckTimer > 2.0f) { // Stuck for 2 seconds
-                isStuck = true;
-                // std::cout << "Monster " << getName() << " is stuck!" << std::endl;
-            }
-        } else {
-            stuckTimer = 0.0f;
-            isStuck = false;
-        }
-    }
-    
-    lastPosition = currentPos;
-}
-
-Vec3 Monster::findPathToTarget(const Vec3& target) {
-    Vec3 currentPos = getPosition();
-    Vec3 direction = target - currentPos;
-    
-    // CRITICAL FIX: Normalize the direction vector to prevent teleporting!
-    float distance = sqrt(direction.x * direction.x + direction.y * direction.y + direction.z * direction.z);
-    if (distance > 0.1f) {
-        direction.x /= distance;
-        direction.y /= distance;
-        direction.z /= distance;
-    }
-    
-    // If stuck, try to get unstuck
-    if (isStuck) {
-        direction = getRandomDirection();
-        // std::cout << "Monster " << getName() << " using random direction to get unstuck" << std::endl;
-    }
-    
-    // Apply obstacle avoidance
-    direction = avoidObstacles(direction);
-    
-    return direction;
-}
-
-Vec3 Monster::avoidObstacles(const Vec3& direction) {
-    Vec3 currentPos = getPosition();
-    Vec3 forward = direction;
-    Vec3 right = Vec3(-forward.z, 0.0f, forward.x); // Perpendicular to forward
-    Vec3 left = Vec3(forward.z, 0.0f, -forward.x);  // Opposite of right
-    
-    // Check for obstacles in different directions
-    float avoidanceDistance = 2.0f; // Distance to check for obstacles
-    
-    // Check forward
-    Vec3 forwardCheck = currentPos + forward * avoidanceDistance;
-    if (isPathBlocked(currentPos, forwardCheck)) {
-        // Try right
-        Vec3 rightCheck = currentPos + right * avoidanceDistance;
-        if (!isPathBlocked(currentPos, rightCheck)) {
-            return right;
-        }
-        
-        // Try left
-        Vec3 leftCheck = currentPos + left * avoidanceDistance;
-        if (!isPathBlocked(currentPos, leftCheck)) {
-            return left;
-        }
-        
-        // Try backward
-        Vec3 backwardCheck = currentPos - forward * avoidanceDistance;
-        if (!isPathBlocked(currentPos, backwardCheck)) {
-            return Vec3(-forward.x, -forward.y, -forward.z);
-        }
-        
-        // If all directions blocked, use random direction
-        return getRandomDirection();
-    }
-    
-    return forward;
-}
-
-bool Monster::isPathBlocked(const Vec3& from, const Vec3& to) const {
-    // Simple path blocking check - can be enhanced with actual collision detection
-    // For now, just check if the path goes through certain areas
-    
-    // Check if path goes through origin (0,0,0) which might be blocked
-    float distance = sqrt(
-        (to.x - from.x) * (to.x - from.x) +
-        (to.y - from.y) * (to.y - from.y) +
-        (to.z - from.z) * (to.z - from.z)
-    );
-    
-    if (distance < 0.1f) return true; // Too close
-    
-    // Simple obstacle check - can be enhanced with actual terrain collision
-    // For now, just return false (no obstacles)
-    return false;
-}
-
-Vec3 Monster::getRandomDirection() const {
-    // Generate random direction
-    float angle = (float)(rand() % 360) * 3.14159f / 180.0f;
-    Vec3 direction;
-    direction.x = cos(angle);
-    direction.y = 0.0f; // Keep on same height
-    direction.z = sin(angle);
-    
-    return direction;
-}
-
-void Monster::updateStuckDetection(const Vec3& oldPos, const Vec3& newPos, float deltaTime) {
-    // This method is called from moveTowardsTarget
-    // The actual stuck detection is handled in updatePathfinding
-}
-
-// Group behavior method implementations
-void Monster::updateGroupBehavior(float deltaTime) {
-    groupCoordinationTimer += deltaTime;
-    
-    // Update group coordination every few seconds
-    if (groupCoordinationTimer >= 2.0f) {
-        communicateWithNearbyMonsters();
-        groupCoordinationTimer = 0.0f;
-    }
-    
-    // Reset group alert flag after some time
-    if (hasAlertedGroup && stateTimer > 10.0f) {
-        hasAlertedGroup = false;
-    }
-}
-
-void Monster::communicateWithNearbyMonsters() {
-    if (isDead()) return;
-    
-    std::vector<Monster*> nearbyMonsters = getNearbyMonsters(groupAlertRadius);
-    
-    if (nearbyMonsters.empty()) {
-        // No nearby monsters, leave group
-        if (inGroup) {
-            leaveGroup();
-        }
-        return;
-    }
-    
-    // Join group if not already in one
-    if (!inGroup) {
-        joinGroup();
-    }
-    
-    // Share information with group members
-    for (Monster* monster : nearbyMonsters) {
-        if (monster && monster != this && !monster->isDead()) {
-            // Share player position if we can see the player
-            if (hasLineOfSight && playerTarget) {
-                monster->lastKnownPlayerPos = playerTarget->getPosition();
-                monster->hasLineOfSight = true;
-                
-                // If we're chasing, alert the other monster
-                if (state == MonsterState::Chasing || state == MonsterState::Attacking) {
-                    monster->becomeAlert();
-                }
-            }
-            
-            // Share group target
-            if (playerTarget) {
-                monster->groupTarget = playerTarget->getPosition();
-            }
-        }
-    }
-}
-
-void Monster::respondToGroupAlert() {
-    if (isDead()) return;
-    
-    // If a nearby monster is alert, become alert too
-    if (state == MonsterState::Patrolling || state == MonsterState::Idle) {
-        becomeAlert();
-    }
-}
-
-void Monster::coordinateAttack() {
-    if (isDead() || !inGroup) return;
-    
-    std::vector<Monster*> nearbyMonsters = getNearbyMonsters(groupAlertRadius);
-    
-    // Coordinate attack timing with nearby monsters
-    for (Monster* monster : nearbyMonsters) {
-        if (monster && monster != this && !monster->isDead()) {
-            // If we're attacking and they're not, encourage them to attack
-            if (state == MonsterState::Attacking && monster->state != MonsterState::Attacking) {
-                if (monster->isInAttackRange()) {
-                    monster->setState(MonsterState::Attacking);
-                }
-            }
-        }
-    }
-}
-
-std::vector<Monster*> Monster::getNearbyMonsters(float radius) const {
-    std::vector<Monster*> nearbyMonsters;
-    
-    // This would need access to the scene or monster spawner to get all monsters
-    // For now, return empty vector - this would be implemented with proper scene access
-    // In a real implementation, you'd query the scene for all monsters within radius
-    
-    return nearbyMonsters;
-}
-
-void Monster::alertNearbyMonsters() {
-    if (isDead()) return;
-    
-    std::vector<Monster*> nearbyMonsters = getNearbyMonsters(groupAlertRadius);
-    
-    for (Monster* monster : nearbyMonsters) {
-        if (monster && monster != this && !monster->isDead()) {
-            // Alert nearby monsters to the threat
-            monster->respondToGroupAlert();
-            
-            // Share player position
-            if (playerTarget) {
-                monster->lastKnownPlayerPos = playerTarget->getPosition();
-                monster->groupTarget = playerTarget->getPosition();
-            }
-            
-            // Increase their aggression
-            monster->setAggressionLevel(monster->aggressionLevel + 0.1f);
-        }
-    }
-    
-    // std::cout << "Monster " << getName() << " alerted " << nearbyMonsters.size() << " nearby monsters!" << std::endl;
-}
-
-bool Monster::isInGroup() const {
-    return inGroup;
-}
-
-void Monster::joinGroup() {
-    if (!inGroup) {
-        inGroup = true;
-        // std::cout << "Monster " << getName() << " joined a group" << std::endl;
-    }
-}
-
-void Monster::leaveGroup() {
-    if (inGroup) {
-        inGroup = false;
-        // std::cout << "Monster " << getName() << " left the group" << std::endl;
-    }
-}
-
-// Enhanced visual effect method implementations
-void Monster::flashStateChange() {
-    isStateFlashing = true;
-    stateChangeFlashTimer = 0.3f; // Flash for 0.3 seconds
-    // std::cout << "Monster " << getName() << " flashing state change for " << stateChangeFlashTimer << " seconds" << std::endl;
-}
-
-void Monster::updateStateVisualEffects(float deltaTime) {
-    if (isStateFlashing) {
-        stateChangeFlashTimer -= deltaTime;
-        if (stateChangeFlashTimer <= 0.0f) {
-            isStateFlashing = false;
-            // std::cout << "Monster " << getName() << " state change flash ended" << std::endl;
-        }
-    }
-}
-
-void Monster::updatePulsingEffect(float deltaTime) {
-    if (isPulsing) {
-        pulseTimer += deltaTime;
-    }
-}
-
-Vec3 Monster::getStateColor() const {
-    switch (state) {
-        case MonsterState::Alert:
-            return alertColor;
-        case MonsterState::Chasing:
-            return chaseColor;
-        case MonsterState::Attacking:
-            return attackColor;
-        case MonsterState::Stunned:
-            return Vec3(0.5f, 0.5f, 0.5f); // Gray when stunned
-        case MonsterState::Retreating:
-            return Vec3(0.8f, 0.2f, 0.8f); // Purple when retreating
-        default:
-            return originalColor;
-    }
-}
-
-void Monster::setPulsing(bool pulsing, float speed) {
-    isPulsing = pulsing;
-    pulseSpeed = speed;
-    if (!pulsing) {
-        pulseTimer = 0.0f;
-    }
-}
-
-// Loot system method implementations
-void Monster::dropLoot() {
-    if (hasDroppedLoot) return;
-    
-    // std::cout << "=== MONSTER LOOT DROP ===" << std::endl;
-    // std::cout << "Monster: " << getName() << std::endl;
-    // std::cout << "Experience reward: " << experienceReward << " XP" << std::endl;
-    // std::cout << "Score reward: " << scoreReward << " points" << std::endl;
-    
-    // In a real game, you would:
-    // 1. Create loot objects at the monster's position
-    // 2. Add experience to the player
-    // 3. Add score to the game score
-    // 4. Possibly drop items, weapons, or other rewards
-    
-    // For now, just log the rewards
-    // std::cout << "Loot dropped at position: (" << getPosition().x << ", " << getPosition().y << ", " << getPosition().z << ")" << std::endl;
-    // std::cout << "=========================" << std::endl;
-}
-
-int Monster::getExperienceReward() const {
-    return experienceReward;
-}
-
-int Monster::getScoreReward() const {
-    return scoreReward;
-}
-
-// Death animation method implementations
-void Monster::startDeathAnimation() {
-    if (isDeathAnimating) return;
-    
-    isDeathAnimating = true;
-    deathAnimationTimer = 0.0f;
-    
-    // Store original scale
-    originalScale = getScale();
-    
-    // std::cout << "=== DEATH ANIMATION STARTED ===" << std::endl;
-    // std::cout << "Monster: " << getName() << std::endl;
-    // std::cout << "Animation duration: " << deathAnimationDuration << " seconds" << std::endl;
-    // std::cout << "Original scale: (" << originalScale.x << ", " << originalScale.y << ", " << originalScale.z << ")" << std::endl;
-    // std::cout << "==============================" << std::endl;
-}
-
-void Monster::updateDeathAnimation(float deltaTime) {
-    if (!isDeathAnimating) return;
-    
-    deathAnimationTimer += deltaTime;
-    
-    // Calculate animation progress (0.0 to 1.0)
-    float progress = deathAnimationTimer / deathAnimationDuration;
-    
-    if (progress >= 1.0f) {
-        // Animation finished
-        isDeathAnimating = false;
-        deathAnimationTimer = deathAnimationDuration;
-        progress = 1.0f;
-        
-        // std::cout << "=== DEATH ANIMATION COMPLETED ===" << std::endl;
-        // std::cout << "Monster: " << getName() << std::endl;
-        // std::cout << "================================" << std::endl;
-    }
-    
-    // Create shrinking effect (monster shrinks and fades)
-    float scaleMultiplier = 1.0f - (progress * 0.8f); // Shrink to 20% of original size
-    deathScale = originalScale * scaleMultiplier;
-    
-    // Apply the death scale
-    setScale(deathScale);
-    
-    // Create fading effect by modifying color alpha (if supported)
-    // For now, we'll just make the monster darker
-    Vec3 fadeColor = getCurrentColor() * (1.0f - progress * 0.5f);
-    setColor(fadeColor);
-    
-    // Debug output every few frames
-    static float debugTimer = 0.0f;
-    debugTimer += deltaTime;
-    if (debugTimer > 0.5f) {
-        // std::cout << "Death animation progress: " << (progress * 100.0f) << "%" << std::endl;
-        // std::cout << "Current scale: (" << deathScale.x << ", " << deathScale.y << ", " << deathScale.z << ")" << std::endl;
-        debugTimer = 0.0f;
-    }
-}
-
-
 } // namespace Engine
@@ -4,16 +4,22 @@
  * OVERVIEW:
  * Implements basic monster enemies that can move around the world and be shot at.
  * Uses the Xenomorph model for visual representation.
+ * 
+ * Gameplay state and AI run in MonsterSimulation (structure-of-arrays, batched
+ * per-state passes) owned by MonsterSpawner; Monster is the renderable view.
  */
 
 #pragma once
 #include "../Engine/Core/GameObject.h"
+#include "../Engine/Core/MonsterSimulation.h"
+#include "../Engine/Core/TimerWheel.h"
+#include "../Engine/Core/TaskScheduler.h"
+#include "../Engine/Network/NetProtocol.h"
 #include "../Engine/Math/Math.h"
 #include "../Engine/Rendering/Material.h"
 #include "../Engine/Utils/OBJLoader.h"
-// #include "HealthBar.h"  // REMOVED: Using new texture-based health bar system
-#include "../Engine/Rendering/TextureHealthBar.h"
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 namespace Engine {
@@ -31,216 +37,116 @@ struct MaterialGroup {
 };
 
 /**
- * MonsterType - Different types of monsters
- */
-enum class MonsterType {
-    Xenomorph,      // Standard alien monster
-    Runner,         // Fast moving monster
-    Tank            // Slow but tough monster
-};
-
-/**
- * MonsterState - Current state of the monster
- */
-enum class MonsterState {
-    Idle,           // Standing still
-    Patrolling,     // Moving around
-    Alert,          // Aware of player but not yet chasing
-    Chasing,        // Moving towards player
-    Attacking,      // Performing attack
-    Stunned,        // Temporarily disabled (e.g., after taking damage)
-    Retreating,     // Moving away from player when low health
-    Dead            // Dead monster
-};
-
-/**
- * Monster - Main monster class extending GameObject
+ * Monster - Thin GameObject view over one MonsterSimulation slot
+ *
+ * Gameplay state (position, heading, health, state machine, timers, AI levels)
+ * lives in the spawner's MonsterSimulation; the view keeps what rendering needs
+ * (mesh, materials, damage flash, death animation) and forwards gameplay
+ * calls through its handle. A view without a slot counts as dead. Health bars
+ * are drawn by the game from the render snapshot (health, showHealthBar).
  */
 class Monster : public GameObject {
 private:
-    // Monster properties
     MonsterType type;
-    MonsterState state;
-    float health;
-    float maxHealth;
-    float moveSpeed;
-    float attackRange;
-    float attackDamage;
-    float detectionRange;
-    float dangerRange;  // Range at which monster becomes aggressive and charges
-    
-    // Movement
-    Vec3 targetPosition;
-    float moveTimer;
-    float stateTimer;
-    float patrolRadius;
-    float chargeSpeed;      // Speed when charging at player
-    float baseSpeed;        // Normal patrol speed
-    bool isCharging;        // Whether monster is in charging mode
-    
-    // AI behavior
-    float lastAttackTime;
-    float attackCooldown;
-    float alertTimer;           // Time spent in alert state
-    float stunTimer;            // Time remaining stunned
-    float retreatTimer;         // Time spent retreating
-    float lastPlayerSeenTime;   // When player was last seen
-    Vec3 lastKnownPlayerPos;    // Last known player position
-    bool hasLineOfSight;        // Whether monster can see player
-    float aggressionLevel;      // How aggressive the monster is (0.0-1.0)
-    float fearLevel;            // How scared the monster is (0.0-1.0)
-    
-    // Pathfinding
-    Vec3 currentPathDirection;  // Current movement direction
-    float pathUpdateTimer;      // Timer for pathfinding updates
-    float pathUpdateInterval;   // How often to update pathfinding
-    bool isStuck;              // Whether monster is stuck
-    float stuckTimer;          // How long monster has been stuck
-    Vec3 lastPosition;         // Last position for stuck detection
-    
-    // Group behavior
-    bool inGroup;              // Whether monster is part of a group
-    float groupAlertRadius;    // Radius to alert nearby monsters
-    float groupCoordinationTimer; // Timer for group coordination updates
-    bool hasAlertedGroup;      // Whether this monster has alerted the group
-    Vec3 groupTarget;          // Shared target for group coordination
+    
+    // Simulation slot (owned by MonsterSpawner)
+    MonsterSimulation* simulation;
+    uint32_t simulationHandle;
+    
+    // Slot state as of the last sync, which the view's visuals follow
+    MonsterState viewState;
+    float viewHealth;
     
     // Visual effects
-    float damageFlashTimer;
+    TimerId damageFlashTimer;  // Ends the flash (TimerWheel)
     Vec3 originalColor;
     Vec3 damageColor;
     bool isFlashing;
-    
-    // Enhanced visual effects
-    float stateChangeFlashTimer;
-    bool isStateFlashing;
     Vec3 alertColor;           // Color when alert
     Vec3 chaseColor;           // Color when chasing
     Vec3 attackColor;          // Color when attacking
-    float pulseTimer;          // Timer for pulsing effects
-    bool isPulsing;            // Whether monster is pulsing
-    float pulseSpeed;          // Speed of pulsing effect
     
     // Loot system
-    int experienceReward;      // Experience points awarded when killed
-    int scoreReward;           // Score points awarded when killed
     bool hasDroppedLoot;       // Whether loot has been dropped
     
     // Death animation
     float deathAnimationTimer; // Timer for death animation
     float deathAnimationDuration; // Duration of death animation
     bool isDeathAnimating;     // Whether death animation is playing
+    bool deathHandled;         // View-side death handling already ran
     Vec3 deathScale;           // Scale during death animation
     Vec3 originalScale;        // Original scale before death
     
     // Deletion management
     bool markedForDeletion;
-    float deletionTimer;
+    TimerId deletionTimer;     // Pending until the deletion delay has passed
     static constexpr float DELETION_DELAY = 0.5f; // 0.5 seconds delay
     
     // References
     GameObject* playerTarget;
     
-    // Health bar system - NEW: Using texture-based system
-    std::unique_ptr<TextureHealthBar> textureHealthBar;
+    // Health bar (drawn by the game)
     bool showHealthBar;
     
-    // Material system
+    // Material system; groups are replaced, never modified, so render snapshots can share them
     MaterialLibrary monsterMaterials;
-    std::vector<MaterialGroup> materialGroups;
+    std::shared_ptr<const std::vector<MaterialGroup>> materialGroups;
 
 public:
     // Constructor/Destructor
     Monster(const std::string& name, MonsterType monsterType = MonsterType::Xenomorph);
-    virtual ~Monster() = default;
+    virtual ~Monster();
     
     // Core functionality
     virtual bool initialize() override;
     virtual void update(float deltaTime) override;
     virtual void render(const Renderer& renderer, const Camera& camera) override;
+    virtual void captureDraws(std::vector<MeshDrawState>& draws) const override; // One draw per material group
     virtual void cleanup() override;
     
+    // Simulation binding (done by MonsterSpawner)
+    void bindSimulation(MonsterSimulation* owner, uint32_t handle);
+    uint32_t getSimulationHandle() const { return simulationHandle; }
+    bool isBound() const { return simulation && simulation->isValid(simulationHandle); }
+    void syncFromSimulation(const Vec3& position, float yawDegrees); // Batched transform and status write-back
+    void resetFromSimulation(); // After a snapshot restore: visual state follows the slot, pending effects end
+    void handleStateChange(MonsterState oldState, MonsterState newState);
+    
     // Monster control
     void spawn(const Vec3& position);
     void takeDamage(float damage, GameObject* attacker = nullptr);
     void die();
-    
-    // AI behavior
-    void updateAI(float deltaTime);
-    void updateMovement(float deltaTime);
-    void updateState(float deltaTime);
-    void findNewTarget();
-    void moveTowardsTarget(float deltaTime);
-    void patrol(float deltaTime);
-    void attack();
     void setRotationFromDirection(const Vec3& direction);
     
-    // Enhanced AI methods
-    void updateLineOfSight();
-    void updateAggression(float deltaTime);
-    void updateFear(float deltaTime);
-    void retreat(float deltaTime);
-    void becomeAlert();
-    void becomeStunned(float duration);
-    bool canSeePlayer() const;
-    bool hasPlayerInSight() const;
-    float getDistanceToLastKnownPlayerPos() const;
-    
-    // Pathfinding methods
-    void updatePathfinding(float deltaTime);
-    Vec3 findPathToTarget(const Vec3& target);
-    Vec3 avoidObstacles(const Vec3& direction);
-    bool isPathBlocked(const Vec3& from, const Vec3& to) const;
-    Vec3 getRandomDirection() const;
-    
-    // Group behavior methods
-    void updateGroupBehavior(float deltaTime);
-    void communicateWithNearbyMonsters();
-    void respondToGroupAlert();
-    void coordinateAttack();
-    std::vector<Monster*> getNearbyMonsters(float radius) const;
-    void alertNearbyMonsters();
-    bool isInGroup() const;
-    void joinGroup();
-    void leaveGroup();
-    
     // State management
     void setState(MonsterState newState);
-    MonsterState getState() const { return state; }
+    MonsterState getState() const { return isBound() ? simulation->getState(simulationHandle) : MonsterState::Dead; }
     std::string getStateName(MonsterState state) const;
-    bool isDead() const { 
-        try {
-            // CRASH PREVENTION: Multiple safety checks
-            if (!getActive()) return true; // If inactive, consider dead
-            if (health <= 0.0f) return true; // If no health, consider dead
-            return state == MonsterState::Dead; 
-        } catch (...) {
-            return true; // If we can't access anything, assume dead to prevent crashes
-        }
-    }
-    bool isAlive() const { return health > 0.0f; }
+    bool isDead() const { return !getActive() || !isAlive(); }
+    bool isAlive() const { return getHealth() > 0.0f; }
+    
+    // What the view shows: the slot state at the last sync
+    MonsterState getViewState() const { return viewState; }
+    bool isViewAlive() const { return viewHealth > 0.0f; }
     
     // Deletion management
-    bool shouldBeDeleted() const { return markedForDeletion && deletionTimer >= DELETION_DELAY; }
+    bool shouldBeDeleted() const { return markedForDeletion && !TimerWheel::getInstance().isPending(deletionTimer); }
     void markForDeletion();
     
     // Health and combat
-    float getHealth() const { return health; }
-    float getMaxHealth() const { return maxHealth; }
-    float getHealthPercentage() const { return health / maxHealth; }
+    float getHealth() const { return isBound() ? simulation->getHealth(simulationHandle) : 0.0f; }
+    float getMaxHealth() const { return MonsterSimulation::getArchetype(type).maxHealth; }
+    float getHealthPercentage() const { return getHealth() / getMaxHealth(); }
     void setHealth(float newHealth);
     
-    // Health bar management - NEW: Using texture-based system
+    // Health bar management
     void setShowHealthBar(bool show) { showHealthBar = show; }
     bool getShowHealthBar() const { return showHealthBar; }
-    void updateHealthBar();
-    void renderHealthBar(const Camera& camera);
     
     // Movement and positioning
     void setTargetPosition(const Vec3& position);
-    Vec3 getTargetPosition() const { return targetPosition; }
-    void setMoveSpeed(float speed) { moveSpeed = speed; }
-    float getMoveSpeed() const { return health > 0.0f ? moveSpeed : 0.0f; }
+    Vec3 getTargetPosition() const;
+    float getMoveSpeed() const;
     
     // Targeting
     void setPlayerTarget(GameObject* player) { playerTarget = player; }
@@ -248,33 +154,24 @@ public:
     
     // Visual effects
     void flashDamage();
+    bool isDamageFlashing() const { return isFlashing; }
     void updateVisualEffects(float deltaTime);
     Vec3 getCurrentColor() const;
-    
-    // Enhanced visual effects
-    void flashStateChange();
-    void updateStateVisualEffects(float deltaTime);
-    void updatePulsingEffect(float deltaTime);
     Vec3 getStateColor() const;
-    void setPulsing(bool pulsing, float speed = 2.0f);
-    
-    // Configuration
-    void configureMonster(MonsterType monsterType);
     
     // Utility
+    MonsterType getType() const { return type; }
     float getDistanceToPlayer() const;
     bool isInAttackRange() const;
-    bool isPlayerInDangerZone() const;  // New: Check if player is in danger zone
-    Vec3 getRandomPatrolPosition() const;
-    void resetTimers();
-    
-    // Enhanced utility methods
-    float getAggressionLevel() const { return aggressionLevel; }
-    float getFearLevel() const { return fearLevel; }
-    void setAggressionLevel(float level) { aggressionLevel = std::max(0.0f, std::min(1.0f, level)); }
-    void setFearLevel(float level) { fearLevel = std::max(0.0f, std::min(1.0f, level)); }
-    bool isStunned() const { return stunTimer > 0.0f; }
-    bool shouldRetreat() const { return getHealthPercentage() < 0.3f && fearLevel > 0.5f; }
+    bool isPlayerInDangerZone() const;
+    
+    // AI levels (stored in the simulation)
+    float getAggressionLevel() const { return isBound() ? simulation->getAggression(simulationHandle) : 0.0f; }
+    float getFearLevel() const { return isBound() ? simulation->getFear(simulationHandle) : 0.0f; }
+    void setAggressionLevel(float level) { if (isBound()) simulation->setAggression(simulationHandle, level); }
+    void setFearLevel(float level) { if (isBound()) simulation->setFear(simulationHandle, level); }
+    bool isStunned() const { return isBound() && simulation->getStunTimer(simulationHandle) > 0.0f; }
+    bool hasPlayerInSight() const { return isBound() && simulation->hasLineOfSight(simulationHandle); }
     
     // Loot and rewards
     void dropLoot();
@@ -291,8 +188,7 @@ public:
     
     // Renderer selection
     virtual RendererType getPreferredRendererType() const override;
-    
-
+    const std::vector<MaterialGroup>& getMaterialGroups() const; // Empty without a loaded model
 
 protected:
     // Override points for custom behavior
@@ -304,32 +200,38 @@ protected:
     void setupMonsterMesh();
     void setupMonsterMaterial();
     void createMaterialGroups(const OBJMeshData& objData);
-    void updateDamageFlash(float deltaTime);
-    bool shouldChangeState() const;
-    MonsterState determineNextState();
-    
-    // Enhanced internal helpers
-    void updateTimers(float deltaTime);
-    void updateBehaviorModifiers(float deltaTime);
-    bool checkLineOfSightToPlayer() const;
-    void updateLastKnownPlayerPosition();
-    float calculateThreatLevel() const;
-    void updateStuckDetection(const Vec3& oldPos, const Vec3& newPos, float deltaTime);
+    void handleDeath();
+    void syncStatus(); // viewState/viewHealth from the slot
 };
 
 /**
  * MonsterSpawner - Manages monster spawning and population
+ * 
+ * Owns the MonsterSimulation: every tick it steps all monsters in batched
+ * passes, applies their attacks to the player and writes transforms back to
+ * the Monster views.
+ *
+ * Wave flow and difficulty ramp run as TaskScheduler tasks: they sleep on the
+ * TimerWheel between spawns/waves and on the monsterDied event while the
+ * population cap is reached, instead of being polled every frame.
+ *
+ * saveState/restoreState snapshot the simulation, the wave/difficulty
+ * progress and the time left on the tasks' sleeps. Restoring keeps every
+ * view whose slot comes back with the same type and only builds views for
+ * monsters that did not exist anymore.
  */
 class MonsterSpawner {
 private:
     std::vector<Monster*> activeMonsters; // Raw pointers since scene owns the monsters
+    MonsterSimulation simulation; // Hot monster state (SoA)
+    std::vector<Monster*> monstersByHandle; // Simulation handle -> view
+    uint32_t nextMonsterSeed;
     std::vector<Vec3> spawnPoints;
     std::vector<MonsterType> monsterTypes;
     
     // Spawning configuration
     int maxMonsters;
     float spawnInterval;
-    float lastSpawnTime;
     float spawnRadius;
     Vec3 spawnCenter;
     
@@ -337,18 +239,28 @@ private:
     int currentWave;
     int monstersInCurrentWave;
     int monstersSpawnedInWave;
-    float waveStartTime;
+    double waveStartTime;       // TimerWheel clock
     float waveDuration;
     bool waveInProgress;
     float timeBetweenWaves;
-    float lastWaveEndTime;
     
     // Difficulty scaling
     float difficultyLevel;
     float difficultyIncreaseRate;
-    float lastDifficultyIncrease;
     float difficultyIncreaseInterval;
     
+    // Sequencing tasks
+    enum class WaveStep { StartWave, SpawnMonsters, EndWave };
+    WaveStep waveStep;
+    TaskId waveTask;
+    TaskId difficultyTask;
+    TaskEvent monsterDied;      // Wakes the wave task when it is waiting at the population cap
+    double waveResumeTime;      // TimerWheel time the wave task's sleep ends (< 0: waiting on monsterDied)
+    double difficultyResumeTime;
+    
+    // Network client: server monster id -> local simulation handle
+    std::unordered_map<uint32_t, uint32_t> replicatedHandles;
+    
     // References
     GameObject* playerTarget;
     Scene* gameScene;
@@ -356,7 +268,7 @@ private:
 public:
     // Constructor/Destructor
     MonsterSpawner(Scene* scene, GameObject* player);
-    ~MonsterSpawner() = default;
+    ~MonsterSpawner();
     void update(float deltaTime);
     void cleanup();
     
@@ -373,6 +285,37 @@ public:
     void setSpawnCenter(const Vec3& center);
     void addSpawnPoint(const Vec3& point);
     void addMonsterType(MonsterType type);
+    void setPlayerTarget(GameObject* player); // Retargets live monsters too
+    void setWorldSeed(uint64_t seed) { simulation.setWorldSeed(seed); } // Key of spawn and behaviour draws
+    uint64_t getWorldSeed() const { return simulation.getWorldSeed(); }
+    
+    // Simulation
+    void updateSimulation(float deltaTime);
+    
+    // update() in three steps: beginUpdate/endUpdate touch the views, the player and the scene,
+    // stepSimulation only the spawner's own pools. beginUpdate returns false when update() would
+    // have done nothing.
+    bool beginUpdate();
+    void stepSimulation(float deltaTime) { simulation.update(deltaTime); }
+    void endUpdate();
+    
+    MonsterSimulation& getSimulation() { return simulation; }
+    const MonsterSimulation& getSimulation() const { return simulation; }
+    int getAliveMonsterCount() const { return static_cast<int>(simulation.getLiveCount()); }
+    Monster* getMonsterByHandle(uint32_t handle) const {
+        return handle < monstersByHandle.size() ? monstersByHandle[handle] : nullptr;
+    }
+    
+    // Snapshots (SimulationState)
+    static const uint32_t STATE_TAG;
+    static const uint16_t STATE_VERSION;
+    void saveState(StateWriter& writer) const;
+    bool restoreState(StateReader& reader);
+    static bool validateState(StateReader& reader); // Whole section incl. the simulation, changes nothing
+    
+    // Network client: mirror the server's monsters (spawns new ids, moves
+    // known ones, kills ids that are gone) instead of running update()
+    void applyReplicatedMonsters(const std::vector<NetMonsterState>& monsters);
     
     // Management
     const std::vector<Monster*>& getActiveMonsters() const;
@@ -390,7 +333,6 @@ public:
     float getWaveProgress() const;
     
     // Difficulty scaling
-    void updateDifficulty(float deltaTime);
     float getDifficultyLevel() const;
     void setDifficultyLevel(float level);
     void increaseDifficulty(float amount = 0.1f);
@@ -398,8 +340,18 @@ public:
     // Utility
     Vec3 getRandomSpawnPosition() const;
     MonsterType getRandomMonsterType() const;
-    bool shouldSpawnMonster() const;
-    bool shouldStartNewWave() const;
+    
+private:
+    Monster* createMonster(const Vec3& position, MonsterType type); // No population cap
+    Monster* createView(uint32_t handle, MonsterType type); // Bound to an existing slot, named after it
+    void dispatchSimulationEvents();
+    
+    // Sequencing
+    void startTasks();
+    void stopTasks();
+    void startDifficultyTask(float firstDelay);
+    void restartTasks(float waveDelay, float difficultyDelay); // Keeps waveStep
+    TaskWait resumeWaveSequence();
 };
 
 } // namespace Engine
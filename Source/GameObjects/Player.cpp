@@ -5,6 +5,7 @@
 #include "Player.h"
 // #include "HealthBar.h"  // REMOVED: Using new texture-based health bar system
 #include "../Engine/Rendering/TextureHealthBar.h"
+#include "../Engine/Core/RenderSnapshot.h"
 #include "../Engine/Core/Scene.h"
 #include "../Engine/Rendering/Renderer.h"
 #include <iostream>
@@ -20,7 +21,7 @@ Player::Player(const std::string& name)
       maxArmor(50.0f),
       textureHealthBar(nullptr),  // NEW: Using texture-based system
       showHealthBar(true),
-      damageFlashTimer(0.0f),
+      damageFlashTimer(TimerWheel::INVALID_TIMER),
       originalColor(0.2f, 0.6f, 1.0f),  // Blue color for player
       damageColor(1.0f, 0.0f, 0.0f),    // Red for damage
       isFlashing(false),
@@ -54,7 +55,7 @@ void Player::update(float deltaTime) {
     if (!isActive || !isInitialized) return;
     
     // Update visual effects
-    updateVisualEffects(deltaTime);
+    updateVisualEffects();
     
     // Update regeneration
     updateRegeneration(deltaTime);
@@ -85,11 +86,30 @@ void Player::render(const Renderer& renderer, const Camera& camera) {
     }
 }
 
+void Player::captureDraws(std::vector<MeshDrawState>& draws) const {
+    if (!isActive || !isInitialized || isDead()) return;
+    
+    size_t first = draws.size();
+    GameObject::captureDraws(draws);
+    for (size_t i = first; i < draws.size(); i++) {
+        draws[i].color = getCurrentColor(); // Damage flash, as render() sets it
+    }
+}
+
+Player::~Player() {
+    // The pending flash callback points at this player
+    TimerWheel::getInstance().cancel(damageFlashTimer);
+}
+
 void Player::cleanup() {
     if (!isInitialized) return;
     
     std::cout << "Cleaning up Player: " << getName() << std::endl;
     
+    TimerWheel::getInstance().cancel(damageFlashTimer);
+    damageFlashTimer = TimerWheel::INVALID_TIMER;
+    isFlashing = false;
+    
     GameObject::cleanup();
 }
 
@@ -266,12 +286,15 @@ void Player::updateHealthBar() {
 
 void Player::flashDamage() {
     isFlashing = true;
-    damageFlashTimer = 0.5f; // Flash for 0.5 seconds
-    std::cout << "Player " << getName() << " flashing damage for " << damageFlashTimer << " seconds" << std::endl;
+    damageFlashTimer = TimerWheel::getInstance().reschedule(damageFlashTimer, 0.5f, [this]() { // Flash for 0.5 seconds
+        isFlashing = false;
+        damageFlashTimer = TimerWheel::INVALID_TIMER;
+    });
+    std::cout << "Player " << getName() << " flashing damage for 0.5 seconds" << std::endl;
 }
 
-void Player::updateVisualEffects(float deltaTime) {
-    updateDamageFlash(deltaTime);
+void Player::updateVisualEffects() {
+    // Damage flash ends through the TimerWheel
 }
 
 Vec3 Player::getCurrentColor() const {
@@ -281,16 +304,6 @@ Vec3 Player::getCurrentColor() const {
     return originalColor;
 }
 
-void Player::updateDamageFlash(float deltaTime) {
-    if (isFlashing) {
-        damageFlashTimer -= deltaTime;
-        if (damageFlashTimer <= 0.0f) {
-            isFlashing = false;
-            std::cout << "Player " << getName() << " damage flash ended" << std::endl;
-        }
-    }
-}
-
 void Player::updateRegeneration(float deltaTime) {
     if (isDead()) return;
     
@@ -7,6 +7,7 @@
 
 #pragma once
 #include "../Engine/Core/GameObject.h"
+#include "../Engine/Core/TimerWheel.h"
 #include "../Engine/Math/Math.h"
 #include <memory>
 
@@ -32,7 +33,7 @@ private:
     bool showHealthBar;
     
     // Damage effects
-    float damageFlashTimer;
+    TimerId damageFlashTimer;  // Ends the flash (TimerWheel)
     Vec3 originalColor;
     Vec3 damageColor;
     bool isFlashing;
@@ -46,12 +47,13 @@ private:
 public:
     // Constructor/Destructor
     Player(const std::string& name = "Player");
-    virtual ~Player() = default;
+    virtual ~Player();
     
     // Core functionality
     virtual bool initialize() override;
     virtual void update(float deltaTime) override;
     virtual void render(const Renderer& renderer, const Camera& camera) override;
+    virtual void captureDraws(std::vector<MeshDrawState>& draws) const override;
     virtual void cleanup() override;
     
     // Health and damage
@@ -85,7 +87,7 @@ public:
     
     // Visual effects
     void flashDamage();
-    void updateVisualEffects(float deltaTime);
+    void updateVisualEffects();
     Vec3 getCurrentColor() const;
 
 protected:
@@ -95,7 +97,6 @@ protected:
     virtual void onHeal(float amount);
     
     // Internal helpers
-    void updateDamageFlash(float deltaTime);
     void updateRegeneration(float deltaTime);
 };
 
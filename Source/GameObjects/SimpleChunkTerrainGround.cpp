@@ -5,6 +5,8 @@
 #include "SimpleChunkTerrainGround.h"
 #include "../Engine/Rendering/Renderer.h"
 #include "../Engine/Rendering/BasicRenderer.h"
+#include "../Engine/Core/RenderSnapshot.h"
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 
@@ -55,19 +57,54 @@ void SimpleChunkTerrainGround::render(const Renderer& renderer, const Camera& ca
     // Render the terrain mesh with height-based coloring
     const BasicRenderer* basicRenderer = dynamic_cast<const BasicRenderer*>(&renderer);
     
+    // Front to back, so near hills reject the fragments of the chunks behind them
+    sortChunksFrontToBack(camera.getPosition());
+    
     // Render each chunk
+    for (const auto& draw : chunkDrawOrder) {
+        const Mesh& chunkMesh = **draw.second;
+        if (basicRenderer) {
+            // Use height-based coloring for terrain
+            basicRenderer->renderMesh(chunkMesh, getModelMatrix(), camera, getColor(), true);
+        } else {
+            // Fall back to regular rendering
+            renderer.renderMesh(chunkMesh, getModelMatrix(), camera, getColor());
+        }
+    }
+}
+
+void SimpleChunkTerrainGround::captureDraws(std::vector<MeshDrawState>& draws) const {
+    if (!getActive() || !isValid() || !isInitialized) {
+        return;
+    }
+    
+    // Ordered from the player, which the camera follows
+    sortChunksFrontToBack(playerPosition);
+    
+    const Mat4 modelMatrix = getModelMatrix();
+    for (const auto& entry : chunkDrawOrder) {
+        MeshDrawState draw;
+        draw.mesh = *entry.second;
+        draw.modelMatrix = modelMatrix;
+        draw.color = getColor();
+        draw.entityId = getId();
+        draw.style = DrawStyle::HeightColored; // Pass renderer, height-based coloring
+        draws.push_back(draw);
+    }
+}
+
+void SimpleChunkTerrainGround::sortChunksFrontToBack(const Vec3& viewPosition) const {
+    chunkDrawOrder.clear();
     for (const auto& chunkPair : chunkMeshes) {
-        const auto& chunkMesh = chunkPair.second;
-        if (chunkMesh) {
-            if (basicRenderer) {
-                // Use height-based coloring for terrain
-                basicRenderer->renderMesh(*chunkMesh, getModelMatrix(), camera, getColor(), true);
-            } else {
-                // Fall back to regular rendering
-                renderer.renderMesh(*chunkMesh, getModelMatrix(), camera, getColor());
-            }
+        if (chunkPair.second) {
+            auto centre = chunkCentres.find(chunkPair.first);
+            if (centre == chunkCentres.end()) continue;
+            Vec3 offset = centre->second - viewPosition;
+            chunkDrawOrder.emplace_back(offset.x * offset.x + offset.z * offset.z, &chunkPair.second);
         }
     }
+    std::sort(chunkDrawOrder.begin(), chunkDrawOrder.end(),
+              [](const std::pair<float, const std::shared_ptr<Mesh>*>& a, const std::pair<float, const std::shared_ptr<Mesh>*>& b) { return a.first < b.first; });
 }
 
 void SimpleChunkTerrainGround::updateChunksForPlayer(const Vec3& playerPos) {
@@ -114,9 +151,11 @@ void SimpleChunkTerrainGround::createChunkMesh(const TerrainChunkData& chunkData
     std::string key = getChunkKey(chunkX, chunkZ);
     
     // Create mesh from chunk data
-    auto mesh = std::make_unique<Mesh>();
+    auto mesh = std::make_shared<Mesh>();
     if (mesh->createMeshWithNormals(chunkData.vertices, chunkData.indices)) {
         chunkMeshes[key] = std::move(mesh);
+        float chunkSize = static_cast<float>(terrainGenerator.getChunkSize());
+        chunkCentres[key] = Vec3((chunkX + 0.5f) * chunkSize, 0.0f, (chunkZ + 0.5f) * chunkSize);
     } else {
         // std::cout << "SimpleChunkTerrainGround: FAILED to create mesh for chunk (" << chunkX << ", " << chunkZ << ")" << std::endl;
     }
@@ -159,6 +198,7 @@ float SimpleChunkTerrainGround::getHeightAt(float worldX, float worldZ) const {
 void SimpleChunkTerrainGround::clearAllChunks() {
     // std::cout << "SimpleChunkTerrainGround: Clearing all chunks" << std::endl;
     chunkMeshes.clear();
+    chunkCentres.clear();
     terrainGenerator.clearAllChunks();
 }
 
@@ -12,13 +12,16 @@
 #include <memory>
 #include <vector>
 #include <unordered_map>
+#include <utility>
 
 namespace Engine {
 
 class SimpleChunkTerrainGround : public Ground {
 private:
     SimpleChunkTerrainGenerator terrainGenerator;
-    std::unordered_map<std::string, std::unique_ptr<Engine::Mesh>> chunkMeshes;
+    std::unordered_map<std::string, std::shared_ptr<Engine::Mesh>> chunkMeshes;
+    std::unordered_map<std::string, Vec3> chunkCentres;        // Same keys as chunkMeshes, for draw ordering
+    mutable std::vector<std::pair<float, const std::shared_ptr<Mesh>*>> chunkDrawOrder;  // Reused each render/capture: squared distance, mesh
     bool isInitialized;
     
     // Terrain parameters
@@ -33,6 +36,7 @@ public:
     bool initialize() override;
     void update(float deltaTime) override;
     void render(const Renderer& renderer, const Camera& camera) override;
+    void captureDraws(std::vector<MeshDrawState>& draws) const override;
     
     // Terrain generation and management
     void updateChunksForPlayer(const Vec3& playerPos);
@@ -49,13 +53,14 @@ public:
     void clearAllChunks();
     
     // Get chunk information
-    const std::unordered_map<std::string, std::unique_ptr<Mesh>>& getChunkMeshes() const { return chunkMeshes; }
+    const std::unordered_map<std::string, std::shared_ptr<Mesh>>& getChunkMeshes() const { return chunkMeshes; }
     int getLoadedChunkCount() const { return static_cast<int>(chunkMeshes.size()); }
     
 private:
     std::string getChunkKey(int chunkX, int chunkZ) const;
     void createChunkMesh(const TerrainChunkData& chunkData, int chunkX, int chunkZ);
     bool isChunkInRange(int chunkX, int chunkZ, const Vec3& playerPos) const;
+    void sortChunksFrontToBack(const Vec3& viewPosition) const; // Fills chunkDrawOrder
 };
 
 } // namespace Engine
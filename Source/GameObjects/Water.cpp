@@ -5,17 +5,64 @@
 #include "Water.h"
 #include "../Engine/Rendering/Mesh.h"
 #include "../Engine/Rendering/WaterRenderer.h"
+#include "../Engine/Core/RenderSnapshot.h"
+#include <cmath>
 #include <iostream>
 
 namespace Engine {
 
+namespace {
+
+// Surface grid: GRID_SEGMENTS is chosen so 2 pi / segments roughly matches the
+// solved growth, which keeps the grid cells close to square at every radius
+const int GRID_RINGS = 96;
+const int GRID_SEGMENTS = 128;
+const float GRID_INNER_SPACING = 0.25f;    // Metres between the innermost rings
+const float GRID_RADIUS = 1000.0f;          // Outermost ring
+
+GerstnerWave makeWave(float directionX, float directionZ, float amplitude, float wavelength, float steepness) {
+    GerstnerWave wave;
+    wave.direction = Vec2(directionX, directionZ);
+    wave.amplitude = amplitude;
+    wave.wavelength = wavelength;
+    wave.steepness = steepness;
+    return wave;
+}
+
+// Growth g such that rings at innerSpacing / g * (e^(g i) - 1) reach radius at i = rings
+float solveGridGrowth(float innerSpacing, int rings, float radius) {
+    float low = 1e-6f;
+    float high = 1.0f;
+    for (int iteration = 0; iteration < 64; iteration++) {
+        float mid = 0.5f * (low + high);
+        float outer = innerSpacing / mid * (std::exp(mid * rings) - 1.0f);
+        if (outer < radius) {
+            low = mid;
+        } else {
+            high = mid;
+        }
+    }
+    return 0.5f * (low + high);
+}
+
+} // namespace
+
 Water::Water(const std::string& name, float height)
     : GameObject(name), waterHeight(height), waveSpeed(0.03f), 
       distortionScale(0.01f), shineDamper(20.0f), reflectivity(0.6f),
-      waterRenderer(nullptr) {
+      gridGrowth(0.0f), waterRenderer(nullptr) {
     
     // Set water color (blue tint)
     setColor(Vec3(0.0f, 0.3f, 0.5f));
+    
+    // Default swell: one long wave close to the former 31 m sine, shorter chop across it
+    waves = {
+        makeWave( 1.0f,  0.2f, 0.45f, 31.0f, 0.5f),
+        makeWave( 0.7f,  0.9f, 0.30f, 17.0f, 0.6f),
+        makeWave(-0.4f,  1.0f, 0.18f,  9.0f, 0.6f),
+        makeWave( 0.9f, -0.5f, 0.10f,  5.5f, 0.5f),
+        makeWave(-0.8f, -0.3f, 0.05f,  2.7f, 0.4f)
+    };
 }
 
 Water::~Water() {
@@ -37,6 +84,8 @@ bool Water::initialize() {
         waterRenderer->setDistortionScale(distortionScale);
         waterRenderer->setShineDamper(shineDamper);
         waterRenderer->setReflectivity(reflectivity);
+        waterRenderer->setWaves(waves);
+        waterRenderer->setSurfaceGrid(GRID_INNER_SPACING, gridGrowth);
     } else {
     }
     
@@ -49,16 +98,43 @@ void Water::update(float deltaTime) {
     
     // Update base GameObject
     GameObject::update(deltaTime);
-    
-    // Update water-specific parameters if needed
+}
+
+void Water::setWaveSpeed(float speed) {
+    waveSpeed = speed;
     if (waterRenderer) {
         waterRenderer->setWaveSpeed(waveSpeed);
+    }
+}
+
+void Water::setDistortionScale(float scale) {
+    distortionScale = scale;
+    if (waterRenderer) {
         waterRenderer->setDistortionScale(distortionScale);
+    }
+}
+
+void Water::setShineDamper(float damper) {
+    shineDamper = damper;
+    if (waterRenderer) {
         waterRenderer->setShineDamper(shineDamper);
+    }
+}
+
+void Water::setReflectivity(float reflect) {
+    reflectivity = reflect;
+    if (waterRenderer) {
         waterRenderer->setReflectivity(reflectivity);
     }
 }
 
+void Water::setWaves(const std::vector<GerstnerWave>& newWaves) {
+    waves = newWaves;
+    if (waterRenderer) {
+        waterRenderer->setWaves(waves);
+    }
+}
+
 void Water::render(const Renderer& renderer, const Camera& camera) {
     if (!isActive || !isInitialized || !mesh) return;
 
@@ -72,83 +148,74 @@ void Water::render(const Renderer& renderer, const Camera& camera) {
     }
 }
 
+void Water::captureDraws(std::vector<MeshDrawState>& draws) const {
+    if (!isActive || !isInitialized || !mesh) return;
+    if (!waterRenderer) {
+        GameObject::captureDraws(draws);
+        return;
+    }
+    
+    MeshDrawState draw;
+    draw.mesh = mesh;
+    draw.modelMatrix = getWaterModelMatrix();
+    draw.color = getColor();
+    draw.renderer = waterRenderer;
+    draw.entityId = getId();
+    draw.style = DrawStyle::Water;
+    draw.waterHeight = waterHeight;
+    draws.push_back(draw);
+}
+
 void Water::setupMesh() {
-    // Create a massive plane for water surface (covers the entire world)
-    const int width = 1000;  // 1000x1000 world units - massive
-    const int length = 1000;
-    const int resolution = 64;  // 64x64 vertices for smooth water
-    
-    std::vector<Vec3> vertices;
-    std::vector<Vec3> normals;
-    std::vector<Vec2> texCoords;
-    std::vector<unsigned int> indices;
+    // Polar grid around the origin; the renderer places it under the camera.
+    // Ring spacing grows with the radius, so distant water gets as many
+    // vertices as it has pixels rather than as many as it has metres.
+    gridGrowth = solveGridGrowth(GRID_INNER_SPACING, GRID_RINGS, GRID_RADIUS);
+    const float ringScale = GRID_INNER_SPACING / gridGrowth;
+    const float segmentAngle = 2.0f * 3.14159265f / static_cast<float>(GRID_SEGMENTS);
     
-    // Generate vertices
-    for (int z = 0; z <= resolution; z++) {
-        for (int x = 0; x <= resolution; x++) {
-            // Position (centered around origin, Y is always 0 for the mesh)
-            float xPos = (float(x) / resolution - 0.5f) * width;
-            float zPos = (float(z) / resolution - 0.5f) * length;
-            float yPos = 0.0f; // Mesh is created at Y=0, waterHeight is applied in shader
-            
-            vertices.push_back(Vec3(xPos, yPos, zPos));
-            
-            // Normal (pointing up for water surface)
-            normals.push_back(Vec3(0.0f, 1.0f, 0.0f));
-            
-            // Texture coordinates
-            float u = float(x) / resolution;
-            float v = float(z) / resolution;
-            texCoords.push_back(Vec2(u, v));
+    std::vector<float> vertexData;
+    std::vector<unsigned int> indices;
+    vertexData.reserve((1 + GRID_RINGS * GRID_SEGMENTS) * 3);
+    indices.reserve(GRID_SEGMENTS * 3 + (GRID_RINGS - 1) * GRID_SEGMENTS * 6);
+    
+    // Centre vertex, then GRID_SEGMENTS vertices per ring (Y is always 0, waterHeight is applied in shader)
+    vertexData.insert(vertexData.end(), { 0.0f, 0.0f, 0.0f });
+    for (int ring = 1; ring <= GRID_RINGS; ring++) {
+        float radius = ringScale * (std::exp(gridGrowth * static_cast<float>(ring)) - 1.0f);
+        for (int segment = 0; segment < GRID_SEGMENTS; segment++) {
+            float angle = segmentAngle * static_cast<float>(segment);
+            vertexData.insert(vertexData.end(), { std::cos(angle) * radius, 0.0f, std::sin(angle) * radius });
         }
     }
     
-    // Generate indices
-    for (int z = 0; z < resolution; z++) {
-        for (int x = 0; x < resolution; x++) {
-            int topLeft = z * (resolution + 1) + x;
-            int topRight = topLeft + 1;
-            int bottomLeft = (z + 1) * (resolution + 1) + x;
-            int bottomRight = bottomLeft + 1;
-            
-            // First triangle
-            indices.push_back(topLeft);
-            indices.push_back(bottomLeft);
-            indices.push_back(topRight);
-            
-            // Second triangle
-            indices.push_back(topRight);
-            indices.push_back(bottomLeft);
-            indices.push_back(bottomRight);
-        }
-    }
+    auto vertexIndex = [](int ring, int segment) {
+        return static_cast<unsigned int>(1 + (ring - 1) * GRID_SEGMENTS + segment % GRID_SEGMENTS);
+    };
     
-    // Create mesh with normals and texture coordinates
-    mesh = std::make_unique<Mesh>();
+    // Fan from the centre to the first ring
+    for (int segment = 0; segment < GRID_SEGMENTS; segment++) {
+        indices.insert(indices.end(), { 0u, vertexIndex(1, segment + 1), vertexIndex(1, segment) });
+    }
     
-    // Convert data to the format expected by Mesh class
-    std::vector<float> vertexData;
-    for (size_t i = 0; i < vertices.size(); i++) {
-        // Position (3 floats)
-        vertexData.push_back(vertices[i].x);
-        vertexData.push_back(vertices[i].y);
-        vertexData.push_back(vertices[i].z);
-        
-        // Normal (3 floats)
-        vertexData.push_back(normals[i].x);
-        vertexData.push_back(normals[i].y);
-        vertexData.push_back(normals[i].z);
-        
-        // Texture coordinates (2 floats)
-        vertexData.push_back(texCoords[i].x);
-        vertexData.push_back(texCoords[i].y);
+    // Quads between consecutive rings
+    for (int ring = 1; ring < GRID_RINGS; ring++) {
+        for (int segment = 0; segment < GRID_SEGMENTS; segment++) {
+            unsigned int inner = vertexIndex(ring, segment);
+            unsigned int innerNext = vertexIndex(ring, segment + 1);
+            unsigned int outer = vertexIndex(ring + 1, segment);
+            unsigned int outerNext = vertexIndex(ring + 1, segment + 1);
+            indices.insert(indices.end(), { inner, innerNext, outer });
+            indices.insert(indices.end(), { innerNext, outerNext, outer });
+        }
     }
     
-    if (!mesh->createMeshWithNormalsAndTexCoords(vertexData, indices)) {
+    mesh = std::make_shared<Mesh>();
+    if (!mesh->createMesh(vertexData, indices)) {
         return;
     }
     
-    // std::cout << "Water mesh created with " << indices.size() / 3 << " triangles" << std::endl;
+    // std::cout << "Water grid created with " << indices.size() / 3 << " triangles" << std::endl;
 }
 
 Mat4 Water::getWaterModelMatrix() const {
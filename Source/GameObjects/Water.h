@@ -3,12 +3,19 @@
  * 
  * Represents a water surface with reflection, refraction, and wave animation.
  * Uses the WaterRenderer for specialized water rendering effects.
+ * 
+ * The mesh is a polar grid around the camera (rings at geometrically growing
+ * radii out to 1 km) rather than a fixed patch: the renderer moves it with
+ * the camera and water_vertex.glsl displaces it with the Gerstner wave set,
+ * so the water reaches the horizon at a constant vertex count with the
+ * detail near the viewer.
  */
 
 #pragma once
 #include "../Engine/Core/GameObject.h"
 #include "../Engine/Rendering/WaterRenderer.h"
 #include <memory>
+#include <vector>
 
 namespace Engine {
 
@@ -20,6 +27,10 @@ private:
     float shineDamper;
     float reflectivity;
     
+    // Surface waves (evaluated on the GPU) and the grid they displace
+    std::vector<GerstnerWave> waves;
+    float gridGrowth;          // Ring spacing growth per metre of radius, solved by setupMesh
+    
     // Water-specific renderer
     WaterRenderer* waterRenderer;
 
@@ -31,23 +42,28 @@ public:
     bool initialize() override;
     void update(float deltaTime) override;
     void render(const Renderer& renderer, const Camera& camera) override;
+    void captureDraws(std::vector<MeshDrawState>& draws) const override;
     
-    // Water-specific methods
+    // Water-specific methods (the surface parameters are forwarded to the water
+    // renderer when set, so it is not written while a frame is being drawn)
     void setWaterHeight(float height) { waterHeight = height; }
     float getWaterHeight() const { return waterHeight; }
     
-    void setWaveSpeed(float speed) { waveSpeed = speed; }
+    void setWaveSpeed(float speed);
     float getWaveSpeed() const { return waveSpeed; }
     
-    void setDistortionScale(float scale) { distortionScale = scale; }
+    void setDistortionScale(float scale);
     float getDistortionScale() const { return distortionScale; }
     
-    void setShineDamper(float damper) { shineDamper = damper; }
+    void setShineDamper(float damper);
     float getShineDamper() const { return shineDamper; }
     
-    void setReflectivity(float reflect) { reflectivity = reflect; }
+    void setReflectivity(float reflect);
     float getReflectivity() const { return reflectivity; }
     
+    void setWaves(const std::vector<GerstnerWave>& newWaves);
+    const std::vector<GerstnerWave>& getWaves() const { return waves; }
+    
     // Renderer selection
     RendererType getPreferredRendererType() const override { return RendererType::Water; }
     
@@ -13,6 +13,8 @@
 #include "../Engine/Rendering/WeaponRenderer.h"
 #include "../Engine/Rendering/Mesh.h"
 #include "../Engine/Rendering/Shader.h"
+#include "../Engine/Rendering/RendererFactory.h"
+#include "../Engine/Core/RenderSnapshot.h"
 #include "../Engine/Math/Math.h"
 #include <algorithm>
 #include <GL/glew.h>
@@ -124,7 +126,7 @@ bool Weapon::loadWeaponModel(const std::string& modelPath) {
     
     
     // Create mesh from OBJ data
-    mesh = std::make_unique<Mesh>();
+    mesh = std::make_shared<Mesh>();
     
     // Convert OBJ data to interleaved format for texture coordinates
     // OBJ data has interleaved format: [pos.x, pos.y, pos.z, normal.x, normal.y, normal.z, tex.u, tex.v]
@@ -250,24 +252,13 @@ void Weapon::render(const Renderer& renderer, const Camera& camera) {
         // Multi-material rendering: Render each material group with its own color
         // This successfully renders the weapon with true multi-material colors (black, brown, gray)
         // as defined in the MTL file, giving realistic weapon appearance
-        if (!materialGroups.empty()) {
-            for (const auto& materialGroup : materialGroups) {
+        if (!getMaterialGroups().empty()) {
+            for (const auto& materialGroup : getMaterialGroups()) {
                 weaponRenderer->renderWeaponTriangles(*mesh, weaponMatrix, camera, materialGroup.color, materialGroup.indices, true);
             }
         } else {
             // Fallback to blended material color if no material groups
-            Vec3 renderColor = weaponColor; // Default fallback color
-            if (weaponMaterials.getMaterialCount() > 0) {
-                // Use the first material's color
-                auto materialNames = weaponMaterials.getMaterialNames();
-                if (!materialNames.empty()) {
-                    const Material* firstMaterial = weaponMaterials.getMaterial(materialNames[0]);
-                    if (firstMaterial) {
-                        renderColor = firstMaterial->diffuse;
-                    }
-                }
-            }
-            weaponRenderer->renderWeaponMesh(*mesh, weaponMatrix, camera, renderColor, true);
+            weaponRenderer->renderWeaponMesh(*mesh, weaponMatrix, camera, getFallbackColor(), true);
         }
     } else {
         // Fallback to basic rendering (backward compatibility)
@@ -275,6 +266,60 @@ void Weapon::render(const Renderer& renderer, const Camera& camera) {
     }
 }
 
+void Weapon::captureDraws(std::vector<MeshDrawState>& draws) const {
+    if (!isVisible || !mesh || !mesh->isValid()) {
+        return;
+    }
+    
+    const Renderer* weaponRenderer = RendererFactory::getInstance().getRenderer(RendererType::Weapon);
+    if (!weaponRenderer) {
+        // Same fallback as render(): the object's own renderer and transform
+        size_t first = draws.size();
+        GameObject::captureDraws(draws);
+        for (size_t i = first; i < draws.size(); i++) {
+            draws[i].placement = DrawPlacement::Fixed;
+        }
+        return;
+    }
+    
+    MeshDrawState draw;
+    draw.mesh = mesh;
+    draw.modelMatrix = createWeaponTransformMatrix();
+    draw.renderer = weaponRenderer;
+    draw.entityId = getId();
+    
+    if (materialGroups && !materialGroups->empty()) {
+        for (const MaterialGroup& group : *materialGroups) {
+            draw.triangles = std::shared_ptr<const std::vector<unsigned int>>(materialGroups, &group.indices);
+            draw.color = group.color;
+            draws.push_back(draw);
+        }
+    } else {
+        draw.color = getFallbackColor();
+        draws.push_back(draw);
+    }
+}
+
+const std::vector<Weapon::MaterialGroup>& Weapon::getMaterialGroups() const {
+    static const std::vector<MaterialGroup> noGroups;
+    return materialGroups ? *materialGroups : noGroups;
+}
+
+Vec3 Weapon::getFallbackColor() const {
+    // Blended material color if no material groups: the first material's color
+    Vec3 renderColor = weaponColor; // Default fallback color
+    if (weaponMaterials.getMaterialCount() > 0) {
+        auto materialNames = weaponMaterials.getMaterialNames();
+        if (!materialNames.empty()) {
+            const Material* firstMaterial = weaponMaterials.getMaterial(materialNames[0]);
+            if (firstMaterial) {
+                renderColor = firstMaterial->diffuse;
+            }
+        }
+    }
+    return renderColor;
+}
+
 void Weapon::setupMesh() {
     // Create a simple placeholder weapon mesh (cube) if no model is loaded
     std::vector<float> vertices = {
@@ -305,7 +350,7 @@ void Weapon::setupMesh() {
         4, 5, 1, 1, 0, 4
     };
     
-    mesh = std::make_unique<Mesh>();
+    mesh = std::make_shared<Mesh>();
     if (!mesh->createMesh(vertices, indices)) {
     }
     
@@ -425,8 +470,8 @@ void Weapon::createMaterialGroups(const OBJMeshData& objData) {
     // Implementation for creating material groups from OBJ data
     // Parse the OBJ data and create material groups based on material assignments
     
-    // Clear existing material groups
-    materialGroups.clear();
+    // Built into a new list; snapshots may still hold the old one
+    auto groups = std::make_shared<std::vector<MaterialGroup>>();
     
     // Create material groups based on loaded materials
     if (weaponMaterials.getMaterialCount() > 0 && !objData.faceMaterials.empty()) {
@@ -466,7 +511,7 @@ void Weapon::createMaterialGroups(const OBJMeshData& objData) {
                 group.color = mat->diffuse;
                 group.indices = materialIndexMap[materialName];
                 
-                materialGroups.push_back(group);
+                groups->push_back(group);
                 // std::cout << "Created material group '" << materialName << "' with color ("
                 //           << mat->diffuse.x << ", " << mat->diffuse.y << ", " << mat->diffuse.z 
                 //           << ") and " << group.indices.size() / 3 << " triangles" << std::endl;
@@ -483,9 +528,10 @@ void Weapon::createMaterialGroups(const OBJMeshData& objData) {
             defaultGroup.indices.push_back(objData.indices[i]);
         }
         
-        materialGroups.push_back(defaultGroup);
+        groups->push_back(defaultGroup);
     }
     
+    materialGroups = groups;
 }
 
 // Weapon switching implementation
@@ -776,9 +822,9 @@ void Weapon::stopFiring() {
     }
 }
 
-void Weapon::fireSingleShot() {
+void Weapon::fireSingleShot(float leadTime) {
     if (shootingEnabled) {
-        shootingComponent.fireSingleShot();
+        shootingComponent.fireSingleShot(leadTime);
     }
 }
 
@@ -824,6 +870,12 @@ void Weapon::configureShooting(const WeaponStats& stats) {
     }
 }
 
+void Weapon::setRandomKey(uint64_t worldSeed) {
+    if (shootingEnabled) {
+        shootingComponent.getShootingSystem()->setRandomKey(worldSeed, getId());
+    }
+}
+
 const WeaponStats& Weapon::getShootingStats() const {
     static WeaponStats defaultStats;
     return shootingEnabled ? shootingComponent.getShootingSystem()->getWeaponStats() : defaultStats;
@@ -85,13 +85,14 @@ private:
     // Material system
     MaterialLibrary weaponMaterials; // Materials loaded from .mtl file
     
-    // Material groups for multi-material rendering
+    // Material groups for multi-material rendering; replaced on model load, never
+    // modified, so render snapshots can share them
     struct MaterialGroup {
         std::string materialName;
         std::vector<unsigned int> indices; // Triangle indices for this material
         Vec3 color; // Material color
     };
-    std::vector<MaterialGroup> materialGroups;
+    std::shared_ptr<const std::vector<MaterialGroup>> materialGroups;
     
     // Weapon switching system
     struct WeaponData {
@@ -169,7 +170,7 @@ public:
     
     // Material access
     const MaterialLibrary& getWeaponMaterials() const { return weaponMaterials; }
-    const std::vector<MaterialGroup>& getMaterialGroups() const { return materialGroups; }
+    const std::vector<MaterialGroup>& getMaterialGroups() const;
     
     // Shooting system integration
     void enableShooting(bool enabled) { shootingEnabled = enabled; }
@@ -180,7 +181,7 @@ public:
     // Shooting interface
     void startFiring();
     void stopFiring();
-    void fireSingleShot();
+    void fireSingleShot(float leadTime = 0.0f); // Seconds since the trigger was pulled (sub-tick input timing)
     void fireMonsterHunterShot();
     bool canFire() const;
     bool hasAmmo() const;
@@ -194,6 +195,7 @@ public:
     void configureShooting(const WeaponStats& stats);
     const WeaponStats& getShootingStats() const;
     void setProjectileManager(ProjectileManager* manager);
+    void setRandomKey(uint64_t worldSeed); // Keys spread and recoil draws by world seed and this weapon's id
     
     // Recoil methods
     void applyRecoil(const Vec3& recoil);
@@ -208,6 +210,7 @@ public:
     virtual bool initialize() override;
     virtual void update(float deltaTime) override;
     virtual void render(const Renderer& renderer, const Camera& camera) override;
+    virtual void captureDraws(std::vector<MeshDrawState>& draws) const override; // View-space draws
     virtual void cleanup() override;
 
 private:
@@ -218,6 +221,7 @@ private:
     Vec3 calculateAimDirection() const;
     Mat4 createWeaponTransformMatrix() const;
     void createMaterialGroups(const OBJMeshData& objData);
+    Vec3 getFallbackColor() const; // Whole-mesh colour when there are no material groups
     
     // Shooting system helpers
     void initializeShootingSystem();
@@ -9,12 +9,46 @@
  * - Minimal main function
  * - All logic encapsulated in Game class
  * - Proper error handling and cleanup
+ * 
+ * COMMAND LINE:
+ * - (no arguments)  Run the game
+ * - --benchmark     Run the built-in benchmark scenarios and exit
+ *                   (see BenchmarkRunner.h for the remaining options)
+ * - --single-threaded  Run simulation and rendering on one thread
+ * - --tick-rate N   Simulation ticks per second in threaded mode (default 60)
+ * - --vsync MODE    Present mode: vsync (default), adaptive, uncapped
+ * - --fps-cap N     Frame limiter (0 = off)
+ * - --dt-smoothing N  Average the frame delta over N frames (1 = off, default 4)
+ * - --frame-stats   Print the frame-time histogram on exit
+ * - --dynamic-res on|off  GPU-time driven scene resolution (default on)
+ * - --gpu-budget MS  Scene GPU time the dynamic resolution aims for (default 12)
+ * - --min-scale S   Lowest dynamic resolution scale, 0.25-1.0 (default 0.5)
+ * - --connect HOST[:PORT]  Play on a dedicated server (default port 27015)
+ * - --server        Run a headless dedicated server instead of the game
+ *                   (see GameServer.h: --port, --tick-rate, --snapshot-rate,
+ *                   --max-clients, --max-monsters, --max-rewind, --bots,
+ *                   --server-duration)
  */
 
 #include "Engine/Core/Game.h"
+#include "Engine/Core/BenchmarkRunner.h"
+#include "Engine/Network/GameServer.h"
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <string>
 
-int main() {
+int main(int argc, char** argv) {
+    // Dedicated server: no window, no GL context
+    Engine::ServerOptions serverOptions;
+    if (Engine::ServerOptions::parseCommandLine(argc, argv, serverOptions)) {
+        Engine::GameServer server(serverOptions);
+        if (!server.initialize()) {
+            return -1;
+        }
+        return server.run();
+    }
+    
     // Create game engine instance
     Engine::Game game(1200, 800, "Counter-Strike Style FPS Engine");
     
@@ -23,9 +57,63 @@ int main() {
         return -1;
     }
     
+    // Benchmark mode: run scripted scenarios, exit code reports regressions
+    Engine::BenchmarkOptions benchmarkOptions;
+    if (Engine::BenchmarkOptions::parseCommandLine(argc, argv, benchmarkOptions)) {
+        Engine::BenchmarkRunner runner(game, benchmarkOptions);
+        runner.registerDefaultScenarios();
+        return runner.run();
+    }
+    
+    // Simulation runs on its own thread unless asked otherwise
+    game.setThreadedMode(true);
+    bool printFrameStats = false;
+    std::string serverAddress;
+    Engine::FramePacer* framePacer = game.getFramePacer();
+    Engine::DynamicResolution* dynamicResolution = game.getDynamicResolution();
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--single-threaded") == 0) {
+            game.setThreadedMode(false);
+        } else if (std::strcmp(argv[i], "--tick-rate") == 0 && i + 1 < argc) {
+            game.setSimulationTickRate(static_cast<float>(std::atof(argv[++i])));
+        } else if (std::strcmp(argv[i], "--vsync") == 0 && i + 1 < argc) {
+            Engine::FramePacer::PresentMode mode;
+            if (Engine::FramePacer::parsePresentMode(argv[++i], mode)) {
+                framePacer->setPresentMode(mode);
+            } else {
+                std::cerr << "Unknown --vsync mode '" << argv[i] << "' (vsync, adaptive, uncapped)" << std::endl;
+            }
+        } else if (std::strcmp(argv[i], "--fps-cap") == 0 && i + 1 < argc) {
+            framePacer->setFrameRateLimit(static_cast<float>(std::atof(argv[++i])));
+        } else if (std::strcmp(argv[i], "--dt-smoothing") == 0 && i + 1 < argc) {
+            framePacer->setSmoothingWindow(std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--frame-stats") == 0) {
+            printFrameStats = true;
+        } else if (std::strcmp(argv[i], "--dynamic-res") == 0 && i + 1 < argc) {
+            bool enable = std::strcmp(argv[++i], "off") != 0;
+            if (dynamicResolution) dynamicResolution->setEnabled(enable);
+        } else if (std::strcmp(argv[i], "--gpu-budget") == 0 && i + 1 < argc) {
+            float budgetMs = static_cast<float>(std::atof(argv[++i]));
+            if (dynamicResolution) dynamicResolution->setGpuBudgetMs(budgetMs);
+        } else if (std::strcmp(argv[i], "--min-scale") == 0 && i + 1 < argc) {
+            float minScale = static_cast<float>(std::atof(argv[++i]));
+            if (dynamicResolution) dynamicResolution->setScaleRange(minScale, 1.0f);
+        } else if (std::strcmp(argv[i], "--connect") == 0 && i + 1 < argc) {
+            serverAddress = argv[++i];
+        }
+    }
+    
+    if (!serverAddress.empty() && !game.connectToServer(serverAddress)) {
+        return -1;
+    }
+    
     // Run main game loop
     game.run();
     
+    if (printFrameStats) {
+        std::cout << framePacer->getSummary();
+    }
+    
     // Cleanup is handled automatically by Game destructor
     return 0;
 }
\ No newline at end of file